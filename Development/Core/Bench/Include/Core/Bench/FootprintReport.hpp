@@ -0,0 +1,195 @@
+#pragma once
+
+#include <Core/Data/Decode.hpp>
+#include <Core/Data/Encode.hpp>
+#include <Core/Data/PacketReport.hpp>
+#include <Core/Span.hpp>
+#include <Core/StdTypes.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+
+namespace shmit
+{
+namespace bench
+{
+
+/**!
+ * @brief Limits that a row of a FootprintReport is checked against. The footprint is best checked at compile time
+ * as well, through data::is_within_budget, while latency can only be checked once it has been measured.
+ */
+struct ReportBudget
+{
+    /// @brief No latency limit
+    constexpr static double kUnboundedNs {std::numeric_limits<double>::infinity()};
+
+    /// @brief Size limits
+    data::PacketBudget footprint {};
+
+    /// @brief Slowest encode allowed, in nanoseconds per Packet
+    double max_encode_ns {kUnboundedNs};
+
+    /// @brief Slowest decode allowed, in nanoseconds per Packet
+    double max_decode_ns {kUnboundedNs};
+};
+
+/**!
+ * @brief Prints one row per registered Packet or MessageSet: its compile-time data::PacketReport along with encode and
+ * decode times measured on the build machine, and whether it is within its budget.
+ *
+ * Times are the best average over kRepetitions loops of kIterations calls, so that they track what the code costs
+ * rather than how busy the machine is.
+ */
+class FootprintReport
+{
+public:
+    /// @brief Calls timed per loop
+    constexpr static size_t kIterations {20000U};
+
+    /// @brief Loops timed per measurement, the fastest is kept
+    constexpr static size_t kRepetitions {5U};
+
+    /**!
+     * @brief Initializing constructor, prints the report header
+     *
+     * @param[in] out Stream to print the report to
+     */
+    explicit FootprintReport(std::FILE* out) noexcept : m_out {out}
+    {
+        static_cast<void>(std::fprintf(m_out, "%-24s %6s %6s %8s %6s %7s %5s %6s %10s %10s  %s\n", "Type", "Fields",
+                                       "Wire B", "Wire pad", "Mem B", "Mem pad", "Runs", "Groups", "Encode ns",
+                                       "Decode ns", "Budget"));
+    }
+
+    /**!
+     * @brief Measures a Packet and prints its row
+     *
+     * @tparam PacketT Packet specialization
+     * @param[in] name Name to print the row under
+     * @param[in] budget Limits to check the row against
+     * @param[in] sample Value that is encoded and decoded while measuring
+     */
+    template<typename PacketT>
+    void Add(char const* name, ReportBudget const& budget = {}, PacketT const& sample = PacketT {}) noexcept;
+
+    /**!
+     * @brief Prints the row of a MessageSet, whose every message type is best added as its own row as well
+     *
+     * @tparam MessageSetT io::session::MessageSet specialization
+     * @param[in] name Name to print the row under
+     * @param[in] max_message_bytes Largest tagged message allowed, in bytes
+     */
+    template<typename MessageSetT>
+    void AddMessageSet(char const* name, size_t max_message_bytes = data::PacketBudget::kUnbounded) noexcept;
+
+    /// @brief Number of rows that exceeded their budget
+    size_t GetOverBudgetCount() const noexcept
+    {
+        return m_over_budget_count;
+    }
+
+private:
+    /**!
+     * @brief Best average time of a call, in nanoseconds
+     *
+     * @tparam FunctionT Callable taking no arguments
+     * @param[in] function Call to time
+     * @return Nanoseconds per call
+     */
+    template<typename FunctionT>
+    static double MeasureNs(FunctionT function) noexcept;
+
+    std::FILE* m_out;
+    size_t     m_over_budget_count {0U};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FootprintReport method definitions in alphabetical order            ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename PacketT>
+void FootprintReport::Add(char const* name, ReportBudget const& budget, PacketT const& sample) noexcept
+{
+    constexpr static data::PacketReport kReport {data::packet_report_v<PacketT>};
+
+    uint8_t       buffer[PacketT::kSizeBytes];
+    Span<uint8_t> buffer_span {buffer, PacketT::kSizeBytes};
+    static_cast<void>(std::memset(buffer, 0U, PacketT::kSizeBytes)); // Avoid unused return warning
+
+    // Opaque to the optimizer every call, otherwise encoding a loop-invariant value is hoisted out of the loop
+    PacketT value {sample};
+    double const kEncodeNs {MeasureNs(
+        [&]()
+        {
+            benchmark::DoNotOptimize(value);
+            size_t bits_encoded {0U};
+            benchmark::DoNotOptimize(data::encode(value, buffer_span, bits_encoded));
+            benchmark::ClobberMemory();
+        })};
+
+    Span<uint8_t const> decode_span {span_cast<uint8_t const>(buffer_span)};
+    double const        kDecodeNs {MeasureNs(
+        [&]()
+        {
+            benchmark::DoNotOptimize(buffer);
+            size_t bits_decoded {0U};
+            benchmark::DoNotOptimize(data::decode(decode_span, bits_decoded, value));
+            benchmark::DoNotOptimize(value);
+        })};
+
+    char const* verdict {"ok"};
+    if (!data::is_within_budget(kReport, budget.footprint))
+        verdict = "OVER: size";
+    else if ((kEncodeNs > budget.max_encode_ns) || (kDecodeNs > budget.max_decode_ns))
+        verdict = "OVER: latency";
+
+    if (std::strcmp(verdict, "ok") != 0)
+        m_over_budget_count++;
+
+    static_cast<void>(std::fprintf(m_out, "%-24s %6zu %6zu %8zu %6zu %7zu %5zu %6zu %10.1f %10.1f  %s\n", name,
+                                   kReport.field_count, kReport.wire_bytes, kReport.wire_padding_bits,
+                                   kReport.memory_bytes, kReport.memory_padding_bytes, kReport.run_count,
+                                   kReport.bit_group_count, kEncodeNs, kDecodeNs, verdict));
+}
+
+template<typename MessageSetT>
+void FootprintReport::AddMessageSet(char const* name, size_t max_message_bytes) noexcept
+{
+    bool const kIsWithinBudget {MessageSetT::kMaxMessageSizeBytes <= max_message_bytes};
+    if (!kIsWithinBudget)
+        m_over_budget_count++;
+
+    // Messages are counted in the fields column and the largest tagged message in the wire column
+    static_cast<void>(std::fprintf(m_out, "%-24s %6zu %6zu %8s %6s %7s %5s %6s %10s %10s  %s\n", name,
+                                   MessageSetT::kMessageCount, MessageSetT::kMaxMessageSizeBytes, "-", "-", "-", "-",
+                                   "-", "-", "-", (kIsWithinBudget ? "ok" : "OVER: size")));
+}
+
+//  Private     ========================================================================================================
+
+template<typename FunctionT>
+double FootprintReport::MeasureNs(FunctionT function) noexcept // Static method
+{
+    double best_ns {std::numeric_limits<double>::infinity()};
+    for (size_t repetition = 0U; repetition < kRepetitions; repetition++)
+    {
+        auto const kStart {std::chrono::steady_clock::now()};
+        for (size_t i = 0U; i < kIterations; i++)
+            function();
+
+        std::chrono::duration<double, std::nano> const kElapsed {std::chrono::steady_clock::now() - kStart};
+        best_ns = std::min(best_ns, (kElapsed.count() / static_cast<double>(kIterations)));
+    }
+
+    return best_ns;
+}
+
+} // namespace bench
+} // namespace shmit
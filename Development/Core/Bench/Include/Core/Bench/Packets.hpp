@@ -0,0 +1,71 @@
+#pragma once
+
+#include <Core/Data/Packet.hpp>
+#include <Core/StdTypes.hpp>
+
+namespace shmit
+{
+namespace bench
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Benchmark packets               ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Group of bitfields that starts `OffsetBitsV` bits in to its packet
+template<size_t OffsetBitsV>
+struct bit_group_packet
+{
+    using type = data::packet_t<data::BitField<OffsetBitsV>, data::BitField<13>, data::BitField<19>, data::BitField<9>,
+                                data::Bit>;
+};
+
+template<>
+struct bit_group_packet<0U>
+{
+    using type = data::packet_t<data::BitField<13>, data::BitField<19>, data::BitField<9>, data::Bit>;
+};
+
+/// @brief Bitfield wider than a 32-bit word that straddles byte boundaries, moved as a partial working word
+using WideBitPacket = data::packet_t<data::BitField<3>, data::BitField<40>>;
+
+using HeaderPacket = data::packet_t<uint16_t, uint8_t, data::BitField<4>, data::BitField<4>>;
+using NestedPacket = data::packet_t<HeaderPacket, uint32_t, data::packet_t<float, float, float>>;
+
+using MixedPacket = data::packet_t<HeaderPacket, uint64_t, double, data::BitField<3>, data::BitField<17>, data::Bit,
+                                   data::ConstBitField<3>, int32_t, data::BigEndianField<uint32_t>, NestedPacket,
+                                   data::BitField<40>, int16_t, float>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Benchmark packet factories      ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static HeaderPacket make_header_packet()
+{
+    return {uint16_t {0xBEEF}, uint8_t {0x42}, data::BitField<4> {0xA}, data::BitField<4> {0x5}};
+}
+
+static NestedPacket make_nested_packet()
+{
+    return {make_header_packet(), uint32_t {0xDEADBEEF}, data::packet_t<float, float, float> {1.0F, 2.0F, 3.0F}};
+}
+
+static MixedPacket make_mixed_packet()
+{
+    return {make_header_packet(),
+            uint64_t {0x0123456789ABCDEF},
+            3.14,
+            data::BitField<3> {0x5},
+            data::BitField<17> {0x1ABCD},
+            data::Bit {true},
+            data::ConstBitField<3> {0x0},
+            int32_t {-42},
+            uint32_t {0xCAFEF00D},
+            make_nested_packet(),
+            data::BitField<40> {0xAB12345678},
+            int16_t {-7},
+            2.5F};
+}
+
+} // namespace bench
+} // namespace shmit
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Inbound.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/Outbound.hpp>
+#include <Core/StdTypes.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace shmit
+{
+namespace bench
+{
+
+/**!
+ * @brief Opaque message of a fixed encoded size. Messages large enough to hold one carry their send time in their
+ * first bytes so that receivers can measure latency across threads.
+ *
+ * @tparam SizeBytesV Encoded size of the message
+ */
+template<size_t SizeBytesV>
+struct BenchMessage
+{
+    /// @brief Whether the message is large enough to carry a timestamp
+    constexpr static bool kIsTimestamped {SizeBytesV >= sizeof(int64_t)};
+
+    uint8_t bytes[SizeBytesV];
+};
+
+/**!
+ * @brief Log-linear histogram of latency samples in nanoseconds. Each power of two is split in to eight buckets, so
+ * that percentiles are reported within 12.5% without storing every sample.
+ *
+ */
+class LatencyHistogram
+{
+public:
+    /**!
+     * @brief Records a sample
+     *
+     * @param[in] sample_ns Latency in nanoseconds
+     */
+    void Record(int64_t sample_ns) noexcept
+    {
+        uint64_t const value {(sample_ns > 0) ? static_cast<uint64_t>(sample_ns) : 0U};
+        m_buckets[ToBucket(value)]++;
+        m_count++;
+    }
+
+    /**!
+     * @brief Reports the 50th, 99th and 99.9th percentiles as benchmark counters
+     *
+     * @param[in] state Benchmark state to report to
+     */
+    void Report(benchmark::State& state) const noexcept
+    {
+        if (m_count == 0U)
+            return;
+
+        state.counters["p50_ns"]  = static_cast<double>(Percentile(0.5));
+        state.counters["p99_ns"]  = static_cast<double>(Percentile(0.99));
+        state.counters["p999_ns"] = static_cast<double>(Percentile(0.999));
+    }
+
+private:
+    constexpr static size_t kSubBucketBits {3U};
+    constexpr static size_t kSubBucketCount {size_t {1U} << kSubBucketBits};
+    constexpr static size_t kLinearCount {kSubBucketCount * 2U};
+    constexpr static size_t kBucketCount {kLinearCount + ((64U - (kSubBucketBits + 1U)) * kSubBucketCount)};
+
+    static size_t ToBucket(uint64_t value) noexcept
+    {
+        if (value < kLinearCount)
+            return static_cast<size_t>(value);
+
+        size_t const msb {static_cast<size_t>(63 - __builtin_clzll(value))};
+        size_t const sub {static_cast<size_t>((value >> (msb - kSubBucketBits)) & (kSubBucketCount - 1U))};
+        return (kLinearCount + ((msb - (kSubBucketBits + 1U)) * kSubBucketCount) + sub);
+    }
+
+    /// @brief Largest value that falls in a bucket
+    static uint64_t FromBucket(size_t bucket) noexcept
+    {
+        if (bucket < kLinearCount)
+            return bucket;
+
+        size_t const   msb {((bucket - kLinearCount) / kSubBucketCount) + kSubBucketBits + 1U};
+        size_t const   sub {(bucket - kLinearCount) % kSubBucketCount};
+        uint64_t const step {uint64_t {1U} << (msb - kSubBucketBits)};
+        return ((uint64_t {1U} << msb) + (sub * step) + (step - 1U));
+    }
+
+    uint64_t Percentile(double fraction) const noexcept
+    {
+        uint64_t const threshold {static_cast<uint64_t>(static_cast<double>(m_count) * fraction)};
+
+        uint64_t accumulated {0U};
+        for (size_t bucket = 0U; bucket < kBucketCount; bucket++)
+        {
+            accumulated += m_buckets[bucket];
+            if (accumulated > threshold)
+                return FromBucket(bucket);
+        }
+
+        return FromBucket(kBucketCount - 1U);
+    }
+
+    uint64_t m_buckets[kBucketCount] {};
+    uint64_t m_count {0U};
+};
+
+/**!
+ * @brief Pins the calling thread to a core, best effort
+ *
+ * @param[in] core Index of the core, ignored if out of range
+ */
+static void pin_current_thread(size_t core) noexcept
+{
+#ifdef __linux__
+    if (core >= std::thread::hardware_concurrency())
+        return;
+
+    cpu_set_t cpus;
+    CPU_ZERO(&cpus);
+    CPU_SET(core, &cpus);
+    static_cast<void>(pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus));
+#else
+    static_cast<void>(core);
+#endif
+}
+
+/// @brief Monotonic time in nanoseconds, finer than platform::Clock for timing single operations
+static int64_t now_ns() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+/**!
+ * @brief Puts and then gets one message per iteration on the benchmark thread, timing each round trip in to a
+ * latency histogram. Measures the Egress/Ingress path and session overhead without any contention.
+ *
+ * @tparam MessageT Message type
+ * @param[in] state Benchmark state
+ * @param[in] outbound Session that messages are put to
+ * @param[in] inbound Session that messages are got from, must return what was put to `outbound`
+ */
+template<typename MessageT>
+static void bench_round_trip(benchmark::State& state, io::session::Outbound& outbound, io::session::Inbound& inbound)
+{
+    io::session::Egress<MessageT>  egress {outbound};
+    io::session::Ingress<MessageT> ingress {inbound};
+
+    MessageT sent {};
+    MessageT received {};
+    std::memset(sent.bytes, 0x5A, sizeof(sent.bytes));
+
+    LatencyHistogram histogram {};
+    for (auto _ : state)
+    {
+        int64_t const start_ns {now_ns()};
+        bool const    is_success {egress.Put(sent).IsSuccess() && ingress.Get(received).IsSuccess()};
+        histogram.Record(now_ns() - start_ns);
+
+        if (!is_success)
+        {
+            state.SkipWithError("Round trip failed");
+            break;
+        }
+
+        benchmark::DoNotOptimize(received);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(sizeof(MessageT)));
+    histogram.Report(state);
+}
+
+/**!
+ * @brief Streams messages from a producer thread to the benchmark thread, each pinned to their own core. Every
+ * iteration receives a burst of messages. Timestamped messages report the latency from put to get, including any time
+ * spent queued behind earlier messages.
+ *
+ * @note Sessions must be safe to put to and get from concurrently, from one thread each
+ *
+ * @tparam MessageT Message type
+ * @param[in] state Benchmark state
+ * @param[in] outbound Session that messages are put to
+ * @param[in] inbound Session that messages are got from, fed by `outbound`
+ * @param[in] producer_core Core that the producer is pinned to
+ * @param[in] consumer_core Core that the consumer is pinned to
+ */
+template<typename MessageT>
+static void bench_cross_thread(benchmark::State& state, io::session::Outbound& outbound, io::session::Inbound& inbound,
+                               size_t producer_core = 0U, size_t consumer_core = 1U)
+{
+    constexpr static size_t kBurstCount {256U};
+
+    io::session::Egress<MessageT>  egress {outbound};
+    io::session::Ingress<MessageT> ingress {inbound};
+
+    std::atomic<bool> is_stopping {false};
+    std::thread       producer {[&]()
+                          {
+                              pin_current_thread(producer_core);
+
+                              MessageT sent {};
+                              std::memset(sent.bytes, 0x5A, sizeof(sent.bytes));
+                              while (!is_stopping.load(std::memory_order_relaxed))
+                              {
+                                  if constexpr (MessageT::kIsTimestamped)
+                                  {
+                                      int64_t const sent_ns {now_ns()};
+                                      std::memcpy(sent.bytes, &sent_ns, sizeof(sent_ns));
+                                  }
+
+                                  while (egress.Put(sent).IsFailure())
+                                  {
+                                      if (is_stopping.load(std::memory_order_relaxed))
+                                          return;
+                                  }
+                              }
+                          }};
+
+    pin_current_thread(consumer_core);
+
+    MessageT         received {};
+    LatencyHistogram histogram {};
+    for (auto _ : state)
+    {
+        for (size_t i = 0U; i < kBurstCount; i++)
+        {
+            while (ingress.Get(received).IsFailure())
+            {
+            }
+
+            if constexpr (MessageT::kIsTimestamped)
+            {
+                int64_t sent_ns {0};
+                std::memcpy(&sent_ns, received.bytes, sizeof(sent_ns));
+                histogram.Record(now_ns() - sent_ns);
+            }
+        }
+    }
+
+    is_stopping.store(true, std::memory_order_relaxed);
+    producer.join();
+
+    // Leave the session empty for whichever benchmark uses it next
+    while (ingress.Get(received).IsSuccess())
+    {
+    }
+
+    int64_t const num_messages {static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(kBurstCount)};
+    state.SetItemsProcessed(num_messages);
+    state.SetBytesProcessed(num_messages * static_cast<int64_t>(sizeof(MessageT)));
+    histogram.Report(state);
+}
+
+} // namespace bench
+} // namespace shmit
@@ -0,0 +1,237 @@
+#include <Core/Bench/Packets.hpp>
+#include <Core/Data/Decode.hpp>
+#include <Core/Data/Encode.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/Span.hpp>
+
+#include <benchmark/benchmark.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace shmit;
+using namespace shmit::bench;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Benchmark constants             ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Number of packets encoded back to back by the batch benchmarks
+constexpr static size_t kBatchPacketCount {256U};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Benchmark helpers               ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Reports the bytes moved per iteration, from which Google Benchmark derives throughput
+static void set_bytes_processed(benchmark::State& state, size_t bytes_per_iteration)
+{
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(bytes_per_iteration));
+}
+
+template<typename T>
+static void bench_encode(benchmark::State& state, T const& obj)
+{
+    uint8_t       buffer[footprint_size_bytes_v<T>];
+    Span<uint8_t> buffer_span {buffer, footprint_size_bytes_v<T>};
+    std::memset(buffer, 0U, footprint_size_bytes_v<T>);
+
+    // Opaque to the optimizer every iteration, otherwise encoding a loop-invariant object is hoisted out of the loop
+    T value {obj};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(value);
+
+        size_t bits_encoded {0U};
+        benchmark::DoNotOptimize(encode(value, buffer_span, bits_encoded));
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed(state, footprint_size_bytes_v<T>);
+}
+
+template<typename T>
+static void bench_decode(benchmark::State& state, T const& obj)
+{
+    uint8_t       buffer[footprint_size_bytes_v<T>];
+    Span<uint8_t> buffer_span {buffer, footprint_size_bytes_v<T>};
+    size_t        bits_encoded {0U};
+    if (encode(obj, buffer_span, bits_encoded).IsFailure())
+    {
+        state.SkipWithError("Encoding failed");
+        return;
+    }
+
+    Span<uint8_t const> decode_span {span_cast<uint8_t const>(buffer_span)};
+    T                   decoded {obj};
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(buffer);
+
+        size_t bits_decoded {0U};
+        benchmark::DoNotOptimize(decode(decode_span, bits_decoded, decoded));
+        benchmark::DoNotOptimize(decoded);
+    }
+
+    set_bytes_processed(state, footprint_size_bytes_v<T>);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Field benchmarks                ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename T>
+static void BM_Field_encode(benchmark::State& state)
+{
+    bench_encode(state, Field<T> {static_cast<T>(0x5A)});
+}
+BENCHMARK_TEMPLATE(BM_Field_encode, uint8_t);
+BENCHMARK_TEMPLATE(BM_Field_encode, uint32_t);
+BENCHMARK_TEMPLATE(BM_Field_encode, uint64_t);
+BENCHMARK_TEMPLATE(BM_Field_encode, double);
+
+template<typename T>
+static void BM_Field_decode(benchmark::State& state)
+{
+    bench_decode(state, Field<T> {static_cast<T>(0x5A)});
+}
+BENCHMARK_TEMPLATE(BM_Field_decode, uint8_t);
+BENCHMARK_TEMPLATE(BM_Field_decode, uint32_t);
+BENCHMARK_TEMPLATE(BM_Field_decode, uint64_t);
+BENCHMARK_TEMPLATE(BM_Field_decode, double);
+
+template<typename T>
+static void BM_BigEndianField_encode(benchmark::State& state)
+{
+    bench_encode(state, BigEndianField<T> {static_cast<T>(0x5A)});
+}
+BENCHMARK_TEMPLATE(BM_BigEndianField_encode, uint32_t);
+BENCHMARK_TEMPLATE(BM_BigEndianField_encode, uint64_t);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  BitField group benchmarks       ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<size_t OffsetBitsV>
+static typename bit_group_packet<OffsetBitsV>::type make_bit_group_packet()
+{
+    if constexpr (OffsetBitsV == 0U)
+        return {BitField<13> {0x1ABC}, BitField<19> {0x5A5A5}, BitField<9> {0x155}, Bit {true}};
+    else
+        return {BitField<OffsetBitsV> {0U}, BitField<13> {0x1ABC}, BitField<19> {0x5A5A5}, BitField<9> {0x155},
+                Bit {true}};
+}
+
+template<size_t OffsetBitsV>
+static void BM_BitGroup_encode(benchmark::State& state)
+{
+    bench_encode(state, make_bit_group_packet<OffsetBitsV>());
+}
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 0U);
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 1U);
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 2U);
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 3U);
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 4U);
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 5U);
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 6U);
+BENCHMARK_TEMPLATE(BM_BitGroup_encode, 7U);
+
+template<size_t OffsetBitsV>
+static void BM_BitGroup_decode(benchmark::State& state)
+{
+    bench_decode(state, make_bit_group_packet<OffsetBitsV>());
+}
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 0U);
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 1U);
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 2U);
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 3U);
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 4U);
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 5U);
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 6U);
+BENCHMARK_TEMPLATE(BM_BitGroup_decode, 7U);
+
+static void BM_WideBitField_encode(benchmark::State& state)
+{
+    bench_encode(state, WideBitPacket {BitField<3> {0x5}, BitField<40> {0xA5A5A5A5A5}});
+}
+BENCHMARK(BM_WideBitField_encode);
+
+static void BM_WideBitField_decode(benchmark::State& state)
+{
+    bench_decode(state, WideBitPacket {BitField<3> {0x5}, BitField<40> {0xA5A5A5A5A5}});
+}
+BENCHMARK(BM_WideBitField_decode);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Packet benchmarks               ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void BM_NestedPacket_encode(benchmark::State& state)
+{
+    bench_encode(state, make_nested_packet());
+}
+BENCHMARK(BM_NestedPacket_encode);
+
+static void BM_NestedPacket_decode(benchmark::State& state)
+{
+    bench_decode(state, make_nested_packet());
+}
+BENCHMARK(BM_NestedPacket_decode);
+
+static void BM_MixedPacket_encode(benchmark::State& state)
+{
+    bench_encode(state, make_mixed_packet());
+}
+BENCHMARK(BM_MixedPacket_encode);
+
+static void BM_MixedPacket_decode(benchmark::State& state)
+{
+    bench_decode(state, make_mixed_packet());
+}
+BENCHMARK(BM_MixedPacket_decode);
+
+static void BM_MixedPacket_encode_batch(benchmark::State& state)
+{
+    std::vector<MixedPacket> packets(kBatchPacketCount, make_mixed_packet());
+    std::vector<uint8_t>     buffer(kBatchPacketCount * MixedPacket::kSizeBytes, 0U);
+
+    Span<MixedPacket const> packet_span {packets.data(), packets.size()};
+    Span<uint8_t>           buffer_span {buffer.data(), buffer.size()};
+    for (auto _ : state)
+    {
+        size_t bits_encoded {0U};
+        benchmark::DoNotOptimize(encode_batch(packet_span, buffer_span, bits_encoded));
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed(state, buffer.size());
+}
+BENCHMARK(BM_MixedPacket_encode_batch);
+
+static void BM_MixedPacket_decode_batch(benchmark::State& state)
+{
+    std::vector<MixedPacket> packets(kBatchPacketCount, make_mixed_packet());
+    std::vector<uint8_t>     buffer(kBatchPacketCount * MixedPacket::kSizeBytes, 0U);
+
+    Span<MixedPacket const> packet_span {packets.data(), packets.size()};
+    Span<uint8_t>           buffer_span {buffer.data(), buffer.size()};
+    size_t                  bits_encoded {0U};
+    if (encode_batch(packet_span, buffer_span, bits_encoded) != kBatchPacketCount)
+    {
+        state.SkipWithError("Encoding failed");
+        return;
+    }
+
+    Span<uint8_t const> decode_span {span_cast<uint8_t const>(buffer_span)};
+    Span<MixedPacket>   decoded_span {packets.data(), packets.size()};
+    for (auto _ : state)
+    {
+        size_t bits_decoded {0U};
+        benchmark::DoNotOptimize(decode_batch(decode_span, bits_decoded, decoded_span));
+        benchmark::ClobberMemory();
+    }
+
+    set_bytes_processed(state, buffer.size());
+}
+BENCHMARK(BM_MixedPacket_decode_batch);
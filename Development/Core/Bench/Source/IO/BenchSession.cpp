@@ -0,0 +1,106 @@
+#include <Core/Bench/Session.hpp>
+
+#include <Core/IO/Session/MpmcSession.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+#include <Core/Mocks/IO/Session/MockInbound.hpp>
+#include <Core/Mocks/IO/Session/MockOutbound.hpp>
+
+#include <benchmark/benchmark.h>
+#include <gmock/gmock.h>
+
+#include <limits>
+#include <memory>
+
+using namespace shmit;
+using namespace shmit::bench;
+using namespace shmit::io::session;
+
+using ::testing::_;
+using ::testing::NiceMock;
+using ::testing::Return;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Benchmark sessions              ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Ring large enough to queue plenty of the largest messages
+using BenchRingSession = RingSession<(1U << 16U)>;
+
+/// @brief Slots sized for the largest message
+using BenchMpmcSession = MpmcSession<256U, 4096U>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Round trip benchmarks           ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Mocked sessions that accept every post and satisfy every request, isolating Egress and Ingress themselves
+ *
+ */
+template<size_t SizeBytesV>
+static void BM_MockSession_round_trip(benchmark::State& state)
+{
+    NiceMock<MockOutbound> outbound {};
+    NiceMock<MockInbound>  inbound {};
+    ON_CALL(outbound, OutputBytesAvailable()).WillByDefault(Return(std::numeric_limits<size_t>::max()));
+    ON_CALL(outbound, Post(_, _)).WillByDefault(Return(MockOutbound::Result::Success()));
+    ON_CALL(inbound, InputBytesAvailable()).WillByDefault(Return(std::numeric_limits<size_t>::max()));
+    ON_CALL(inbound, Request(_, _)).WillByDefault(Return(MockInbound::Result::Success()));
+
+    bench_round_trip<BenchMessage<SizeBytesV>>(state, outbound, inbound);
+}
+BENCHMARK_TEMPLATE(BM_MockSession_round_trip, 1U);
+BENCHMARK_TEMPLATE(BM_MockSession_round_trip, 64U);
+BENCHMARK_TEMPLATE(BM_MockSession_round_trip, 4096U);
+
+template<size_t SizeBytesV>
+static void BM_RingSession_round_trip(benchmark::State& state)
+{
+    auto session {std::make_unique<BenchRingSession>()};
+    bench_round_trip<BenchMessage<SizeBytesV>>(state, *session, *session);
+}
+BENCHMARK_TEMPLATE(BM_RingSession_round_trip, 1U);
+BENCHMARK_TEMPLATE(BM_RingSession_round_trip, 8U);
+BENCHMARK_TEMPLATE(BM_RingSession_round_trip, 64U);
+BENCHMARK_TEMPLATE(BM_RingSession_round_trip, 512U);
+BENCHMARK_TEMPLATE(BM_RingSession_round_trip, 4096U);
+
+template<size_t SizeBytesV>
+static void BM_MpmcSession_round_trip(benchmark::State& state)
+{
+    auto session {std::make_unique<BenchMpmcSession>()};
+    bench_round_trip<BenchMessage<SizeBytesV>>(state, *session, *session);
+}
+BENCHMARK_TEMPLATE(BM_MpmcSession_round_trip, 1U);
+BENCHMARK_TEMPLATE(BM_MpmcSession_round_trip, 8U);
+BENCHMARK_TEMPLATE(BM_MpmcSession_round_trip, 64U);
+BENCHMARK_TEMPLATE(BM_MpmcSession_round_trip, 512U);
+BENCHMARK_TEMPLATE(BM_MpmcSession_round_trip, 4096U);
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Cross-thread benchmarks         ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<size_t SizeBytesV>
+static void BM_RingSession_cross_thread(benchmark::State& state)
+{
+    auto session {std::make_unique<BenchRingSession>()};
+    bench_cross_thread<BenchMessage<SizeBytesV>>(state, *session, *session);
+}
+BENCHMARK_TEMPLATE(BM_RingSession_cross_thread, 1U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingSession_cross_thread, 8U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingSession_cross_thread, 64U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingSession_cross_thread, 512U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_RingSession_cross_thread, 4096U)->UseRealTime();
+
+template<size_t SizeBytesV>
+static void BM_MpmcSession_cross_thread(benchmark::State& state)
+{
+    auto session {std::make_unique<BenchMpmcSession>()};
+    bench_cross_thread<BenchMessage<SizeBytesV>>(state, *session, *session);
+}
+BENCHMARK_TEMPLATE(BM_MpmcSession_cross_thread, 1U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpmcSession_cross_thread, 8U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpmcSession_cross_thread, 64U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpmcSession_cross_thread, 512U)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_MpmcSession_cross_thread, 4096U)->UseRealTime();
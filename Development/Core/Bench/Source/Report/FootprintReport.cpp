@@ -0,0 +1,59 @@
+#include <Core/Bench/FootprintReport.hpp>
+#include <Core/Bench/Packets.hpp>
+
+#include <Core/Data/PacketReport.hpp>
+#include <Core/IO/Session/MessageSet.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+
+using namespace shmit;
+using namespace shmit::bench;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Registered types and budgets    ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Register a type by giving it a budget, a static_assert on its footprint and a row in main(). Size budgets fail the
+// build of this report, latency budgets fail ShmitCore-FootprintReport-check. Latency budgets are loose on purpose so
+// that they catch an order-of-magnitude regression on any build machine rather than noise.
+
+using BenchMessageSet = io::session::MessageSet<HeaderPacket, NestedPacket, MixedPacket>;
+
+constexpr static ReportBudget kHeaderBudget {{4U, 6U, 1U}, 100.0, 100.0};
+constexpr static ReportBudget kNestedBudget {{20U, 28U, 6U}, 200.0, 200.0};
+constexpr static ReportBudget kMixedBudget {{62U, 96U, 17U}, 500.0, 500.0};
+
+constexpr static size_t kBenchMessageSetMaxBytes {64U};
+
+static_assert(data::is_within_budget(data::packet_report_v<HeaderPacket>, kHeaderBudget.footprint),
+              "HeaderPacket is over its footprint budget");
+static_assert(data::is_within_budget(data::packet_report_v<NestedPacket>, kNestedBudget.footprint),
+              "NestedPacket is over its footprint budget");
+static_assert(data::is_within_budget(data::packet_report_v<MixedPacket>, kMixedBudget.footprint),
+              "MixedPacket is over its footprint budget");
+static_assert(BenchMessageSet::kMaxMessageSizeBytes <= kBenchMessageSetMaxBytes,
+              "BenchMessageSet is over its message size budget");
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Report                          ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int main()
+{
+    FootprintReport report {stdout};
+
+    report.Add<HeaderPacket>("HeaderPacket", kHeaderBudget, make_header_packet());
+    report.Add<NestedPacket>("NestedPacket", kNestedBudget, make_nested_packet());
+    report.Add<MixedPacket>("MixedPacket", kMixedBudget, make_mixed_packet());
+    report.AddMessageSet<BenchMessageSet>("BenchMessageSet", kBenchMessageSetMaxBytes);
+
+    size_t const kOverBudgetCount {report.GetOverBudgetCount()};
+    if (kOverBudgetCount > 0U)
+    {
+        static_cast<void>(std::fprintf(stderr, "%zu type(s) over budget\n", kOverBudgetCount));
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
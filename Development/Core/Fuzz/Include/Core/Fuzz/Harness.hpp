@@ -0,0 +1,131 @@
+#pragma once
+
+#include "Core/Mocks/IO/Session/MockInbound.hpp"
+
+#include <Core/Span.hpp>
+#include <Core/StdTypes.hpp>
+
+#include <gmock/gmock.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+// Cost ceiling of a single fuzz input, set by the SHMITCORE_FUZZ_FIXED_NS and SHMITCORE_FUZZ_NS_PER_BYTE cache
+// variables. Both are loose on purpose, they are there to catch paths that scale badly with the input rather than to
+// measure it.
+#ifndef SHMIT_FUZZ_FIXED_NS
+#define SHMIT_FUZZ_FIXED_NS 100000
+#endif
+
+#ifndef SHMIT_FUZZ_NS_PER_BYTE
+#define SHMIT_FUZZ_NS_PER_BYTE 1000
+#endif
+
+/**!
+ * @brief Entry point of a fuzz target, called once per input by libFuzzer, AFL or the standalone driver
+ *
+ * @param[in] data Input bytes
+ * @param[in] size Number of input bytes
+ * @return 0, inputs are never rejected
+ */
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* data, size_t size);
+
+namespace shmit
+{
+namespace fuzz
+{
+
+/**!
+ * @brief Time allowed to handle one input: a fixed allowance for setup plus a budget per input byte
+ */
+struct CostCeiling
+{
+    int64_t fixed_ns;
+    int64_t ns_per_byte;
+};
+
+/// @brief Ceiling every target is held to
+constexpr static CostCeiling kCostCeiling {SHMIT_FUZZ_FIXED_NS, SHMIT_FUZZ_NS_PER_BYTE};
+
+/// @brief Times an input is run before it is flagged, so that a single preempted run is not taken for a slow path
+constexpr static size_t kCostAttempts {3U};
+
+/**!
+ * @brief Input bytes as read by a MockInbound, see bind_inbound
+ */
+struct ByteStream
+{
+    Span<uint8_t const> bytes;
+    size_t              read_bytes {0U};
+
+    /// @brief Number of bytes left to read
+    size_t GetRemainingBytes() const noexcept
+    {
+        return bytes.size() - read_bytes;
+    }
+};
+
+/**!
+ * @brief Makes a mocked session serve the bytes of a stream, as if they had arrived on a link. The session never
+ * lends out its storage, so that readers take their copying path.
+ *
+ * @param[in] session Mocked session
+ * @param[in] stream Bytes to serve, must outlive the session
+ */
+static void bind_inbound(::testing::NiceMock<MockInbound>& session, ByteStream& stream)
+{
+    ON_CALL(session, InputBytesAvailable()).WillByDefault([&stream]() { return stream.GetRemainingBytes(); });
+    ON_CALL(session, Request(::testing::_, ::testing::_))
+        .WillByDefault(
+            [&stream](Span<uint8_t> rx, std::chrono::microseconds timeout)
+            {
+                static_cast<void>(timeout); // Avoid unused warning
+                if (rx.size() > stream.GetRemainingBytes())
+                    return MockInbound::Result::Failure();
+
+                static_cast<void>(std::memcpy(rx.data(), &stream.bytes[stream.read_bytes], rx.size()));
+                stream.read_bytes += rx.size();
+                return MockInbound::Result::Success();
+            });
+}
+
+/**!
+ * @brief Runs one input through a target and aborts, so that the fuzzing engine keeps the input, if it takes longer
+ * than kCostCeiling allows on every one of kCostAttempts runs
+ *
+ * @tparam FunctionT Callable taking the input as a Span<uint8_t const>, must leave no state behind between runs
+ * @param[in] target Name of the target, printed when an input is flagged
+ * @param[in] input Input bytes
+ * @param[in] function Decode path under test
+ */
+template<typename FunctionT>
+static void run_within_ceiling(char const* target, Span<uint8_t const> input, FunctionT function)
+{
+    int64_t const kCeilingNs {kCostCeiling.fixed_ns +
+                              (kCostCeiling.ns_per_byte * static_cast<int64_t>(input.size()))};
+
+    int64_t best_ns {0};
+    for (size_t attempt = 0U; attempt < kCostAttempts; attempt++)
+    {
+        auto const kStart {std::chrono::steady_clock::now()};
+        function(input);
+        int64_t const kElapsedNs {
+            std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - kStart).count()};
+
+        best_ns = (attempt == 0U) ? kElapsedNs : std::min(best_ns, kElapsedNs);
+        if (best_ns <= kCeilingNs)
+            return;
+    }
+
+    double const kNsPerByte {static_cast<double>(best_ns) / static_cast<double>(std::max<size_t>(input.size(), 1U))};
+    static_cast<void>(std::fprintf(stderr, "%s: %zu byte input took %lld ns, ceiling is %lld ns (%.1f ns/byte)\n",
+                                   target, input.size(), static_cast<long long>(best_ns),
+                                   static_cast<long long>(kCeilingNs), kNsPerByte));
+    std::abort();
+}
+
+} // namespace fuzz
+} // namespace shmit
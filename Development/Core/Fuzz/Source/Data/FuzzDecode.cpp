@@ -0,0 +1,79 @@
+#include <Core/Fuzz/Harness.hpp>
+
+#include <Core/Data/Decode.hpp>
+#include <Core/Data/Field.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/Span.hpp>
+
+#include <cstdlib>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Fuzzed packets                  ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using BitsPacket  = packet_t<BitField<3>, BitField<17>, Bit, ConstBitField<3>, uint32_t, BitField<40>, int16_t>;
+using VarPacket   = packet_t<uint8_t, VarField<uint32_t>, VarField<int64_t>, BitField<4>, Bit>;
+using BlobPacket  = packet_t<uint8_t, BlobField<32>, BitField<4>, Bit, uint16_t>;
+using WidePacket  = packet_t<double, uint64_t, BitsPacket, float>;
+using BatchPacket = packet_t<uint16_t, BitField<12>, BitField<4>>;
+
+/// @brief Most Packets decoded per batch
+constexpr static size_t kBatchCapacity {16U};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Decode paths                    ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Decodes an object from the input at a given starting offset, and checks that a successful decode stays
+ * within the input
+ *
+ * @tparam T Decoded object type
+ * @param[in] input Data source
+ * @param[in] start_bits Offset to start decoding from
+ */
+template<typename T>
+static void decode_checked(Span<uint8_t const> input, size_t start_bits)
+{
+    T      decoded {};
+    size_t offset_bits {start_bits};
+    if (decode(input, offset_bits, decoded).IsSuccess() && (offset_bits > (8U * input.size())))
+        std::abort();
+}
+
+/// @brief Runs every decode path over one input
+static void decode_all(Span<uint8_t const> input)
+{
+    // The first byte picks the starting offset, so that unaligned starts are covered as well
+    size_t const              kStartBits {input[0U] & 0x7U};
+    Span<uint8_t const> const kBody {input.subspan(1U)};
+
+    decode_checked<BitsPacket>(kBody, kStartBits);
+    decode_checked<VarPacket>(kBody, kStartBits);
+    decode_checked<BlobPacket>(kBody, kStartBits);
+    decode_checked<WidePacket>(kBody, kStartBits);
+    decode_checked<VarField<uint64_t>>(kBody, kStartBits);
+    decode_checked<BlobField<64>>(kBody, kStartBits);
+
+    BatchPacket  batch[kBatchCapacity] {};
+    size_t       offset_bits {kStartBits};
+    size_t const kNumDecoded {decode_batch(kBody, offset_bits, Span<BatchPacket> {batch, kBatchCapacity})};
+    if ((kNumDecoded > kBatchCapacity) || (offset_bits > (8U * kBody.size())))
+        std::abort();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Fuzz target                     ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* data, size_t size)
+{
+    if (size == 0U)
+        return 0;
+
+    fuzz::run_within_ceiling("FuzzDecode", Span<uint8_t const> {data, size}, decode_all);
+    return 0;
+}
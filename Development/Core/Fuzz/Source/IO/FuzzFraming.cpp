@@ -0,0 +1,60 @@
+#include <Core/Fuzz/Harness.hpp>
+
+#include <Core/IO/Session/Framing.hpp>
+#include <Core/Span.hpp>
+
+#include <chrono>
+#include <cstdlib>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+/// @brief Payload buffer of the framed stage, small enough that large frames from the input are discarded
+constexpr static size_t kFramedCapacity {128U};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Unframing path                  ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Unframes the input as if it arrived on a link, draining every payload as soon as it is buffered. Covers
+ * sync hunting, header rescans and discarded frames, which is where hostile input can make a decoder loop.
+ *
+ * @param[in] input Bytes served to the framed stage
+ */
+static void unframe_all(Span<uint8_t const> input)
+{
+    ::testing::NiceMock<MockInbound> session {};
+    fuzz::ByteStream                 stream {input};
+    fuzz::bind_inbound(session, stream);
+
+    FramedInbound<kFramedCapacity> framed {session};
+    uint8_t                        payload[kFramedCapacity];
+    while (true)
+    {
+        size_t const kNumFrames {framed.Update()};
+        size_t const kNumBytes {framed.InputBytesAvailable()};
+        if (kNumBytes > kFramedCapacity)
+            std::abort();
+
+        if (kNumBytes > 0U)
+        {
+            if (framed.Request(Span<uint8_t> {payload, kNumBytes}, std::chrono::microseconds::zero()).IsFailure())
+                std::abort();
+        }
+        else if (kNumFrames == 0U)
+        {
+            break;
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Fuzz target                     ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* data, size_t size)
+{
+    fuzz::run_within_ceiling("FuzzFraming", Span<uint8_t const> {data, size}, unframe_all);
+    return 0;
+}
@@ -0,0 +1,59 @@
+#include <Core/Fuzz/Harness.hpp>
+
+#include <Core/Data/Field.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/Span.hpp>
+
+#include <chrono>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Fuzzed packets                  ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using SamplePacket = data::packet_t<uint16_t, uint8_t, data::BitField<4>, data::BitField<4>, uint32_t, float>;
+using StatusPacket = data::packet_t<data::ConstBitField<4>, data::BitField<12>, int64_t, data::Bit>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Get paths                       ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Gets objects from a session serving the input until a Get fails
+ *
+ * @tparam T Object type
+ * @param[in] input Bytes served by the session
+ */
+template<typename T>
+static void get_until_failure(Span<uint8_t const> input)
+{
+    ::testing::NiceMock<MockInbound> session {};
+    fuzz::ByteStream                 stream {input};
+    fuzz::bind_inbound(session, stream);
+
+    Ingress<T> ingress {session};
+    T          value {};
+    while (ingress.Get(value, std::chrono::microseconds::zero()).IsSuccess())
+    {
+    }
+}
+
+/// @brief Runs every Get path over one input
+static void get_all(Span<uint8_t const> input)
+{
+    get_until_failure<SamplePacket>(input);
+    get_until_failure<StatusPacket>(input);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Fuzz target                     ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+extern "C" int LLVMFuzzerTestOneInput(uint8_t const* data, size_t size)
+{
+    fuzz::run_within_ceiling("FuzzIngress", Span<uint8_t const> {data, size}, get_all);
+    return 0;
+}
@@ -0,0 +1,165 @@
+#include <Core/Fuzz/Harness.hpp>
+
+#include <Core/Data/Crc.hpp>
+#include <Core/IO/Session/Framing.hpp>
+#include <Core/Span.hpp>
+#include <Core/StdTypes.hpp>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace shmit;
+
+// Driver for builds without libFuzzer. Given files, such as a saved corpus or an AFL test case (afl-fuzz ... -- <target>
+// @@), runs each of them once. Given nothing, runs a fixed set of generated inputs shaped to stress decode paths, which
+// is what ctest does on every build.
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Input generation                ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Inputs generated when no files are given
+constexpr static size_t kDefaultGeneratedCount {2000U};
+
+/// @brief Largest generated input in bytes
+constexpr static size_t kMaxGeneratedBytes {4096U};
+
+/// @brief Fixed seed, so that a flagged generated input is reproduced by running again
+constexpr static uint64_t kSeed {0x5EED5EED5EED5EEDU};
+
+/// @brief Deterministic xorshift64 generator
+class InputGenerator
+{
+public:
+    uint64_t Next() noexcept
+    {
+        m_state ^= (m_state << 13U);
+        m_state ^= (m_state >> 7U);
+        m_state ^= (m_state << 17U);
+        return m_state;
+    }
+
+    uint8_t NextByte() noexcept
+    {
+        return static_cast<uint8_t>(Next());
+    }
+
+    /// @brief Draws a value in [0, bound)
+    size_t NextBelow(size_t bound) noexcept
+    {
+        return static_cast<size_t>(Next() % bound);
+    }
+
+    /**!
+     * @brief Fills an input with one of several shapes: noise, floods of a single byte (such as varint continuations),
+     * floods of sync bytes, and runs of frames that are valid, corrupt or claim too large a payload
+     *
+     * @param[out] input Generated input
+     */
+    void Generate(std::vector<uint8_t>& input)
+    {
+        input.clear();
+        size_t const kSizeBytes {NextBelow(kMaxGeneratedBytes + 1U)};
+
+        switch (NextBelow(4U))
+        {
+            case 0U:
+                while (input.size() < kSizeBytes)
+                    input.push_back(NextByte());
+                break;
+
+            case 1U:
+                input.assign(kSizeBytes, ((Next() & 1U) != 0U) ? uint8_t {0xFFU} : NextByte());
+                break;
+
+            case 2U:
+                while (input.size() < kSizeBytes)
+                    input.push_back(((input.size() & 1U) == 0U) ? io::session::FrameFormat::kSync0
+                                                                : io::session::FrameFormat::kSync1);
+                break;
+
+            default:
+                while (input.size() < kSizeBytes)
+                    AppendFrame(input);
+                break;
+        }
+    }
+
+private:
+    /// @brief Appends a frame, which is one time in four corrupted and one time in eight far too large
+    void AppendFrame(std::vector<uint8_t>& input)
+    {
+        size_t const kPayloadBytes {((Next() & 7U) == 0U) ? (0x8000U + NextBelow(0x8000U)) : NextBelow(160U)};
+        uint8_t const kLength[2U] {static_cast<uint8_t>(kPayloadBytes), static_cast<uint8_t>(kPayloadBytes >> 8U)};
+
+        input.push_back(io::session::FrameFormat::kSync0);
+        input.push_back(io::session::FrameFormat::kSync1);
+        input.push_back(kLength[0U]);
+        input.push_back(kLength[1U]);
+        input.push_back(data::crc8(Span<uint8_t const> {kLength, sizeof(kLength)}));
+
+        // Frames that claim a large payload are cut short, what follows them is read as their payload
+        size_t const kPayloadStart {input.size()};
+        size_t const kWrittenBytes {(kPayloadBytes > 0xFFU) ? NextBelow(64U) : kPayloadBytes};
+        for (size_t i = 0U; i < kWrittenBytes; i++)
+            input.push_back(NextByte());
+
+        uint32_t const kCheck {data::crc32(Span<uint8_t const> {(input.data() + kPayloadStart), kWrittenBytes})};
+        for (size_t i = 0U; i < sizeof(kCheck); i++)
+            input.push_back(static_cast<uint8_t>(kCheck >> (8U * i)));
+
+        if ((Next() & 3U) == 0U)
+            input[kPayloadStart - 1U - NextBelow(3U)] ^= static_cast<uint8_t>(1U << NextBelow(8U));
+    }
+
+    uint64_t m_state {kSeed};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Driver                          ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Runs the contents of a file through the target
+static bool run_file(char const* path)
+{
+    std::ifstream file {path, std::ios::binary};
+    if (!file)
+    {
+        static_cast<void>(std::fprintf(stderr, "Could not open %s\n", path));
+        return false;
+    }
+
+    std::vector<uint8_t> const kInput {std::istreambuf_iterator<char> {file}, std::istreambuf_iterator<char> {}};
+    static_cast<void>(LLVMFuzzerTestOneInput(kInput.data(), kInput.size()));
+    return true;
+}
+
+int main(int argc, char** argv)
+{
+    if (argc > 1)
+    {
+        for (int i = 1; i < argc; i++)
+        {
+            if (!run_file(argv[i]))
+                return EXIT_FAILURE;
+        }
+
+        return EXIT_SUCCESS;
+    }
+
+    InputGenerator       generator {};
+    std::vector<uint8_t> input {};
+    input.reserve(kMaxGeneratedBytes + 0x100U);
+    for (size_t i = 0U; i < kDefaultGeneratedCount; i++)
+    {
+        generator.Generate(input);
+        static_cast<void>(LLVMFuzzerTestOneInput(input.data(), input.size()));
+    }
+
+    static_cast<void>(std::fprintf(stdout, "Ran %zu generated inputs\n", kDefaultGeneratedCount));
+    return EXIT_SUCCESS;
+}
@@ -1,24 +1,105 @@
 #include <Core/Help/RoutineLogic.hpp>
+#include <Core/Platform/Wait.hpp>
+
+#include <algorithm>
 
 namespace shmit
 {
 namespace help
 {
 
-void WaitForPassCondition(RepeatableCheck condition)
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions               ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Shared backoff loop behind every BlockOnPassCondition overload
+ *
+ * @param[in] condition Condition to wait on
+ * @param[in] notifier Optional notifier to sleep on, null to sleep undisturbed
+ * @param[in] timeout Optional timer that bounds the wait, null to wait forever
+ * @retval true if the condition passed
+ * @retval false if the timer expired first
+ */
+static bool block_with_backoff(RepeatableCheck const& condition, PassNotifier const* notifier,
+                               time::Timer const* timeout) noexcept
 {
-    bool condition_passed {false};
-    do
+    // Word that nobody notifies, for sleeping without a notifier
+    static std::atomic<uint32_t> const kUnnotifiedWord {0U};
+
+    std::chrono::microseconds slice {1};
+    for (size_t num_checks = 0U;; num_checks++)
     {
-        condition_passed = condition();
-    } while (!condition_passed);
+        uint32_t const epoch {(notifier != nullptr) ? notifier->GetEpoch() : 0U};
+        if (condition())
+            return true;
+
+        if ((timeout != nullptr) && timeout->IsExpired())
+            return false;
+
+        if (num_checks < kSpinCheckCount)
+            continue;
+
+        if (num_checks < (kSpinCheckCount + kYieldCheckCount))
+        {
+            platform::yield();
+            continue;
+        }
+
+        if (notifier != nullptr)
+            notifier->Wait(epoch, slice);
+        else
+            platform::wait_on(kUnnotifiedWord, 0U, slice);
+
+        slice = std::min((slice * 2), kMaxBlockSlice);
+    }
+}
+
+void WaitForPassCondition(RepeatableCheck condition)
+{
+    WaitForPassCondition<RepeatableCheck&>(condition);
 }
 
 void BlockOnPassCondition(RepeatableCheck condition)
 {
-    // TODO call to system block method between checks
-    // For now pass to WaitForPassCondition
-    WaitForPassCondition(condition);
+    static_cast<void>(block_with_backoff(condition, nullptr, nullptr));
+}
+
+bool BlockOnPassCondition(RepeatableCheck condition, time::Timer const& timeout)
+{
+    return block_with_backoff(condition, nullptr, &timeout);
+}
+
+void BlockOnPassCondition(RepeatableCheck condition, PassNotifier const& notifier)
+{
+    static_cast<void>(block_with_backoff(condition, &notifier, nullptr));
+}
+
+bool BlockOnPassCondition(RepeatableCheck condition, PassNotifier const& notifier, time::Timer const& timeout)
+{
+    return block_with_backoff(condition, &notifier, &timeout);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PassNotifier method definitions in alphabetical order                ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+uint32_t PassNotifier::GetEpoch() const noexcept
+{
+    return m_epoch.load(std::memory_order_acquire);
+}
+
+void PassNotifier::Notify() noexcept
+{
+    static_cast<void>(m_epoch.fetch_add(1U, std::memory_order_acq_rel));
+    platform::notify_all(m_epoch);
+}
+
+void PassNotifier::Wait(uint32_t epoch, std::chrono::microseconds timeout) const noexcept
+{
+    platform::wait_on(m_epoch, epoch, timeout);
 }
 
 } // namespace help
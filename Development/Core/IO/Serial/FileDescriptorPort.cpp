@@ -0,0 +1,106 @@
+#include <Core/IO/Serial/FileDescriptorPort.hpp>
+
+#ifdef NATIVE_SHMIT
+
+#include <Core/Platform/Clock.hpp>
+
+#include <cerrno>
+
+#include <poll.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#endif
+
+namespace shmit
+{
+namespace io
+{
+namespace serial
+{
+
+#ifdef NATIVE_SHMIT
+
+/**!
+ * @brief Waits for a descriptor to become ready
+ *
+ * @param[in] file_descriptor Descriptor to wait on
+ * @param[in] events Events to wait for, POLLIN or POLLOUT
+ * @param[in] timeout Maximum time to wait, rounded up to whole milliseconds
+ * @retval true if the descriptor is ready
+ * @retval false if the timeout elapsed or polling failed
+ */
+static bool poll_descriptor(int file_descriptor, short events, std::chrono::microseconds timeout) noexcept
+{
+    pollfd descriptor {file_descriptor, events, 0};
+    int const timeout_ms {static_cast<int>((timeout.count() + 999) / 1000)};
+    return ((poll(&descriptor, 1U, timeout_ms) > 0) && ((descriptor.revents & events) != 0));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FileDescriptorPort constructor definitions          ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+FileDescriptorPort::FileDescriptorPort(int file_descriptor) noexcept : m_file_descriptor {file_descriptor}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FileDescriptorPort method definitions in alphabetical order         ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+size_t FileDescriptorPort::Read(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept
+{
+    if ((rx.size() == 0U) || !poll_descriptor(m_file_descriptor, POLLIN, timeout))
+        return 0U;
+
+    ssize_t const num_read {read(m_file_descriptor, rx.data(), rx.size())};
+    return ((num_read > 0) ? static_cast<size_t>(num_read) : 0U);
+}
+
+size_t FileDescriptorPort::ReadBytesAvailable() const noexcept
+{
+    int num_ready {0};
+    if (ioctl(m_file_descriptor, FIONREAD, &num_ready) != 0)
+        return 0U;
+
+    return ((num_ready > 0) ? static_cast<size_t>(num_ready) : 0U);
+}
+
+size_t FileDescriptorPort::Write(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept
+{
+    platform::Clock::time_point const deadline {platform::Clock::now() + timeout};
+
+    size_t num_written {0U};
+    while (num_written < tx.size())
+    {
+        ssize_t const num_sent {write(m_file_descriptor, (tx.data() + num_written), (tx.size() - num_written))};
+        if (num_sent > 0)
+        {
+            num_written += static_cast<size_t>(num_sent);
+            continue;
+        }
+
+        if ((num_sent < 0) && (errno != EAGAIN) && (errno != EWOULDBLOCK) && (errno != EINTR))
+            break;
+
+        // The descriptor is full, wait for room until the deadline
+        platform::Clock::time_point const now {platform::Clock::now()};
+        if ((now >= deadline)
+            || !poll_descriptor(m_file_descriptor, POLLOUT,
+                                std::chrono::duration_cast<std::chrono::microseconds>(deadline - now)))
+            break;
+    }
+
+    return num_written;
+}
+
+#endif
+
+} // namespace serial
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,121 @@
+#include <Core/IO/Session/FlowControl.hpp>
+#include <Core/IO/Session/Instrumentation.hpp>
+#include <Core/IO/Session/Outbound.hpp>
+#include <Core/Platform/Clock.hpp>
+#include <Core/Platform/Wait.hpp>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FlowControl method definitions in alphabetical order            ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+BinaryResult FlowControl::AcquireCredit(Outbound const& session, size_t size_bytes,
+                                        std::chrono::microseconds timeout) noexcept
+{
+    // Only the producer touches credit, so what it already holds can be read relaxed
+    size_t const kCreditBytes {m_credit_bytes.load(std::memory_order_relaxed)};
+    if (!WaitForSpace(session, (kCreditBytes + size_bytes), timeout))
+        return BinaryResult::Failure();
+
+    m_credit_bytes.store((kCreditBytes + size_bytes), std::memory_order_relaxed);
+    return BinaryResult::Success();
+}
+
+size_t FlowControl::GetCreditBytes() const noexcept
+{
+    return m_credit_bytes.load(std::memory_order_relaxed);
+}
+
+void FlowControl::NotifyDrained(size_t used_bytes) noexcept
+{
+    // Ordered against the waiter count, so that either a waiter sees the released space or it is woken
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (m_waiter_count.load(std::memory_order_seq_cst) > 0U)
+    {
+        m_space_epoch.fetch_add(1U, std::memory_order_seq_cst);
+        platform::notify_all(m_space_epoch);
+    }
+
+    if ((m_callback != nullptr) && (used_bytes <= m_low_watermark_bytes) &&
+        m_is_above_high.load(std::memory_order_relaxed) && m_is_above_high.exchange(false, std::memory_order_acq_rel))
+        m_callback(Watermark::kLow, m_context);
+}
+
+void FlowControl::NotifyFilled(size_t used_bytes) noexcept
+{
+    if ((m_callback != nullptr) && (used_bytes >= m_high_watermark_bytes) &&
+        !m_is_above_high.load(std::memory_order_relaxed) && !m_is_above_high.exchange(true, std::memory_order_acq_rel))
+        m_callback(Watermark::kHigh, m_context);
+}
+
+BinaryResult FlowControl::SetWatermarks(size_t low_bytes, size_t high_bytes, WatermarkCallback callback,
+                                        void* context) noexcept
+{
+    if (low_bytes >= high_bytes)
+        return BinaryResult::Failure();
+
+    m_low_watermark_bytes  = low_bytes;
+    m_high_watermark_bytes = high_bytes;
+    m_callback             = callback;
+    m_context              = context;
+    m_is_above_high.store(false, std::memory_order_relaxed);
+    return BinaryResult::Success();
+}
+
+size_t FlowControl::SpendCredit(size_t size_bytes) noexcept
+{
+    size_t const kCreditBytes {m_credit_bytes.load(std::memory_order_relaxed)};
+    size_t const kSpentBytes {(size_bytes < kCreditBytes) ? size_bytes : kCreditBytes};
+    m_credit_bytes.store((kCreditBytes - kSpentBytes), std::memory_order_relaxed);
+    return kSpentBytes;
+}
+
+bool FlowControl::WaitForSpace(Outbound const& session, size_t size_bytes, std::chrono::microseconds timeout) noexcept
+{
+    if (session.OutputBytesAvailable() >= size_bytes)
+        return true;
+
+    if (timeout <= std::chrono::microseconds::zero())
+        return false;
+
+    auto const kDeadline {platform::Clock::now() + timeout};
+
+    // Announce the wait before looking again, space released after it is sure to bump the epoch
+    m_waiter_count.fetch_add(1U, std::memory_order_seq_cst);
+
+    bool is_space_free {false};
+    while (true)
+    {
+        uint32_t const kEpoch {m_space_epoch.load(std::memory_order_seq_cst)};
+        if (session.OutputBytesAvailable() >= size_bytes)
+        {
+            is_space_free = true;
+            break;
+        }
+
+        auto const kNow {platform::Clock::now()};
+        if (kNow >= kDeadline)
+            break;
+
+        auto const kRemaining {std::chrono::duration_cast<std::chrono::microseconds>(kDeadline - kNow)};
+        platform::wait_on(m_space_epoch, kEpoch, kRemaining);
+    }
+
+    m_waiter_count.fetch_sub(1U, std::memory_order_relaxed);
+    if (!is_space_free)
+        instrument_count(SessionCounter::kWaitTimeouts);
+
+    return is_space_free;
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,119 @@
+#include <Core/IO/Session/Framing.hpp>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FramedOutbound constructor definitions          ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+FramedOutbound::FramedOutbound(Outbound& session) noexcept : m_session {session}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FramedOutbound method definitions in alphabetical order         ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+FramedOutbound::Result FramedOutbound::Commit(size_t size_bytes) noexcept
+{
+    Span<uint8_t> const reserved {m_reserved};
+    m_reserved = Span<uint8_t> {nullptr, size_t {0U}};
+
+    if (reserved.size() < FrameFormat::kOverheadBytes)
+        return Result::Failure();
+
+    if (size_bytes == 0U)
+        return m_session.Commit(0U);
+
+    if (size_bytes > (reserved.size() - FrameFormat::kOverheadBytes))
+    {
+        static_cast<void>(m_session.Commit(0U)); // Abandon the reservation
+        return Result::Failure();
+    }
+
+    // The payload was just encoded in to the reservation, check it while it is still in cache
+    Span<uint8_t const> const payload {(reserved.data() + FrameFormat::kHeaderSizeBytes), size_bytes};
+    _detail::write_frame_header(reserved.data(), size_bytes);
+    _detail::write_frame_trailer((reserved.data() + FrameFormat::kHeaderSizeBytes + size_bytes), data::crc32(payload));
+
+    return m_session.Commit(size_bytes + FrameFormat::kOverheadBytes);
+}
+
+size_t FramedOutbound::OutputBytesAvailable() const noexcept
+{
+    size_t const available_bytes {m_session.OutputBytesAvailable()};
+    if (available_bytes <= FrameFormat::kOverheadBytes)
+        return 0U;
+
+    return std::min((available_bytes - FrameFormat::kOverheadBytes), FrameFormat::kMaxPayloadSizeBytes);
+}
+
+FramedOutbound::Result FramedOutbound::Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept
+{
+    return Post(Span<Span<uint8_t const> const> {&tx, 1U}, timeout);
+}
+
+FramedOutbound::Result FramedOutbound::Post(Span<Span<uint8_t const> const> parts,
+                                            std::chrono::microseconds       timeout) noexcept
+{
+    if (parts.count() > kMaxPartCount)
+        return Result::Failure();
+
+    // Checksum the payload as it is gathered, the parts are passed on without a copy
+    size_t   payload_size_bytes {0U};
+    uint32_t crc_state {data::kCrc32Initial};
+    for (Span<uint8_t const> const& part : parts)
+    {
+        payload_size_bytes += part.size();
+        crc_state = data::crc32_update(crc_state, part);
+    }
+
+    if (payload_size_bytes > FrameFormat::kMaxPayloadSizeBytes)
+        return Result::Failure();
+
+    uint8_t header[FrameFormat::kHeaderSizeBytes] {};
+    uint8_t trailer[FrameFormat::kTrailerSizeBytes] {};
+    _detail::write_frame_header(header, payload_size_bytes);
+    _detail::write_frame_trailer(trailer, data::crc32_finalize(crc_state));
+
+    // Header, up to kMaxPartCount parts of payload and trailer
+    Span<uint8_t const> const kNone {nullptr, size_t {0U}};
+    Span<uint8_t const>       frame_parts[kMaxPartCount + 2U] {kNone, kNone, kNone, kNone, kNone,
+                                                               kNone, kNone, kNone, kNone, kNone};
+    frame_parts[0U] = Span<uint8_t const> {header, FrameFormat::kHeaderSizeBytes};
+
+    size_t num_frame_parts {1U};
+    for (Span<uint8_t const> const& part : parts)
+        frame_parts[num_frame_parts++] = part;
+
+    frame_parts[num_frame_parts++] = Span<uint8_t const> {trailer, FrameFormat::kTrailerSizeBytes};
+
+    return m_session.Post(Span<Span<uint8_t const> const> {frame_parts, num_frame_parts}, timeout);
+}
+
+Span<uint8_t> FramedOutbound::Reserve(size_t size_bytes) noexcept
+{
+    m_reserved = Span<uint8_t> {nullptr, size_t {0U}};
+    if (size_bytes > FrameFormat::kMaxPayloadSizeBytes)
+        return m_reserved;
+
+    Span<uint8_t> const reserved {m_session.Reserve(size_bytes + FrameFormat::kOverheadBytes)};
+    if (reserved.size() < (size_bytes + FrameFormat::kOverheadBytes))
+        return m_reserved;
+
+    m_reserved = reserved;
+    return reserved.subspan(FrameFormat::kHeaderSizeBytes, size_bytes);
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,74 @@
+#include <Core/IO/Session/Instrumentation.hpp>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+
+namespace _detail
+{
+
+/// @brief Number of threads that may each count in to their own block
+constexpr static size_t kInstrumentBlockCount {32U};
+
+static InstrumentBlock s_instrument_blocks[kInstrumentBlockCount] {};
+
+/// @brief Block counted in to by every thread once the pool has run out
+static InstrumentBlock s_shared_instrument_block {{}, {}, {true}, true};
+
+InstrumentBlock& lease_instrument_block() noexcept
+{
+    for (InstrumentBlock& block : s_instrument_blocks)
+    {
+        bool is_leased {false};
+        if (block.is_leased.compare_exchange_strong(is_leased, true, std::memory_order_acquire))
+            return block;
+    }
+
+    return s_shared_instrument_block;
+}
+
+void release_instrument_block(InstrumentBlock& block) noexcept
+{
+    if (!block.is_shared)
+        block.is_leased.store(false, std::memory_order_release);
+}
+
+} // namespace _detail
+
+#endif
+
+SessionStatistics scrape_session_statistics() noexcept
+{
+    SessionStatistics statistics {};
+
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+    auto const accumulate {[&statistics](_detail::InstrumentBlock const& block)
+                           {
+                               for (size_t i = 0U; i < SessionStatistics::kCounterCount; i++)
+                                   statistics.counters[i] += block.counters[i].load(std::memory_order_relaxed);
+
+                               for (size_t i = 0U; i < SessionStatistics::kHistogramCount; i++)
+                               {
+                                   for (size_t j = 0U; j < SessionStatistics::kHistogramBucketCount; j++)
+                                       statistics.histograms[i][j] +=
+                                           block.histograms[i][j].load(std::memory_order_relaxed);
+                               }
+                           }};
+
+    for (_detail::InstrumentBlock const& block : _detail::s_instrument_blocks)
+        accumulate(block);
+
+    accumulate(_detail::s_shared_instrument_block);
+#endif
+
+    return statistics;
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,473 @@
+#include <Core/IO/Session/MappedFile.hpp>
+
+#ifdef NATIVE_SHMIT
+
+#include <Core/IO/Session/_Detail/Spin.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <new>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#endif
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+#ifdef NATIVE_SHMIT
+
+/// @brief Longest segment path, the prefix followed by a '.' and a six digit index
+constexpr static size_t kSegmentPathSizeBytes {MappedFileFormat::kMaxPathSizeBytes + 8U};
+
+/**!
+ * @brief Names a segment file
+ *
+ * @param[out] path Destination, kSegmentPathSizeBytes long
+ * @param[in] path_prefix Path that segment files are named after
+ * @param[in] index Index of the segment
+ */
+static void format_segment_path(char* path, char const* path_prefix, size_t index) noexcept
+{
+    static_cast<void>(std::snprintf(path, kSegmentPathSizeBytes, "%s.%06zu", path_prefix, index));
+}
+
+/**!
+ * @brief Applies mapping advice, which the kernel is free to ignore
+ *
+ * @param[in] segment Mapped segment
+ * @param[in] use_huge_pages True to ask for huge pages
+ * @param[in] is_sequential True if the segment will be read front to back
+ */
+static void advise_segment(_detail::MappedSegment const& segment, bool use_huge_pages, bool is_sequential) noexcept
+{
+#if defined(MADV_HUGEPAGE)
+    if (use_huge_pages)
+        static_cast<void>(madvise(segment.mapping, segment.mapping_size_bytes, MADV_HUGEPAGE));
+#else
+    static_cast<void>(use_huge_pages); // Avoid unused warning
+#endif
+
+    if (is_sequential)
+        static_cast<void>(madvise(segment.mapping, segment.mapping_size_bytes, MADV_SEQUENTIAL));
+}
+
+/**!
+ * @brief Unmaps and closes a segment, if it is mapped
+ *
+ * @param[in,out] segment Segment to unmap, left empty
+ */
+static void unmap_segment(_detail::MappedSegment& segment) noexcept
+{
+    if (segment.IsMapped())
+        static_cast<void>(munmap(segment.mapping, segment.mapping_size_bytes));
+
+    if (segment.file_descriptor >= 0)
+        static_cast<void>(close(segment.file_descriptor));
+
+    segment = _detail::MappedSegment {};
+}
+
+/**!
+ * @brief Creates, preallocates and maps a new segment for writing, and initializes its header
+ *
+ * @param[in] path Segment file to create, overwritten if it exists
+ * @param[in] capacity_bytes Size of the data area, the header plus data must be a whole number of pages
+ * @param[in] use_huge_pages True to ask for huge pages
+ * @param[out] segment Mapped segment
+ * @retval true if the segment is mapped
+ * @retval false otherwise, `segment` is left empty
+ */
+static bool map_segment_for_writing(char const* path, size_t capacity_bytes, bool use_huge_pages,
+                                    _detail::MappedSegment& segment) noexcept
+{
+    size_t const mapping_size_bytes {MappedFileFormat::kHeaderSizeBytes + capacity_bytes};
+
+    segment.file_descriptor = open(path, (O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC), 0644);
+    if (segment.file_descriptor < 0)
+        return false;
+
+    // Preallocate up front so that posting never waits on the filesystem to find blocks
+    if (posix_fallocate(segment.file_descriptor, 0, static_cast<off_t>(mapping_size_bytes)) != 0)
+    {
+        unmap_segment(segment);
+        return false;
+    }
+
+    void* const mapping {
+        mmap(nullptr, mapping_size_bytes, (PROT_READ | PROT_WRITE), MAP_SHARED, segment.file_descriptor, 0)};
+    if (mapping == MAP_FAILED)
+    {
+        unmap_segment(segment);
+        return false;
+    }
+
+    segment.mapping            = static_cast<uint8_t*>(mapping);
+    segment.mapping_size_bytes = mapping_size_bytes;
+    advise_segment(segment, use_huge_pages, false);
+
+    static_cast<void>(new (segment.mapping) MappedFileFormat::Header {MappedFileFormat::kMagic, {0U}, capacity_bytes,
+                                                                      {0U}});
+    return true;
+}
+
+/**!
+ * @brief Maps an existing segment for reading and checks its header
+ *
+ * @param[in] path Segment file to map
+ * @param[in] use_huge_pages True to ask for huge pages
+ * @param[out] segment Mapped segment
+ * @retval true if the segment is mapped
+ * @retval false otherwise, `segment` is left empty
+ */
+static bool map_segment_for_reading(char const* path, bool use_huge_pages, _detail::MappedSegment& segment) noexcept
+{
+    segment.file_descriptor = open(path, (O_RDONLY | O_CLOEXEC));
+    if (segment.file_descriptor < 0)
+        return false;
+
+    struct stat status {};
+    if ((fstat(segment.file_descriptor, &status) != 0)
+        || (static_cast<size_t>(status.st_size) < MappedFileFormat::kHeaderSizeBytes))
+    {
+        unmap_segment(segment);
+        return false;
+    }
+
+    size_t const mapping_size_bytes {static_cast<size_t>(status.st_size)};
+    void* const  mapping {mmap(nullptr, mapping_size_bytes, PROT_READ, MAP_SHARED, segment.file_descriptor, 0)};
+    if (mapping == MAP_FAILED)
+    {
+        unmap_segment(segment);
+        return false;
+    }
+
+    segment.mapping            = static_cast<uint8_t*>(mapping);
+    segment.mapping_size_bytes = mapping_size_bytes;
+
+    MappedFileFormat::Header const* header {segment.GetHeader()};
+    if ((header->magic != MappedFileFormat::kMagic)
+        || (header->capacity_bytes > (mapping_size_bytes - MappedFileFormat::kHeaderSizeBytes)))
+    {
+        unmap_segment(segment);
+        return false;
+    }
+
+    advise_segment(segment, use_huge_pages, true);
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MappedFileOutbound constructor definitions          ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+MappedFileOutbound::MappedFileOutbound(char const* path_prefix, size_t segment_capacity_bytes,
+                                       bool use_huge_pages) noexcept :
+    m_path_prefix {}, m_capacity_bytes {segment_capacity_bytes}, m_use_huge_pages {use_huge_pages}
+{
+    static_cast<void>(std::snprintf(m_path_prefix, sizeof(m_path_prefix), "%s", path_prefix));
+}
+
+MappedFileOutbound::~MappedFileOutbound() noexcept
+{
+    while (m_is_locked.exchange(true, std::memory_order_acquire))
+    {
+        // Wait out a concurrent PrepareNextSegment
+    }
+
+    unmap_segment(m_retired);
+
+    // Remove the unused standby before sealing, so that a reader never follows on to it
+    if (m_standby.IsMapped())
+    {
+        char path[kSegmentPathSizeBytes];
+        format_segment_path(path, m_path_prefix, (m_segment_index + 1U));
+        unmap_segment(m_standby);
+        static_cast<void>(unlink(path));
+    }
+
+    if (m_active.IsMapped())
+        m_active.GetHeader()->is_sealed.store(1U, std::memory_order_release);
+
+    unmap_segment(m_active);
+    m_is_locked.store(false, std::memory_order_release);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MappedFileOutbound method definitions in alphabetical order         ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+MappedFileOutbound::Result MappedFileOutbound::Commit(size_t size_bytes) noexcept
+{
+    size_t const reserved_bytes {m_reserved_bytes};
+    m_reserved_bytes = 0U;
+
+    if (size_bytes > reserved_bytes)
+        return Result::Failure();
+
+    if (size_bytes > 0U)
+        Publish(size_bytes);
+
+    return Result::Success();
+}
+
+size_t MappedFileOutbound::GetSegmentIndex() const noexcept
+{
+    return m_segment_index;
+}
+
+MappedFileOutbound::Result MappedFileOutbound::Open() noexcept
+{
+    if (m_active.IsMapped())
+        return Result::Failure();
+
+    // Segments are a whole number of pages, header included
+    size_t const page_size_bytes {static_cast<size_t>(sysconf(_SC_PAGESIZE))};
+    size_t const mapping_size_bytes {MappedFileFormat::kHeaderSizeBytes + std::max(m_capacity_bytes, size_t {1U})};
+    m_capacity_bytes = ((((mapping_size_bytes + page_size_bytes) - 1U) / page_size_bytes) * page_size_bytes)
+                       - MappedFileFormat::kHeaderSizeBytes;
+
+    char path[kSegmentPathSizeBytes];
+    format_segment_path(path, m_path_prefix, 0U);
+    if (!map_segment_for_writing(path, m_capacity_bytes, m_use_huge_pages, m_active))
+        return Result::Failure();
+
+    m_segment_index = 0U;
+    m_tail_bytes    = 0U;
+
+    // A missing standby is mapped again on rotation, it does not keep the recording from starting
+    static_cast<void>(PrepareNextSegment());
+    return Result::Success();
+}
+
+size_t MappedFileOutbound::OutputBytesAvailable() const noexcept
+{
+    return (m_active.IsMapped() ? m_capacity_bytes : 0U);
+}
+
+MappedFileOutbound::Result MappedFileOutbound::Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept
+{
+    if (!MakeRoom(tx.size(), timeout))
+        return Result::Failure();
+
+    static_cast<void>(std::memcpy((m_active.GetData() + m_tail_bytes), tx.data(), tx.size()));
+    Publish(tx.size());
+    return Result::Success();
+}
+
+MappedFileOutbound::Result MappedFileOutbound::Post(Span<Span<uint8_t const> const> parts,
+                                                    std::chrono::microseconds       timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t const> const& part : parts)
+        size_bytes += part.size();
+
+    if (!MakeRoom(size_bytes, timeout))
+        return Result::Failure();
+
+    uint8_t* destination {m_active.GetData() + m_tail_bytes};
+    for (Span<uint8_t const> const& part : parts)
+    {
+        static_cast<void>(std::memcpy(destination, part.data(), part.size()));
+        destination += part.size();
+    }
+
+    Publish(size_bytes);
+    return Result::Success();
+}
+
+MappedFileOutbound::Result MappedFileOutbound::PrepareNextSegment() noexcept
+{
+    if (m_is_locked.exchange(true, std::memory_order_acquire))
+        return Result::Failure();
+
+    bool const is_ready {UnlockedPrepare()};
+    m_is_locked.store(false, std::memory_order_release);
+    return (is_ready ? Result::Success() : Result::Failure());
+}
+
+Span<uint8_t> MappedFileOutbound::Reserve(size_t size_bytes) noexcept
+{
+    m_reserved_bytes = 0U;
+    if (!MakeRoom(size_bytes, std::chrono::microseconds::zero()))
+        return Span<uint8_t> {nullptr, size_t {0U}};
+
+    m_reserved_bytes = size_bytes;
+    return Span<uint8_t> {(m_active.GetData() + m_tail_bytes), size_bytes};
+}
+
+//  Private     ========================================================================================================
+
+bool MappedFileOutbound::MakeRoom(size_t size_bytes, std::chrono::microseconds timeout) noexcept
+{
+    if (!m_active.IsMapped() || (size_bytes > m_capacity_bytes))
+        return false;
+
+    if (size_bytes <= (m_capacity_bytes - m_tail_bytes))
+        return true;
+
+    return _detail::spin_until([this]() -> bool { return TryRotate(); }, timeout);
+}
+
+void MappedFileOutbound::Publish(size_t size_bytes) noexcept
+{
+    m_tail_bytes += size_bytes;
+    m_active.GetHeader()->tail_bytes.store(m_tail_bytes, std::memory_order_release);
+}
+
+bool MappedFileOutbound::TryRotate() noexcept
+{
+    if (m_is_locked.exchange(true, std::memory_order_acquire))
+        return false;
+
+    // Normally the standby is already mapped and nothing here touches the filesystem
+    bool const is_ready {UnlockedPrepare()};
+    if (is_ready)
+    {
+        m_active.GetHeader()->is_sealed.store(1U, std::memory_order_release);
+
+        // The retired segment is unmapped by the next PrepareNextSegment
+        m_retired = m_active;
+        m_active  = m_standby;
+        m_standby = _detail::MappedSegment {};
+
+        m_segment_index++;
+        m_tail_bytes = 0U;
+    }
+
+    m_is_locked.store(false, std::memory_order_release);
+    return is_ready;
+}
+
+bool MappedFileOutbound::UnlockedPrepare() noexcept
+{
+    unmap_segment(m_retired);
+
+    if (m_standby.IsMapped())
+        return true;
+
+    char path[kSegmentPathSizeBytes];
+    format_segment_path(path, m_path_prefix, (m_segment_index + 1U));
+    return map_segment_for_writing(path, m_capacity_bytes, m_use_huge_pages, m_standby);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MappedFileInbound constructor definitions           ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+MappedFileInbound::MappedFileInbound(char const* path_prefix, bool use_huge_pages) noexcept :
+    m_path_prefix {}, m_use_huge_pages {use_huge_pages}
+{
+    static_cast<void>(std::snprintf(m_path_prefix, sizeof(m_path_prefix), "%s", path_prefix));
+}
+
+MappedFileInbound::~MappedFileInbound() noexcept
+{
+    unmap_segment(m_segment);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MappedFileInbound method definitions in alphabetical order          ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+MappedFileInbound::Result MappedFileInbound::Consume(size_t size_bytes) noexcept
+{
+    if (InputBytesAvailable() < size_bytes)
+        return Result::Failure();
+
+    m_head_bytes += size_bytes;
+    static_cast<void>(Update());
+    return Result::Success();
+}
+
+size_t MappedFileInbound::GetSegmentIndex() const noexcept
+{
+    return m_segment_index;
+}
+
+size_t MappedFileInbound::InputBytesAvailable() const noexcept
+{
+    if (!m_segment.IsMapped())
+        return 0U;
+
+    MappedFileFormat::Header const* header {m_segment.GetHeader()};
+    size_t const tail_bytes {static_cast<size_t>(std::min(header->tail_bytes.load(std::memory_order_acquire),
+                                                          header->capacity_bytes))};
+    return ((tail_bytes > m_head_bytes) ? (tail_bytes - m_head_bytes) : 0U);
+}
+
+MappedFileInbound::Result MappedFileInbound::Open() noexcept
+{
+    if (m_segment.IsMapped())
+        return Result::Failure();
+
+    char path[kSegmentPathSizeBytes];
+    format_segment_path(path, m_path_prefix, 0U);
+    if (!map_segment_for_reading(path, m_use_huge_pages, m_segment))
+        return Result::Failure();
+
+    m_segment_index = 0U;
+    m_head_bytes    = 0U;
+    return Result::Success();
+}
+
+Span<uint8_t const> MappedFileInbound::Peek(size_t size_bytes) noexcept
+{
+    if (Update() < size_bytes)
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    return Span<uint8_t const> {(m_segment.GetData() + m_head_bytes), size_bytes};
+}
+
+MappedFileInbound::Result MappedFileInbound::Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept
+{
+    if (!_detail::spin_until([&]() -> bool { return (Update() >= rx.size()); }, timeout))
+        return Result::Failure();
+
+    static_cast<void>(std::memcpy(rx.data(), (m_segment.GetData() + m_head_bytes), rx.size()));
+    return Consume(rx.size());
+}
+
+size_t MappedFileInbound::Update() noexcept
+{
+    // The writer seals a segment after its last publish, so a sealed segment with nothing left is finished
+    while (m_segment.IsMapped() && (m_segment.GetHeader()->is_sealed.load(std::memory_order_acquire) != 0U)
+           && (InputBytesAvailable() == 0U))
+    {
+        char path[kSegmentPathSizeBytes];
+        format_segment_path(path, m_path_prefix, (m_segment_index + 1U));
+
+        _detail::MappedSegment next {};
+        if (!map_segment_for_reading(path, m_use_huge_pages, next))
+            break;
+
+        unmap_segment(m_segment);
+        m_segment = next;
+        m_segment_index++;
+        m_head_bytes = 0U;
+    }
+
+    return InputBytesAvailable();
+}
+
+#endif
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,485 @@
+#include <Core/IO/Session/SharedMemory.hpp>
+
+#ifdef NATIVE_SHMIT
+
+#include <Core/IO/Session/Instrumentation.hpp>
+#include <Core/IO/Session/_Detail/Spin.hpp>
+#include <Core/Platform/Clock.hpp>
+#include <Core/Platform/Wait.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__linux__)
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#endif
+
+#endif
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+#ifdef NATIVE_SHMIT
+
+/// @brief Most times that a side will check on a ring being initialized by the other side before giving up
+constexpr static size_t kMaxInitializationChecks {100000U};
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t), "Futex words must be plain 32-bit integers");
+
+/**!
+ * @brief Sleeps while a shared word holds an expected value, until woken or a timeout elapses. Spurious wakeups are
+ * allowed.
+ *
+ * @param[in] word Word in shared memory
+ * @param[in] expected Value the word must still hold to sleep
+ * @param[in] timeout Maximum time to sleep
+ */
+static void futex_wait(std::atomic<uint32_t>& word, uint32_t expected, std::chrono::microseconds timeout) noexcept
+{
+#if defined(__linux__)
+    timespec const duration {static_cast<time_t>(timeout.count() / 1000000),
+                             static_cast<long>((timeout.count() % 1000000) * 1000)};
+    static_cast<void>(syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT, expected, &duration, nullptr,
+                              0));
+#else
+    static_cast<void>(word);     // Avoid unused warning
+    static_cast<void>(expected); // Avoid unused warning
+    static_cast<void>(timeout);  // Avoid unused warning
+    platform::yield();
+#endif
+}
+
+/**!
+ * @brief Wakes a process sleeping on a shared word in futex_wait
+ *
+ * @param[in] word Word in shared memory
+ */
+static void futex_wake(std::atomic<uint32_t>& word) noexcept
+{
+#if defined(__linux__)
+    static_cast<void>(syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE, 1, nullptr, nullptr, 0));
+#else
+    static_cast<void>(word); // Avoid unused warning
+#endif
+}
+
+/**!
+ * @brief Copy bytes in to a ring starting at a position, in up to two pieces split where the ring wraps
+ *
+ * @param[in] ring Shared ring
+ * @param[in] capacity_bytes Size of the ring, a power of two
+ * @param[in] position Position of the first byte
+ * @param[in] src Bytes to copy
+ */
+static void copy_in(uint8_t* ring, size_t capacity_bytes, uint64_t position, Span<uint8_t const> src) noexcept
+{
+    size_t const start {static_cast<size_t>(position & (capacity_bytes - 1U))};
+    size_t const first_size_bytes {std::min(src.size(), (capacity_bytes - start))};
+    static_cast<void>(std::memcpy((ring + start), src.data(), first_size_bytes));
+    static_cast<void>(std::memcpy(ring, (src.data() + first_size_bytes), (src.size() - first_size_bytes)));
+}
+
+/**!
+ * @brief Copy bytes out of a ring starting at a position, in up to two pieces split where the ring wraps
+ *
+ * @param[in] ring Shared ring
+ * @param[in] capacity_bytes Size of the ring, a power of two
+ * @param[in] position Position of the first byte
+ * @param[in] dest Destination, filled in its entirety
+ */
+static void copy_out(uint8_t const* ring, size_t capacity_bytes, uint64_t position, Span<uint8_t> dest) noexcept
+{
+    size_t const start {static_cast<size_t>(position & (capacity_bytes - 1U))};
+    size_t const first_size_bytes {std::min(dest.size(), (capacity_bytes - start))};
+    static_cast<void>(std::memcpy(dest.data(), (ring + start), first_size_bytes));
+    static_cast<void>(std::memcpy((dest.data() + first_size_bytes), ring, (dest.size() - first_size_bytes)));
+}
+
+/**!
+ * @brief Unmaps and closes a ring, if it is mapped
+ *
+ * @param[in,out] ring Ring to unmap, left empty
+ */
+static void unmap_shared_ring(_detail::SharedRing& ring) noexcept
+{
+    if (ring.IsMapped())
+        static_cast<void>(munmap(ring.mapping, ring.mapping_size_bytes));
+
+    if (ring.file_descriptor >= 0)
+        static_cast<void>(close(ring.file_descriptor));
+
+    ring = _detail::SharedRing {};
+}
+
+/**!
+ * @brief Creates or attaches to a named ring. Whichever side gets there first sizes and initializes it, the other
+ * waits for it to be ready.
+ *
+ * @param[in] name Name of the shared memory object
+ * @param[in] capacity_bytes Size of the ring, must be a nonzero power of two
+ * @param[out] ring Mapped ring
+ * @retval true if the ring is mapped and ready
+ * @retval false otherwise, `ring` is left empty
+ */
+static bool map_shared_ring(char const* name, size_t capacity_bytes, _detail::SharedRing& ring) noexcept
+{
+    if ((capacity_bytes == 0U) || ((capacity_bytes & (capacity_bytes - 1U)) != 0U))
+        return false;
+
+    size_t const mapping_size_bytes {SharedMemoryFormat::kHeaderSizeBytes + capacity_bytes};
+
+    ring.file_descriptor = shm_open(name, (O_RDWR | O_CREAT | O_CLOEXEC), 0600);
+    if (ring.file_descriptor < 0)
+        return false;
+
+    // A new object is empty, both sides may size it since they size it the same
+    struct stat status {};
+    if (fstat(ring.file_descriptor, &status) != 0)
+    {
+        unmap_shared_ring(ring);
+        return false;
+    }
+
+    if ((status.st_size == 0) && (ftruncate(ring.file_descriptor, static_cast<off_t>(mapping_size_bytes)) != 0))
+    {
+        unmap_shared_ring(ring);
+        return false;
+    }
+
+    if ((status.st_size != 0) && (static_cast<size_t>(status.st_size) != mapping_size_bytes))
+    {
+        unmap_shared_ring(ring);
+        return false;
+    }
+
+    void* const mapping {
+        mmap(nullptr, mapping_size_bytes, (PROT_READ | PROT_WRITE), MAP_SHARED, ring.file_descriptor, 0)};
+    if (mapping == MAP_FAILED)
+    {
+        unmap_shared_ring(ring);
+        return false;
+    }
+
+    ring.mapping            = static_cast<uint8_t*>(mapping);
+    ring.mapping_size_bytes = mapping_size_bytes;
+
+    // The zero filled object is already a valid, empty ring, only the identity is left to fill in
+    SharedMemoryFormat::Header* header {ring.GetHeader()};
+    uint32_t                    state {SharedMemoryFormat::kUninitialized};
+    if (header->state.compare_exchange_strong(state, SharedMemoryFormat::kInitializing, std::memory_order_acquire))
+    {
+        header->magic          = SharedMemoryFormat::kMagic;
+        header->capacity_bytes = capacity_bytes;
+        header->state.store(SharedMemoryFormat::kReady, std::memory_order_release);
+    }
+
+    for (size_t i = 0U; header->state.load(std::memory_order_acquire) != SharedMemoryFormat::kReady; i++)
+    {
+        if (i >= kMaxInitializationChecks)
+        {
+            unmap_shared_ring(ring);
+            return false;
+        }
+
+        platform::yield();
+    }
+
+    if ((header->magic != SharedMemoryFormat::kMagic) || (header->capacity_bytes != capacity_bytes))
+    {
+        unmap_shared_ring(ring);
+        return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Namespace function definitions      ////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+BinaryResult unlink_shared_memory(char const* name) noexcept
+{
+    return ((shm_unlink(name) == 0) ? BinaryResult::Success() : BinaryResult::Failure());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  SharedMemoryOutbound constructor definitions        ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+SharedMemoryOutbound::SharedMemoryOutbound(char const* name, size_t capacity_bytes) noexcept :
+    m_name {}, m_capacity_bytes {capacity_bytes}
+{
+    static_cast<void>(std::snprintf(m_name, sizeof(m_name), "%s", name));
+}
+
+SharedMemoryOutbound::~SharedMemoryOutbound() noexcept
+{
+    unmap_shared_ring(m_ring);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  SharedMemoryOutbound method definitions in alphabetical order       ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+SharedMemoryOutbound::Result SharedMemoryOutbound::Commit(size_t size_bytes) noexcept
+{
+    if (!m_ring.IsMapped() || (size_bytes > m_reserved_bytes))
+        return Result::Failure();
+
+    m_reserved_bytes = 0U;
+    if (size_bytes > 0U)
+        Publish(m_ring.GetHeader()->head.load(std::memory_order_relaxed) + size_bytes);
+
+    return Result::Success();
+}
+
+SharedMemoryOutbound::Result SharedMemoryOutbound::Open() noexcept
+{
+    if (m_ring.IsMapped())
+        return Result::Failure();
+
+    return (map_shared_ring(m_name, m_capacity_bytes, m_ring) ? Result::Success() : Result::Failure());
+}
+
+size_t SharedMemoryOutbound::OutputBytesAvailable() const noexcept
+{
+    if (!m_ring.IsMapped())
+        return 0U;
+
+    SharedMemoryFormat::Header const* header {m_ring.GetHeader()};
+    uint64_t const                    head {header->head.load(std::memory_order_relaxed)};
+    return static_cast<size_t>(m_capacity_bytes - (head - header->tail.load(std::memory_order_acquire)));
+}
+
+SharedMemoryOutbound::Result SharedMemoryOutbound::Post(Span<uint8_t const>       tx,
+                                                        std::chrono::microseconds timeout) noexcept
+{
+    return Post(Span<Span<uint8_t const> const> {&tx, 1U}, timeout);
+}
+
+SharedMemoryOutbound::Result SharedMemoryOutbound::Post(Span<Span<uint8_t const> const> parts,
+                                                        std::chrono::microseconds       timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t const> const& part : parts)
+        size_bytes += part.size();
+
+    if (!m_ring.IsMapped() || (size_bytes > m_capacity_bytes))
+        return Result::Failure();
+
+    // Only the producer moves the head, so it can be read relaxed
+    SharedMemoryFormat::Header* header {m_ring.GetHeader()};
+    uint64_t const              head {header->head.load(std::memory_order_relaxed)};
+    auto has_space {[&]() -> bool
+                    {
+                        uint64_t const tail {header->tail.load(std::memory_order_acquire)};
+                        return ((m_capacity_bytes - (head - tail)) >= size_bytes);
+                    }};
+    if (!_detail::spin_until(has_space, timeout))
+        return Result::Failure();
+
+    uint64_t position {head};
+    for (Span<uint8_t const> const& part : parts)
+    {
+        copy_in(m_ring.GetRing(), m_capacity_bytes, position, part);
+        position += part.size();
+    }
+
+    Publish(head + size_bytes);
+    return Result::Success();
+}
+
+Span<uint8_t> SharedMemoryOutbound::Reserve(size_t size_bytes) noexcept
+{
+    m_reserved_bytes = 0U;
+    if (!m_ring.IsMapped())
+        return Span<uint8_t> {nullptr, size_t {0U}};
+
+    SharedMemoryFormat::Header const* header {m_ring.GetHeader()};
+    uint64_t const                    head {header->head.load(std::memory_order_relaxed)};
+    size_t const                      start {static_cast<size_t>(head & (m_capacity_bytes - 1U))};
+    uint64_t const                    tail {header->tail.load(std::memory_order_acquire)};
+    size_t const                      free_bytes {static_cast<size_t>(m_capacity_bytes - (head - tail))};
+    if ((free_bytes < size_bytes) || ((m_capacity_bytes - start) < size_bytes))
+        return Span<uint8_t> {nullptr, size_t {0U}};
+
+    m_reserved_bytes = size_bytes;
+    return Span<uint8_t> {(m_ring.GetRing() + start), size_bytes};
+}
+
+//  Private     ========================================================================================================
+
+void SharedMemoryOutbound::Publish(uint64_t head) noexcept
+{
+    SharedMemoryFormat::Header* header {m_ring.GetHeader()};
+    header->head.store(head, std::memory_order_release);
+
+    // Pairs with the fence in WaitForInput, either the consumer sees the new head or this sees it waiting
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (header->is_consumer_waiting.load(std::memory_order_relaxed) != 0U)
+        futex_wake(header->is_consumer_waiting);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  SharedMemoryInbound constructor definitions         ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+SharedMemoryInbound::SharedMemoryInbound(char const* name, size_t capacity_bytes) noexcept :
+    m_name {}, m_capacity_bytes {capacity_bytes}
+{
+    static_cast<void>(std::snprintf(m_name, sizeof(m_name), "%s", name));
+}
+
+SharedMemoryInbound::~SharedMemoryInbound() noexcept
+{
+    unmap_shared_ring(m_ring);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  SharedMemoryInbound method definitions in alphabetical order        ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+SharedMemoryInbound::Result SharedMemoryInbound::Consume(size_t size_bytes) noexcept
+{
+    if (InputBytesAvailable() < size_bytes)
+        return Result::Failure();
+
+    // Release the space back to the producer
+    SharedMemoryFormat::Header* header {m_ring.GetHeader()};
+    header->tail.store((header->tail.load(std::memory_order_relaxed) + size_bytes), std::memory_order_release);
+    return Result::Success();
+}
+
+size_t SharedMemoryInbound::InputBytesAvailable() const noexcept
+{
+    if (!m_ring.IsMapped())
+        return 0U;
+
+    SharedMemoryFormat::Header const* header {m_ring.GetHeader()};
+    uint64_t const                    tail {header->tail.load(std::memory_order_relaxed)};
+    return static_cast<size_t>(header->head.load(std::memory_order_acquire) - tail);
+}
+
+SharedMemoryInbound::Result SharedMemoryInbound::Open() noexcept
+{
+    if (m_ring.IsMapped())
+        return Result::Failure();
+
+    return (map_shared_ring(m_name, m_capacity_bytes, m_ring) ? Result::Success() : Result::Failure());
+}
+
+Span<uint8_t const> SharedMemoryInbound::Peek(size_t size_bytes) noexcept
+{
+    if (InputBytesAvailable() < size_bytes)
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    uint64_t const tail {m_ring.GetHeader()->tail.load(std::memory_order_relaxed)};
+    size_t const   start {static_cast<size_t>(tail & (m_capacity_bytes - 1U))};
+    if ((m_capacity_bytes - start) < size_bytes)
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    return Span<uint8_t const> {(m_ring.GetRing() + start), size_bytes};
+}
+
+SharedMemoryInbound::Result SharedMemoryInbound::Request(Span<uint8_t>             rx,
+                                                         std::chrono::microseconds timeout) noexcept
+{
+    return Request(Span<Span<uint8_t> const> {&rx, 1U}, timeout);
+}
+
+SharedMemoryInbound::Result SharedMemoryInbound::Request(Span<Span<uint8_t> const> parts,
+                                                         std::chrono::microseconds timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t> const& part : parts)
+        size_bytes += part.size();
+
+    if (!m_ring.IsMapped() || (size_bytes > m_capacity_bytes) || !WaitForInput(size_bytes, timeout))
+        return Result::Failure();
+
+    // Only the consumer moves the tail, so it can be read relaxed
+    SharedMemoryFormat::Header* header {m_ring.GetHeader()};
+    uint64_t const              tail {header->tail.load(std::memory_order_relaxed)};
+
+    uint64_t position {tail};
+    for (Span<uint8_t> const& part : parts)
+    {
+        copy_out(m_ring.GetRing(), m_capacity_bytes, position, part);
+        position += part.size();
+    }
+
+    header->tail.store((tail + size_bytes), std::memory_order_release);
+    return Result::Success();
+}
+
+//  Private     ========================================================================================================
+
+bool SharedMemoryInbound::WaitForInput(size_t size_bytes, std::chrono::microseconds timeout) noexcept
+{
+    if (InputBytesAvailable() >= size_bytes)
+        return true;
+
+    if (timeout <= std::chrono::microseconds::zero())
+        return false;
+
+    // Most transmissions land within a short spin, which costs neither side a syscall
+    for (size_t i = 0U; i < kSpinCount; i++)
+    {
+        if (InputBytesAvailable() >= size_bytes)
+            return true;
+    }
+
+    SharedMemoryFormat::Header*       header {m_ring.GetHeader()};
+    platform::Clock::time_point const deadline {platform::Clock::now() + timeout};
+    for (platform::Clock::time_point now = platform::Clock::now(); now < deadline; now = platform::Clock::now())
+    {
+        header->is_consumer_waiting.store(1U, std::memory_order_relaxed);
+
+        // Pairs with the fence in SharedMemoryOutbound::Publish
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (InputBytesAvailable() >= size_bytes)
+        {
+            header->is_consumer_waiting.store(0U, std::memory_order_relaxed);
+            return true;
+        }
+
+        futex_wait(header->is_consumer_waiting, 1U,
+                   std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+        header->is_consumer_waiting.store(0U, std::memory_order_relaxed);
+
+        if (InputBytesAvailable() >= size_bytes)
+            return true;
+    }
+
+    if (InputBytesAvailable() >= size_bytes)
+        return true;
+
+    instrument_count(SessionCounter::kWaitTimeouts);
+    return false;
+}
+
+#endif
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -1,4 +1,5 @@
 #include "Core/IO/Session/Transference.hpp"
+#include "Core/IO/Session/_Detail/Spin.hpp"
 
 namespace shmit
 {
@@ -13,11 +14,21 @@ namespace session
 
 //  Public      ========================================================================================================
 
-Transference::Transference(Span<uint8_t> data) noexcept : m_result {Result::Code::kPending}, m_data {data}
+Transference::Transference(Span<uint8_t> data, CompletionCallback callback, void* context) noexcept :
+    m_result_code {ResultCode::kPending},
+    m_data {data.data(), data.count()},
+    m_writable_data {data},
+    m_callback {callback},
+    m_context {context}
 {
 }
 
-Transference::Transference(Span<uint8_t const> data) noexcept : m_result {Result::Code::kPending}, m_data {data}
+Transference::Transference(Span<uint8_t const> data, CompletionCallback callback, void* context) noexcept :
+    m_result_code {ResultCode::kPending},
+    m_data {data},
+    m_writable_data {nullptr, size_t {0U}},
+    m_callback {callback},
+    m_context {context}
 {
 }
 
@@ -34,12 +45,42 @@ Span<uint8_t const> Transference::GetData() const noexcept
 
 Transference::Result Transference::GetResult() const noexcept
 {
-    return m_result;
+    return Result {m_result_code.load(std::memory_order_acquire)};
+}
+
+Span<uint8_t> Transference::GetWritableData() const noexcept
+{
+    return m_writable_data;
+}
+
+bool Transference::IsPending() const noexcept
+{
+    return (m_result_code.load(std::memory_order_acquire) == ResultCode::kPending);
+}
+
+void Transference::Reset() noexcept
+{
+    m_result_code.store(ResultCode::kPending, std::memory_order_relaxed);
 }
 
 void Transference::SetResult(Result result) noexcept
 {
-    m_result = result;
+    ResultCode code {ResultCode::kPending};
+    if (result.IsSuccess())
+        code = ResultCode::kComplete;
+    else if (result.IsFailure())
+        code = ResultCode::kFailed;
+    m_result_code.store(code, std::memory_order_release);
+
+    if ((code != ResultCode::kPending) && (m_callback != nullptr))
+        m_callback(*this, m_context);
+}
+
+Transference::Result Transference::Wait(std::chrono::microseconds timeout) const noexcept
+{
+    auto is_complete {[this]() -> bool { return !IsPending(); }};
+    static_cast<void>(_detail::spin_until(is_complete, timeout));
+    return GetResult();
 }
 
 } // namespace session
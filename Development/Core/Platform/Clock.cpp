@@ -13,15 +13,32 @@ extern Clock::duration get_platform_clock_duration_since_epoch() noexcept;
 
 Clock::duration get_platform_clock_duration_since_epoch() noexcept
 {
-    return std::chrono::duration_cast<Clock::duration>(std::chrono::system_clock::now().time_since_epoch());
+    // steady_clock reads CLOCK_MONOTONIC, which Linux serves from the TSC through the vDSO without a system call
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::steady_clock::now().time_since_epoch());
 }
 
 #endif
 
+std::atomic<CoarseClock::rep> CoarseClock::s_cached_count {0};
+
 Clock::time_point Clock::now() // Static method
 {
     return time_point {get_platform_clock_duration_since_epoch()};
 }
 
+CoarseClock::time_point CoarseClock::Update() noexcept // Static method
+{
+    rep const count {get_platform_clock_duration_since_epoch().count()};
+
+    // Concurrent updates may race, never let the cached time step backwards
+    rep cached_count {s_cached_count.load(std::memory_order_relaxed)};
+    while ((cached_count < count)
+           && !s_cached_count.compare_exchange_weak(cached_count, count, std::memory_order_relaxed))
+    {
+    }
+
+    return now();
+}
+
 } // namespace platform
 } // namespace shmit
@@ -0,0 +1,64 @@
+#include <Core/Platform/Wait.hpp>
+
+#ifdef NATIVE_SHMIT
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#endif
+
+namespace shmit
+{
+namespace platform
+{
+
+#ifdef NATIVE_SHMIT
+
+/// @brief Threads waiting on any word that hashes to the same bucket share one mutex and condition variable
+struct WaitBucket
+{
+    std::mutex              mutex;
+    std::condition_variable condition;
+};
+
+constexpr static size_t kNumWaitBuckets {16U};
+
+static WaitBucket& get_wait_bucket(std::atomic<uint32_t> const& word) noexcept
+{
+    static WaitBucket buckets[kNumWaitBuckets];
+
+    // Words are at least 4-byte aligned, drop the bits that never vary
+    uintptr_t const address {reinterpret_cast<uintptr_t>(&word)};
+    return buckets[(address >> 2U) % kNumWaitBuckets];
+}
+
+void wait_on(std::atomic<uint32_t> const& word, uint32_t expected, std::chrono::microseconds timeout) noexcept
+{
+    WaitBucket&                  bucket {get_wait_bucket(word)};
+    std::unique_lock<std::mutex> lock {bucket.mutex};
+
+    // Checked under the bucket's lock so that a notification between here and blocking is never lost
+    auto is_changed {[&]() -> bool { return (word.load(std::memory_order_acquire) != expected); }};
+    static_cast<void>(bucket.condition.wait_for(lock, timeout, is_changed));
+}
+
+void notify_all(std::atomic<uint32_t> const& word) noexcept
+{
+    WaitBucket& bucket {get_wait_bucket(word)};
+    {
+        std::lock_guard<std::mutex> lock {bucket.mutex};
+    }
+
+    bucket.condition.notify_all();
+}
+
+void yield() noexcept
+{
+    std::this_thread::yield();
+}
+
+#endif
+
+} // namespace platform
+} // namespace shmit
@@ -0,0 +1,313 @@
+#include <Core/Platform/Wait.hpp>
+#include <Core/System/Executor.hpp>
+
+#ifdef NATIVE_SHMIT
+
+#include <algorithm>
+#include <chrono>
+#include <system_error>
+#include <thread>
+
+#endif
+
+namespace shmit
+{
+namespace system
+{
+
+#ifdef NATIVE_SHMIT
+
+/// @brief Longest an idle worker waits before looking for work again, covers a wakeup missed by a racing submitter
+constexpr static std::chrono::microseconds kIdleWaitTimeout {10000};
+
+/// @brief Worker that the calling thread runs, if any, so that work submitted from a worker stays on its own deque
+struct CurrentWorker
+{
+    Executor const* executor;
+    size_t          index;
+};
+
+static thread_local CurrentWorker current_worker {nullptr, 0U};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Work constructor definitions                ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+Work::Work(Handler handler, void* context) noexcept : m_port_storage {}, m_handler {handler}, m_context {context}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Work method definitions in alphabetical order               ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+bool Work::IsPending() const noexcept
+{
+    return m_is_pending.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Executor constructor definitions            ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+Executor::Executor(size_t worker_count) noexcept : m_worker_count {worker_count}
+{
+    if (m_worker_count == 0U)
+        m_worker_count = std::thread::hardware_concurrency();
+
+    m_worker_count = std::clamp(m_worker_count, size_t {1U}, kMaxWorkerCount);
+}
+
+Executor::~Executor() noexcept
+{
+    Stop();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Executor method definitions in alphabetical order           ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+size_t Executor::GetWorkerCount() const noexcept
+{
+    return m_worker_count;
+}
+
+bool Executor::IsRunning() const noexcept
+{
+    return m_is_running.load(std::memory_order_acquire);
+}
+
+BinaryResult Executor::Start() noexcept
+{
+    if (m_is_running.exchange(true, std::memory_order_acq_rel))
+        return BinaryResult::Failure();
+
+    for (size_t i = 0U; i < m_worker_count; i++)
+    {
+        try
+        {
+            m_workers[i].thread = std::thread {[this, i]() { RunWorker(i); }};
+        }
+        catch (std::system_error const& error)
+        {
+            static_cast<void>(error); // Avoid unused warning
+            Stop();
+            return BinaryResult::Failure();
+        }
+    }
+
+    return BinaryResult::Success();
+}
+
+void Executor::Stop() noexcept
+{
+    m_is_running.store(false, std::memory_order_release);
+    m_generation.fetch_add(1U, std::memory_order_seq_cst);
+    platform::notify_all(m_generation);
+
+    for (size_t i = 0U; i < m_worker_count; i++)
+    {
+        if (m_workers[i].thread.joinable())
+            m_workers[i].thread.join();
+    }
+}
+
+BinaryResult Executor::Submit(Work& work) noexcept
+{
+    if (work.m_is_pending.exchange(true, std::memory_order_acq_rel))
+        return BinaryResult::Failure();
+
+    // Workers keep their own work close, everyone else goes through the submission stack
+    bool const kIsFromWorker {current_worker.executor == this};
+    if (!kIsFromWorker || !m_workers[current_worker.index].deque.Push(&work))
+    {
+        Work* head {m_submitted.load(std::memory_order_relaxed)};
+        do
+        {
+            work.m_next = head;
+        }
+        while (!m_submitted.compare_exchange_weak(head, &work, std::memory_order_release, std::memory_order_relaxed));
+    }
+
+    // Sequentially consistent with the sleeper count, so that either a sleeper sees the work or it is woken
+    m_generation.fetch_add(1U, std::memory_order_seq_cst);
+    if (m_sleeper_count.load(std::memory_order_seq_cst) > 0U)
+        platform::notify_all(m_generation);
+
+    return BinaryResult::Success();
+}
+
+//  Private     ========================================================================================================
+
+Work* Executor::FindWork(size_t worker_index) noexcept
+{
+    Work* work {m_workers[worker_index].deque.Pop()};
+    if (work == nullptr)
+        work = TakeSubmitted(worker_index);
+
+    // Steal from the other workers in turn, starting with the next one along so that thieves spread out
+    for (size_t i = 1U; (work == nullptr) && (i < m_worker_count); i++)
+        work = m_workers[(worker_index + i) % m_worker_count].deque.Steal();
+
+    return work;
+}
+
+void Executor::RunWork(Work& work) noexcept // Static method
+{
+    Work::Handler const kHandler {work.m_handler};
+    void* const         kContext {work.m_context};
+
+    // Cleared first so that the handler may submit its own work item again
+    work.m_is_pending.store(false, std::memory_order_release);
+    kHandler(kContext);
+}
+
+void Executor::RunWorker(size_t worker_index) noexcept
+{
+    current_worker = CurrentWorker {this, worker_index};
+
+    while (m_is_running.load(std::memory_order_acquire))
+    {
+        Work* work {FindWork(worker_index)};
+        if (work != nullptr)
+        {
+            RunWork(*work);
+            continue;
+        }
+
+        // Announce the sleep before the final look for work, a submission after it is sure to wake this worker
+        m_sleeper_count.fetch_add(1U, std::memory_order_seq_cst);
+        uint32_t const kGeneration {m_generation.load(std::memory_order_seq_cst)};
+
+        work = FindWork(worker_index);
+        if ((work == nullptr) && m_is_running.load(std::memory_order_acquire))
+            platform::wait_on(m_generation, kGeneration, kIdleWaitTimeout);
+
+        m_sleeper_count.fetch_sub(1U, std::memory_order_relaxed);
+        if (work != nullptr)
+            RunWork(*work);
+    }
+
+    current_worker = CurrentWorker {nullptr, 0U};
+}
+
+Work* Executor::TakeSubmitted(size_t worker_index) noexcept
+{
+    Work* stack {m_submitted.exchange(nullptr, std::memory_order_acquire)};
+    if (stack == nullptr)
+        return nullptr;
+
+    // Reverse the stack so that work taken in a batch runs in the order it was submitted
+    Work* queue {nullptr};
+    while (stack != nullptr)
+    {
+        Work* const kNext {stack->m_next};
+        stack->m_next = queue;
+        queue         = stack;
+        stack         = kNext;
+    }
+
+    // Keep the oldest to run now, the rest are left on this worker's deque for it and its thieves
+    Work* const kFirst {queue};
+    queue = queue->m_next;
+    if (queue == nullptr)
+        return kFirst;
+
+    WorkDeque& deque {m_workers[worker_index].deque};
+    while ((queue != nullptr) && deque.Push(queue))
+        queue = queue->m_next;
+
+    // Whatever didn't fit goes back on the submission stack
+    while (queue != nullptr)
+    {
+        Work* const kNext {queue->m_next};
+        Work*       head {m_submitted.load(std::memory_order_relaxed)};
+        do
+        {
+            queue->m_next = head;
+        }
+        while (!m_submitted.compare_exchange_weak(head, queue, std::memory_order_release, std::memory_order_relaxed));
+        queue = kNext;
+    }
+
+    // Let idle workers know there is work to steal
+    m_generation.fetch_add(1U, std::memory_order_seq_cst);
+    if (m_sleeper_count.load(std::memory_order_seq_cst) > 0U)
+        platform::notify_all(m_generation);
+
+    return kFirst;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Executor::WorkDeque method definitions in alphabetical order        ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+Work* Executor::WorkDeque::Pop() noexcept
+{
+    int64_t const kBottom {bottom.load(std::memory_order_relaxed) - 1};
+    bottom.store(kBottom, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t top_index {top.load(std::memory_order_relaxed)};
+
+    if (top_index > kBottom)
+    {
+        bottom.store((kBottom + 1), std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    Work* work {slots[static_cast<size_t>(kBottom) & (kDequeCapacity - 1U)].load(std::memory_order_relaxed)};
+    if (top_index == kBottom)
+    {
+        // Last item, race any thief for it
+        if (!top.compare_exchange_strong(top_index, (top_index + 1), std::memory_order_seq_cst,
+                                         std::memory_order_relaxed))
+            work = nullptr;
+
+        bottom.store((kBottom + 1), std::memory_order_relaxed);
+    }
+
+    return work;
+}
+
+bool Executor::WorkDeque::Push(Work* work) noexcept
+{
+    int64_t const kBottom {bottom.load(std::memory_order_relaxed)};
+    int64_t const kTop {top.load(std::memory_order_acquire)};
+    if ((kBottom - kTop) >= static_cast<int64_t>(kDequeCapacity))
+        return false;
+
+    slots[static_cast<size_t>(kBottom) & (kDequeCapacity - 1U)].store(work, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    bottom.store((kBottom + 1), std::memory_order_relaxed);
+    return true;
+}
+
+Work* Executor::WorkDeque::Steal() noexcept
+{
+    int64_t top_index {top.load(std::memory_order_acquire)};
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    int64_t const kBottom {bottom.load(std::memory_order_acquire)};
+    if (top_index >= kBottom)
+        return nullptr;
+
+    Work* const kWork {slots[static_cast<size_t>(top_index) & (kDequeCapacity - 1U)].load(std::memory_order_relaxed)};
+    if (!top.compare_exchange_strong(top_index, (top_index + 1), std::memory_order_seq_cst, std::memory_order_relaxed))
+        return nullptr;
+
+    return kWork;
+}
+
+#endif
+
+} // namespace system
+} // namespace shmit
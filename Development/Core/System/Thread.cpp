@@ -0,0 +1,138 @@
+#include <Core/System/Thread.hpp>
+
+#ifdef NATIVE_SHMIT
+
+#include <algorithm>
+#include <climits>
+#include <sched.h>
+
+#endif
+
+namespace shmit
+{
+namespace system
+{
+
+#ifdef NATIVE_SHMIT
+
+/**!
+ * @brief Sets up the attributes that a thread is created with
+ *
+ * @param[out] attributes Initialized attributes, destroyed by the caller
+ * @param[in] stack Stack the thread runs on
+ * @param[in] options Core affinity and priority
+ * @return True if every attribute was accepted
+ */
+static bool set_thread_attributes(pthread_attr_t& attributes, Span<uint8_t> stack,
+                                  ThreadOptions const& options) noexcept
+{
+    if (pthread_attr_setstack(&attributes, stack.data(), stack.count()) != 0)
+        return false;
+
+    if (options.core != ThreadOptions::kAnyCore)
+    {
+#ifdef __linux__
+        if (options.core >= CPU_SETSIZE)
+            return false;
+
+        cpu_set_t cpu_set;
+        CPU_ZERO(&cpu_set);
+        CPU_SET(options.core, &cpu_set);
+        if (pthread_attr_setaffinity_np(&attributes, sizeof(cpu_set), &cpu_set) != 0)
+            return false;
+#else
+        return false;
+#endif
+    }
+
+    if (options.priority != ThreadOptions::kNormalPriority)
+    {
+        if ((options.priority < 1) || (options.priority > ThreadOptions::kMaxPriority))
+            return false;
+
+        // Clamped in to what the host's SCHED_FIFO offers, Linux offers exactly 1 to 99
+        sched_param parameters {};
+        parameters.sched_priority = std::min(options.priority, sched_get_priority_max(SCHED_FIFO));
+        if ((pthread_attr_setinheritsched(&attributes, PTHREAD_EXPLICIT_SCHED) != 0) ||
+            (pthread_attr_setschedpolicy(&attributes, SCHED_FIFO) != 0) ||
+            (pthread_attr_setschedparam(&attributes, &parameters) != 0))
+            return false;
+    }
+
+    return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Thread constructor definitions              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+Thread::Thread(Span<uint8_t> stack) noexcept : m_stack {stack}
+{
+}
+
+Thread::~Thread() noexcept
+{
+    static_cast<void>(Join());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Thread method definitions in alphabetical order             ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+bool Thread::IsJoinable() const noexcept
+{
+    return m_is_joinable;
+}
+
+BinaryResult Thread::Join() noexcept
+{
+    if (!m_is_joinable)
+        return BinaryResult::Failure();
+
+    if (pthread_join(m_handle, nullptr) != 0)
+        return BinaryResult::Failure();
+
+    m_is_joinable = false;
+    return BinaryResult::Success();
+}
+
+BinaryResult Thread::Start(Entry entry, void* context, ThreadOptions const& options) noexcept
+{
+    if (m_is_joinable || (entry == nullptr) || (m_stack.count() < static_cast<size_t>(PTHREAD_STACK_MIN)))
+        return BinaryResult::Failure();
+
+    m_entry   = entry;
+    m_context = context;
+
+    pthread_attr_t attributes;
+    if (pthread_attr_init(&attributes) != 0)
+        return BinaryResult::Failure();
+
+    bool const kIsCreated {set_thread_attributes(attributes, m_stack, options) &&
+                           (pthread_create(&m_handle, &attributes, &Thread::Run, this) == 0)};
+    static_cast<void>(pthread_attr_destroy(&attributes));
+
+    if (!kIsCreated)
+        return BinaryResult::Failure();
+
+    m_is_joinable = true;
+    return BinaryResult::Success();
+}
+
+//  Private     ========================================================================================================
+
+void* Thread::Run(void* thread) noexcept // Static method
+{
+    Thread const& self {*static_cast<Thread const*>(thread)};
+    self.m_entry(self.m_context);
+    return nullptr;
+}
+
+#endif
+
+} // namespace system
+} // namespace shmit
@@ -0,0 +1,210 @@
+#include <Core/Data/Field.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <type_traits>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  ArrayField tests             ///////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that the count prefix is the smallest type holding the maximum count, and that sizes are upper bounds
+ *
+ */
+TEST(ArrayField, count_type_fits_capacity)
+{
+    ::testing::StaticAssertTypeEq<uint8_t, BlobField<255>::count_type>();
+    ::testing::StaticAssertTypeEq<uint16_t, BlobField<256>::count_type>();
+    ::testing::StaticAssertTypeEq<uint16_t, ArrayField<uint32_t, 1000>::count_type>();
+    ::testing::StaticAssertTypeEq<Span<uint16_t const>, ArrayField<uint16_t const, 4>::value_type>();
+
+    EXPECT_EQ((8U * (1U + 16U)), BlobField<16>::kSizeBits);
+    EXPECT_EQ((4U + (1000U * 4U)), (footprint_size_bytes_v<ArrayField<uint32_t, 1000>>)); // Count padded to alignment
+    EXPECT_EQ(1U, BlobField<16>::kPrefixSizeBytes);
+    EXPECT_EQ(2U, (ArrayField<uint16_t, 8>::kPrefixSizeBytes));
+    EXPECT_EQ(8U, (ArrayField<uint64_t, 300>::kPrefixSizeBytes));
+
+    BlobField<16> const kEmpty {};
+    EXPECT_EQ(0U, kEmpty.value.count());
+    EXPECT_EQ(1U, encoded_size_bytes(kEmpty));
+}
+
+/**
+ * Test that only the occupied elements are encoded, and that decoding points straight in to the source buffer
+ *
+ */
+TEST(ArrayField, encodes_occupied_elements_and_decodes_in_place)
+{
+    uint16_t const          kSamples[] {0x1111, 0x2222, 0x3333};
+    ArrayField<uint16_t, 8> field {Span<uint16_t const> {kSamples}};
+    EXPECT_EQ((2U + sizeof(kSamples)), encoded_size_bytes(field));
+
+    alignas(uint16_t) uint8_t buffer[32U];
+    std::memset(buffer, 0xFF, sizeof(buffer));
+    size_t bits_encoded {0U};
+    ASSERT_TRUE(encode(field, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    EXPECT_EQ((8U * (2U + sizeof(kSamples))), bits_encoded);
+    EXPECT_EQ(3U, buffer[0]);
+    EXPECT_EQ(0U, buffer[1]);                       // Count is padded so that the elements are aligned
+    EXPECT_EQ(0xFF, buffer[2U + sizeof(kSamples)]); // Unoccupied capacity is not written
+
+    ArrayField<uint16_t, 8> decoded {};
+    size_t                  bits_decoded {0U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    ASSERT_EQ(3U, decoded.value.count());
+    EXPECT_EQ(reinterpret_cast<uint16_t const*>(buffer + 2U), decoded.value.data());
+    EXPECT_EQ(0x1111, decoded.value[0]);
+    EXPECT_EQ(0x2222, decoded.value[1]);
+    EXPECT_EQ(0x3333, decoded.value[2]);
+}
+
+/**
+ * Test that a field's own encoding decodes back for element types wider than the count, whether empty or not
+ *
+ */
+TEST(ArrayField, round_trip_wide_elements)
+{
+    uint64_t const          kSamples[] {0x0123456789ABCDEF, 0xFEDCBA9876543210};
+    ArrayField<uint64_t, 4> field {Span<uint64_t const> {kSamples}};
+
+    alignas(uint64_t) uint8_t buffer[64U] {};
+
+    size_t bits_encoded {0U};
+    ASSERT_TRUE(encode(field, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    EXPECT_EQ((8U * (8U + sizeof(kSamples))), bits_encoded);
+
+    ArrayField<uint64_t, 4> decoded {};
+    size_t                  bits_decoded {0U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    ASSERT_EQ(2U, decoded.value.count());
+    EXPECT_EQ(kSamples[0], decoded.value[0]);
+    EXPECT_EQ(kSamples[1], decoded.value[1]);
+
+    ArrayField<uint64_t, 4> const kEmpty {};
+    bits_encoded = 0U;
+    ASSERT_TRUE(encode(kEmpty, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    bits_decoded = 0U;
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    EXPECT_EQ(0U, decoded.value.count());
+}
+
+/**
+ * Test that counts beyond capacity, truncated elements, and misaligned elements are rejected
+ *
+ */
+TEST(ArrayField, rejects_invalid_arrays)
+{
+    uint8_t const kBytes[] {1U, 2U, 3U, 4U, 5U};
+    BlobField<4>  blob {Span<uint8_t const> {kBytes}};
+
+    uint8_t buffer[16U] {};
+    size_t  offset_bits {0U};
+    EXPECT_FALSE(encode(blob, Span<uint8_t> {buffer}, offset_bits).IsSuccess()); // Too many elements
+
+    blob.value = Span<uint8_t const> {kBytes, 4U};
+    EXPECT_FALSE(encode(blob, Span<uint8_t> {buffer, 4U}, offset_bits).IsSuccess()); // Buffer too small
+    EXPECT_EQ(0U, offset_bits);
+
+    uint8_t const kTooMany[] {5U, 0U, 0U, 0U, 0U, 0U};
+    EXPECT_FALSE(decode(Span<uint8_t const> {kTooMany}, offset_bits, blob).IsSuccess());
+
+    uint8_t const kTruncated[] {3U, 0U, 0U};
+    EXPECT_FALSE(decode(Span<uint8_t const> {kTruncated}, offset_bits, blob).IsSuccess());
+
+    // A field placed at an offset that is not aligned for its elements can't be decoded in place
+    alignas(uint32_t) uint8_t const kMisaligned[] {0U, 1U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U, 0U};
+    ArrayField<uint32_t, 2>       words {};
+    offset_bits = 8U;
+    EXPECT_FALSE(decode(Span<uint8_t const> {kMisaligned}, offset_bits, words).IsSuccess());
+    EXPECT_EQ(8U, offset_bits);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Packet tests             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using MessagePacket = packet_t<uint8_t, BlobField<32>, BitField<4>, Bit, uint16_t>;
+
+/**
+ * Test that a Packet holding an ArrayField encodes only its occupied bytes and decodes without copying them
+ *
+ */
+TEST(ArrayField, packet_round_trip)
+{
+    char const    kText[] {"hello"};
+    MessagePacket packet {uint8_t {0x42},
+                          BlobField<32> {Span<uint8_t const> {reinterpret_cast<uint8_t const*>(kText), 5U}},
+                          BitField<4> {0xA}, Bit {true}, uint16_t {0xBEEF}};
+
+    // 1 + (1 + 5) + 1 (bits) + 2
+    EXPECT_EQ(10U, encoded_size_bytes(packet));
+
+    uint8_t buffer[MessagePacket::kSizeBytes] {};
+    size_t  bits_encoded {0U};
+    ASSERT_TRUE(encode(packet, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    EXPECT_EQ(80U, bits_encoded);
+
+    uint8_t const kExpected[] {0x42, 5U, 'h', 'e', 'l', 'l', 'o', 0x1A, 0xEF, 0xBE};
+    EXPECT_EQ(0, std::memcmp(kExpected, buffer, sizeof(kExpected)));
+
+    MessagePacket decoded {};
+    size_t        bits_decoded {0U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    EXPECT_EQ(0x42, packet_field_value<0>(decoded));
+    EXPECT_EQ((buffer + 2U), packet_field_value<1>(decoded).data());
+    EXPECT_EQ(5U, packet_field_value<1>(decoded).count());
+    EXPECT_EQ(0xA, packet_field_value<2>(decoded));
+    EXPECT_TRUE(packet_field_value<3>(decoded));
+    EXPECT_EQ(0xBEEF, packet_field_value<4>(decoded));
+
+    // An array over capacity fails the whole packet without writing
+    uint8_t const kOversized[33U] {};
+    packet_field_value<1>(packet) = Span<uint8_t const> {kOversized};
+    bits_encoded                  = 0U;
+    EXPECT_FALSE(encode(packet, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    EXPECT_EQ(0U, bits_encoded);
+}
+
+using WordsPacket = packet_t<ArrayField<uint32_t, 4>, uint8_t>;
+
+/**
+ * Test that a Packet leading with an ArrayField of words decodes its own encoding, whether the array is empty or not
+ *
+ */
+TEST(ArrayField, packet_round_trip_wide_elements)
+{
+    uint32_t const kWords[] {0xDEADBEEF, 0xCAFEF00D, 0x01234567};
+    WordsPacket    packet {ArrayField<uint32_t, 4> {Span<uint32_t const> {kWords}}, uint8_t {0x42}};
+
+    alignas(uint32_t) uint8_t buffer[WordsPacket::kSizeBytes] {};
+    size_t                    bits_encoded {0U};
+    ASSERT_TRUE(encode(packet, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    EXPECT_EQ((8U * (4U + sizeof(kWords) + 1U)), bits_encoded);
+
+    WordsPacket decoded {};
+    size_t      bits_decoded {0U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    ASSERT_EQ(3U, packet_field_value<0>(decoded).count());
+    EXPECT_EQ(0xCAFEF00D, packet_field_value<0>(decoded)[1]);
+    EXPECT_EQ(0x42, packet_field_value<1>(decoded));
+
+    packet_field_value<0>(packet) = Span<uint32_t const> {nullptr, size_t {0U}};
+    bits_encoded                  = 0U;
+    ASSERT_TRUE(encode(packet, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    bits_decoded = 0U;
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(0U, packet_field_value<0>(decoded).count());
+    EXPECT_EQ(0x42, packet_field_value<1>(decoded));
+}
@@ -0,0 +1,40 @@
+#include <Core/Data/Crc.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Standard check input for CRC catalogues
+static uint8_t const kCheckInput[] {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  CRC tests                       ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Crc, crc32_check_value)
+{
+    EXPECT_EQ(crc32(Span<uint8_t const> {kCheckInput}), 0xCBF43926U);
+    EXPECT_EQ(crc32(Span<uint8_t const> {kCheckInput, size_t {0U}}), 0x00000000U);
+}
+
+TEST(Crc, crc32_update_in_pieces_matches_whole)
+{
+    Span<uint8_t const> const input {kCheckInput};
+
+    uint32_t state {kCrc32Initial};
+    state = crc32_update(state, input.subspan(0U, 2U));
+    state = crc32_update(state, input.subspan(2U, 5U));
+    state = crc32_update(state, input.subspan(7U));
+    EXPECT_EQ(crc32_finalize(state), crc32(input));
+}
+
+TEST(Crc, crc8_check_value)
+{
+    EXPECT_EQ(crc8(Span<uint8_t const> {kCheckInput}), 0xF4U);
+}
@@ -0,0 +1,158 @@
+#include <Core/Data/Delta.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test packets             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using InnerPacket     = packet_t<Bit, BitField<15>>;
+using TelemetryPacket = packet_t<uint8_t, BitField<7>, ConstBitField<3>, Bit, uint16_t, InnerPacket, BitField<36>,
+                                 int32_t, double>;
+
+static TelemetryPacket make_telemetry_packet()
+{
+    return TelemetryPacket {uint8_t {0xA5},
+                            BitField<7> {0x5A},
+                            ConstBitField<3> {0x5},
+                            Bit {true},
+                            uint16_t {0xBEEF},
+                            InnerPacket {Bit {false}, BitField<15> {0x1234}},
+                            BitField<36> {0xFEDCBA987},
+                            int32_t {-12345},
+                            double {3.25}};
+}
+
+/// @brief Checks that every decodable field of two packets holds the same value, ConstBitFields are never decoded
+static void expect_packets_equal(TelemetryPacket const& expected, TelemetryPacket const& actual)
+{
+    InnerPacket const& kExpectedInner {packet_field_value<5>(expected)};
+    InnerPacket const& kActualInner {packet_field_value<5>(actual)};
+
+    EXPECT_EQ(packet_field_value<0>(expected), packet_field_value<0>(actual));
+    EXPECT_EQ(packet_field_value<1>(expected), packet_field_value<1>(actual));
+    EXPECT_EQ(packet_field_value<3>(expected), packet_field_value<3>(actual));
+    EXPECT_EQ(packet_field_value<4>(expected), packet_field_value<4>(actual));
+    EXPECT_EQ(packet_field_value<0>(kExpectedInner), packet_field_value<0>(kActualInner));
+    EXPECT_EQ(packet_field_value<1>(kExpectedInner), packet_field_value<1>(kActualInner));
+    EXPECT_EQ(packet_field_value<6>(expected), packet_field_value<6>(actual));
+    EXPECT_EQ(packet_field_value<7>(expected), packet_field_value<7>(actual));
+    EXPECT_EQ(packet_field_value<8>(expected), packet_field_value<8>(actual));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Delta tests          ///////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that a delta against an empty reference carries every differing field and reproduces the packet
+ *
+ */
+TEST(Delta, first_delta_reproduces_packet)
+{
+    TelemetryPacket const kPacket {make_telemetry_packet()};
+
+    uint8_t sender_reference[TelemetryPacket::kSizeBytes] {};
+    uint8_t receiver_baseline[TelemetryPacket::kSizeBytes] {};
+
+    uint8_t buffer[delta_max_size_bytes_v<TelemetryPacket> + 1U];
+    size_t  bits_encoded {1U};
+    ASSERT_TRUE(encode_delta(kPacket, Span<uint8_t> {sender_reference}, Span<uint8_t> {buffer}, bits_encoded)
+                    .IsSuccess());
+
+    TelemetryPacket decoded {};
+    size_t          bits_decoded {1U};
+    ASSERT_TRUE(decode_delta(Span<uint8_t const> {buffer}, bits_decoded, Span<uint8_t> {receiver_baseline}, decoded)
+                    .IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    expect_packets_equal(kPacket, decoded);
+
+    // Both ends now hold the packet's full encoding
+    uint8_t expected[TelemetryPacket::kSizeBytes] {};
+    size_t  offset_bits {0U};
+    ASSERT_TRUE(encode(kPacket, Span<uint8_t> {expected}, offset_bits).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(expected, sender_reference, sizeof(expected)));
+    EXPECT_EQ(0, std::memcmp(expected, receiver_baseline, sizeof(expected)));
+}
+
+/**
+ * Test that a delta carries only the changed fields, packed behind the presence bitmap
+ *
+ */
+TEST(Delta, carries_only_changed_fields)
+{
+    TelemetryPacket packet {make_telemetry_packet()};
+
+    uint8_t sender_reference[TelemetryPacket::kSizeBytes] {};
+    uint8_t receiver_baseline[TelemetryPacket::kSizeBytes] {};
+    uint8_t buffer[delta_max_size_bytes_v<TelemetryPacket>];
+
+    size_t          bits_encoded {0U};
+    size_t          bits_decoded {0U};
+    TelemetryPacket decoded {};
+    ASSERT_TRUE(encode_delta(packet, Span<uint8_t> {sender_reference}, Span<uint8_t> {buffer}, bits_encoded)
+                    .IsSuccess());
+    ASSERT_TRUE(decode_delta(Span<uint8_t const> {buffer}, bits_decoded, Span<uint8_t> {receiver_baseline}, decoded)
+                    .IsSuccess());
+
+    // Change a bit-packed field and a byte-aligned field
+    packet_field_value<1>(packet) = 0x11;
+    packet_field_value<7>(packet) = 42;
+
+    bits_encoded = 0U;
+    ASSERT_TRUE(encode_delta(packet, Span<uint8_t> {sender_reference}, Span<uint8_t> {buffer}, bits_encoded)
+                    .IsSuccess());
+
+    constexpr size_t kPresenceSizeBytes {delta_presence_size_bytes_v<TelemetryPacket>};
+    constexpr size_t kChangedSizeBits {7U + 32U};
+    EXPECT_EQ((8U * (kPresenceSizeBytes + math::bytes_to_contain(kChangedSizeBits))), bits_encoded);
+    EXPECT_EQ(((1U << 1U) | (1U << 7U)), buffer[0]);
+    EXPECT_EQ(0U, buffer[1]);
+    EXPECT_EQ(0x11, (buffer[kPresenceSizeBytes] & 0x7F));
+
+    bits_decoded = 0U;
+    ASSERT_TRUE(decode_delta(Span<uint8_t const> {buffer}, bits_decoded, Span<uint8_t> {receiver_baseline}, decoded)
+                    .IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    expect_packets_equal(packet, decoded);
+
+    // An unchanged packet is just the bitmap
+    bits_encoded = 0U;
+    ASSERT_TRUE(encode_delta(packet, Span<uint8_t> {sender_reference}, Span<uint8_t> {buffer}, bits_encoded)
+                    .IsSuccess());
+    EXPECT_EQ((8U * kPresenceSizeBytes), bits_encoded);
+}
+
+/**
+ * Test that buffers too small for the delta are rejected without touching the reference or baseline
+ *
+ */
+TEST(Delta, rejects_short_buffers)
+{
+    TelemetryPacket const kPacket {make_telemetry_packet()};
+
+    uint8_t reference[TelemetryPacket::kSizeBytes] {};
+    uint8_t small_buffer[delta_presence_size_bytes_v<TelemetryPacket> + 1U];
+    size_t  offset_bits {0U};
+    EXPECT_FALSE(encode_delta(kPacket, Span<uint8_t> {reference}, Span<uint8_t> {small_buffer}, offset_bits)
+                     .IsSuccess());
+    EXPECT_EQ(0U, offset_bits);
+
+    uint8_t const kEmpty[TelemetryPacket::kSizeBytes] {};
+    EXPECT_EQ(0, std::memcmp(kEmpty, reference, sizeof(reference)));
+
+    // A bitmap announcing more fields than the buffer holds
+    uint8_t const   kTruncated[delta_presence_size_bytes_v<TelemetryPacket> + 1U] {0xFF, 0x01, 0x00};
+    uint8_t         baseline[TelemetryPacket::kSizeBytes] {};
+    TelemetryPacket decoded {};
+    EXPECT_FALSE(decode_delta(Span<uint8_t const> {kTruncated}, offset_bits, Span<uint8_t> {baseline}, decoded)
+                     .IsSuccess());
+    EXPECT_EQ(0, std::memcmp(kEmpty, baseline, sizeof(baseline)));
+}
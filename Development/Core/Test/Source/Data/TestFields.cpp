@@ -223,6 +223,43 @@ TEST(Field, decode_at_offset)
     ASSERT_EQ(kFinalOffsetBits, bits_decoded);
 }
 
+/**
+ * Test that Fields with an explicit byte order are encoded and decoded in that order regardless of the host
+ *
+ */
+TEST(Field, byte_order)
+{
+    constexpr uint32_t kValue {0x12345678};
+    uint8_t const      big_endian_bytes[4U] {0x12, 0x34, 0x56, 0x78};
+    uint8_t const      little_endian_bytes[4U] {0x78, 0x56, 0x34, 0x12};
+
+    uint8_t       bytes[4U];
+    Span<uint8_t> byte_span {bytes, 4U};
+
+    // Big endian
+    size_t bits_encoded {0U};
+    EXPECT_TRUE(encode(BigEndianField<uint32_t> {kValue}, byte_span, bits_encoded).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(big_endian_bytes, bytes, 4U));
+
+    size_t                   bits_decoded {0U};
+    BigEndianField<uint32_t> big_endian_decoded;
+    EXPECT_TRUE(decode(Span<uint8_t const> {bytes, 4U}, bits_decoded, big_endian_decoded).IsSuccess());
+    EXPECT_EQ(kValue, big_endian_decoded.value);
+
+    // Little endian
+    bits_encoded = 0U;
+    EXPECT_TRUE(encode(LittleEndianField<uint32_t> {kValue}, byte_span, bits_encoded).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(little_endian_bytes, bytes, 4U));
+
+    bits_decoded = 0U;
+    LittleEndianField<uint32_t> little_endian_decoded;
+    EXPECT_TRUE(decode(Span<uint8_t const> {bytes, 4U}, bits_decoded, little_endian_decoded).IsSuccess());
+    EXPECT_EQ(kValue, little_endian_decoded.value);
+
+    // Native order is the default
+    ::testing::StaticAssertTypeEq<Field<uint32_t>, Field<uint32_t, ByteOrder::kNative>>();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //  BitField tests              ////////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -594,6 +631,53 @@ TEST(BitField, decode_super_byte_values)
     ASSERT_EQ(math::bits_to_contain(kEncodingSizeBytes), bits_decoded);
 }
 
+/**
+ * Test that wide BitFields survive a round trip through a byte buffer at every bit offset within a byte, leaving the
+ * surrounding bits untouched
+ *
+ */
+TEST(BitField, wide_values_at_every_offset)
+{
+    using FortyBitField = BitField<40>;
+    using WordBitField  = BitField<64>;
+
+    constexpr typename FortyBitField::value_type kFortyValue {0xA5C3E1F00FULL};
+    constexpr typename WordBitField::value_type  kWordValue {0xF00DFACEDEADBEEFULL};
+
+    constexpr size_t kEncodingSizeBits {7U + FortyBitField::kSizeBits + WordBitField::kSizeBits};
+    constexpr size_t kEncodingSizeBytes {math::bytes_to_contain(kEncodingSizeBits) + 1U};
+
+    for (size_t offset = 0U; offset < math::bits_to_contain(1U); offset++)
+    {
+        // Fill the destination with ones so that any disturbance of neighboring bits is detectable
+        uint8_t       bytes[kEncodingSizeBytes];
+        Span<uint8_t> byte_span {bytes, kEncodingSizeBytes};
+        static_cast<void>(std::memset(bytes, 0xFF, kEncodingSizeBytes));
+
+        size_t        bits_encoded {offset};
+        FortyBitField forty {kFortyValue};
+        WordBitField  word {kWordValue};
+        ASSERT_TRUE(encode(forty, byte_span, bits_encoded).IsSuccess()) << "Offset " << offset;
+        ASSERT_TRUE(encode(word, byte_span, bits_encoded).IsSuccess()) << "Offset " << offset;
+        ASSERT_EQ((offset + FortyBitField::kSizeBits + WordBitField::kSizeBits), bits_encoded);
+
+        // Leading and trailing bits must still be set
+        uint8_t const kLeadingMask {static_cast<uint8_t>((1U << offset) - 1U)};
+        EXPECT_EQ(kLeadingMask, (bytes[0] & kLeadingMask)) << "Offset " << offset;
+        EXPECT_EQ(0xFF, bytes[kEncodingSizeBytes - 1U]) << "Offset " << offset;
+
+        size_t              bits_decoded {offset};
+        FortyBitField       forty_decoded {};
+        WordBitField        word_decoded {};
+        Span<uint8_t const> const_byte_span {bytes, kEncodingSizeBytes};
+        ASSERT_TRUE(decode(const_byte_span, bits_decoded, forty_decoded).IsSuccess()) << "Offset " << offset;
+        ASSERT_TRUE(decode(const_byte_span, bits_decoded, word_decoded).IsSuccess()) << "Offset " << offset;
+        EXPECT_EQ(bits_encoded, bits_decoded);
+        EXPECT_EQ(kFortyValue, forty_decoded.value) << "Offset " << offset;
+        EXPECT_EQ(kWordValue, word_decoded.value) << "Offset " << offset;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //  ConstBitField tests             ////////////////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
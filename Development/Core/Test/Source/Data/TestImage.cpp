@@ -0,0 +1,109 @@
+#include <Core/Data/Image.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+
+using namespace shmit;
+using namespace shmit::data;
+
+/// @brief Encodes a Packet at runtime through encode, and checks that it matches its constant image byte for byte
+template<typename PacketT>
+static ::testing::AssertionResult matches_runtime_encode(PacketT const& packet, PacketImage<PacketT> const& image)
+{
+    uint8_t buffer[PacketT::kSizeBytes] {};
+    size_t  offset_bits {0U};
+    if (!encode(packet, Span<uint8_t> {buffer}, offset_bits).IsSuccess())
+        return ::testing::AssertionFailure() << "Runtime encode failed";
+
+    for (size_t i = 0U; i < PacketT::kSizeBytes; i++)
+    {
+        if (buffer[i] != image[i])
+            return ::testing::AssertionFailure() << "Byte " << i << " differs: runtime " << static_cast<int>(buffer[i])
+                                                 << ", image " << static_cast<int>(image[i]);
+    }
+    return ::testing::AssertionSuccess();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  encode_to_array tests           ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Data_Image, bit_fields)
+{
+    using FunSizePacket = packet_t<Bit, Bit, Bit, Bit, Bit>;
+
+    constexpr FunSizePacket kPacket {true, false, true, false, true};
+    constexpr auto          kImage {encode_to_array(kPacket)};
+    static_assert(kImage.size() == 1U);
+    static_assert(kImage[0] == 0x15);
+    EXPECT_TRUE(matches_runtime_encode(kPacket, kImage));
+}
+
+TEST(Data_Image, loosely_packed)
+{
+    using LooselyPackedPacket = packet_t<Bit, uint8_t, bool, BitField<14>, uint16_t>;
+
+    constexpr LooselyPackedPacket kPacket {false, uint8_t {255}, true, uint16_t {0x1FFF}, uint16_t {0xA55A}};
+    constexpr auto                kImage {encode_to_array(kPacket)};
+    static_assert(kImage.size() == LooselyPackedPacket::kSizeBytes);
+    static_assert(kImage[1] == 0xFF);
+    EXPECT_TRUE(matches_runtime_encode(kPacket, kImage));
+}
+
+TEST(Data_Image, byte_order_and_floating_point)
+{
+    using Command = packet_t<uint8_t, BigEndianField<uint32_t>, LittleEndianField<uint16_t>, float, ConstBitField<4>,
+                             BitField<12>, int16_t>;
+
+    constexpr Command kCommand {uint8_t {0x42}, uint32_t {0x01020304}, uint16_t {0xBEEF}, 1.5f, uint8_t {0xA},
+                                uint16_t {0x123}, int16_t {-2}};
+    constexpr auto    kImage {encode_to_array(kCommand)};
+
+    static_assert(kImage[0] == 0x42);
+    constexpr size_t kBigStart {packet_field_layout_v<1U, Command>.offset_bits / 8U};
+    static_assert((kImage[kBigStart] == 0x01) && (kImage[kBigStart + 3U] == 0x04)); // Most significant byte first
+
+    constexpr size_t kLittleStart {packet_field_layout_v<2U, Command>.offset_bits / 8U};
+    static_assert((kImage[kLittleStart] == 0xEF) && (kImage[kLittleStart + 1U] == 0xBE)); // Least significant first
+    EXPECT_TRUE(matches_runtime_encode(kCommand, kImage));
+}
+
+TEST(Data_Image, nested_packet)
+{
+    using Inner = packet_t<Bit, BitField<15>>;
+    using Outer = packet_t<uint8_t, Inner, BitField<3>, uint32_t>;
+
+    constexpr Outer kPacket {uint8_t {7}, Inner {true, uint16_t {0x7FFE}}, uint8_t {5}, uint32_t {0xCAFEF00D}};
+    constexpr auto  kImage {encode_to_array(kPacket)};
+    EXPECT_TRUE(matches_runtime_encode(kPacket, kImage));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  decode_from_array tests         ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Data_Image, round_trip)
+{
+    using Inner  = packet_t<Bit, BitField<15>>;
+    using Record = packet_t<BigEndianField<int32_t>, Inner, BitField<5>, Bit, double>;
+
+    constexpr Record kRecord {int32_t {-123456}, Inner {false, uint16_t {0x1234}}, uint8_t {0x1F}, true, -0.25};
+    constexpr Record kDecoded {decode_from_array<Record>(encode_to_array(kRecord))};
+
+    static_assert(packet_field_value<0U>(kDecoded) == -123456);
+    static_assert(packet_field_value<1>(packet_field_value<1U>(kDecoded)) == 0x1234);
+    static_assert(packet_field_value<2U>(kDecoded) == 0x1F);
+    static_assert(packet_field_value<3U>(kDecoded));
+    static_assert(packet_field_value<4U>(kDecoded) == -0.25);
+
+    // A constant image decodes the same through the runtime path
+    constexpr auto kImage {encode_to_array(kRecord)};
+    Record         decoded {};
+    size_t         offset_bits {0U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {kImage.data(), kImage.size()}, offset_bits, decoded).IsSuccess());
+    EXPECT_EQ(packet_field_value<0U>(decoded), -123456);
+    EXPECT_EQ(packet_field_value<4U>(decoded), -0.25);
+}
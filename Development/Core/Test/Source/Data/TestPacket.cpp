@@ -408,10 +408,185 @@ TEST(Packet, accumulated_size)
     EXPECT_EQ(kDoubleNestedPacketPacketExpectedSizeBytes, kDoubleNestedPacketPacketSizeBytes);
 }
 
+/**
+ * Test that the compile-time layout of a Packet places each field at the expected offset with the expected padding
+ *
+ */
+TEST(Packet, field_layout)
+{
+    // LooselyPackedPacket, see the diagram above
+    constexpr auto kLooselyPackedPacketLayout {packet_layout_v<LooselyPackedPacket>};
+    ASSERT_EQ(LooselyPackedPacket::kNumFields, kLooselyPackedPacketLayout.size());
+
+    constexpr size_t kExpectedOffsets[] {0U, 8U, 16U, 24U, 40U};
+    constexpr size_t kExpectedSizes[] {1U, 8U, 8U, 14U, 16U};
+    constexpr size_t kExpectedPadding[] {0U, 7U, 0U, 0U, 2U};
+    for (size_t i = 0U; i < LooselyPackedPacket::kNumFields; i++)
+    {
+        EXPECT_EQ(kExpectedOffsets[i], kLooselyPackedPacketLayout[i].offset_bits) << "Field " << i;
+        EXPECT_EQ(kExpectedSizes[i], kLooselyPackedPacketLayout[i].size_bits) << "Field " << i;
+        EXPECT_EQ(kExpectedPadding[i], kLooselyPackedPacketLayout[i].padding_bits) << "Field " << i;
+    }
+
+    // NestedPacketPacket, nested packet must start on a byte boundary
+    static_assert(packet_field_layout_v<4U, NestedPacketPacket>.offset_bits == 24U, "Nested packet offset mismatch");
+    static_assert(packet_field_layout_v<4U, NestedPacketPacket>.padding_bits == 7U, "Nested packet padding mismatch");
+    static_assert(packet_field_layout<5U, NestedPacketPacket>::kOffsetBits == 40U, "Trailing field offset mismatch");
+}
+
+/**
+ * Test that a Packet encoded at an offset lands at the following byte boundary and leaves surrounding bytes untouched
+ *
+ */
+TEST(Packet, encode_at_offset)
+{
+    constexpr size_t kBufferSizeBytes {TightlyPackedPacket::kSizeBytes + 2U};
+    uint8_t          encode_buffer[kBufferSizeBytes];
+    Span<uint8_t>    encode_span {encode_buffer, kBufferSizeBytes};
+    std::memset(encode_buffer, 0U, kBufferSizeBytes);
+    encode_buffer[0]                    = 0x01;
+    encode_buffer[kBufferSizeBytes - 1] = 0xEE;
+
+    size_t bits_encoded {1U};
+    ASSERT_TRUE(encode(tightly_packed_packet, encode_span, bits_encoded).IsSuccess());
+    EXPECT_EQ((8U + kTightlyPackedPacketExpectedSizeBits), bits_encoded);
+    EXPECT_EQ(0x01, encode_buffer[0]);
+    EXPECT_EQ(0xEE, encode_buffer[kBufferSizeBytes - 1]);
+
+    Span<uint8_t> expected_span {tightly_packed_packet_expected_bytes, kTightlyPackedPacketExpectedSizeBytes};
+    EXPECT_TRUE(byte_spans_match(expected_span, encode_span.subspan(1U, kTightlyPackedPacketExpectedSizeBytes)));
+
+    // A buffer one byte too short must be rejected before anything is written
+    size_t        short_bits_encoded {1U};
+    Span<uint8_t> short_span {encode_buffer, TightlyPackedPacket::kSizeBytes};
+    EXPECT_TRUE(encode(tightly_packed_packet, short_span, short_bits_encoded).IsFailure());
+    EXPECT_EQ(1U, short_bits_encoded);
+}
+
 /**
  * Test that Packet fields can be initialized with arguments on construction
  *
  */
+TEST(Packet, coalesced_field_runs)
+{
+    // Byte-aligned Fields coalesce in to runs, BitFields and nested Packets stand alone
+    static_assert(_detail::packet_field_run_end<0U, 5U, LooselyPackedPacket>::value == 1U, "");
+    static_assert(_detail::packet_field_run_end<1U, 5U, LooselyPackedPacket>::value == 3U, "");
+    static_assert(_detail::packet_field_run_end<3U, 5U, LooselyPackedPacket>::value == 4U, "");
+    static_assert(_detail::packet_field_run_end<0U, 2U, DoubleNestedPacket>::value == 1U, "");
+
+    using ScalarPacket = packet_t<uint16_t, uint32_t, uint8_t, int64_t>;
+    static_assert(_detail::packet_field_run_end<0U, 4U, ScalarPacket>::value == 4U, "");
+
+    ScalarPacket const packet {uint16_t {0x1234}, uint32_t {0xDEADBEEF}, uint8_t {0x5A}, int64_t {-2}};
+
+    // Expected bytes are each value copied in place, back to back
+    uint8_t  expected_buffer[ScalarPacket::kSizeBytes];
+    uint16_t first {0x1234};
+    uint32_t second {0xDEADBEEF};
+    uint8_t  third {0x5A};
+    int64_t  fourth {-2};
+    std::memcpy(expected_buffer, &first, sizeof(first));
+    std::memcpy((expected_buffer + 2U), &second, sizeof(second));
+    std::memcpy((expected_buffer + 6U), &third, sizeof(third));
+    std::memcpy((expected_buffer + 7U), &fourth, sizeof(fourth));
+
+    uint8_t       encode_buffer[ScalarPacket::kSizeBytes];
+    Span<uint8_t> encode_span {encode_buffer, ScalarPacket::kSizeBytes};
+    size_t        bits_encoded {0U};
+    ASSERT_TRUE(encode(packet, encode_span, bits_encoded).IsSuccess());
+    EXPECT_EQ(ScalarPacket::kSizeBits, bits_encoded);
+
+    Span<uint8_t> expected_span {expected_buffer, ScalarPacket::kSizeBytes};
+    EXPECT_TRUE(byte_spans_match(expected_span, encode_span));
+
+    ScalarPacket        decoded;
+    Span<uint8_t const> decode_span {encode_buffer, ScalarPacket::kSizeBytes};
+    size_t              bits_decoded {0U};
+    ASSERT_TRUE(decode(decode_span, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(ScalarPacket::kSizeBits, bits_decoded);
+    EXPECT_EQ(0x1234, packet_field_value<0>(decoded));
+    EXPECT_EQ(0xDEADBEEF, packet_field_value<1>(decoded));
+    EXPECT_EQ(0x5A, packet_field_value<2>(decoded));
+    EXPECT_EQ(-2, packet_field_value<3>(decoded));
+}
+
+TEST(Packet, bit_groups)
+{
+    // Consecutive bit-packed fields group together for as long as they fit in one working word
+    static_assert(_detail::packet_field_run_end<0U, 5U, FunSizePacket>::value == 5U, "");
+    static_assert(_detail::packet_field_run_end<1U, 6U, TightlyPackedPacket>::value == 3U, "");
+    static_assert(_detail::packet_field_run_end<4U, 6U, TightlyPackedPacket>::value == 6U, "");
+    static_assert(_detail::packet_field_run_end<0U, 4U, JunkInTheTrunkPacket>::value == 2U, "");
+
+    // Groups starting mid-byte must leave room for the shift
+    using SpilledPacket = packet_t<Bit, BitField<62>, BitField<3>, ConstBitField<4>, BitField<7>>;
+    static_assert(_detail::packet_field_run_end<0U, 5U, SpilledPacket>::value == 2U, "");
+    static_assert(_detail::packet_field_run_end<2U, 5U, SpilledPacket>::value == 5U, "");
+
+    SpilledPacket const packet {Bit {true}, BitField<62> {0xABCDEF012345678}, BitField<3> {0x5},
+                                ConstBitField<4> {0xA}, BitField<7> {0x3C}};
+
+    // Reference footprint is built one field at a time
+    uint8_t expected_buffer[SpilledPacket::kSizeBytes];
+    std::memset(expected_buffer, 0U, SpilledPacket::kSizeBytes);
+    _detail::encode_field_at(Bit {true}, expected_buffer, packet_layout_v<SpilledPacket>[0].offset_bits);
+    _detail::encode_field_at(BitField<62> {0xABCDEF012345678}, expected_buffer,
+                             packet_layout_v<SpilledPacket>[1].offset_bits);
+    _detail::encode_field_at(BitField<3> {0x5}, expected_buffer, packet_layout_v<SpilledPacket>[2].offset_bits);
+    _detail::encode_field_at(ConstBitField<4> {0xA}, expected_buffer, packet_layout_v<SpilledPacket>[3].offset_bits);
+    _detail::encode_field_at(BitField<7> {0x3C}, expected_buffer, packet_layout_v<SpilledPacket>[4].offset_bits);
+
+    uint8_t       encode_buffer[SpilledPacket::kSizeBytes];
+    Span<uint8_t> encode_span {encode_buffer, SpilledPacket::kSizeBytes};
+    size_t        bits_encoded {0U};
+    ASSERT_TRUE(encode(packet, encode_span, bits_encoded).IsSuccess());
+
+    Span<uint8_t> expected_span {expected_buffer, SpilledPacket::kSizeBytes};
+    EXPECT_TRUE(byte_spans_match(expected_span, encode_span));
+
+    SpilledPacket       decoded;
+    Span<uint8_t const> decode_span {encode_buffer, SpilledPacket::kSizeBytes};
+    size_t              bits_decoded {0U};
+    ASSERT_TRUE(decode(decode_span, bits_decoded, decoded).IsSuccess());
+    EXPECT_TRUE(packet_field_value<0>(decoded));
+    EXPECT_EQ(0xABCDEF012345678U, packet_field_value<1>(decoded));
+    EXPECT_EQ(0x5U, packet_field_value<2>(decoded));
+    EXPECT_EQ(0x0U, packet_field_value<3>(decoded));
+    EXPECT_EQ(0x3CU, packet_field_value<4>(decoded));
+}
+
+TEST(Packet, byte_order)
+{
+    using MixedPacket =
+        packet_t<BigEndianField<uint16_t>, uint16_t, Bit, LittleEndianField<int32_t>, BigEndianField<float>>;
+    static_assert(_detail::packet_field_run_end<0U, 5U, MixedPacket>::value == 1U, "");
+
+    MixedPacket const packet {BigEndianField<uint16_t> {0xABCD}, uint16_t {0x1234}, Bit {true},
+                              LittleEndianField<int32_t> {0x01020304}, BigEndianField<float> {1.5F}};
+
+    uint8_t       encode_buffer[MixedPacket::kSizeBytes];
+    Span<uint8_t> encode_span {encode_buffer, MixedPacket::kSizeBytes};
+    size_t        bits_encoded {0U};
+    ASSERT_TRUE(encode(packet, encode_span, bits_encoded).IsSuccess());
+
+    EXPECT_EQ(0xAB, encode_buffer[0]);
+    EXPECT_EQ(0xCD, encode_buffer[1]);
+    EXPECT_EQ(0x04, encode_buffer[5]);
+    EXPECT_EQ(0x01, encode_buffer[8]);
+    EXPECT_EQ(0x3F, encode_buffer[9]); // 1.5F is 0x3FC00000
+    EXPECT_EQ(0xC0, encode_buffer[10]);
+
+    MixedPacket         decoded;
+    Span<uint8_t const> decode_span {encode_buffer, MixedPacket::kSizeBytes};
+    size_t              bits_decoded {0U};
+    ASSERT_TRUE(decode(decode_span, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(0xABCD, packet_field_value<0>(decoded));
+    EXPECT_EQ(0x1234, packet_field_value<1>(decoded));
+    EXPECT_EQ(0x01020304, packet_field_value<3>(decoded));
+    EXPECT_EQ(1.5F, packet_field_value<4>(decoded));
+}
+
 TEST(Packet, initializing_constructor)
 {
     // FunSizePacket
@@ -737,3 +912,205 @@ TEST(Packet, decode)
 // Encode Packet comprised of BitFields
 
 // Encode Packet comprised of a combination
+
+TEST(Packet, batch)
+{
+    constexpr size_t kNumPackets {4U};
+    constexpr size_t kPacketSizeBytes {TightlyPackedPacket::kSizeBytes};
+
+    TightlyPackedPacket packets[kNumPackets] {tightly_packed_packet, tightly_packed_packet, tightly_packed_packet,
+                                              tightly_packed_packet};
+    packet_field_value<0>(packets[1]) = 0x42;
+    packet_field_value<3>(packets[3]) = 0x1234;
+
+    // One byte of lead-in and room for exactly three packets
+    constexpr size_t kBufferSizeBytes {1U + (3U * kPacketSizeBytes) + (kPacketSizeBytes - 1U)};
+    uint8_t          encode_buffer[kBufferSizeBytes];
+    std::memset(encode_buffer, 0U, kBufferSizeBytes);
+    Span<uint8_t> encode_span {encode_buffer, kBufferSizeBytes};
+
+    size_t bits_encoded {1U};
+    EXPECT_EQ(3U, encode_batch(Span<TightlyPackedPacket const> {packets, kNumPackets}, encode_span, bits_encoded));
+    EXPECT_EQ(8U * (1U + (3U * kPacketSizeBytes)), bits_encoded);
+
+    // Each packet in the batch matches what a single encode would produce at the same position
+    for (size_t i = 0U; i < 3U; i++)
+    {
+        uint8_t       single_buffer[kPacketSizeBytes];
+        Span<uint8_t> single_span {single_buffer, kPacketSizeBytes};
+        size_t        single_bits_encoded {0U};
+        ASSERT_TRUE(encode(packets[i], single_span, single_bits_encoded).IsSuccess());
+        EXPECT_TRUE(byte_spans_match(single_span, encode_span.subspan(1U + (i * kPacketSizeBytes), kPacketSizeBytes)));
+    }
+
+    TightlyPackedPacket decoded[kNumPackets];
+    Span<uint8_t const> decode_span {encode_buffer, kBufferSizeBytes};
+    size_t              bits_decoded {1U};
+    EXPECT_EQ(3U, decode_batch(decode_span, bits_decoded, Span<TightlyPackedPacket> {decoded, kNumPackets}));
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    for (size_t i = 0U; i < 3U; i++)
+        EXPECT_TRUE(packets_match(packets[i], decoded[i]));
+
+    // Nothing fits, nothing is processed and the offset is left alone
+    size_t        short_bits_encoded {1U};
+    Span<uint8_t> short_span {encode_buffer, kPacketSizeBytes};
+    EXPECT_EQ(0U, encode_batch(Span<TightlyPackedPacket const> {packets, kNumPackets}, short_span, short_bits_encoded));
+    EXPECT_EQ(1U, short_bits_encoded);
+}
+
+
+// Fields of the same sizes held in presented order, sorted by alignment, and sorted and aligned to a cache line
+// Layouts are given for Packets already spelled out in their sanitized form, packet_t would instantiate them too early
+using PresentedOrderPacket = packet_t<uint8_t, uint64_t, uint8_t, uint32_t, Bit, uint16_t>;
+using SortedPacket = Packet<Field<int8_t>, Field<uint64_t>, Field<uint8_t>, Field<uint32_t>, Bit, Field<uint16_t>>;
+using CacheAlignedPacket = Packet<Field<int8_t>, Field<int64_t>, Field<uint8_t>, Field<uint32_t>, Bit, Field<uint16_t>>;
+
+template<>
+struct shmit::data::packet_storage_layout<SortedPacket>
+{
+    constexpr static PacketStorageLayout value {true, 0U};
+};
+
+template<>
+struct shmit::data::packet_storage_layout<CacheAlignedPacket>
+{
+    constexpr static PacketStorageLayout value {true, 64U};
+};
+
+template<typename PacketT>
+static PacketT make_storage_layout_packet()
+{
+    PacketT packet {};
+    packet_field_value<0>(packet) = 0x12;
+    packet_field_value<1>(packet) = 0x0123456789ABCDEF;
+    packet_field_value<2>(packet) = 0x34;
+    packet_field_value<3>(packet) = 0x56789ABC;
+    packet_field_value<4>(packet) = true;
+    packet_field_value<5>(packet) = 0xDEF0;
+    return packet;
+}
+
+TEST(Packet, storage_layout)
+{
+    EXPECT_FALSE(PresentedOrderPacket::kStorageLayout.is_sorted_by_alignment);
+    EXPECT_TRUE(SortedPacket::kStorageLayout.is_sorted_by_alignment);
+
+    // Sorting removes the padding between fields, alignment pads the Packet out to a whole cache line
+    EXPECT_EQ(32U, sizeof(PresentedOrderPacket));
+    EXPECT_EQ(24U, sizeof(SortedPacket));
+    EXPECT_EQ(64U, alignof(CacheAlignedPacket));
+    EXPECT_EQ(64U, sizeof(CacheAlignedPacket));
+
+    // Storage is ordered by descending alignment
+    SortedPacket sorted {make_storage_layout_packet<SortedPacket>()};
+    auto const   address_of = [](auto const& value) { return reinterpret_cast<uintptr_t>(&value); };
+    EXPECT_LT(address_of(packet_field_value<1>(sorted)), address_of(packet_field_value<3>(sorted)));
+    EXPECT_LT(address_of(packet_field_value<3>(sorted)), address_of(packet_field_value<5>(sorted)));
+    EXPECT_LT(address_of(packet_field_value<5>(sorted)), address_of(packet_field_value<0>(sorted)));
+
+    // The encoded footprint is unchanged
+    PresentedOrderPacket const kPresented {make_storage_layout_packet<PresentedOrderPacket>()};
+    CacheAlignedPacket const   kCacheAligned {make_storage_layout_packet<CacheAlignedPacket>()};
+    static_assert(PresentedOrderPacket::kSizeBytes == SortedPacket::kSizeBytes);
+    static_assert(PresentedOrderPacket::kSizeBytes == CacheAlignedPacket::kSizeBytes);
+
+    constexpr size_t kSizeBytes {PresentedOrderPacket::kSizeBytes};
+    uint8_t          presented_buffer[kSizeBytes] {};
+    uint8_t          sorted_buffer[kSizeBytes] {};
+    uint8_t          cache_aligned_buffer[kSizeBytes] {};
+
+    size_t presented_bits {0U};
+    size_t sorted_bits {0U};
+    size_t cache_aligned_bits {0U};
+    ASSERT_TRUE(encode(kPresented, Span<uint8_t> {presented_buffer}, presented_bits).IsSuccess());
+    ASSERT_TRUE(encode(sorted, Span<uint8_t> {sorted_buffer}, sorted_bits).IsSuccess());
+    ASSERT_TRUE(encode(kCacheAligned, Span<uint8_t> {cache_aligned_buffer}, cache_aligned_bits).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(presented_buffer, sorted_buffer, kSizeBytes));
+    EXPECT_EQ(0, std::memcmp(presented_buffer, cache_aligned_buffer, kSizeBytes));
+
+    SortedPacket decoded {};
+    size_t       decoded_bits {0U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {presented_buffer}, decoded_bits, decoded).IsSuccess());
+    EXPECT_TRUE(packets_match(sorted, decoded));
+}
+
+TEST(Packet, wire_identical)
+{
+    // Naturally aligned Fields in native byte order with nothing between them
+    using WireIdenticalPacket = packet_t<uint64_t, uint32_t, uint16_t, uint8_t, int8_t>;
+    static_assert(is_wire_identical_v<WireIdenticalPacket>);
+
+    // Padding in memory, bit-packing, byte swapping, sorted storage, and nested packets all need encoding
+    static_assert(!is_wire_identical_v<PresentedOrderPacket>);
+    static_assert(!is_wire_identical_v<SortedPacket>);
+    static_assert(!is_wire_identical_v<packet_t<uint32_t, uint8_t>>);
+    static_assert(!is_wire_identical_v<packet_t<uint8_t, uint32_t>>);
+    static_assert(!is_wire_identical_v<packet_t<uint32_t, BitField<32>>>);
+    static_assert(!is_wire_identical_v<packet_t<uint16_t, Field<uint16_t, ByteOrder::kBig>>>);
+    static_assert(!is_wire_identical_v<packet_t<WireIdenticalPacket>>);
+    static_assert(!is_wire_identical_v<uint32_t>);
+
+    constexpr size_t kNumPackets {3U};
+    constexpr size_t kSizeBytes {WireIdenticalPacket::kSizeBytes};
+    static_assert(kSizeBytes == 16U);
+
+    WireIdenticalPacket packets[kNumPackets] {};
+    for (size_t i = 0U; i < kNumPackets; i++)
+    {
+        packet_field_value<0>(packets[i]) = 0x0123456789ABCDEF + i;
+        packet_field_value<1>(packets[i]) = static_cast<uint32_t>(0x89ABCDEF + i);
+        packet_field_value<2>(packets[i]) = static_cast<uint16_t>(0x4567 + i);
+        packet_field_value<3>(packets[i]) = static_cast<uint8_t>(0x23 + i);
+        packet_field_value<4>(packets[i]) = static_cast<int8_t>(-1 - static_cast<int>(i));
+    }
+
+    // A single encode lays the fields out exactly as they sit in memory
+    uint8_t single_buffer[1U + kSizeBytes] {};
+    size_t  bits_encoded {1U};
+    ASSERT_TRUE(encode(packets[0], Span<uint8_t> {single_buffer}, bits_encoded).IsSuccess());
+    EXPECT_EQ(8U * (1U + kSizeBytes), bits_encoded);
+    EXPECT_EQ(0, std::memcmp((single_buffer + 1U), &packets[0], kSizeBytes));
+
+    WireIdenticalPacket decoded {};
+    size_t              bits_decoded {1U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {single_buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    EXPECT_TRUE(packets_match(packets[0], decoded));
+
+    // Batches are one block
+    uint8_t batch_buffer[kNumPackets * kSizeBytes] {};
+    size_t  batch_bits_encoded {0U};
+    EXPECT_EQ(kNumPackets, encode_batch(Span<WireIdenticalPacket const> {packets, kNumPackets},
+                                        Span<uint8_t> {batch_buffer}, batch_bits_encoded));
+    EXPECT_EQ(0, std::memcmp(batch_buffer, packets, sizeof(batch_buffer)));
+
+    WireIdenticalPacket batch_decoded[kNumPackets] {};
+    size_t              batch_bits_decoded {0U};
+    EXPECT_EQ(kNumPackets, decode_batch(Span<uint8_t const> {batch_buffer}, batch_bits_decoded,
+                                        Span<WireIdenticalPacket> {batch_decoded, kNumPackets}));
+    for (size_t i = 0U; i < kNumPackets; i++)
+        EXPECT_TRUE(packets_match(packets[i], batch_decoded[i]));
+}
+
+TEST(Packet, static_extent)
+{
+    // Fits are proven at compile time, results match the bounds-checked path
+    uint8_t expected[LooselyPackedPacket::kSizeBytes] {};
+    size_t  bits_encoded {0U};
+    ASSERT_TRUE(encode(loosely_packed_packet, Span<uint8_t> {expected}, bits_encoded).IsSuccess());
+
+    uint8_t buffer[LooselyPackedPacket::kSizeBytes + 2U] {};
+    encode(loosely_packed_packet, Span<uint8_t, sizeof(buffer)> {buffer});
+    EXPECT_EQ(0, std::memcmp(expected, buffer, LooselyPackedPacket::kSizeBytes));
+
+    LooselyPackedPacket decoded {};
+    decode(Span<uint8_t const, sizeof(buffer)> {buffer}, decoded);
+    EXPECT_TRUE(packets_match(loosely_packed_packet, decoded));
+
+    // A dynamic span is checked once and narrowed to the packet's footprint
+    Span<uint8_t const> dynamic_span {buffer};
+    ASSERT_GE(dynamic_span.count(), LooselyPackedPacket::kSizeBytes);
+    LooselyPackedPacket narrowed {};
+    decode(dynamic_span.first<LooselyPackedPacket::kSizeBytes>(), narrowed);
+    EXPECT_TRUE(packets_match(loosely_packed_packet, narrowed));
+}
@@ -0,0 +1,101 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/Data/PacketColumns.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test packets             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using SamplePacket  = packet_t<uint8_t, BitField<3>, ConstBitField<5>, int32_t, double>;
+using SampleColumns = PacketColumns<8U, uint8_t, BitField<3>, ConstBitField<5>, int32_t, double>;
+
+constexpr static size_t kNumSamples {6U};
+
+static void encode_samples(uint8_t (&buffer)[kNumSamples * SamplePacket::kSizeBytes])
+{
+    size_t offset_bits {0U};
+    for (size_t i = 0U; i < kNumSamples; i++)
+    {
+        SamplePacket const kSample {uint8_t {static_cast<uint8_t>(i)}, BitField<3> {static_cast<uint8_t>(i % 8U)},
+                                    ConstBitField<5> {0x15}, int32_t {static_cast<int32_t>(i) * -100},
+                                    double {static_cast<double>(i) * 0.5}};
+        ASSERT_TRUE(encode(kSample, Span<uint8_t> {buffer}, offset_bits).IsSuccess());
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PacketColumns tests          ///////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that every field of every Packet decodes in to its own contiguous column
+ *
+ */
+TEST(PacketColumns, decode_into_columns)
+{
+    ::testing::StaticAssertTypeEq<uint8_t, SampleColumns::column_value_t<2>>();
+
+    uint8_t buffer[kNumSamples * SamplePacket::kSizeBytes] {};
+    encode_samples(buffer);
+
+    static SampleColumns columns {};
+    size_t               offset_bits {0U};
+    EXPECT_EQ(kNumSamples, decode_into_columns(Span<uint8_t const> {buffer}, offset_bits, columns));
+    EXPECT_EQ((sizeof(buffer) * 8U), offset_bits);
+    ASSERT_EQ(kNumSamples, columns.Count());
+
+    Span<int32_t const> const kValues {static_cast<SampleColumns const&>(columns).GetColumn<3>()};
+    Span<double> const        kReadings {columns.GetColumn<4>()};
+    ASSERT_EQ(kNumSamples, kValues.count());
+    EXPECT_EQ((kValues.data() + 1U), &kValues[1]); // Columns are contiguous
+    EXPECT_EQ(-1500, std::accumulate(kValues.begin(), kValues.end(), 0));
+    EXPECT_DOUBLE_EQ(7.5, std::accumulate(kReadings.begin(), kReadings.end(), 0.0));
+
+    for (size_t i = 0U; i < kNumSamples; i++)
+    {
+        EXPECT_EQ(i, columns.GetColumn<0>()[i]);
+        EXPECT_EQ((i % 8U), columns.GetColumn<1>()[i]);
+        EXPECT_EQ(0x15, columns.GetColumn<2>()[i]); // Bits found on the wire
+    }
+}
+
+/**
+ * Test that rows are appended across calls until capacity is reached, and that clearing drops every row
+ *
+ */
+TEST(PacketColumns, decode_into_columns_respects_capacity)
+{
+    uint8_t buffer[kNumSamples * SamplePacket::kSizeBytes] {};
+    encode_samples(buffer);
+
+    static SampleColumns columns {};
+
+    // Only whole packets are decoded
+    size_t offset_bits {0U};
+    EXPECT_EQ(1U, decode_into_columns(Span<uint8_t const> {buffer, (SamplePacket::kSizeBytes * 2U) - 1U}, offset_bits,
+                                      columns));
+    EXPECT_EQ((SamplePacket::kSizeBits), offset_bits);
+
+    offset_bits = 0U;
+    EXPECT_EQ(kNumSamples, decode_into_columns(Span<uint8_t const> {buffer}, offset_bits, columns));
+    EXPECT_EQ((SampleColumns::kCapacity - kNumSamples - 1U),
+              decode_into_columns(Span<uint8_t const> {buffer}, (offset_bits = 0U), columns));
+    EXPECT_EQ(SampleColumns::kCapacity, columns.Count());
+    EXPECT_EQ(0U, decode_into_columns(Span<uint8_t const> {buffer}, (offset_bits = 0U), columns));
+
+    EXPECT_EQ(0U, columns.GetColumn<0>()[0]);
+    EXPECT_EQ(0U, columns.GetColumn<0>()[1]);
+    EXPECT_EQ(5U, columns.GetColumn<0>()[6]);
+    EXPECT_EQ(0U, columns.GetColumn<0>()[7]);
+
+    columns.Clear();
+    EXPECT_EQ(0U, columns.Count());
+    EXPECT_EQ(0U, columns.GetColumn<4>().count());
+}
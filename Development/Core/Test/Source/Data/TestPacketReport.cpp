@@ -0,0 +1,81 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/Data/PacketReport.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test packets             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using DensePacket  = packet_t<uint32_t, uint16_t, uint16_t>;
+using PaddedPacket = packet_t<uint8_t, uint32_t>;
+using BitsPacket   = packet_t<BitField<3>, BitField<5>, uint8_t, BitField<4>>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PacketReport tests       ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that a packet laid out as it is encoded reports one run, no padding and a single-copy encode
+ *
+ */
+TEST(PacketReport, dense_packet)
+{
+    constexpr PacketReport kReport {packet_report_v<DensePacket>};
+
+    EXPECT_EQ(3U, kReport.field_count);
+    EXPECT_EQ(8U, kReport.wire_bytes);
+    EXPECT_EQ(0U, kReport.wire_padding_bits);
+    EXPECT_EQ(8U, kReport.memory_bytes);
+    EXPECT_EQ(0U, kReport.memory_padding_bytes);
+    EXPECT_EQ(1U, kReport.run_count);
+    EXPECT_EQ(0U, kReport.bit_group_count);
+    EXPECT_TRUE(kReport.is_wire_identical);
+}
+
+/**
+ * Test that in-memory padding is reported while the encoded footprint stays packed
+ *
+ */
+TEST(PacketReport, padded_packet)
+{
+    constexpr PacketReport kReport {packet_report_v<PaddedPacket>};
+
+    EXPECT_EQ(5U, kReport.wire_bytes);
+    EXPECT_EQ(0U, kReport.wire_padding_bits);
+    EXPECT_EQ(sizeof(PaddedPacket), kReport.memory_bytes);
+    EXPECT_EQ((sizeof(PaddedPacket) - 5U), kReport.memory_padding_bytes);
+    EXPECT_FALSE(kReport.is_wire_identical);
+}
+
+/**
+ * Test that BitField groups are counted, and that a lone BitField is a run of its own
+ *
+ */
+TEST(PacketReport, bit_groups)
+{
+    constexpr PacketReport kReport {packet_report_v<BitsPacket>};
+
+    EXPECT_EQ(4U, kReport.field_count);
+    EXPECT_EQ(3U, kReport.wire_bytes);
+    EXPECT_EQ(4U, kReport.wire_padding_bits); // 20 bits rounded up to 3 bytes
+    EXPECT_EQ(3U, kReport.run_count);
+    EXPECT_EQ(1U, kReport.bit_group_count);
+}
+
+/**
+ * Test that budgets are checked limit by limit, at compile time
+ *
+ */
+TEST(PacketReport, budget)
+{
+    static_assert(is_within_budget(packet_report_v<DensePacket>, PacketBudget {8U, 8U, 0U}), "DensePacket fits");
+    static_assert(is_within_budget(packet_report_v<DensePacket>, PacketBudget {}), "Budgets default to unbounded");
+    static_assert(!is_within_budget(packet_report_v<DensePacket>, PacketBudget {7U}), "Wire size is limited");
+    static_assert(!is_within_budget(packet_report_v<PaddedPacket>, PacketBudget {8U, 8U, 0U}), "Padding is limited");
+
+    EXPECT_FALSE(is_within_budget(packet_report_v<BitsPacket>, PacketBudget {PacketBudget::kUnbounded, 1U}));
+}
@@ -0,0 +1,122 @@
+#include "Help.hpp"
+
+#include <Core/Data/Packet.hpp>
+#include <Core/Data/PacketView.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <type_traits>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test packets             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using InnerPacket  = packet_t<Bit, BitField<15>>;
+using RoutedPacket =
+    packet_t<uint8_t, BitField<7>, ConstBitField<3>, Bit, uint16_t, InnerPacket, BitField<36>, int32_t>;
+
+static RoutedPacket const routed_packet {uint8_t {0xA5},
+                                         BitField<7> {0x5A},
+                                         ConstBitField<3> {0x5},
+                                         Bit {true},
+                                         uint16_t {0xBEEF},
+                                         InnerPacket {Bit {false}, BitField<15> {0x1234}},
+                                         BitField<36> {0xFEDCBA987},
+                                         int32_t {-12345}};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PacketView tests             ///////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that every field read through a view matches the packet that was encoded
+ *
+ */
+TEST(PacketView, reads_fields_on_demand)
+{
+    uint8_t       buffer[RoutedPacket::kSizeBytes + 1U];
+    Span<uint8_t> encode_span {buffer, RoutedPacket::kSizeBytes + 1U};
+    size_t        bits_encoded {1U};
+    ASSERT_TRUE(encode(routed_packet, encode_span, bits_encoded).IsSuccess());
+
+    PacketView<uint8_t, BitField<7>, ConstBitField<3>, Bit, uint16_t, InnerPacket, BitField<36>, int32_t> view;
+    Span<uint8_t const> decode_span {buffer, RoutedPacket::kSizeBytes + 1U};
+    size_t              bits_decoded {1U};
+    ASSERT_TRUE(decode(decode_span, bits_decoded, view).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    EXPECT_EQ((buffer + 1U), view.Footprint().data());
+
+    EXPECT_EQ(packet_field_value<0>(routed_packet), packet_field_value<0>(view));
+    EXPECT_EQ(packet_field_value<1>(routed_packet), packet_field_value<1>(view));
+    EXPECT_EQ(packet_field_value<2>(routed_packet), packet_field_value<2>(view)); // Wire bits, not a default value
+    EXPECT_EQ(packet_field_value<3>(routed_packet), packet_field_value<3>(view));
+    EXPECT_EQ(packet_field_value<4>(routed_packet), packet_field_value<4>(view));
+    EXPECT_EQ(packet_field_value<6>(routed_packet), packet_field_value<6>(view));
+    EXPECT_EQ(packet_field_value<7>(routed_packet), packet_field_value<7>(view));
+
+    InnerPacket const inner {packet_field_value<5>(view)};
+    EXPECT_FALSE(packet_field_value<0>(inner));
+    EXPECT_EQ(0x1234U, packet_field_value<1>(inner));
+}
+
+/**
+ * Test that a view can't be bound to a buffer too short to hold the footprint
+ *
+ */
+TEST(PacketView, bounds)
+{
+    uint8_t             buffer[RoutedPacket::kSizeBytes];
+    Span<uint8_t const> short_span {buffer, RoutedPacket::kSizeBytes - 1U};
+    size_t              bits_decoded {0U};
+
+    PacketView<uint8_t, BitField<7>, ConstBitField<3>, Bit, uint16_t, InnerPacket, BitField<36>, int32_t> view;
+    EXPECT_TRUE(decode(short_span, bits_decoded, view).IsFailure());
+    EXPECT_EQ(0U, bits_decoded);
+    EXPECT_EQ(0U, view.Footprint().count());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PacketRef tests             ////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that writing a field through a reference changes only that field's bits
+ *
+ */
+TEST(PacketRef, writes_fields_in_place)
+{
+    uint8_t buffer[RoutedPacket::kSizeBytes];
+    std::memset(buffer, 0U, RoutedPacket::kSizeBytes);
+    Span<uint8_t> span {buffer, RoutedPacket::kSizeBytes};
+    size_t        bits_encoded {0U};
+    ASSERT_TRUE(encode(routed_packet, span, bits_encoded).IsSuccess());
+
+    PacketRef<uint8_t, BitField<7>, ConstBitField<3>, Bit, uint16_t, InnerPacket, BitField<36>, int32_t> ref;
+    size_t bits_decoded {0U};
+    ASSERT_TRUE(decode(span, bits_decoded, ref).IsSuccess());
+
+    set_packet_field_value<1>(ref, 0x11);
+    set_packet_field_value<3>(ref, false);
+    set_packet_field_value<6>(ref, 0x123456789);
+    EXPECT_EQ(0x11U, packet_field_value<1>(ref));
+    EXPECT_FALSE(packet_field_value<3>(ref));
+    EXPECT_EQ(0x123456789U, packet_field_value<6>(ref));
+
+    // Re-encoding the expected packet from scratch must produce the same bytes
+    RoutedPacket expected {routed_packet};
+    packet_field_value<1>(expected) = 0x11;
+    packet_field_value<3>(expected) = false;
+    packet_field_value<6>(expected) = 0x123456789;
+
+    uint8_t expected_buffer[RoutedPacket::kSizeBytes];
+    std::memset(expected_buffer, 0U, RoutedPacket::kSizeBytes);
+    Span<uint8_t> expected_span {expected_buffer, RoutedPacket::kSizeBytes};
+    size_t        expected_bits_encoded {0U};
+    ASSERT_TRUE(encode(expected, expected_span, expected_bits_encoded).IsSuccess());
+    EXPECT_TRUE(byte_spans_match(expected_span, span));
+}
@@ -0,0 +1,172 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/Data/PacketColumns.hpp>
+#include <Core/Data/ParallelDecode.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test packets             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using RecordPacket = packet_t<uint32_t, BitField<12>, Bit, BitField<3>, int16_t>;
+
+constexpr static size_t kNumRecords {4099U}; // Not a multiple of any partition count used below
+
+static RecordPacket make_record(size_t i)
+{
+    return RecordPacket {uint32_t {static_cast<uint32_t>(i)}, BitField<12> {static_cast<uint16_t>(i & 0xFFFU)},
+                         Bit {(i % 2U) == 0U}, BitField<3> {static_cast<uint8_t>(i % 8U)},
+                         int16_t {static_cast<int16_t>(-static_cast<int16_t>(i % 1000U))}};
+}
+
+static void expect_record(RecordPacket const& packet, size_t i)
+{
+    EXPECT_EQ(i, packet_field_value<0>(packet));
+    EXPECT_EQ((i & 0xFFFU), packet_field_value<1>(packet));
+    EXPECT_EQ(((i % 2U) == 0U), packet_field_value<2>(packet));
+    EXPECT_EQ((i % 8U), packet_field_value<3>(packet));
+    EXPECT_EQ(-static_cast<int16_t>(i % 1000U), packet_field_value<4>(packet));
+}
+
+/// @brief Records laid back to back one byte in to the buffer
+static uint8_t* get_record_buffer()
+{
+    static uint8_t buffer[1U + (kNumRecords * RecordPacket::kSizeBytes)] {};
+    static bool    is_filled {false};
+    if (!is_filled)
+    {
+        size_t offset_bits {8U};
+        for (size_t i = 0U; i < kNumRecords; i++)
+            static_cast<void>(encode(make_record(i), Span<uint8_t> {buffer}, offset_bits));
+        is_filled = true;
+    }
+    return buffer;
+}
+
+constexpr static size_t kRecordBufferSizeBytes {1U + (kNumRecords * RecordPacket::kSizeBytes)};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Partition tests          ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that partitions are balanced and together cover every record exactly once
+ *
+ */
+TEST(ParallelDecode, partitions_cover_every_record)
+{
+    for (size_t partition_count : {1U, 3U, 7U, 64U})
+    {
+        size_t expected_begin {0U};
+        for (size_t i = 0U; i < partition_count; i++)
+        {
+            DecodePartition const kRange {decode_partition_range(kNumRecords, i, partition_count)};
+            EXPECT_EQ(expected_begin, kRange.begin);
+            EXPECT_LE((kRange.end - kRange.begin), ((kNumRecords / partition_count) + 1U));
+            EXPECT_GE((kRange.end - kRange.begin), (kNumRecords / partition_count));
+            expected_begin = kRange.end;
+        }
+        EXPECT_EQ(kNumRecords, expected_begin);
+
+        DecodePartition const kOutOfRange {decode_partition_range(kNumRecords, partition_count, partition_count)};
+        EXPECT_EQ(kOutOfRange.begin, kOutOfRange.end);
+    }
+}
+
+/**
+ * Test that decoding every partition of a batch, in any order, matches a sequential decode
+ *
+ */
+TEST(ParallelDecode, decode_batch_partition)
+{
+    static RecordPacket packets[kNumRecords] {};
+    Span<uint8_t const> buffer {get_record_buffer(), kRecordBufferSizeBytes};
+
+    constexpr size_t kPartitionCount {5U};
+    size_t           num_decoded {0U};
+    for (size_t i = kPartitionCount; i > 0U; i--)
+        num_decoded += decode_batch_partition(buffer, 8U, Span<RecordPacket> {packets}, (i - 1U), kPartitionCount);
+
+    EXPECT_EQ(kNumRecords, num_decoded);
+    for (size_t i = 0U; i < kNumRecords; i++)
+        expect_record(packets[i], i);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Parallel decode tests        ///////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that a batch decoded across threads matches a sequential decode, and stops at the destination's capacity
+ *
+ */
+TEST(ParallelDecode, decode_batch_parallel)
+{
+    static RecordPacket packets[kNumRecords] {};
+    Span<uint8_t const> buffer {get_record_buffer(), kRecordBufferSizeBytes};
+
+    size_t offset_bits {8U};
+    EXPECT_EQ(kNumRecords, decode_batch_parallel(buffer, offset_bits, Span<RecordPacket> {packets}, 4U));
+    EXPECT_EQ((kRecordBufferSizeBytes * 8U), offset_bits);
+    for (size_t i = 0U; i < kNumRecords; i++)
+        expect_record(packets[i], i);
+
+    offset_bits = 8U;
+    EXPECT_EQ(1000U, decode_batch_parallel(buffer, offset_bits, Span<RecordPacket> {packets, 1000U}));
+    EXPECT_EQ((8U * (1U + (1000U * RecordPacket::kSizeBytes))), offset_bits);
+}
+
+/**
+ * Test that records at known offsets decode across threads, skipping records that run past the buffer
+ *
+ */
+TEST(ParallelDecode, decode_records_parallel)
+{
+    static RecordPacket packets[kNumRecords] {};
+    static size_t       offsets[kNumRecords] {};
+    Span<uint8_t const> buffer {get_record_buffer(), kRecordBufferSizeBytes};
+
+    // Decode the records in reverse order, as if scanned out of a framed log
+    for (size_t i = 0U; i < kNumRecords; i++)
+        offsets[i] = 1U + ((kNumRecords - 1U - i) * RecordPacket::kSizeBytes);
+    offsets[kNumRecords - 1U] = kRecordBufferSizeBytes - 1U;
+
+    EXPECT_EQ((kNumRecords - 1U),
+              decode_records_parallel(buffer, Span<size_t const> {offsets}, Span<RecordPacket> {packets}, 3U));
+    for (size_t i = 0U; i < (kNumRecords - 1U); i++)
+        expect_record(packets[i], (kNumRecords - 1U - i));
+}
+
+/**
+ * Test that Packets decoded across threads in to columns land in the rows following any already held
+ *
+ */
+TEST(ParallelDecode, decode_into_columns_parallel)
+{
+    using RecordColumns = PacketColumns<(kNumRecords + 1U), uint32_t, BitField<12>, Bit, BitField<3>, int16_t>;
+
+    static RecordColumns columns {};
+    Span<uint8_t const>  buffer {get_record_buffer(), kRecordBufferSizeBytes};
+
+    size_t offset_bits {8U};
+    EXPECT_EQ(1U, decode_into_columns(Span<uint8_t const> {buffer.data(), (1U + RecordPacket::kSizeBytes)}, offset_bits,
+                                      columns));
+
+    offset_bits = 8U;
+    EXPECT_EQ(kNumRecords, decode_into_columns_parallel(buffer, offset_bits, columns, 8U));
+    EXPECT_EQ((kRecordBufferSizeBytes * 8U), offset_bits);
+    ASSERT_EQ((kNumRecords + 1U), columns.Count());
+
+    Span<uint32_t const> const kIds {static_cast<RecordColumns const&>(columns).GetColumn<0>()};
+    Span<bool const> const     kFlags {static_cast<RecordColumns const&>(columns).GetColumn<2>()};
+    EXPECT_EQ(0U, kIds[0]);
+    for (size_t i = 0U; i < kNumRecords; i++)
+    {
+        EXPECT_EQ(i, kIds[i + 1U]);
+        EXPECT_EQ(((i % 2U) == 0U), kFlags[i + 1U]);
+    }
+}
@@ -0,0 +1,121 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/Data/Schema.hpp>
+#include <Core/Span.hpp>
+#include <Core/StringConstant.hpp>
+
+#include <gtest/gtest.h>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test schemas             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using StatusPacketV1 = packet_t<uint16_t, BitField<4>, ConstBitField<4>, Field<uint32_t, ByteOrder::kBig>, uint8_t>;
+using StatusPacketV2 = packet_t<BitField<4>, ConstBitField<4>, uint16_t, uint64_t, BitField<4>, int16_t>;
+
+using StatusSchemaV1 = PacketSchema<StatusPacketV1, string_constant("id"), string_constant("mode"),
+                                    string_constant("reserved"), string_constant("counter"),
+                                    string_constant("legacy")>;
+using StatusSchemaV2 = PacketSchema<StatusPacketV2, string_constant("mode"), string_constant("marker"),
+                                    string_constant("id"), string_constant("counter"), string_constant("reserved"),
+                                    string_constant("temperature")>;
+
+using StatusMigration = schema_mapping_t<StatusSchemaV1, StatusSchemaV2>;
+
+static StatusPacketV1 make_status_packet_v1()
+{
+    return StatusPacketV1 {uint16_t {0x1234}, BitField<4> {0x9}, ConstBitField<4> {0x6},
+                           Field<uint32_t, ByteOrder::kBig> {0xDEADBEEF}, uint8_t {0x77}};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Schema tests             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that fields are matched by name, and that names missing from the older schema are marked as added
+ *
+ */
+TEST(Schema, mapping_matches_names)
+{
+    constexpr auto& kSourceIndices {StatusMigration::kSourceIndices};
+    static_assert(kSourceIndices.size() == StatusPacketV2::kNumFields);
+
+    EXPECT_EQ(1U, kSourceIndices[0]);
+    EXPECT_EQ(kAddedField, kSourceIndices[1]);
+    EXPECT_EQ(0U, kSourceIndices[2]);
+    EXPECT_EQ(3U, kSourceIndices[3]);
+    EXPECT_EQ(2U, kSourceIndices[4]);
+    EXPECT_EQ(kAddedField, kSourceIndices[5]);
+}
+
+/**
+ * Test that an older encoding decodes straight in to the newer layout, with reordered, converted, and added fields
+ *
+ */
+TEST(Schema, decode_migrated_from_older_layout)
+{
+    StatusPacketV1 const kOld {make_status_packet_v1()};
+
+    uint8_t buffer[StatusPacketV1::kSizeBytes + 1U] {};
+    size_t  bits_encoded {8U};
+    ASSERT_TRUE(encode(kOld, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+
+    // Added fields are filled with defaults over whatever the destination held
+    StatusPacketV2 decoded {BitField<4> {0x0}, ConstBitField<4> {0xC}, uint16_t {0U}, uint64_t {0U}, BitField<4> {0x0},
+                            int16_t {-1}};
+    size_t bits_decoded {8U};
+    ASSERT_TRUE(decode_migrated<StatusMigration>(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+
+    EXPECT_EQ(0x9, packet_field_value<0>(decoded));
+    EXPECT_EQ(0xC, packet_field_value<1>(decoded)); // ConstBitFields keep their value
+    EXPECT_EQ(0x1234, packet_field_value<2>(decoded));
+    EXPECT_EQ(0xDEADBEEF, packet_field_value<3>(decoded));
+    EXPECT_EQ(0x6, packet_field_value<4>(decoded)); // Bits of a ConstBitField can be read in to a BitField
+    EXPECT_EQ(0, packet_field_value<5>(decoded));
+}
+
+/**
+ * Test that an explicit index mapping to an identical layout decodes exactly as the Packet's own decode does
+ *
+ */
+TEST(Schema, decode_migrated_identity_mapping)
+{
+    using IdentityMapping = SchemaMapping<StatusPacketV1, StatusPacketV1, 0U, 1U, 2U, 3U, 4U>;
+
+    StatusPacketV1 const kOld {make_status_packet_v1()};
+
+    uint8_t buffer[StatusPacketV1::kSizeBytes] {};
+    size_t  offset_bits {0U};
+    ASSERT_TRUE(encode(kOld, Span<uint8_t> {buffer}, offset_bits).IsSuccess());
+
+    StatusPacketV1 decoded {uint16_t {0U}, BitField<4> {0x0}, ConstBitField<4> {0x6},
+                            Field<uint32_t, ByteOrder::kBig> {0U}, uint8_t {0U}};
+    offset_bits = 0U;
+    ASSERT_TRUE(decode_migrated<IdentityMapping>(Span<uint8_t const> {buffer}, offset_bits, decoded).IsSuccess());
+
+    EXPECT_EQ(0x1234, packet_field_value<0>(decoded));
+    EXPECT_EQ(0x9, packet_field_value<1>(decoded));
+    EXPECT_EQ(0xDEADBEEF, packet_field_value<3>(decoded));
+    EXPECT_EQ(0x77, packet_field_value<4>(decoded));
+}
+
+/**
+ * Test that a buffer too short for the older layout fails without touching the destination
+ *
+ */
+TEST(Schema, decode_migrated_rejects_short_buffer)
+{
+    uint8_t const kBuffer[StatusPacketV1::kSizeBytes - 1U] {};
+
+    StatusPacketV2 decoded {BitField<4> {0x1}, ConstBitField<4> {0xC}, uint16_t {0x55}, uint64_t {0U},
+                            BitField<4> {0x0}, int16_t {7}};
+    size_t offset_bits {0U};
+    EXPECT_FALSE(decode_migrated<StatusMigration>(Span<uint8_t const> {kBuffer}, offset_bits, decoded).IsSuccess());
+    EXPECT_EQ(0U, offset_bits);
+    EXPECT_EQ(0x55, packet_field_value<2>(decoded));
+    EXPECT_EQ(7, packet_field_value<5>(decoded));
+}
@@ -0,0 +1,133 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/Data/TrackedPacket.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test packets             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using InnerPacket = packet_t<Bit, BitField<15>>;
+using StatePacket = TrackedPacket<uint8_t, BitField<7>, ConstBitField<3>, Bit, uint16_t, InnerPacket, BitField<36>,
+                                  int32_t>;
+
+static StatePacket make_state_packet()
+{
+    return StatePacket {uint8_t {0xA5},
+                        BitField<7> {0x5A},
+                        ConstBitField<3> {0x5},
+                        Bit {true},
+                        uint16_t {0xBEEF},
+                        InnerPacket {Bit {false}, BitField<15> {0x1234}},
+                        BitField<36> {0xFEDCBA987},
+                        int32_t {-12345}};
+}
+
+/// @brief Fully encodes the packet held by a TrackedPacket, for comparison
+static void encode_full(StatePacket const& tracked, uint8_t (&buffer)[StatePacket::kSizeBytes])
+{
+    std::memset(buffer, 0, sizeof(buffer));
+    Span<uint8_t> span {buffer, StatePacket::kSizeBytes};
+    size_t        offset_bits {0U};
+    ASSERT_TRUE(encode(tracked.GetPacket(), span, offset_bits).IsSuccess());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  TrackedPacket tests          ///////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that the first incremental encode writes the whole image
+ *
+ */
+TEST(TrackedPacket, first_encode_writes_every_field)
+{
+    StatePacket tracked {make_state_packet()};
+    EXPECT_EQ(StatePacket::kNumFields, tracked.DirtyCount());
+
+    uint8_t expected[StatePacket::kSizeBytes];
+    encode_full(tracked, expected);
+
+    uint8_t image[StatePacket::kSizeBytes] {};
+    ASSERT_TRUE(encode_incremental(tracked, Span<uint8_t> {image}).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(expected, image, sizeof(image)));
+    EXPECT_EQ(0U, tracked.DirtyCount());
+}
+
+/**
+ * Test that only changed fields are rewritten, and that the image still matches a full encode afterwards
+ *
+ */
+TEST(TrackedPacket, rewrites_only_changed_fields)
+{
+    StatePacket tracked {make_state_packet()};
+
+    uint8_t image[StatePacket::kSizeBytes] {};
+    ASSERT_TRUE(encode_incremental(tracked, Span<uint8_t> {image}).IsSuccess());
+
+    packet_field_value<1>(tracked) = 0x11;
+    set_packet_field_value<6>(tracked, 0x123456789);
+    set_packet_field_value<7>(tracked, 42);
+    EXPECT_TRUE(tracked.IsDirty<1>());
+    EXPECT_TRUE(tracked.IsDirty<6>());
+    EXPECT_TRUE(tracked.IsDirty<7>());
+    EXPECT_FALSE(tracked.IsDirty<4>());
+    EXPECT_EQ(3U, tracked.DirtyCount());
+
+    uint8_t expected[StatePacket::kSizeBytes];
+    encode_full(tracked, expected);
+
+    // A byte lying wholly inside a clean field is not touched, so a poisoned byte survives
+    constexpr size_t kCleanByte {(packet_field_layout_v<4, StatePacket::packet_type>.offset_bits + 7U) / 8U};
+    image[kCleanByte] = static_cast<uint8_t>(~expected[kCleanByte]);
+    ASSERT_TRUE(encode_incremental(tracked, Span<uint8_t> {image}).IsSuccess());
+    EXPECT_EQ(static_cast<uint8_t>(~expected[kCleanByte]), image[kCleanByte]);
+
+    // Everything else matches a full encode, including bits shared between neighbouring fields
+    image[kCleanByte] = expected[kCleanByte];
+    EXPECT_EQ(0, std::memcmp(expected, image, sizeof(image)));
+    EXPECT_EQ(0U, tracked.DirtyCount());
+}
+
+/**
+ * Test that assigning an arithmetic field its current value does not mark it as changed
+ *
+ */
+TEST(TrackedPacket, unchanged_assignment_stays_clean)
+{
+    StatePacket tracked {make_state_packet()};
+
+    uint8_t image[StatePacket::kSizeBytes] {};
+    ASSERT_TRUE(encode_incremental(tracked, Span<uint8_t> {image}).IsSuccess());
+
+    set_packet_field_value<0>(tracked, 0xA5);
+    set_packet_field_value<3>(tracked, true);
+    EXPECT_EQ(0U, tracked.DirtyCount());
+
+    // Reading through a const TrackedPacket marks nothing
+    StatePacket const& kTracked {tracked};
+    EXPECT_EQ(0xBEEF, packet_field_value<4>(kTracked));
+    EXPECT_EQ(0U, tracked.DirtyCount());
+
+    tracked.MarkAllDirty();
+    EXPECT_EQ(StatePacket::kNumFields, tracked.DirtyCount());
+}
+
+/**
+ * Test that an image smaller than the footprint is rejected and the changed fields are kept
+ *
+ */
+TEST(TrackedPacket, rejects_short_image)
+{
+    StatePacket tracked {make_state_packet()};
+
+    uint8_t image[StatePacket::kSizeBytes - 1U] {};
+    EXPECT_FALSE(encode_incremental(tracked, Span<uint8_t> {image}).IsSuccess());
+    EXPECT_EQ(StatePacket::kNumFields, tracked.DirtyCount());
+}
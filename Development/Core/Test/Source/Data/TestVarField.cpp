@@ -0,0 +1,200 @@
+#include <Core/Data/Field.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <limits>
+
+using namespace shmit;
+using namespace shmit::data;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Helpers             ////////////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Encodes a VarField and decodes it back, from a buffer of the given size
+template<typename T>
+static void expect_round_trip(T value, size_t buffer_size_bytes)
+{
+    uint8_t buffer[16U] {};
+    ASSERT_LE(buffer_size_bytes, sizeof(buffer));
+
+    VarField<T> const kField {value};
+    size_t            bits_encoded {0U};
+    ASSERT_TRUE(encode(kField, Span<uint8_t> {buffer, buffer_size_bytes}, bits_encoded).IsSuccess());
+    EXPECT_EQ((8U * encoded_size_bytes(kField)), bits_encoded);
+
+    VarField<T> decoded {};
+    size_t      bits_decoded {0U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer, buffer_size_bytes}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    EXPECT_EQ(value, decoded.value);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  VarField tests             /////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * Test that the static size of a VarField is its largest encoded size, and that values take only the bytes they need
+ *
+ */
+TEST(VarField, size_depends_on_value)
+{
+    EXPECT_EQ(2U, VarField<uint8_t>::kMaxSizeBytes);
+    EXPECT_EQ(5U, VarField<uint32_t>::kMaxSizeBytes);
+    EXPECT_EQ(10U, VarField<int64_t>::kMaxSizeBytes);
+    EXPECT_EQ(40U, VarField<uint32_t>::kSizeBits);
+    EXPECT_EQ(40U, footprint_size_bits_v<VarField<uint32_t>>);
+
+    EXPECT_EQ(1U, encoded_size_bytes(VarField<uint32_t> {0U}));
+    EXPECT_EQ(1U, encoded_size_bytes(VarField<uint32_t> {127U}));
+    EXPECT_EQ(2U, encoded_size_bytes(VarField<uint32_t> {128U}));
+    EXPECT_EQ(5U, encoded_size_bytes(VarField<uint32_t> {std::numeric_limits<uint32_t>::max()}));
+    EXPECT_EQ(10U, encoded_size_bytes(VarField<uint64_t> {std::numeric_limits<uint64_t>::max()}));
+
+    // Small negative values stay small when zigzag encoded
+    EXPECT_EQ(1U, encoded_size_bytes(VarField<int32_t> {-1}));
+    EXPECT_EQ(1U, encoded_size_bytes(VarField<int32_t> {-64}));
+    EXPECT_EQ(2U, encoded_size_bytes(VarField<int32_t> {-65}));
+}
+
+/**
+ * Test that VarFields are encoded as LEB128, least significant group first
+ *
+ */
+TEST(VarField, encodes_leb128)
+{
+    uint8_t buffer[4U] {};
+    size_t  offset_bits {3U}; // Moves to the next byte boundary
+    ASSERT_TRUE(encode(VarField<uint16_t> {300U}, Span<uint8_t> {buffer}, offset_bits).IsSuccess());
+    EXPECT_EQ(24U, offset_bits);
+    EXPECT_EQ(0x00, buffer[0]);
+    EXPECT_EQ(0xAC, buffer[1]);
+    EXPECT_EQ(0x02, buffer[2]);
+
+    offset_bits = 0U;
+    ASSERT_TRUE(encode(VarField<int8_t> {-2}, Span<uint8_t> {buffer}, offset_bits).IsSuccess());
+    EXPECT_EQ(0x03, buffer[0]);
+}
+
+/**
+ * Test that values survive a round trip through both the word-at-a-time and bytewise decode paths
+ *
+ */
+TEST(VarField, round_trips_values)
+{
+    uint64_t const kUnsignedValues[] {0U, 1U, 127U, 128U, 16383U, 16384U, (uint64_t {1U} << 55U) - 1U,
+                                      uint64_t {1U} << 56U, std::numeric_limits<uint64_t>::max()};
+    for (uint64_t const kValue : kUnsignedValues)
+    {
+        expect_round_trip(kValue, 16U);                                           // Whole word available
+        expect_round_trip(kValue, encoded_size_bytes(VarField<uint64_t> {kValue})); // Tight buffer
+    }
+
+    int64_t const kSignedValues[] {0, -1, 1, -64, 64, -8192, std::numeric_limits<int64_t>::min(),
+                                   std::numeric_limits<int64_t>::max()};
+    for (int64_t const kValue : kSignedValues)
+    {
+        expect_round_trip(kValue, 16U);
+        expect_round_trip(kValue, encoded_size_bytes(VarField<int64_t> {kValue}));
+    }
+
+    expect_round_trip(uint16_t {0xFFFF}, 16U);
+    expect_round_trip(int16_t {-32768}, 3U);
+}
+
+/**
+ * Test that truncated values and values too large for the stored type are rejected
+ *
+ */
+TEST(VarField, rejects_malformed_values)
+{
+    VarField<uint32_t> field {7U};
+    size_t             offset_bits {0U};
+
+    uint8_t const kTruncated[] {0x80, 0x80};
+    EXPECT_FALSE(decode(Span<uint8_t const> {kTruncated}, offset_bits, field).IsSuccess());
+
+    uint8_t const kTooLong[] {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00};
+    EXPECT_FALSE(decode(Span<uint8_t const> {kTooLong}, offset_bits, field).IsSuccess());
+
+    VarField<uint64_t> wide {};
+    uint8_t const      kPastSixtyFourBits[] {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+    EXPECT_FALSE(decode(Span<uint8_t const> {kPastSixtyFourBits}, offset_bits, wide).IsSuccess());
+
+    VarField<uint8_t> narrow {};
+    uint8_t const     kOverflow[] {0x80, 0x02}; // 256
+    EXPECT_FALSE(decode(Span<uint8_t const> {kOverflow}, offset_bits, narrow).IsSuccess());
+
+    EXPECT_EQ(0U, offset_bits);
+    EXPECT_EQ(7U, field.value);
+
+    uint8_t buffer[1U] {};
+    EXPECT_FALSE(encode(VarField<uint32_t> {128U}, Span<uint8_t> {buffer}, offset_bits).IsSuccess());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Packet tests             ///////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using CounterPacket = packet_t<uint8_t, VarField<uint32_t>, BitField<3>, Bit, VarField<int16_t>, uint16_t>;
+
+/**
+ * Test that a Packet holding VarFields encodes them field by field, taking only the bytes its values need
+ *
+ */
+TEST(VarField, packet_round_trip)
+{
+    CounterPacket const kPacket {uint8_t {0x42}, VarField<uint32_t> {300U}, BitField<3> {5U}, Bit {true},
+                                 VarField<int16_t> {-3}, uint16_t {0xBEEF}};
+
+    // 1 + 2 + 1 (bits) + 1 + 2
+    EXPECT_EQ(7U, encoded_size_bytes(kPacket));
+    EXPECT_GE(CounterPacket::kSizeBytes, encoded_size_bytes(kPacket));
+
+    uint8_t buffer[CounterPacket::kSizeBytes + 1U] {};
+    size_t  bits_encoded {1U};
+    ASSERT_TRUE(encode(kPacket, Span<uint8_t> {buffer}, bits_encoded).IsSuccess());
+    EXPECT_EQ((8U * (1U + 7U)), bits_encoded);
+
+    uint8_t const kExpected[] {0x42, 0xAC, 0x02, 0x0D, 0x05, 0xEF, 0xBE};
+    EXPECT_EQ(0, std::memcmp(kExpected, (buffer + 1U), sizeof(kExpected)));
+
+    CounterPacket decoded {};
+    size_t        bits_decoded {1U};
+    ASSERT_TRUE(decode(Span<uint8_t const> {buffer}, bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(bits_encoded, bits_decoded);
+    EXPECT_EQ(packet_field_value<0>(kPacket), packet_field_value<0>(decoded));
+    EXPECT_EQ(packet_field_value<1>(kPacket), packet_field_value<1>(decoded));
+    EXPECT_EQ(packet_field_value<2>(kPacket), packet_field_value<2>(decoded));
+    EXPECT_EQ(packet_field_value<3>(kPacket), packet_field_value<3>(decoded));
+    EXPECT_EQ(packet_field_value<4>(kPacket), packet_field_value<4>(decoded));
+    EXPECT_EQ(packet_field_value<5>(kPacket), packet_field_value<5>(decoded));
+
+    // Fixed-size packets always take their whole footprint
+    using FixedPacket = packet_t<uint8_t, uint32_t>;
+    EXPECT_EQ(FixedPacket::kSizeBytes, encoded_size_bytes(FixedPacket {uint8_t {1U}, uint32_t {2U}}));
+}
+
+/**
+ * Test that buffers too short for a Packet holding VarFields are rejected
+ *
+ */
+TEST(VarField, packet_rejects_short_buffer)
+{
+    CounterPacket const kPacket {uint8_t {0x42}, VarField<uint32_t> {300U}, BitField<3> {5U}, Bit {true},
+                                 VarField<int16_t> {-3}, uint16_t {0xBEEF}};
+
+    uint8_t buffer[6U] {};
+    size_t  offset_bits {0U};
+    EXPECT_FALSE(encode(kPacket, Span<uint8_t> {buffer}, offset_bits).IsSuccess());
+    EXPECT_EQ(0U, offset_bits);
+
+    uint8_t const kTruncated[] {0x42, 0xAC, 0x02, 0x0D, 0x05, 0xEF};
+    CounterPacket decoded {};
+    EXPECT_FALSE(decode(Span<uint8_t const> {kTruncated}, offset_bits, decoded).IsSuccess());
+    EXPECT_EQ(0U, offset_bits);
+}
@@ -0,0 +1,82 @@
+#include <Core/Help/InplaceFunction.hpp>
+#include <Core/Help/RoutineLogic.hpp>
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+using namespace shmit;
+using namespace shmit::help;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  InplaceFunction tests               ////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that an InplaceFunction invokes its stored callable, including mutable and capturing ones, and that an
+ * empty one is harmless
+ *
+ */
+TEST(Help_InplaceFunction, invoke)
+{
+    InplaceFunction<int(int, int), 16U> empty;
+    EXPECT_FALSE(static_cast<bool>(empty));
+    EXPECT_EQ(0, empty(1, 2));
+
+    InplaceFunction<int(int, int), 16U> add {[](int lhs, int rhs) -> int { return (lhs + rhs); }};
+    EXPECT_TRUE(static_cast<bool>(add));
+    EXPECT_EQ(5, add(2, 3));
+
+    int                             num_calls {0};
+    InplaceFunction<int(void), 16U> counter {[&num_calls, total = 0]() mutable -> int
+                                             {
+                                                 num_calls++;
+                                                 return ++total;
+                                             }};
+    EXPECT_EQ(1, counter());
+    EXPECT_EQ(2, counter());
+    EXPECT_EQ(2, num_calls);
+}
+
+/**
+ * @brief Test that copies hold their own callable and that stored callables are destroyed exactly once
+ *
+ */
+TEST(Help_InplaceFunction, copy_and_destroy)
+{
+    std::shared_ptr<int> tracked {std::make_shared<int>(7)};
+    {
+        InplaceFunction<int(void), 32U> original {[tracked]() -> int { return *tracked; }};
+        EXPECT_EQ(2, tracked.use_count());
+
+        InplaceFunction<int(void), 32U> copy {original};
+        EXPECT_EQ(3, tracked.use_count());
+        EXPECT_EQ(7, copy());
+
+        InplaceFunction<int(void), 32U> assigned;
+        assigned = copy;
+        EXPECT_EQ(4, tracked.use_count());
+        assigned = InplaceFunction<int(void), 32U> {[]() -> int { return 9; }};
+        EXPECT_EQ(3, tracked.use_count());
+        EXPECT_EQ(9, assigned());
+    }
+    EXPECT_EQ(1, tracked.use_count());
+}
+
+/**
+ * @brief Test that a RepeatableCheck holds a typical capturing lambda and drives the polling loops
+ *
+ */
+TEST(Help_InplaceFunction, repeatable_check)
+{
+    size_t num_checks {0U};
+    size_t pass_after {5U};
+
+    RepeatableCheck check {[&num_checks, &pass_after]() -> bool { return (++num_checks >= pass_after); }};
+    WaitForPassCondition(check);
+    EXPECT_EQ(5U, num_checks);
+
+    // Taken by type, no type erasure
+    WaitForPassCondition([&]() -> bool { return (++num_checks >= 10U); });
+    EXPECT_EQ(10U, num_checks);
+}
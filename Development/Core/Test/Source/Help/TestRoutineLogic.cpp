@@ -0,0 +1,86 @@
+#include <Core/Help/RoutineLogic.hpp>
+#include <Core/Platform/Clock.hpp>
+#include <Core/Time/Timer.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace shmit;
+using namespace shmit::help;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  RoutineLogic tests              ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that blocking returns once a condition set by another thread passes, well after backoff has set in
+ *
+ */
+TEST(Help_RoutineLogic, block_until_condition_passes)
+{
+    std::atomic<bool> is_ready {false};
+
+    std::thread producer {[&]()
+                          {
+                              std::this_thread::sleep_for(std::chrono::milliseconds {20});
+                              is_ready.store(true);
+                          }};
+
+    BlockOnPassCondition([&]() -> bool { return is_ready.load(); });
+    EXPECT_TRUE(is_ready.load());
+    producer.join();
+}
+
+/**
+ * @brief Test that blocking with a timer gives up once the timer expires
+ *
+ */
+TEST(Help_RoutineLogic, block_times_out)
+{
+    time::BasicTimer<platform::Clock> timeout {std::chrono::milliseconds {10}};
+
+    size_t num_checks {0U};
+    EXPECT_FALSE(BlockOnPassCondition(
+        [&]() -> bool
+        {
+            num_checks++;
+            return false;
+        },
+        timeout));
+    EXPECT_TRUE(timeout.IsExpired());
+
+    // Backoff keeps the number of checks well below a hot spin
+    EXPECT_LT(num_checks, 1000U);
+
+    time::BasicTimer<platform::Clock> never_expires {std::chrono::seconds {10}};
+    EXPECT_TRUE(BlockOnPassCondition([]() -> bool { return true; }, never_expires));
+}
+
+/**
+ * @brief Test that a notifier wakes a waiter as soon as the producer makes its condition pass
+ *
+ */
+TEST(Help_RoutineLogic, notifier_wakes_waiter)
+{
+    PassNotifier      notifier;
+    std::atomic<bool> is_ready {false};
+
+    uint32_t const epoch {notifier.GetEpoch()};
+    notifier.Notify();
+    EXPECT_NE(epoch, notifier.GetEpoch());
+    notifier.Wait(epoch, std::chrono::microseconds {1000000}); // Already notified, returns right away
+
+    std::thread producer {[&]()
+                          {
+                              std::this_thread::sleep_for(std::chrono::milliseconds {20});
+                              is_ready.store(true);
+                              notifier.Notify();
+                          }};
+
+    time::BasicTimer<platform::Clock> timeout {std::chrono::seconds {10}};
+    EXPECT_TRUE(BlockOnPassCondition([&]() -> bool { return is_ready.load(); }, notifier, timeout));
+    producer.join();
+}
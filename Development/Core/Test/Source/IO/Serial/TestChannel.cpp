@@ -0,0 +1,231 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Serial/Channel.hpp>
+#include <Core/IO/Serial/FileDescriptorPort.hpp>
+#include <Core/IO/Serial/StreamBufferPort.hpp>
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Framing.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <sstream>
+#include <string>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace shmit;
+using namespace shmit::io;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Sample = data::packet_t<uint32_t, uint16_t>;
+
+/// @brief Connected pair of non-blocking stream sockets, standing in for the two ends of a serial link
+class SocketLink : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        ASSERT_EQ(socketpair(AF_UNIX, SOCK_STREAM, 0, m_sockets), 0);
+        for (int socket : m_sockets)
+            ASSERT_EQ(fcntl(socket, F_SETFL, (fcntl(socket, F_GETFL) | O_NONBLOCK)), 0);
+    }
+
+    void TearDown() override
+    {
+        for (int socket : m_sockets)
+            static_cast<void>(close(socket));
+    }
+
+    int m_sockets[2U] {-1, -1};
+};
+
+/// @brief Port that writes in the background, completing each write only when told to as if its DMA interrupt fired
+class DeferredPort final : public serial::Port
+{
+public:
+    size_t ReadBytesAvailable() const noexcept override
+    {
+        return 0U;
+    }
+
+    size_t Read(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override
+    {
+        static_cast<void>(rx);      // Avoid unused parameter
+        static_cast<void>(timeout); // Avoid unused parameter
+        return 0U;
+    }
+
+    size_t Write(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override
+    {
+        static_cast<void>(timeout); // Avoid unused parameter
+        m_wire.append(reinterpret_cast<char const*>(tx.data()), tx.size());
+        return tx.size();
+    }
+
+    bool WriteAsync(session::Transference& transference) noexcept override
+    {
+        if (m_in_flight != nullptr)
+            return false;
+
+        m_in_flight = &transference;
+        return true;
+    }
+
+    void CompleteFromIsr() noexcept
+    {
+        session::Transference* const transference {m_in_flight};
+        m_in_flight = nullptr;
+        static_cast<void>(Write(transference->GetData(), std::chrono::microseconds::zero()));
+        transference->SetResult(session::Transference::Result::Success());
+    }
+
+    std::string m_wire {};
+
+private:
+    session::Transference* m_in_flight {nullptr};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Channel tests                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(SocketLink, egress_to_ingress)
+{
+    serial::FileDescriptorPort port_a {m_sockets[0U]};
+    serial::FileDescriptorPort port_b {m_sockets[1U]};
+    serial::Channel<>          channel_a {port_a};
+    serial::Channel<>          channel_b {port_b};
+
+    session::Egress<Sample>  egress {channel_a};
+    session::Ingress<Sample> ingress {channel_b};
+
+    ASSERT_TRUE(egress.Put(Sample {uint32_t {0xDEADBEEF}, uint16_t {7U}}).IsSuccess());
+    ASSERT_TRUE(egress.Put(Sample {uint32_t {0x0BADF00D}, uint16_t {8U}}).IsSuccess());
+
+    // Ingress decodes the first sample in place, reading ahead the second
+    Sample received {};
+    ASSERT_TRUE(ingress.Get(received).IsSuccess());
+    EXPECT_EQ(data::packet_field_value<0U>(received), 0xDEADBEEF);
+    ASSERT_TRUE(ingress.Get(received).IsSuccess());
+    EXPECT_EQ(data::packet_field_value<1U>(received), 8U);
+    EXPECT_EQ(channel_b.InputBytesAvailable(), 0U);
+}
+
+TEST_F(SocketLink, timed_out_request_keeps_partial_bytes)
+{
+    serial::FileDescriptorPort port_a {m_sockets[0U]};
+    serial::FileDescriptorPort port_b {m_sockets[1U]};
+    serial::Channel<>          channel_a {port_a};
+    serial::Channel<>          channel_b {port_b};
+
+    std::array<uint8_t, 2U> const kFirst {1U, 2U};
+    std::array<uint8_t, 2U> const kSecond {3U, 4U};
+    ASSERT_TRUE(
+        channel_a.Post(Span<uint8_t const> {kFirst.data(), kFirst.size()}, std::chrono::milliseconds {10}).IsSuccess());
+
+    std::array<uint8_t, 4U> received {};
+    Span<uint8_t> const     received_span {received.data(), received.size()};
+    EXPECT_TRUE(channel_b.Request(received_span, std::chrono::milliseconds {5}).IsFailure());
+    EXPECT_EQ(channel_b.InputBytesAvailable(), kFirst.size());
+
+    ASSERT_TRUE(channel_a.Post(Span<uint8_t const> {kSecond.data(), kSecond.size()}, std::chrono::milliseconds {10})
+                    .IsSuccess());
+    ASSERT_TRUE(channel_b.Request(received_span, std::chrono::milliseconds {50}).IsSuccess());
+    EXPECT_EQ(received, (std::array<uint8_t, 4U> {1U, 2U, 3U, 4U}));
+}
+
+TEST_F(SocketLink, framed_over_channel)
+{
+    serial::FileDescriptorPort port_a {m_sockets[0U]};
+    serial::FileDescriptorPort port_b {m_sockets[1U]};
+    serial::Channel<>          channel_a {port_a};
+    serial::Channel<>          channel_b {port_b};
+
+    session::FramedOutbound     framed_out {channel_a};
+    session::FramedInbound<64U> framed_in {channel_b};
+
+    session::Egress<Sample>  egress {framed_out};
+    session::Ingress<Sample> ingress {framed_in};
+    ASSERT_TRUE(egress.Put(Sample {uint32_t {42U}, uint16_t {43U}}, std::chrono::milliseconds {10}).IsSuccess());
+
+    EXPECT_EQ(framed_in.Update(), 1U);
+
+    Sample received {};
+    ASSERT_TRUE(ingress.Get(received).IsSuccess());
+    EXPECT_EQ(data::packet_field_value<0U>(received), 42U);
+}
+
+TEST(Serial_Channel, stream_buffer_backend)
+{
+    std::array<uint8_t, 3U> const             kFirst {0xAAU, 0xBBU, 0xCCU};
+    std::array<uint8_t, 2U> const             kSecond {0xDDU, 0xEEU};
+    std::array<Span<uint8_t const>, 2U> const kParts {Span<uint8_t const> {kFirst.data(), kFirst.size()},
+                                                      Span<uint8_t const> {kSecond.data(), kSecond.size()}};
+
+    // Writes land in the stream buffer whole
+    std::stringbuf           tx_buffer {};
+    serial::StreamBufferPort tx_port {tx_buffer};
+    serial::Channel<16U>     tx_channel {tx_port};
+    ASSERT_TRUE(tx_channel
+                    .Post(Span<Span<uint8_t const> const> {kParts.data(), kParts.size()},
+                          std::chrono::microseconds::zero())
+                    .IsSuccess());
+    EXPECT_EQ(tx_buffer.str(), "\xAA\xBB\xCC\xDD\xEE");
+
+    // Reads are peeked and consumed from the channel's own buffer
+    std::stringbuf           rx_buffer {tx_buffer.str(), std::ios_base::in};
+    serial::StreamBufferPort rx_port {rx_buffer};
+    serial::Channel<16U>     rx_channel {rx_port};
+    EXPECT_EQ(rx_channel.InputBytesAvailable(), 5U);
+
+    Span<uint8_t const> const peeked {rx_channel.Peek(4U)};
+    ASSERT_EQ(peeked.size(), 4U);
+    EXPECT_EQ(peeked[3U], 0xDDU);
+    EXPECT_TRUE(rx_channel.Consume(4U).IsSuccess());
+
+    uint8_t last {0U};
+    ASSERT_TRUE(rx_channel.Request(Span<uint8_t> {&last, 1U}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(last, 0xEEU);
+    EXPECT_EQ(rx_channel.InputBytesAvailable(), 0U);
+}
+
+TEST(Serial_Channel, post_async_completes_through_callback)
+{
+    std::array<uint8_t, 3U> const kFirst {0x01U, 0x02U, 0x03U};
+    std::array<uint8_t, 2U> const kSecond {0x04U, 0x05U};
+
+    DeferredPort         port {};
+    serial::Channel<16U> channel {port};
+
+    size_t     num_completed {0U};
+    auto const on_complete {[](session::Transference& transference, void* context)
+                            {
+                                EXPECT_TRUE(transference.GetResult().IsSuccess());
+                                (*static_cast<size_t*>(context))++;
+                            }};
+
+    // The first write is left in flight with the port
+    session::Transference first {Span<uint8_t const> {kFirst.data(), kFirst.size()}, on_complete, &num_completed};
+    ASSERT_TRUE(channel.PostAsync(first).IsSuccess());
+    EXPECT_TRUE(first.IsPending());
+    EXPECT_EQ(num_completed, 0U);
+    EXPECT_TRUE(port.m_wire.empty());
+
+    // While the port is busy, the next write goes through synchronously
+    session::Transference second {Span<uint8_t const> {kSecond.data(), kSecond.size()}, on_complete, &num_completed};
+    ASSERT_TRUE(channel.PostAsync(second).IsSuccess());
+    EXPECT_FALSE(second.IsPending());
+    EXPECT_EQ(num_completed, 1U);
+
+    port.CompleteFromIsr();
+    EXPECT_FALSE(first.IsPending());
+    EXPECT_EQ(num_completed, 2U);
+    EXPECT_EQ(port.m_wire, "\x04\x05\x01\x02\x03");
+}
@@ -0,0 +1,210 @@
+#include <Core/IO/Session/Coroutine.hpp>
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+/**
+ * @brief Session that only completes transferences when told to, standing in for a UART or SPI driver whose DMA
+ * completion interrupt fires some time after a transfer is started
+ *
+ */
+class DeferredSession : public Outbound, public Inbound
+{
+public:
+    virtual size_t InputBytesAvailable() const noexcept override
+    {
+        return 0U;
+    }
+
+    virtual size_t OutputBytesAvailable() const noexcept override
+    {
+        return sizeof(m_wire);
+    }
+
+    virtual Outbound::Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override
+    {
+        static_cast<void>(tx);      // Avoid unused parameter
+        static_cast<void>(timeout); // Avoid unused parameter
+        return Outbound::Result::Failure();
+    }
+
+    virtual Inbound::Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override
+    {
+        static_cast<void>(rx);      // Avoid unused parameter
+        static_cast<void>(timeout); // Avoid unused parameter
+        return Inbound::Result::Failure();
+    }
+
+    virtual Outbound::Result PostAsync(Transference& transference) noexcept override
+    {
+        m_post = &transference;
+        return Outbound::Result::Success();
+    }
+
+    virtual Inbound::Result RequestAsync(Transference& transference) noexcept override
+    {
+        m_request = &transference;
+        return Inbound::Result::Success();
+    }
+
+    /// @brief Complete whichever transfers are in flight, as if their interrupts fired. Posted bytes are looped back
+    /// out to the next request.
+    void CompleteFromIsr() noexcept
+    {
+        if (m_post != nullptr)
+        {
+            std::memcpy(m_wire, m_post->GetData().data(), m_post->GetData().size());
+            m_wire_is_full = true;
+
+            Transference* post {m_post};
+            m_post = nullptr;
+            post->SetResult(Transference::Result::Success());
+        }
+
+        if ((m_request != nullptr) && m_wire_is_full)
+        {
+            std::memcpy(m_request->GetWritableData().data(), m_wire, m_request->GetWritableData().size());
+            m_wire_is_full = false;
+
+            Transference* request {m_request};
+            m_request = nullptr;
+            request->SetResult(Transference::Result::Success());
+        }
+    }
+
+private:
+    Transference* m_post {nullptr};
+    Transference* m_request {nullptr};
+    uint8_t       m_wire[sizeof(uint32_t)] {};
+    bool          m_wire_is_full {false};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Coroutine tests             ////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that coroutines awaiting synchronous sessions never suspend
+ *
+ */
+TEST(Session_Coroutine, synchronous_session_completes_inline)
+{
+    SessionExecutor   executor;
+    RingSession<16U>  ring;
+    Egress<uint32_t>  egress {ring};
+    Ingress<uint32_t> ingress {ring};
+
+    uint32_t received {0U};
+    bool     finished {false};
+
+    auto exchange {[&]() -> SessionTask
+                   {
+                       EXPECT_TRUE((co_await executor.Put(egress, 0xFEEDF00DU)).IsSuccess());
+                       EXPECT_TRUE((co_await executor.Get(ingress, received)).IsSuccess());
+                       EXPECT_TRUE((co_await executor.Get(ingress, received)).IsFailure()); // Nothing left
+                       finished = true;
+                   }};
+
+    exchange();
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(executor.IsIdle());
+    EXPECT_EQ(0xFEEDF00DU, received);
+}
+
+/**
+ * @brief Test that one executor drives many coroutines over many sessions, resuming each only once its transfers
+ * complete
+ *
+ */
+TEST(Session_Coroutine, executor_drives_many_sessions)
+{
+    constexpr size_t   kNumSessions {32U};
+    constexpr uint32_t kNumRounds {4U};
+
+    SessionExecutor executor;
+    DeferredSession sessions[kNumSessions];
+    size_t          num_finished {0U};
+
+    auto loopback {[&](DeferredSession& session, uint32_t seed) -> SessionTask
+                   {
+                       Egress<uint32_t>  egress {session};
+                       Ingress<uint32_t> ingress {session};
+                       for (uint32_t round = 0U; round < kNumRounds; round++)
+                       {
+                           uint32_t received {0U};
+                           EXPECT_TRUE((co_await executor.Put(egress, (seed + round))).IsSuccess());
+                           EXPECT_TRUE((co_await executor.Get(ingress, received)).IsSuccess());
+                           EXPECT_EQ((seed + round), received);
+                       }
+                       num_finished++;
+                   }};
+
+    for (size_t i = 0U; i < kNumSessions; i++)
+        loopback(sessions[i], static_cast<uint32_t>(i * 100U));
+
+    // Every coroutine is parked on its first post
+    EXPECT_FALSE(executor.IsIdle());
+    EXPECT_EQ(0U, executor.Poll());
+
+    while (!executor.IsIdle())
+    {
+        for (DeferredSession& session : sessions)
+            session.CompleteFromIsr();
+
+        static_cast<void>(executor.Poll());
+    }
+
+    EXPECT_EQ(kNumSessions, num_finished);
+}
+
+/**
+ * @brief Test that Run blocks until a transference completes from another context, rather than spinning on Poll
+ *
+ */
+TEST(Session_Coroutine, run_blocks_until_completion)
+{
+    constexpr std::chrono::milliseconds kCompletionDelay {100};
+
+    SessionExecutor  executor;
+    DeferredSession  session;
+    Egress<uint32_t> egress {session};
+    bool             finished {false};
+
+    auto post {[&]() -> SessionTask
+               {
+                   EXPECT_TRUE((co_await executor.Put(egress, 0xC0FFEEU)).IsSuccess());
+                   finished = true;
+               }};
+
+    post();
+    ASSERT_FALSE(executor.IsIdle());
+
+    // Complete the post from another thread, as if its interrupt fired some time later
+    std::thread completer {[&]()
+                           {
+                               std::this_thread::sleep_for(kCompletionDelay);
+                               session.CompleteFromIsr();
+                           }};
+
+    std::clock_t const kCpuStart {std::clock()};
+    executor.Run();
+    std::clock_t const kCpuEnd {std::clock()};
+    completer.join();
+
+    EXPECT_TRUE(finished);
+    EXPECT_TRUE(executor.IsIdle());
+
+    // A spinning Run burns about as much processor time as the delay lasted
+    double const kCpuMs {(1000.0 * static_cast<double>(kCpuEnd - kCpuStart)) / CLOCKS_PER_SEC};
+    EXPECT_LT(kCpuMs, (static_cast<double>(kCompletionDelay.count()) / 2.0));
+}
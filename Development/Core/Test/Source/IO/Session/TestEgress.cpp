@@ -1,13 +1,16 @@
 #include "Core/Mocks/IO/Session/MockOutbound.hpp"
 
 #include <Core/Data/Footprint.hpp>
+#include <Core/Data/Packet.hpp>
 #include <Core/IO/Session/Egress.hpp>
 
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
 #include <chrono>
+#include <cstring>
 #include <limits>
+#include <string>
 
 using namespace shmit;
 using namespace shmit::io::session;
@@ -99,9 +102,8 @@ TEST(Session_Egress, nonzero_timeout)
         .WillOnce(Invoke(
             [&](Span<uint8_t const> tx, std::chrono::microseconds timeout) -> MockOutbound::Result
             {
-                // Verify that the timeout supplied to the session is within (0, kTestDuration]
-                EXPECT_GT(timeout.count(), 0);
-                EXPECT_LE(timeout, kTestDuration);
+                // Verify that the whole duration is supplied to the session, encoding is not charged to it
+                EXPECT_EQ(kTestDuration, timeout);
 
                 // Don't care what the return value is for this test
                 return MockOutbound::Result::Success();
@@ -151,3 +153,194 @@ TEST(Session_Egress, session_posting_fails)
     Egress<int> test_egress {mock_outbound};
     ASSERT_TRUE(test_egress.Put(test_value).IsFailure());
 }
+
+/**
+ * @brief Test that an Egress encodes straight in to the Outbound session buffer's storage when the session lends it
+ * out, bypassing Post entirely
+ *
+ */
+TEST(Session_Egress, encodes_in_place)
+{
+    using TestValueType = int;
+
+    constexpr TestValueType kTestValue {42};
+
+    // Mock Outbound session that lends out a fixed block of storage
+    class LendingOutbound : public MockOutbound
+    {
+    public:
+        virtual Span<uint8_t> Reserve(size_t size_bytes) noexcept override
+        {
+            reserved_bytes = size_bytes;
+            return Span<uint8_t> {storage, size_bytes};
+        }
+
+        virtual Result Commit(size_t size_bytes) noexcept override
+        {
+            committed_bytes = size_bytes;
+            return Result::Success();
+        }
+
+        uint8_t storage[sizeof(TestValueType)] {};
+        size_t  reserved_bytes {0U};
+        size_t  committed_bytes {0U};
+    };
+
+    LendingOutbound lending_outbound;
+    // Expect plenty of availablities in the session
+    EXPECT_CALL(lending_outbound, OutputBytesAvailable()).WillOnce(Return(std::numeric_limits<size_t>::max()));
+    // Expect the fallback path to go unused
+    EXPECT_CALL(lending_outbound, Post(_, _)).Times(0U);
+
+    // Start the test
+    Egress<TestValueType> test_egress {lending_outbound};
+    ASSERT_TRUE(test_egress.Put(kTestValue).IsSuccess());
+    EXPECT_EQ(sizeof(TestValueType), lending_outbound.reserved_bytes);
+    EXPECT_EQ(sizeof(TestValueType), lending_outbound.committed_bytes);
+    EXPECT_EQ(kTestValue, *(reinterpret_cast<TestValueType const*>(lending_outbound.storage)));
+}
+
+/**
+ * @brief Test that a burst put to an Egress is staged and posted in as few transmissions as possible, and that only as
+ * many objects as the Outbound session buffer has room for are accepted
+ *
+ */
+TEST(Session_Egress, put_many)
+{
+    using TestValueType = int;
+
+    constexpr size_t kNumValues {100U};
+    constexpr size_t kNumAccepted {90U};
+    constexpr size_t kStagingCount {Egress<TestValueType>::kPutManyStagingSizeBytes / sizeof(TestValueType)};
+
+    TestValueType values[kNumValues] {};
+    for (size_t i = 0U; i < kNumValues; i++)
+        values[i] = static_cast<TestValueType>(i);
+
+    // Stage mock Outbound session
+    MockOutbound mock_outbound;
+    // Expect room for fewer values than are put, plus some change
+    EXPECT_CALL(mock_outbound, OutputBytesAvailable())
+        .WillOnce(Return((kNumAccepted * sizeof(TestValueType)) + (sizeof(TestValueType) - 1U)));
+    // Expect the accepted values to be posted in full chunks of staging, waiting only on the first
+    size_t num_received {0U};
+    EXPECT_CALL(mock_outbound, Post(_, _))
+        .Times(2)
+        .WillRepeatedly(Invoke(
+            [&](Span<uint8_t const> tx, std::chrono::microseconds timeout) -> MockOutbound::Result
+            {
+                EXPECT_EQ(((num_received == 0U) ? std::chrono::microseconds {1000} : std::chrono::microseconds::zero()),
+                          timeout);
+                EXPECT_EQ(0U, (tx.size() % sizeof(TestValueType)));
+                EXPECT_LE(tx.size(), (kStagingCount * sizeof(TestValueType)));
+
+                for (size_t i = 0U; i < (tx.size() / sizeof(TestValueType)); i++)
+                {
+                    auto value {*(reinterpret_cast<TestValueType const*>(tx.data() + (i * sizeof(TestValueType))))};
+                    EXPECT_EQ(static_cast<TestValueType>(num_received), value);
+                    num_received++;
+                }
+
+                return MockOutbound::Result::Success();
+            }));
+
+    // Start the test
+    Egress<TestValueType> test_egress {mock_outbound};
+    EXPECT_EQ(kNumAccepted, test_egress.PutMany(Span<TestValueType const> {values}, std::chrono::microseconds {1000}));
+    EXPECT_EQ(kNumAccepted, num_received);
+}
+
+/**
+ * @brief Test that objects laid out in memory exactly as they are encoded are posted straight from the caller's storage
+ *
+ */
+TEST(Session_Egress, wire_identical_skips_staging)
+{
+    using TestValueType = data::packet_t<uint32_t, uint16_t, uint8_t, uint8_t>;
+    static_assert(data::is_wire_identical_v<TestValueType>);
+
+    constexpr size_t kNumValues {4U};
+    TestValueType    values[kNumValues] {};
+    for (size_t i = 0U; i < kNumValues; i++)
+        data::packet_field_value<0>(values[i]) = static_cast<uint32_t>(i);
+
+    // Stage mock Outbound session
+    MockOutbound mock_outbound;
+    EXPECT_CALL(mock_outbound, OutputBytesAvailable()).WillRepeatedly(Return(std::numeric_limits<size_t>::max()));
+    // Expect one post for the single put and one for the entire burst, each over the objects themselves
+    EXPECT_CALL(mock_outbound, Post(_, _))
+        .WillOnce(Invoke(
+            [&](Span<uint8_t const> tx, std::chrono::microseconds timeout) -> MockOutbound::Result
+            {
+                static_cast<void>(timeout); // Avoid unused parameter
+
+                EXPECT_EQ(reinterpret_cast<uint8_t const*>(&values[1]), tx.data());
+                EXPECT_EQ(TestValueType::kSizeBytes, tx.size());
+                return MockOutbound::Result::Success();
+            }))
+        .WillOnce(Invoke(
+            [&](Span<uint8_t const> tx, std::chrono::microseconds timeout) -> MockOutbound::Result
+            {
+                static_cast<void>(timeout); // Avoid unused parameter
+
+                EXPECT_EQ(reinterpret_cast<uint8_t const*>(values), tx.data());
+                EXPECT_EQ((kNumValues * TestValueType::kSizeBytes), tx.size());
+                return MockOutbound::Result::Success();
+            }));
+
+    // Start the test
+    Egress<TestValueType> test_egress {mock_outbound};
+    ASSERT_TRUE(test_egress.Put(values[1]).IsSuccess());
+    EXPECT_EQ(kNumValues, test_egress.PutMany(Span<TestValueType const> {values}, std::chrono::microseconds {1000}));
+}
+
+/**
+ * @brief Test that a multi-part put to a session that can't lend out its storage is gathered in to one scalar post,
+ * which is handed the whole timeout, and that parts too large to gather are posted one by one in order
+ *
+ */
+TEST(Session_Egress, put_multipart_without_reservation)
+{
+    using TestValueType = uint32_t;
+
+    constexpr TestValueType             kValue {0xA1B2C3D4U};
+    constexpr std::chrono::microseconds kTestDuration {1000};
+    uint8_t const                       kTrailer[] {0x01, 0x02, 0x03};
+    uint8_t                             large[Outbound::kGatherSizeBytes] {};
+    large[Outbound::kGatherSizeBytes - 1U] = 0x5A;
+
+    // Stage mock Outbound session
+    MockOutbound mock_outbound;
+    EXPECT_CALL(mock_outbound, OutputBytesAvailable()).WillRepeatedly(Return(std::numeric_limits<size_t>::max()));
+    // Expect the small put as one transmission, then the large put's parts in order, all within the duration
+    std::string posted {};
+    size_t      num_posts {0U};
+    EXPECT_CALL(mock_outbound, Post(_, _))
+        .Times(3)
+        .WillRepeatedly(Invoke(
+            [&](Span<uint8_t const> tx, std::chrono::microseconds timeout) -> MockOutbound::Result
+            {
+                if (num_posts == 0U)
+                    EXPECT_EQ(kTestDuration, timeout);
+                else
+                    EXPECT_LE(timeout, kTestDuration);
+
+                num_posts++;
+                posted.append(reinterpret_cast<char const*>(tx.data()), tx.size());
+                return MockOutbound::Result::Success();
+            }));
+
+    // Start the test
+    Egress<TestValueType> test_egress {mock_outbound};
+    EXPECT_TRUE(test_egress.PutMultipart(kTestDuration, kValue, Span<uint8_t const> {kTrailer}).IsSuccess());
+    EXPECT_EQ(1U, num_posts);
+    ASSERT_EQ((sizeof(kValue) + sizeof(kTrailer)), posted.size());
+    EXPECT_EQ(0, std::memcmp(posted.data(), &kValue, sizeof(kValue)));
+    EXPECT_EQ(0, std::memcmp((posted.data() + sizeof(kValue)), kTrailer, sizeof(kTrailer)));
+
+    posted.clear();
+    EXPECT_TRUE(test_egress.PutMultipart(kTestDuration, kValue, Span<uint8_t const> {large}).IsSuccess());
+    ASSERT_EQ((sizeof(kValue) + sizeof(large)), posted.size());
+    EXPECT_EQ(0, std::memcmp(posted.data(), &kValue, sizeof(kValue)));
+    EXPECT_EQ(0, std::memcmp((posted.data() + sizeof(kValue)), large, sizeof(large)));
+}
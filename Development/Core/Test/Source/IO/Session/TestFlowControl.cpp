@@ -0,0 +1,263 @@
+#include "Core/Mocks/IO/Session/MockOutbound.hpp"
+
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/FlowControl.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+using ::testing::Return;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Session with flow control that can't lend out its storage, and records the timeout each Post is given
+class TimedSession final : public Outbound
+{
+public:
+    size_t OutputBytesAvailable() const noexcept override
+    {
+        return m_available_bytes.load();
+    }
+
+    Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override
+    {
+        static_cast<void>(tx); // Avoid unused warning
+        m_post_timeout = timeout;
+        return m_is_failing_posts ? Result::Failure() : Result::Success();
+    }
+
+    Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override
+    {
+        static_cast<void>(parts); // Avoid unused warning
+        m_post_timeout = timeout;
+        return m_is_failing_posts ? Result::Failure() : Result::Success();
+    }
+
+    FlowControl* GetFlowControl() noexcept override
+    {
+        return &m_flow_control;
+    }
+
+    /// @brief Frees up space as a consumer would
+    void Free(size_t size_bytes) noexcept
+    {
+        m_available_bytes.store(size_bytes);
+        m_flow_control.NotifyDrained(0U);
+    }
+
+    std::chrono::microseconds GetPostTimeout() const noexcept
+    {
+        return m_post_timeout;
+    }
+
+    /// @brief Makes every following Post fail, as a driver error would
+    void SetFailingPosts(bool is_failing) noexcept
+    {
+        m_is_failing_posts = is_failing;
+    }
+
+private:
+    std::atomic<size_t>       m_available_bytes {0U};
+    FlowControl               m_flow_control {};
+    std::chrono::microseconds m_post_timeout {0};
+    bool                      m_is_failing_posts {false};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FlowControl tests               ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that a blocking Put sleeps until the consumer frees space, and times out if it never does
+ *
+ */
+TEST(Session_FlowControl, blocking_put_wakes_on_drain)
+{
+    RingSession<8U>   ring;
+    Egress<uint32_t>  egress {ring};
+    Ingress<uint32_t> ingress {ring};
+
+    ASSERT_TRUE(egress.Put(1U).IsSuccess());
+    ASSERT_TRUE(egress.Put(2U).IsSuccess());
+    EXPECT_TRUE(egress.Put(3U).IsFailure());
+    EXPECT_TRUE(egress.Put(3U, std::chrono::microseconds {1000}).IsFailure());
+
+    std::thread consumer {[&]()
+                          {
+                              std::this_thread::sleep_for(std::chrono::milliseconds {5});
+                              uint32_t value {0U};
+                              static_cast<void>(ingress.Get(value));
+                          }};
+
+    EXPECT_TRUE(egress.Put(3U, std::chrono::microseconds {1000000}).IsSuccess());
+    consumer.join();
+
+    uint32_t value {0U};
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    EXPECT_EQ(2U, value);
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    EXPECT_EQ(3U, value);
+}
+
+/**
+ * @brief Test that watermark callbacks fire once per crossing, with hysteresis between the two watermarks
+ *
+ */
+TEST(Session_FlowControl, watermarks)
+{
+    RingSession<16U>  ring;
+    Egress<uint32_t>  egress {ring};
+    Ingress<uint32_t> ingress {ring};
+
+    std::vector<FlowControl::Watermark> crossings {};
+    auto record {[](FlowControl::Watermark watermark, void* context)
+                 { static_cast<std::vector<FlowControl::Watermark>*>(context)->push_back(watermark); }};
+
+    FlowControl& flow_control {*ring.GetFlowControl()};
+    EXPECT_TRUE(flow_control.SetWatermarks(8U, 8U, record, &crossings).IsFailure());
+    ASSERT_TRUE(flow_control.SetWatermarks(4U, 12U, record, &crossings).IsSuccess());
+
+    ASSERT_TRUE(egress.Put(1U).IsSuccess());
+    ASSERT_TRUE(egress.Put(2U).IsSuccess());
+    EXPECT_TRUE(crossings.empty());
+    ASSERT_TRUE(egress.Put(3U).IsSuccess());
+    ASSERT_TRUE(egress.Put(4U).IsSuccess());
+    ASSERT_EQ(1U, crossings.size());
+    EXPECT_EQ(FlowControl::Watermark::kHigh, crossings[0]);
+
+    // Nothing fires between the watermarks, whichever way the session moves
+    uint32_t value {0U};
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    ASSERT_TRUE(egress.Put(5U).IsSuccess());
+    EXPECT_EQ(1U, crossings.size());
+
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    ASSERT_EQ(2U, crossings.size());
+    EXPECT_EQ(FlowControl::Watermark::kLow, crossings[1]);
+}
+
+/**
+ * @brief Test that credit is only granted for free space, and that Put and PutMany spend it
+ *
+ */
+TEST(Session_FlowControl, credit)
+{
+    RingSession<16U>  ring;
+    Egress<uint32_t>  egress {ring};
+    Ingress<uint32_t> ingress {ring};
+
+    ASSERT_TRUE(egress.AcquireCredit(3U, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(3U, egress.GetCredit());
+    EXPECT_TRUE(egress.AcquireCredit(2U, std::chrono::microseconds {1000}).IsFailure()); // Only one more fits
+    EXPECT_EQ(3U, egress.GetCredit());
+
+    ASSERT_TRUE(egress.Put(1U).IsSuccess());
+    EXPECT_EQ(2U, egress.GetCredit());
+
+    uint32_t const kBurst[2U] {2U, 3U};
+    EXPECT_EQ(2U, egress.PutMany(Span<uint32_t const> {kBurst}, std::chrono::microseconds::zero()));
+    EXPECT_EQ(0U, egress.GetCredit());
+
+    // Credit waits on the consumer like any other Put
+    std::thread consumer {[&]()
+                          {
+                              std::this_thread::sleep_for(std::chrono::milliseconds {5});
+                              uint32_t value {0U};
+                              static_cast<void>(ingress.Get(value));
+                              static_cast<void>(ingress.Get(value));
+                          }};
+
+    EXPECT_TRUE(egress.AcquireCredit(3U, std::chrono::microseconds {1000000}).IsSuccess());
+    consumer.join();
+    EXPECT_EQ(3U, egress.GetCredit());
+}
+
+/**
+ * @brief Test that a PutMany whose post fails keeps the credit it would have spent
+ *
+ */
+TEST(Session_FlowControl, failed_put_many_keeps_credit)
+{
+    TimedSession     session {};
+    Egress<uint32_t> egress {session};
+
+    session.Free(64U);
+    ASSERT_TRUE(egress.AcquireCredit(4U, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(4U, egress.GetCredit());
+
+    uint32_t const kBurst[2U] {1U, 2U};
+    session.SetFailingPosts(true);
+    EXPECT_EQ(0U, egress.PutMany(Span<uint32_t const> {kBurst}, std::chrono::microseconds::zero()));
+    EXPECT_EQ(4U, egress.GetCredit());
+
+    session.SetFailingPosts(false);
+    EXPECT_EQ(2U, egress.PutMany(Span<uint32_t const> {kBurst}, std::chrono::microseconds::zero()));
+    EXPECT_EQ(2U, egress.GetCredit());
+}
+
+/**
+ * @brief Test that sessions without flow control are still checked once, and grant no credit
+ *
+ */
+TEST(Session_FlowControl, session_without_flow_control)
+{
+    MockOutbound     outbound {};
+    Egress<uint32_t> egress {outbound};
+
+    EXPECT_EQ(nullptr, outbound.GetFlowControl());
+    EXPECT_CALL(outbound, OutputBytesAvailable()).Times(1).WillOnce(Return(0U));
+    EXPECT_TRUE(egress.Put(1U, std::chrono::microseconds {1000}).IsFailure());
+
+    EXPECT_TRUE(egress.AcquireCredit(1U, std::chrono::microseconds::zero()).IsFailure());
+    EXPECT_EQ(0U, egress.GetCredit());
+}
+
+/**
+ * @brief Test that the time spent waiting for space is taken off the timeout that the Post is given
+ *
+ */
+TEST(Session_FlowControl, wait_and_post_share_the_timeout)
+{
+    constexpr std::chrono::microseconds kTimeout {1000000};
+    constexpr std::chrono::milliseconds kDrainDelay {50};
+
+    TimedSession     session {};
+    Egress<uint32_t> egress {session};
+
+    std::thread consumer {[&]()
+                          {
+                              std::this_thread::sleep_for(kDrainDelay);
+                              session.Free(64U);
+                          }};
+
+    EXPECT_TRUE(egress.Put(1U, kTimeout).IsSuccess());
+    consumer.join();
+    EXPECT_LE(session.GetPostTimeout(), (kTimeout - kDrainDelay));
+
+    // The multipart path shares it as well
+    session.Free(0U);
+    std::thread second_consumer {[&]()
+                                 {
+                                     std::this_thread::sleep_for(kDrainDelay);
+                                     session.Free(64U);
+                                 }};
+
+    uint8_t const kTrailer[2U] {1U, 2U};
+    EXPECT_TRUE(egress.PutMultipart(kTimeout, 1U, Span<uint8_t const> {kTrailer}).IsSuccess());
+    second_consumer.join();
+    EXPECT_LE(session.GetPostTimeout(), (kTimeout - kDrainDelay));
+}
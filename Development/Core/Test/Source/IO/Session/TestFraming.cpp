@@ -0,0 +1,284 @@
+#include <Core/Data/Crc.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Framing.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Sample = data::packet_t<uint32_t, uint16_t, uint8_t>;
+
+/// @brief Session that only copies, so that the framing stages must fall back from Reserve and Peek
+class CopyingSession final : public Outbound, public Inbound
+{
+public:
+    using Result = BinaryResult;
+
+    size_t OutputBytesAvailable() const noexcept override
+    {
+        return m_ring.OutputBytesAvailable();
+    }
+
+    Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override
+    {
+        return m_ring.Post(tx, timeout);
+    }
+
+    Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override
+    {
+        return m_ring.Post(parts, timeout);
+    }
+
+    size_t InputBytesAvailable() const noexcept override
+    {
+        return m_ring.InputBytesAvailable();
+    }
+
+    Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override
+    {
+        return m_ring.Request(rx, timeout);
+    }
+
+private:
+    RingSession<256U> m_ring {};
+};
+
+/// @brief Posts raw bytes to a session
+template<size_t SizeV>
+static void post_raw(Outbound& session, std::array<uint8_t, SizeV> const& bytes)
+{
+    ASSERT_TRUE(session.Post(Span<uint8_t const> {bytes.data(), SizeV}, std::chrono::microseconds::zero()).IsSuccess());
+}
+
+/// @brief Requests raw bytes from a session
+template<size_t SizeV>
+static void request_raw(Inbound& session, std::array<uint8_t, SizeV>& bytes)
+{
+    ASSERT_TRUE(session.Request(Span<uint8_t> {bytes.data(), SizeV}, std::chrono::microseconds::zero()).IsSuccess());
+}
+
+static Sample make_sample(uint32_t value)
+{
+    return Sample {value, static_cast<uint16_t>(value >> 4U), static_cast<uint8_t>(value)};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Framing tests                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Session_Framing, frame_wire_format)
+{
+    RingSession<256U> link {};
+    FramedOutbound    framed_out {link};
+
+    std::array<uint8_t, 3U> const kPayload {0x01U, 0x02U, 0x03U};
+    post_raw(framed_out, kPayload);
+    ASSERT_EQ(link.InputBytesAvailable(), (kPayload.size() + FrameFormat::kOverheadBytes));
+
+    std::array<uint8_t, 12U> frame {};
+    request_raw(link, frame);
+
+    EXPECT_EQ(frame[0U], FrameFormat::kSync0);
+    EXPECT_EQ(frame[1U], FrameFormat::kSync1);
+    EXPECT_EQ(frame[2U], 3U);
+    EXPECT_EQ(frame[3U], 0U);
+    EXPECT_EQ(frame[4U], data::crc8(Span<uint8_t const> {(frame.data() + 2U), size_t {2U}}));
+    EXPECT_EQ(frame[5U], 0x01U);
+    EXPECT_EQ(frame[7U], 0x03U);
+
+    uint32_t const kCrc {data::crc32(Span<uint8_t const> {kPayload.data(), kPayload.size()})};
+    EXPECT_EQ(frame[8U], static_cast<uint8_t>(kCrc));
+    EXPECT_EQ(frame[11U], static_cast<uint8_t>(kCrc >> 24U));
+}
+
+TEST(Session_Framing, egress_to_ingress_in_place)
+{
+    RingSession<256U>  link {};
+    FramedOutbound     framed_out {link};
+    FramedInbound<64U> framed_in {link};
+
+    Egress<Sample>  egress {framed_out};
+    Ingress<Sample> ingress {framed_in};
+
+    ASSERT_TRUE(egress.Put(make_sample(0x12345678U)).IsSuccess());
+    ASSERT_TRUE(egress.Put(make_sample(0x0BADF00DU)).IsSuccess());
+    ASSERT_EQ(link.InputBytesAvailable(), (2U * (Sample::kSizeBytes + FrameFormat::kOverheadBytes)));
+
+    EXPECT_EQ(framed_in.Update(), 2U);
+    EXPECT_EQ(framed_in.InputBytesAvailable(), (2U * Sample::kSizeBytes));
+
+    Sample received {};
+    ASSERT_TRUE(ingress.Get(received).IsSuccess());
+    EXPECT_EQ(data::packet_field_value<0U>(received), 0x12345678U);
+    ASSERT_TRUE(ingress.Get(received).IsSuccess());
+    EXPECT_EQ(data::packet_field_value<0U>(received), 0x0BADF00DU);
+    EXPECT_EQ(framed_in.GetDroppedFrameCount(), 0U);
+}
+
+TEST(Session_Framing, egress_to_ingress_through_copies)
+{
+    CopyingSession     link {};
+    FramedOutbound     framed_out {link};
+    FramedInbound<64U> framed_in {link};
+
+    Egress<Sample>  egress {framed_out};
+    Ingress<Sample> ingress {framed_in};
+
+    ASSERT_TRUE(egress.Put(make_sample(42U)).IsSuccess());
+
+    // Request pulls the frame itself
+    std::array<uint8_t, Sample::kSizeBytes> payload {};
+    ASSERT_TRUE(framed_in.Request(Span<uint8_t> {payload.data(), payload.size()}, std::chrono::milliseconds {10})
+                    .IsSuccess());
+    EXPECT_EQ(payload[0U], 42U);
+    EXPECT_EQ(framed_in.InputBytesAvailable(), 0U);
+}
+
+TEST(Session_Framing, vectored_post_is_one_frame)
+{
+    RingSession<256U>  link {};
+    FramedOutbound     framed_out {link};
+    FramedInbound<64U> framed_in {link};
+
+    std::array<uint8_t, 2U> const             kFirst {0xAAU, 0xBBU};
+    std::array<uint8_t, 3U> const             kSecond {0xCCU, 0xDDU, 0xEEU};
+    std::array<Span<uint8_t const>, 2U> const kParts {Span<uint8_t const> {kFirst.data(), kFirst.size()},
+                                                      Span<uint8_t const> {kSecond.data(), kSecond.size()}};
+    ASSERT_TRUE(framed_out.Post(Span<Span<uint8_t const> const> {kParts.data(), kParts.size()},
+                                std::chrono::microseconds::zero())
+                    .IsSuccess());
+
+    EXPECT_EQ(framed_in.Update(), 1U);
+    Span<uint8_t const> const payload {framed_in.Peek(5U)};
+    ASSERT_EQ(payload.size(), 5U);
+    EXPECT_EQ(payload[1U], 0xBBU);
+    EXPECT_EQ(payload[2U], 0xCCU);
+    EXPECT_TRUE(framed_in.Consume(5U).IsSuccess());
+}
+
+TEST(Session_Framing, corrupt_payload_drops_only_its_frame)
+{
+    RingSession<256U>  link {};
+    RingSession<256U>  wire {};
+    FramedOutbound     framed_out {wire};
+    FramedInbound<64U> framed_in {link};
+
+    // Frame two payloads, then corrupt the first on its way across the link
+    std::array<uint8_t, 4U> const kPayload {0x10U, 0x20U, 0x30U, 0x40U};
+    post_raw(framed_out, kPayload);
+    post_raw(framed_out, kPayload);
+
+    std::array<uint8_t, 2U * (4U + FrameFormat::kOverheadBytes)> frames {};
+    request_raw(wire, frames);
+    frames[FrameFormat::kHeaderSizeBytes + 1U] ^= 0x01U;
+    post_raw(link, frames);
+
+    EXPECT_EQ(framed_in.Update(), 1U);
+    EXPECT_EQ(framed_in.GetDroppedFrameCount(), 1U);
+    EXPECT_EQ(framed_in.InputBytesAvailable(), kPayload.size());
+    EXPECT_EQ(link.InputBytesAvailable(), 0U);
+}
+
+TEST(Session_Framing, resynchronizes_after_noise_and_false_sync)
+{
+    RingSession<256U>  link {};
+    RingSession<256U>  wire {};
+    FramedOutbound     framed_out {wire};
+    FramedInbound<64U> framed_in {link};
+
+    // Noise, then a false sync whose header check fails and which hides the real sync within its header
+    std::array<uint8_t, 6U> const kNoise {0x00U, 0xA5U, 0x13U, FrameFormat::kSync0, FrameFormat::kSync1, 0x77U};
+    post_raw(link, kNoise);
+
+    std::array<uint8_t, 2U> const kPayload {0x5AU, 0xA5U};
+    post_raw(framed_out, kPayload);
+
+    std::array<uint8_t, 2U + FrameFormat::kOverheadBytes> frame {};
+    request_raw(wire, frame);
+    post_raw(link, frame);
+
+    EXPECT_EQ(framed_in.Update(), 1U);
+    Span<uint8_t const> const payload {framed_in.Peek(2U)};
+    ASSERT_EQ(payload.size(), 2U);
+    EXPECT_EQ(payload[0U], 0x5AU);
+    EXPECT_EQ(payload[1U], 0xA5U);
+}
+
+TEST(Session_Framing, full_buffer_leaves_frames_in_session)
+{
+    RingSession<256U>  link {};
+    FramedOutbound     framed_out {link};
+    FramedInbound<12U> framed_in {link};
+
+    std::array<uint8_t, 8U> const kPayload {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+    post_raw(framed_out, kPayload);
+    post_raw(framed_out, kPayload);
+
+    // Only one payload fits until it is consumed
+    EXPECT_EQ(framed_in.Update(), 1U);
+    EXPECT_GT(link.InputBytesAvailable(), 0U);
+    EXPECT_TRUE(framed_in.Consume(kPayload.size()).IsSuccess());
+
+    EXPECT_EQ(framed_in.Update(), 1U);
+    EXPECT_EQ(framed_in.InputBytesAvailable(), kPayload.size());
+    EXPECT_EQ(link.InputBytesAvailable(), 0U);
+    EXPECT_EQ(framed_in.GetDroppedFrameCount(), 0U);
+}
+
+TEST(Session_Framing, full_buffer_through_copies_loses_no_bytes)
+{
+    RingSession<256U>  wire {};
+    CopyingSession     link {};
+    FramedOutbound     framed_out {wire};
+    FramedInbound<12U> framed_in {link};
+
+    std::array<uint8_t, 8U> const kPayload {1U, 2U, 3U, 4U, 5U, 6U, 7U, 8U};
+    post_raw(framed_out, kPayload);
+    post_raw(framed_out, kPayload);
+
+    constexpr size_t                          kFrameSizeBytes {kPayload.size() + FrameFormat::kOverheadBytes};
+    std::array<uint8_t, 2U * kFrameSizeBytes> frames {};
+    request_raw(wire, frames);
+
+    // Stop one byte in to the second frame, so that its header is pulled while the buffer is still full
+    Span<uint8_t const> const kFramesSpan {frames.data(), frames.size()};
+    ASSERT_TRUE(link.Post(kFramesSpan.first(kFrameSizeBytes + 1U), std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(framed_in.Update(), 1U);
+    ASSERT_TRUE(link.Post(kFramesSpan.subspan(kFrameSizeBytes + 1U), std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(framed_in.Update(), 0U);
+
+    std::array<uint8_t, 8U> payload {};
+    request_raw(framed_in, payload);
+    EXPECT_EQ(framed_in.Update(), 1U);
+    request_raw(framed_in, payload);
+    EXPECT_EQ(payload, kPayload);
+    EXPECT_EQ(framed_in.GetDroppedFrameCount(), 0U);
+    EXPECT_EQ(link.InputBytesAvailable(), 0U);
+}
+
+TEST(Session_Framing, oversized_frame_is_skipped)
+{
+    RingSession<256U> link {};
+    FramedOutbound    framed_out {link};
+    FramedInbound<4U> framed_in {link};
+
+    std::array<uint8_t, 8U> const kLarge {};
+    std::array<uint8_t, 2U> const kSmall {9U, 8U};
+    post_raw(framed_out, kLarge);
+    post_raw(framed_out, kSmall);
+
+    EXPECT_EQ(framed_in.Update(), 1U);
+    EXPECT_EQ(framed_in.GetDroppedFrameCount(), 1U);
+    EXPECT_EQ(framed_in.InputBytesAvailable(), kSmall.size());
+}
@@ -1,6 +1,8 @@
 #include "Core/Mocks/IO/Session/MockInbound.hpp"
 
+#include <Core/Data/Field.hpp>
 #include <Core/Data/Footprint.hpp>
+#include <Core/Data/Packet.hpp>
 #include <Core/IO/Session/Ingress.hpp>
 
 #include <gmock/gmock.h>
@@ -160,3 +162,209 @@ TEST(Session_Ingress, session_request_fails)
     Ingress<TestValueType> test_ingress {mock_inbound};
     ASSERT_TRUE(test_ingress.Get(test_value).IsFailure());
 }
+
+/**
+ * @brief Test that a block fetched from an Ingress is requested in as few transmissions as possible, and that only as
+ * many whole objects as the Inbound session buffer holds are read
+ *
+ */
+TEST(Session_Ingress, get_many)
+{
+    using TestValueType = int;
+
+    constexpr size_t kNumValues {100U};
+    constexpr size_t kNumAvailable {90U};
+    constexpr size_t kStagingCount {Ingress<TestValueType>::kGetManyStagingSizeBytes / sizeof(TestValueType)};
+
+    // Stage mock Inbound session
+    MockInbound mock_inbound;
+    // Expect fewer whole values than are asked for, plus some change
+    EXPECT_CALL(mock_inbound, InputBytesAvailable())
+        .WillOnce(Return((kNumAvailable * sizeof(TestValueType)) + (sizeof(TestValueType) - 1U)));
+    // Expect the available values to be requested in full chunks of staging, waiting only on the first
+    size_t num_sent {0U};
+    EXPECT_CALL(mock_inbound, Request(_, _))
+        .Times(2)
+        .WillRepeatedly(Invoke(
+            [&](Span<uint8_t> rx, std::chrono::microseconds timeout) -> MockInbound::Result
+            {
+                EXPECT_EQ(((num_sent == 0U) ? std::chrono::microseconds {1000} : std::chrono::microseconds::zero()),
+                          timeout);
+                EXPECT_EQ(0U, (rx.size() % sizeof(TestValueType)));
+                EXPECT_LE(rx.size(), (kStagingCount * sizeof(TestValueType)));
+
+                for (size_t i = 0U; i < (rx.size() / sizeof(TestValueType)); i++)
+                {
+                    TestValueType const value {static_cast<TestValueType>(num_sent)};
+                    std::memcpy((rx.data() + (i * sizeof(TestValueType))), &value, sizeof(TestValueType));
+                    num_sent++;
+                }
+
+                return MockInbound::Result::Success();
+            }));
+
+    // Start the test
+    TestValueType          test_values[kNumValues] {};
+    Ingress<TestValueType> test_ingress {mock_inbound};
+    ASSERT_EQ(kNumAvailable,
+              test_ingress.GetMany(Span<TestValueType> {test_values}, std::chrono::microseconds {1000}));
+    for (size_t i = 0U; i < kNumAvailable; i++)
+        EXPECT_EQ(static_cast<TestValueType>(i), test_values[i]);
+}
+
+/**
+ * @brief Test that a block of objects which may fail to decode is requested one object at a time, so that a failure
+ * partway through leaves every object after it in the Inbound session
+ *
+ */
+TEST(Session_Ingress, get_many_stops_at_decode_failure)
+{
+    using TestValueType = data::VarField<uint32_t>;
+
+    constexpr size_t kSizeBytes {data::footprint_size_bytes_v<TestValueType>};
+    constexpr size_t kNumValues {3U};
+
+    // The second object never ends its varint and fails to decode
+    uint8_t source[kNumValues * kSizeBytes] {};
+    source[0U]              = 0x01;
+    source[2U * kSizeBytes] = 0x03;
+    for (size_t i = 0U; i < kSizeBytes; i++)
+        source[kSizeBytes + i] = 0x80;
+
+    // Stage mock Inbound session
+    MockInbound mock_inbound;
+    size_t      num_consumed {0U};
+    EXPECT_CALL(mock_inbound, InputBytesAvailable())
+        .WillRepeatedly(Invoke([&]() -> size_t { return (sizeof(source) - num_consumed); }));
+    // Expect every request to cover exactly one object
+    EXPECT_CALL(mock_inbound, Request(_, _))
+        .Times(3)
+        .WillRepeatedly(Invoke(
+            [&](Span<uint8_t> rx, std::chrono::microseconds timeout) -> MockInbound::Result
+            {
+                static_cast<void>(timeout); // Avoid unused parameter
+
+                EXPECT_EQ(kSizeBytes, rx.size());
+                std::memcpy(rx.data(), (source + num_consumed), rx.size());
+                num_consumed += rx.size();
+                return MockInbound::Result::Success();
+            }));
+
+    // Start the test
+    TestValueType          test_values[kNumValues] {};
+    Ingress<TestValueType> test_ingress {mock_inbound};
+    ASSERT_EQ(1U, test_ingress.GetMany(Span<TestValueType> {test_values}, std::chrono::microseconds::zero()));
+    EXPECT_EQ(1U, test_values[0U].value);
+    EXPECT_EQ((2U * kSizeBytes), num_consumed);
+
+    // The object after the failure is still there to be read
+    ASSERT_EQ(1U, test_ingress.GetMany(Span<TestValueType> {test_values}, std::chrono::microseconds::zero()));
+    EXPECT_EQ(3U, test_values[0U].value);
+}
+
+/**
+ * @brief Test that objects laid out in memory exactly as they are encoded are requested straight in to the caller's
+ * storage
+ *
+ */
+TEST(Session_Ingress, wire_identical_skips_staging)
+{
+    using TestValueType = data::packet_t<uint32_t, uint16_t, uint8_t, uint8_t>;
+    static_assert(data::is_wire_identical_v<TestValueType>);
+
+    constexpr size_t kNumValues {4U};
+    TestValueType    test_value {};
+    TestValueType    test_values[kNumValues] {};
+
+    // Stage mock Inbound session
+    MockInbound mock_inbound;
+    EXPECT_CALL(mock_inbound, InputBytesAvailable()).WillRepeatedly(Return(std::numeric_limits<size_t>::max()));
+    // Expect one request for the single get and one for the entire block, each over the objects themselves
+    auto const fill_values = [](Span<uint8_t> rx)
+    {
+        for (size_t i = 0U; i < (rx.size() / TestValueType::kSizeBytes); i++)
+        {
+            uint32_t const kValue {static_cast<uint32_t>(i + 1U)};
+            std::memcpy((rx.data() + (i * TestValueType::kSizeBytes)), &kValue, sizeof(kValue));
+        }
+    };
+    EXPECT_CALL(mock_inbound, Request(_, _))
+        .WillOnce(Invoke(
+            [&](Span<uint8_t> rx, std::chrono::microseconds timeout) -> MockInbound::Result
+            {
+                static_cast<void>(timeout); // Avoid unused parameter
+
+                EXPECT_EQ(reinterpret_cast<uint8_t*>(&test_value), rx.data());
+                EXPECT_EQ(TestValueType::kSizeBytes, rx.size());
+                fill_values(rx);
+                return MockInbound::Result::Success();
+            }))
+        .WillOnce(Invoke(
+            [&](Span<uint8_t> rx, std::chrono::microseconds timeout) -> MockInbound::Result
+            {
+                static_cast<void>(timeout); // Avoid unused parameter
+
+                EXPECT_EQ(reinterpret_cast<uint8_t*>(test_values), rx.data());
+                EXPECT_EQ((kNumValues * TestValueType::kSizeBytes), rx.size());
+                fill_values(rx);
+                return MockInbound::Result::Success();
+            }));
+
+    // Start the test
+    Ingress<TestValueType> test_ingress {mock_inbound};
+    ASSERT_TRUE(test_ingress.Get(test_value, std::chrono::microseconds {1000}).IsSuccess());
+    EXPECT_EQ(1U, data::packet_field_value<0>(test_value));
+
+    ASSERT_EQ(kNumValues, test_ingress.GetMany(Span<TestValueType> {test_values}, std::chrono::microseconds {1000}));
+    for (size_t i = 0U; i < kNumValues; i++)
+        EXPECT_EQ((i + 1U), data::packet_field_value<0>(test_values[i]));
+}
+
+/**
+ * @brief Test that a vectored request from a session that can't lend out its storage is made with one scalar request,
+ * which is handed the whole timeout, and that parts too large to scatter are requested one by one in order
+ *
+ */
+TEST(Session_Ingress, vectored_request_without_peek)
+{
+    constexpr std::chrono::microseconds kTestDuration {1000};
+
+    // Stage mock Inbound session serving a counting byte sequence
+    MockInbound mock_inbound;
+    size_t      num_served {0U};
+    size_t      num_requests {0U};
+    EXPECT_CALL(mock_inbound, InputBytesAvailable()).WillRepeatedly(Return(std::numeric_limits<size_t>::max()));
+    EXPECT_CALL(mock_inbound, Request(_, _))
+        .Times(3)
+        .WillRepeatedly(Invoke(
+            [&](Span<uint8_t> rx, std::chrono::microseconds timeout) -> MockInbound::Result
+            {
+                if (num_requests == 0U)
+                    EXPECT_EQ(kTestDuration, timeout);
+                else
+                    EXPECT_LE(timeout, kTestDuration);
+
+                num_requests++;
+                for (uint8_t& byte : rx)
+                    byte = static_cast<uint8_t>(num_served++);
+
+                return MockInbound::Result::Success();
+            }));
+
+    // Start the test
+    Inbound&      session {mock_inbound};
+    uint8_t       head[2U] {};
+    uint8_t       tail[3U] {};
+    Span<uint8_t> parts[] {Span<uint8_t> {head}, Span<uint8_t> {tail}};
+    ASSERT_TRUE(session.Request(Span<Span<uint8_t> const> {parts}, kTestDuration).IsSuccess());
+    EXPECT_EQ(1U, num_requests);
+    EXPECT_EQ(1U, head[1U]);
+    EXPECT_EQ(4U, tail[2U]);
+
+    uint8_t       large[Inbound::kScatterSizeBytes] {};
+    Span<uint8_t> large_parts[] {Span<uint8_t> {head}, Span<uint8_t> {large}};
+    ASSERT_TRUE(session.Request(Span<Span<uint8_t> const> {large_parts}, kTestDuration).IsSuccess());
+    EXPECT_EQ(6U, head[1U]);
+    EXPECT_EQ(7U, large[0U]);
+    EXPECT_EQ(static_cast<uint8_t>(6U + Inbound::kScatterSizeBytes), large[Inbound::kScatterSizeBytes - 1U]);
+}
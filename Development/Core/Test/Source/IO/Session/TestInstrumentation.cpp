@@ -0,0 +1,82 @@
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/Instrumentation.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Instrumentation tests           ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that puts, gets, rejections and timeouts are counted when instrumentation is enabled, and that nothing
+ * is counted otherwise
+ *
+ */
+TEST(IO_Session_Instrumentation, counts_session_io)
+{
+    RingSession<8U>   ring;
+    Egress<uint32_t>  egress {ring};
+    Ingress<uint32_t> ingress {ring};
+
+    SessionStatistics const before {scrape_session_statistics()};
+
+    uint32_t received {0U};
+    EXPECT_TRUE(egress.Put(0xDEADBEEF).IsSuccess());
+    EXPECT_TRUE(egress.Put(0xCAFEF00D).IsSuccess());
+    EXPECT_TRUE(egress.Put(0x12345678).IsFailure()); // Ring is full
+    EXPECT_TRUE(ingress.Get(received).IsSuccess());
+    EXPECT_TRUE(ingress.Get(received).IsSuccess());
+    EXPECT_TRUE(ingress.Get(received).IsFailure()); // Ring is empty
+
+    uint8_t rx[4U];
+    EXPECT_TRUE(ring.Request(Span<uint8_t> {rx}, std::chrono::microseconds {100}).IsFailure());
+
+    SessionStatistics const after {scrape_session_statistics()};
+    auto const              delta {[&](SessionCounter counter) -> uint64_t
+                      { return (after.GetCounter(counter) - before.GetCounter(counter)); }};
+
+    uint64_t const expected_puts {kIsSessionInstrumented ? 2U : 0U};
+    uint64_t const expected_rejections {kIsSessionInstrumented ? 1U : 0U};
+    EXPECT_EQ(expected_puts, delta(SessionCounter::kPuts));
+    EXPECT_EQ(expected_puts, delta(SessionCounter::kGets));
+    EXPECT_EQ((expected_puts * sizeof(uint32_t)), delta(SessionCounter::kBytesPosted));
+    EXPECT_EQ((expected_puts * sizeof(uint32_t)), delta(SessionCounter::kBytesRequested));
+    EXPECT_EQ(expected_rejections, delta(SessionCounter::kOutputRejections));
+    EXPECT_EQ(expected_rejections, delta(SessionCounter::kInputRejections));
+    EXPECT_EQ(expected_rejections, delta(SessionCounter::kWaitTimeouts));
+
+    uint64_t const encode_samples {after.GetSampleCount(SessionHistogram::kEncodeTime)
+                                   - before.GetSampleCount(SessionHistogram::kEncodeTime)};
+    EXPECT_EQ(expected_puts, encode_samples);
+}
+
+/**
+ * @brief Test that counts from a thread that has exited are still scraped
+ *
+ */
+TEST(IO_Session_Instrumentation, outlives_threads)
+{
+    RingSession<64U> ring;
+    Egress<uint8_t>  egress {ring};
+
+    SessionStatistics const before {scrape_session_statistics()};
+
+    std::thread producer {[&]()
+                          {
+                              for (uint8_t i = 0U; i < 10U; i++)
+                                  static_cast<void>(egress.Put(i));
+                          }};
+    producer.join();
+
+    SessionStatistics const after {scrape_session_statistics()};
+    uint64_t const          expected_puts {kIsSessionInstrumented ? 10U : 0U};
+    EXPECT_EQ(expected_puts, (after.GetCounter(SessionCounter::kPuts) - before.GetCounter(SessionCounter::kPuts)));
+}
@@ -0,0 +1,193 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/MappedFile.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+
+#include <unistd.h>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Sample = data::packet_t<uint32_t, uint16_t>;
+
+/// @brief Large record, a few of which fill a one page segment
+using Record = std::array<uint8_t, 1000U>;
+
+/// @brief Temporary directory that recordings are made in
+class MappedFileRecording : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        char directory[] {"/tmp/shmit-mapped-XXXXXX"};
+        ASSERT_NE(mkdtemp(directory), nullptr);
+        m_directory = directory;
+        m_prefix    = m_directory + "/recording";
+    }
+
+    void TearDown() override
+    {
+        static_cast<void>(std::system(("rm -rf " + m_directory).c_str()));
+    }
+
+    bool SegmentExists(size_t index) const
+    {
+        char path[64U];
+        static_cast<void>(std::snprintf(path, sizeof(path), ".%06zu", index));
+        return (access((m_prefix + path).c_str(), F_OK) == 0);
+    }
+
+    std::string m_directory {};
+    std::string m_prefix {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MappedFile tests                ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(MappedFileRecording, record_and_replay)
+{
+    {
+        MappedFileOutbound outbound {m_prefix.c_str(), 4096U};
+        ASSERT_TRUE(outbound.Open().IsSuccess());
+        EXPECT_GE(outbound.OutputBytesAvailable(), 4096U);
+
+        Egress<Sample> egress {outbound};
+        for (uint32_t i = 0U; i < 100U; i++)
+            ASSERT_TRUE(egress.Put(Sample {i, static_cast<uint16_t>(i * 2U)}).IsSuccess());
+    }
+
+    MappedFileInbound inbound {m_prefix.c_str()};
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+    EXPECT_EQ(inbound.InputBytesAvailable(), (100U * Sample::kSizeBytes));
+
+    Ingress<Sample> ingress {inbound};
+    for (uint32_t i = 0U; i < 100U; i++)
+    {
+        Sample received {};
+        ASSERT_TRUE(ingress.Get(received).IsSuccess());
+        EXPECT_EQ(data::packet_field_value<0U>(received), i);
+        EXPECT_EQ(data::packet_field_value<1U>(received), (i * 2U));
+    }
+
+    Sample received {};
+    EXPECT_TRUE(ingress.Get(received).IsFailure());
+}
+
+TEST_F(MappedFileRecording, segments_rotate)
+{
+    size_t num_segments {0U};
+    {
+        MappedFileOutbound outbound {m_prefix.c_str(), 1U}; // Rounded up to one page
+        ASSERT_TRUE(outbound.Open().IsSuccess());
+        EXPECT_TRUE(SegmentExists(1U)); // Standby is mapped ahead
+
+        Record record {};
+        for (uint8_t i = 0U; i < 12U; i++)
+        {
+            record.fill(i);
+            ASSERT_TRUE(outbound.Post(Span<uint8_t const> {record.data(), record.size()}, std::chrono::milliseconds {1})
+                            .IsSuccess());
+        }
+
+        num_segments = (outbound.GetSegmentIndex() + 1U);
+        EXPECT_GT(num_segments, 1U);
+
+        // Too large for any segment
+        std::array<uint8_t, 8192U> const kOversized {};
+        Span<uint8_t const> const        oversized_span {kOversized.data(), kOversized.size()};
+        EXPECT_TRUE(outbound.Post(oversized_span, std::chrono::milliseconds {1}).IsFailure());
+    }
+
+    // The unused standby is removed when recording stops
+    EXPECT_FALSE(SegmentExists(num_segments));
+
+    MappedFileInbound inbound {m_prefix.c_str()};
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+
+    Record record {};
+    for (uint8_t i = 0U; i < 12U; i++)
+    {
+        ASSERT_TRUE(inbound.Request(Span<uint8_t> {record.data(), record.size()}, std::chrono::microseconds::zero())
+                        .IsSuccess());
+        EXPECT_EQ(record.front(), i);
+        EXPECT_EQ(record.back(), i);
+    }
+
+    EXPECT_EQ(inbound.GetSegmentIndex(), (num_segments - 1U));
+    EXPECT_EQ(inbound.Update(), 0U);
+}
+
+TEST_F(MappedFileRecording, follows_live_writer)
+{
+    MappedFileOutbound outbound {m_prefix.c_str(), 1U};
+    ASSERT_TRUE(outbound.Open().IsSuccess());
+
+    MappedFileInbound inbound {m_prefix.c_str()};
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+    EXPECT_EQ(inbound.InputBytesAvailable(), 0U);
+
+    // Encoded in place through Reserve/Commit
+    Span<uint8_t> reserved {outbound.Reserve(4U)};
+    ASSERT_EQ(reserved.size(), 4U);
+    reserved[0U] = 0x12U;
+    ASSERT_TRUE(outbound.Commit(2U).IsSuccess());
+
+    Span<uint8_t const> peeked {inbound.Peek(2U)};
+    ASSERT_EQ(peeked.size(), 2U);
+    EXPECT_EQ(peeked[0U], 0x12U);
+    EXPECT_TRUE(inbound.Consume(2U).IsSuccess());
+
+    // A maintenance thread keeps the standby mapped while the writer rotates through several segments
+    std::atomic<bool> is_done {false};
+    std::thread       maintenance {[&]()
+                             {
+                                 while (!is_done.load())
+                                 {
+                                     static_cast<void>(outbound.PrepareNextSegment());
+                                     std::this_thread::yield();
+                                 }
+                             }};
+
+    Record record {};
+    Record received {};
+    for (uint8_t i = 0U; i < 20U; i++)
+    {
+        record.fill(i);
+        ASSERT_TRUE(outbound.Post(Span<uint8_t const> {record.data(), record.size()}, std::chrono::milliseconds {100})
+                        .IsSuccess());
+        ASSERT_TRUE(inbound.Request(Span<uint8_t> {received.data(), received.size()}, std::chrono::milliseconds {100})
+                        .IsSuccess());
+        EXPECT_EQ(received.back(), i);
+    }
+
+    is_done.store(true);
+    maintenance.join();
+    EXPECT_EQ(inbound.GetSegmentIndex(), outbound.GetSegmentIndex());
+}
+
+TEST_F(MappedFileRecording, open_missing_recording)
+{
+    MappedFileInbound inbound {m_prefix.c_str()};
+    EXPECT_TRUE(inbound.Open().IsFailure());
+    EXPECT_EQ(inbound.InputBytesAvailable(), 0U);
+    EXPECT_TRUE(inbound.Peek(1U).size() == 0U);
+
+    MappedFileOutbound outbound {(m_directory + "/missing/recording").c_str(), 1U};
+    EXPECT_TRUE(outbound.Open().IsFailure());
+    EXPECT_EQ(outbound.OutputBytesAvailable(), 0U);
+}
@@ -0,0 +1,188 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Session/MessageSet.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Heartbeat = data::packet_t<uint32_t>;
+using Position  = data::packet_t<float, float, float>;
+using Status    = data::packet_t<uint8_t, uint16_t>;
+
+using TestMessages = MessageSet<Heartbeat, Position, Status>;
+
+/// @brief Records which message was handled last
+struct RecordingHandler
+{
+    void operator()(Heartbeat const& message)
+    {
+        handled_tag = TestMessages::TagOf<Heartbeat>();
+        heartbeat   = data::packet_field_value<0U>(message);
+    }
+
+    void operator()(Position const& message)
+    {
+        handled_tag = TestMessages::TagOf<Position>();
+        x           = data::packet_field_value<0U>(message);
+    }
+
+    void operator()(Status const& message)
+    {
+        handled_tag = TestMessages::TagOf<Status>();
+        status      = data::packet_field_value<1U>(message);
+    }
+
+    size_t   handled_tag {TestMessages::kMessageCount};
+    uint32_t heartbeat {0U};
+    float    x {0.0F};
+    uint16_t status {0U};
+};
+
+/// @brief Session that only copies, so that MessageSet must fall back from Reserve and Peek
+class CopyingSession final : public Outbound, public Inbound
+{
+public:
+    using Result = BinaryResult;
+
+    size_t OutputBytesAvailable() const noexcept override
+    {
+        return m_ring.OutputBytesAvailable();
+    }
+
+    Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override
+    {
+        return m_ring.Post(tx, timeout);
+    }
+
+    size_t InputBytesAvailable() const noexcept override
+    {
+        return m_ring.InputBytesAvailable();
+    }
+
+    Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override
+    {
+        return m_ring.Request(rx, timeout);
+    }
+
+private:
+    RingSession<256U> m_ring {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MessageSet tests                ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Session_MessageSet, tags_follow_type_order)
+{
+    static_assert(std::is_same<TestMessages::tag_type, uint8_t>::value);
+    static_assert(TestMessages::TagOf<Heartbeat>() == 0U);
+    static_assert(TestMessages::TagOf<Position>() == 1U);
+    static_assert(TestMessages::TagOf<Status>() == 2U);
+    static_assert(TestMessages::SizeOf<Position>() == (1U + Position::kSizeBytes));
+    static_assert(TestMessages::kMaxMessageSizeBytes == (1U + Position::kSizeBytes));
+}
+
+TEST(Session_MessageSet, put_encodes_tag_then_payload)
+{
+    RingSession<256U> session {};
+    ASSERT_TRUE(TestMessages::Put(session, Status {uint8_t {7U}, uint16_t {0xBEEF}}, std::chrono::microseconds::zero())
+                    .IsSuccess());
+    ASSERT_EQ(session.InputBytesAvailable(), TestMessages::SizeOf<Status>());
+
+    Span<uint8_t const> encoded {session.Peek(TestMessages::SizeOf<Status>())};
+    ASSERT_EQ(encoded.size(), TestMessages::SizeOf<Status>());
+    EXPECT_EQ(encoded[0U], TestMessages::TagOf<Status>());
+
+    Status decoded {};
+    size_t bits_decoded {0U};
+    ASSERT_TRUE(data::decode(encoded.subspan(1U, Status::kSizeBytes), bits_decoded, decoded).IsSuccess());
+    EXPECT_EQ(data::packet_field_value<0U>(decoded), 7U);
+    EXPECT_EQ(data::packet_field_value<1U>(decoded), 0xBEEF);
+}
+
+TEST(Session_MessageSet, get_dispatches_by_tag_in_place)
+{
+    RingSession<256U> session {};
+    ASSERT_TRUE(TestMessages::Put(session, Heartbeat {uint32_t {42U}}, std::chrono::microseconds::zero()).IsSuccess());
+    ASSERT_TRUE(
+        TestMessages::Put(session, Position {1.5F, 2.5F, 3.5F}, std::chrono::microseconds::zero()).IsSuccess());
+
+    RecordingHandler handler {};
+    ASSERT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(handler.handled_tag, TestMessages::TagOf<Heartbeat>());
+    EXPECT_EQ(handler.heartbeat, 42U);
+
+    ASSERT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(handler.handled_tag, TestMessages::TagOf<Position>());
+    EXPECT_EQ(handler.x, 1.5F);
+
+    EXPECT_EQ(session.InputBytesAvailable(), 0U);
+    EXPECT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsFailure());
+}
+
+TEST(Session_MessageSet, get_dispatches_by_tag_through_copies)
+{
+    CopyingSession session {};
+    ASSERT_TRUE(TestMessages::Put(session, Status {uint8_t {1U}, uint16_t {0x1234}}, std::chrono::microseconds::zero())
+                    .IsSuccess());
+    ASSERT_TRUE(TestMessages::Put(session, Heartbeat {uint32_t {9U}}, std::chrono::microseconds::zero()).IsSuccess());
+
+    RecordingHandler handler {};
+    ASSERT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(handler.handled_tag, TestMessages::TagOf<Status>());
+    EXPECT_EQ(handler.status, 0x1234);
+
+    ASSERT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(handler.handled_tag, TestMessages::TagOf<Heartbeat>());
+    EXPECT_EQ(handler.heartbeat, 9U);
+}
+
+TEST(Session_MessageSet, get_unknown_tag_fails)
+{
+    RingSession<256U> session {};
+    uint8_t const     kUnknown[] {static_cast<uint8_t>(TestMessages::kMessageCount), 0U, 0U, 0U, 0U};
+    ASSERT_TRUE(session.Post(Span<uint8_t const> {kUnknown, sizeof(kUnknown)}, std::chrono::microseconds::zero())
+                    .IsSuccess());
+
+    RecordingHandler handler {};
+    EXPECT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsFailure());
+    EXPECT_EQ(handler.handled_tag, TestMessages::kMessageCount);
+    EXPECT_EQ(session.InputBytesAvailable(), (sizeof(kUnknown) - 1U)); // The tag was dropped
+}
+
+TEST(Session_MessageSet, get_wrapped_message_is_copied_out)
+{
+    // Every other Position straddles the end of the ring, so it can't be peeked whole
+    RingSession<16U> session {};
+    RecordingHandler handler {};
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        float const kX {static_cast<float>(i)};
+        ASSERT_TRUE(
+            TestMessages::Put(session, Position {kX, 0.0F, 0.0F}, std::chrono::microseconds::zero()).IsSuccess());
+        ASSERT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsSuccess());
+        EXPECT_EQ(handler.handled_tag, TestMessages::TagOf<Position>());
+        EXPECT_EQ(handler.x, kX);
+        EXPECT_EQ(session.InputBytesAvailable(), 0U);
+    }
+}
+
+TEST(Session_MessageSet, get_partial_message_waits_for_the_rest)
+{
+    RingSession<256U> session {};
+    uint8_t const     kTagOnly[] {TestMessages::TagOf<Heartbeat>()};
+    ASSERT_TRUE(session.Post(Span<uint8_t const> {kTagOnly, sizeof(kTagOnly)}, std::chrono::microseconds::zero())
+                    .IsSuccess());
+
+    RecordingHandler handler {};
+    EXPECT_TRUE(TestMessages::Get(session, handler, std::chrono::microseconds::zero()).IsFailure());
+    EXPECT_EQ(session.InputBytesAvailable(), 1U); // Nothing was consumed
+}
@@ -0,0 +1,184 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/MpmcSession.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MpmcSession tests               ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that messages are queued and dequeued whole, in order, and that availability reflects the slots
+ *
+ */
+TEST(Session_MpmcSession, post_and_request)
+{
+    MpmcSession<2U, 8U> session;
+    EXPECT_EQ(8U, session.OutputBytesAvailable());
+    EXPECT_EQ(0U, session.InputBytesAvailable());
+
+    uint8_t first[3U] {1U, 2U, 3U};
+    uint8_t second[5U] {4U, 5U, 6U, 7U, 8U};
+    ASSERT_TRUE(session.Post(Span<uint8_t const> {first, 3U}, std::chrono::microseconds::zero()).IsSuccess());
+    ASSERT_TRUE(session.Post(Span<uint8_t const> {second, 5U}, std::chrono::microseconds::zero()).IsSuccess());
+
+    // Full
+    EXPECT_EQ(0U, session.OutputBytesAvailable());
+    EXPECT_TRUE(session.Post(Span<uint8_t const> {first, 3U}, std::chrono::microseconds {100}).IsFailure());
+
+    // Requests must match the size of the oldest message
+    EXPECT_EQ(3U, session.InputBytesAvailable());
+    uint8_t rx[5U] {};
+    EXPECT_TRUE(session.Request(Span<uint8_t> {rx, 5U}, std::chrono::microseconds::zero()).IsFailure());
+    ASSERT_TRUE(session.Request(Span<uint8_t> {rx, 3U}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(first, rx, 3U));
+
+    EXPECT_EQ(5U, session.InputBytesAvailable());
+    ASSERT_TRUE(session.Request(Span<uint8_t> {rx, 5U}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(second, rx, 5U));
+
+    // Empty
+    EXPECT_EQ(0U, session.InputBytesAvailable());
+    EXPECT_TRUE(session.Request(Span<uint8_t> {rx, 5U}, std::chrono::microseconds {100}).IsFailure());
+
+    // Oversized messages are rejected outright
+    uint8_t oversized[9U] {};
+    EXPECT_TRUE(session.Post(Span<uint8_t const> {oversized, 9U}, std::chrono::microseconds::zero()).IsFailure());
+}
+
+/**
+ * @brief Test that gathered parts are queued in to one slot as a single message, and scattered back out
+ *
+ */
+TEST(Session_MpmcSession, vectored_post_and_request)
+{
+    MpmcSession<2U, 8U> session;
+
+    uint8_t             header[3U] {1U, 2U, 3U};
+    uint8_t             body[4U] {4U, 5U, 6U, 7U};
+    Span<uint8_t const> tx_parts[] {Span<uint8_t const> {header, 3U}, Span<uint8_t const> {body, 4U}};
+    ASSERT_TRUE(
+        session.Post(Span<Span<uint8_t const> const> {tx_parts}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(7U, session.InputBytesAvailable());
+
+    // Scatter must cover the message exactly
+    uint8_t       rx_head[2U] {};
+    uint8_t       rx_tail[5U] {};
+    Span<uint8_t> short_parts[] {Span<uint8_t> {rx_head, 2U}, Span<uint8_t> {rx_tail, 4U}};
+    EXPECT_TRUE(
+        session.Request(Span<Span<uint8_t> const> {short_parts}, std::chrono::microseconds::zero()).IsFailure());
+
+    Span<uint8_t> rx_parts[] {Span<uint8_t> {rx_head, 2U}, Span<uint8_t> {rx_tail, 5U}};
+    ASSERT_TRUE(session.Request(Span<Span<uint8_t> const> {rx_parts}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(header, rx_head, 2U));
+    EXPECT_EQ(header[2U], rx_tail[0U]);
+    EXPECT_EQ(0, std::memcmp(body, (rx_tail + 1U), 4U));
+
+    // Parts larger than a slot combined are rejected outright
+    Span<uint8_t const> too_large[] {Span<uint8_t const> {body, 4U}, Span<uint8_t const> {body, 4U},
+                                     Span<uint8_t const> {body, 1U}};
+    EXPECT_TRUE(
+        session.Post(Span<Span<uint8_t const> const> {too_large}, std::chrono::microseconds::zero()).IsFailure());
+}
+
+/**
+ * @brief Test that a burst from PutMany is queued one message per object, so that each may be received by an Ingress
+ *
+ */
+TEST(Session_MpmcSession, put_many_then_get)
+{
+    using Sample = data::packet_t<uint8_t, uint32_t>;
+
+    MpmcSession<4U, 16U> session;
+
+    uint32_t const   kWords[6U] {1U, 2U, 3U, 4U, 5U, 6U};
+    Egress<uint32_t> word_egress {session};
+    EXPECT_EQ(4U, word_egress.PutMany(Span<uint32_t const> {kWords}, std::chrono::microseconds::zero()));
+
+    Ingress<uint32_t> word_ingress {session};
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        uint32_t word {0U};
+        ASSERT_TRUE(word_ingress.Get(word).IsSuccess());
+        EXPECT_EQ(kWords[i], word);
+    }
+    EXPECT_EQ(0U, session.InputBytesAvailable());
+
+    // Objects that have to be encoded are split up as well
+    Sample const   kSamples[2U] {Sample {uint8_t {7U}, uint32_t {70U}}, Sample {uint8_t {8U}, uint32_t {80U}}};
+    Egress<Sample> sample_egress {session};
+    EXPECT_EQ(2U, sample_egress.PutMany(Span<Sample const> {kSamples}, std::chrono::microseconds::zero()));
+
+    Ingress<Sample> sample_ingress {session};
+    for (size_t i = 0U; i < 2U; i++)
+    {
+        Sample sample {};
+        ASSERT_TRUE(sample_ingress.Get(sample).IsSuccess());
+        EXPECT_EQ(data::packet_field_value<1U>(kSamples[i]), data::packet_field_value<1U>(sample));
+    }
+}
+
+/**
+ * @brief Test that many Egress producers fanning in to one session never interleave their messages, and that each
+ * producer's messages arrive in the order that they were put
+ *
+ */
+TEST(Session_MpmcSession, fan_in_from_many_egress)
+{
+    struct Message
+    {
+        uint32_t producer;
+        uint32_t sequence;
+        uint32_t check;
+    };
+
+    constexpr uint32_t kNumProducers {8U};
+    constexpr uint32_t kNumMessagesPerProducer {5000U};
+
+    MpmcSession<64U, sizeof(Message)> session;
+
+    std::vector<std::thread> producers;
+    for (uint32_t p = 0U; p < kNumProducers; p++)
+    {
+        producers.emplace_back(
+            [&session, p]()
+            {
+                Egress<Message> egress {session};
+                for (uint32_t i = 0U; i < kNumMessagesPerProducer; i++)
+                {
+                    Message const message {p, i, (p ^ i ^ 0xA5A5A5A5U)};
+                    while (egress.Put(message).IsFailure())
+                        std::this_thread::yield();
+                }
+            });
+    }
+
+    uint32_t         next_sequence[kNumProducers] {};
+    Ingress<Message> ingress {session};
+    for (uint32_t i = 0U; i < (kNumProducers * kNumMessagesPerProducer); i++)
+    {
+        Message message {};
+        while (ingress.Get(message).IsFailure())
+            std::this_thread::yield();
+
+        ASSERT_LT(message.producer, kNumProducers);
+        ASSERT_EQ((message.producer ^ message.sequence ^ 0xA5A5A5A5U), message.check);
+        ASSERT_EQ(next_sequence[message.producer], message.sequence);
+        next_sequence[message.producer]++;
+    }
+
+    for (std::thread& producer : producers)
+        producer.join();
+
+    EXPECT_EQ(0U, session.InputBytesAvailable());
+}
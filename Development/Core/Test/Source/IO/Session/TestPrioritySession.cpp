@@ -0,0 +1,158 @@
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/PrioritySession.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+constexpr static std::chrono::microseconds kNoWait {std::chrono::microseconds::zero()};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PrioritySession tests           ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that each lane reports its own free space, and that a full lane does not hold back any other
+ *
+ */
+TEST(Session_PrioritySession, lane_availability)
+{
+    using Session = PrioritySession<8U, 2U>;
+
+    Session session;
+    EXPECT_EQ(8U, session.OutputBytesAvailable(0U));
+    EXPECT_EQ(8U, session.OutputBytesAvailable(1U));
+    EXPECT_EQ(0U, session.InputBytesAvailable());
+    EXPECT_EQ(Session::kNoLane, session.GetNextLane());
+
+    uint8_t tx[8U] {};
+    ASSERT_TRUE(session.GetLane(1U).Post(Span<uint8_t const> {tx, 8U}, kNoWait).IsSuccess());
+    EXPECT_EQ(0U, session.OutputBytesAvailable(1U));
+    EXPECT_EQ(0U, session.GetLane(1U).OutputBytesAvailable());
+    EXPECT_EQ(8U, session.OutputBytesAvailable(0U));
+
+    // The bulk lane is full, control traffic still goes straight through
+    EXPECT_TRUE(session.GetLane(1U).Post(Span<uint8_t const> {tx, 1U}, kNoWait).IsFailure());
+    ASSERT_TRUE(session.GetLane(0U).Post(Span<uint8_t const> {tx, 2U}, kNoWait).IsSuccess());
+    EXPECT_EQ(2U, session.InputBytesAvailable()); // Sized against the lane served next
+}
+
+/**
+ * @brief Test that strict lanes are drained highest priority first, whatever order they were posted in
+ *
+ */
+TEST(Session_PrioritySession, strict_priority)
+{
+    PrioritySession<16U, 3U> session;
+    Egress<uint32_t>         control {session.GetLane(0U)};
+    Egress<uint32_t>         status {session.GetLane(1U)};
+    Egress<uint32_t>         bulk {session.GetLane(2U)};
+    Ingress<uint32_t>        drain {session};
+
+    ASSERT_TRUE(bulk.Put(30U).IsSuccess());
+    ASSERT_TRUE(bulk.Put(31U).IsSuccess());
+    ASSERT_TRUE(status.Put(20U).IsSuccess());
+    ASSERT_TRUE(control.Put(10U).IsSuccess());
+
+    uint32_t value {0U};
+    uint32_t const kExpected[4U] {10U, 20U, 30U, 31U};
+    for (uint32_t expected : kExpected)
+    {
+        ASSERT_TRUE(drain.Get(value).IsSuccess());
+        EXPECT_EQ(expected, value);
+
+        // Control traffic posted mid-drain is served before the rest of the backlog
+        if (expected == 20U)
+        {
+            ASSERT_TRUE(control.Put(11U).IsSuccess());
+            ASSERT_TRUE(drain.Get(value).IsSuccess());
+            EXPECT_EQ(11U, value);
+        }
+    }
+
+    EXPECT_TRUE(drain.Get(value).IsFailure());
+}
+
+/**
+ * @brief Test that weighted lanes share the drain in proportion to their weights, after every strict lane
+ *
+ */
+TEST(Session_PrioritySession, weighted_fair)
+{
+    PrioritySession<64U, 3U> session;
+    ASSERT_TRUE(session.SetWeight(1U, 3U).IsSuccess());
+    ASSERT_TRUE(session.SetWeight(2U, 1U).IsSuccess());
+    EXPECT_TRUE(session.SetWeight(3U, 1U).IsFailure());
+
+    Outbound& control {session.GetLane(0U)};
+    Outbound& heavy {session.GetLane(1U)};
+    Outbound& light {session.GetLane(2U)};
+
+    uint8_t const kControl {0xC0};
+    uint8_t       tx[1U] {};
+    for (uint8_t i = 0U; i < 8U; i++)
+    {
+        tx[0] = static_cast<uint8_t>(0x10 + i);
+        ASSERT_TRUE(heavy.Post(Span<uint8_t const> {tx, 1U}, kNoWait).IsSuccess());
+        tx[0] = static_cast<uint8_t>(0x20 + i);
+        ASSERT_TRUE(light.Post(Span<uint8_t const> {tx, 1U}, kNoWait).IsSuccess());
+    }
+    ASSERT_TRUE(control.Post(Span<uint8_t const> {&kControl, 1U}, kNoWait).IsSuccess());
+
+    uint8_t rx[1U] {};
+    ASSERT_TRUE(session.Request(Span<uint8_t> {rx, 1U}, kNoWait).IsSuccess());
+    EXPECT_EQ(kControl, rx[0]);
+
+    // Eight transmissions split three to one, interleaved rather than in runs
+    size_t  lane_one_count {0U};
+    uint8_t lanes[8U] {};
+    for (size_t i = 0U; i < 8U; i++)
+    {
+        ASSERT_TRUE(session.Request(Span<uint8_t> {rx, 1U}, kNoWait).IsSuccess());
+        lanes[i] = static_cast<uint8_t>(rx[0] >> 4U);
+        if (lanes[i] == 1U)
+            lane_one_count++;
+    }
+    EXPECT_EQ(6U, lane_one_count);
+    EXPECT_EQ(2U, lanes[2]);
+    EXPECT_EQ(2U, lanes[6]);
+
+    // Once one lane runs dry the other takes the whole drain
+    size_t drained {0U};
+    while (session.Request(Span<uint8_t> {rx, 1U}, kNoWait).IsSuccess())
+        drained++;
+    EXPECT_EQ(8U, drained);
+}
+
+/**
+ * @brief Test that peeked data is consumed from the lane it was peeked in
+ *
+ */
+TEST(Session_PrioritySession, peek_consume)
+{
+    PrioritySession<8U, 2U> session;
+    EXPECT_TRUE(session.Consume(1U).IsFailure()); // Nothing peeked
+
+    uint8_t const kLow[2U] {0x01, 0x02};
+    uint8_t const kHigh[2U] {0xA1, 0xA2};
+    ASSERT_TRUE(session.GetLane(1U).Post(Span<uint8_t const> {kLow, 2U}, kNoWait).IsSuccess());
+    ASSERT_TRUE(session.GetLane(0U).Post(Span<uint8_t const> {kHigh, 2U}, kNoWait).IsSuccess());
+
+    Span<uint8_t const> peeked {session.Peek(2U)};
+    ASSERT_EQ(2U, peeked.size());
+    EXPECT_EQ(0, std::memcmp(kHigh, peeked.data(), 2U));
+    ASSERT_TRUE(session.Consume(2U).IsSuccess());
+    EXPECT_EQ(6U, session.OutputBytesAvailable(1U));
+
+    peeked = session.Peek(2U);
+    ASSERT_EQ(2U, peeked.size());
+    EXPECT_EQ(0, std::memcmp(kLow, peeked.data(), 2U));
+    ASSERT_TRUE(session.Consume(2U).IsSuccess());
+    EXPECT_EQ(0U, session.InputBytesAvailable());
+    EXPECT_EQ(0U, session.Peek(1U).size());
+}
@@ -0,0 +1,343 @@
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+#include <Core/IO/Session/StaticEgress.hpp>
+#include <Core/IO/Session/StaticIngress.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstring>
+#include <ctime>
+#include <thread>
+#include <type_traits>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  RingSession tests               ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that bytes posted to a RingSession are requested back in order, and that availability tracks them
+ *
+ */
+TEST(Session_RingSession, post_and_request)
+{
+    RingSession<16U>  ring;
+    EXPECT_EQ(16U, ring.OutputBytesAvailable());
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+
+    uint8_t tx[6U] {1U, 2U, 3U, 4U, 5U, 6U};
+    ASSERT_TRUE(ring.Post(Span<uint8_t const> {tx, 6U}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(10U, ring.OutputBytesAvailable());
+    EXPECT_EQ(6U, ring.InputBytesAvailable());
+
+    uint8_t rx[6U] {};
+    ASSERT_TRUE(ring.Request(Span<uint8_t> {rx, 6U}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(0, std::memcmp(tx, rx, 6U));
+    EXPECT_EQ(16U, ring.OutputBytesAvailable());
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+}
+
+/**
+ * @brief Test that transmissions straddling the end of the ring arrive intact
+ *
+ */
+TEST(Session_RingSession, wrap_around)
+{
+    RingSession<8U> ring;
+
+    for (uint8_t i = 0U; i < 10U; i++)
+    {
+        uint8_t tx[5U] {i, static_cast<uint8_t>(i + 1U), static_cast<uint8_t>(i + 2U), static_cast<uint8_t>(i + 3U),
+                        static_cast<uint8_t>(i + 4U)};
+        ASSERT_TRUE(ring.Post(Span<uint8_t const> {tx, 5U}, std::chrono::microseconds::zero()).IsSuccess());
+
+        uint8_t rx[5U] {};
+        ASSERT_TRUE(ring.Request(Span<uint8_t> {rx, 5U}, std::chrono::microseconds::zero()).IsSuccess());
+        EXPECT_EQ(0, std::memcmp(tx, rx, 5U));
+    }
+}
+
+/**
+ * @brief Test that transmissions are all-or-nothing when there is not enough space or data
+ *
+ */
+TEST(Session_RingSession, insufficient_space_or_data)
+{
+    RingSession<8U> ring;
+
+    uint8_t tx[9U] {};
+    EXPECT_TRUE(ring.Post(Span<uint8_t const> {tx, 9U}, std::chrono::microseconds::zero()).IsFailure());
+    ASSERT_TRUE(ring.Post(Span<uint8_t const> {tx, 6U}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_TRUE(ring.Post(Span<uint8_t const> {tx, 3U}, std::chrono::microseconds {100}).IsFailure());
+    EXPECT_EQ(2U, ring.OutputBytesAvailable());
+
+    uint8_t rx[7U] {};
+    EXPECT_TRUE(ring.Request(Span<uint8_t> {rx, 7U}, std::chrono::microseconds {100}).IsFailure());
+    EXPECT_EQ(6U, ring.InputBytesAvailable());
+}
+
+/**
+ * @brief Test that gathered parts arrive as one contiguous transmission and scatter back out, including across the end
+ * of the ring
+ *
+ */
+TEST(Session_RingSession, vectored_post_and_request)
+{
+    RingSession<8U> ring;
+
+    for (uint8_t i = 0U; i < 4U; i++)
+    {
+        uint8_t             header[2U] {i, 0xA0U};
+        uint8_t             body[3U] {0xB0U, 0xB1U, 0xB2U};
+        Span<uint8_t const> tx_parts[] {Span<uint8_t const> {header, 2U}, Span<uint8_t const> {body, 3U}};
+        ASSERT_TRUE(
+            ring.Post(Span<Span<uint8_t const> const> {tx_parts}, std::chrono::microseconds::zero()).IsSuccess());
+        EXPECT_EQ(5U, ring.InputBytesAvailable());
+
+        uint8_t       rx_head[4U] {};
+        uint8_t       rx_tail[1U] {};
+        Span<uint8_t> rx_parts[] {Span<uint8_t> {rx_head, 4U}, Span<uint8_t> {rx_tail, 1U}};
+        ASSERT_TRUE(ring.Request(Span<Span<uint8_t> const> {rx_parts}, std::chrono::microseconds::zero()).IsSuccess());
+        EXPECT_EQ(0, std::memcmp(header, rx_head, 2U));
+        EXPECT_EQ(0, std::memcmp(body, (rx_head + 2U), 2U));
+        EXPECT_EQ(body[2U], rx_tail[0U]);
+    }
+
+    // All-or-nothing
+    uint8_t             large[5U] {};
+    Span<uint8_t const> too_large[] {Span<uint8_t const> {large, 5U}, Span<uint8_t const> {large, 4U}};
+    EXPECT_TRUE(ring.Post(Span<Span<uint8_t const> const> {too_large}, std::chrono::microseconds::zero()).IsFailure());
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+}
+
+/**
+ * @brief Test that a multi-part put arrives as one transmission with the parts in order
+ *
+ */
+TEST(Session_RingSession, egress_put_multipart)
+{
+    RingSession<32U>  ring;
+    Egress<uint32_t>  egress {ring};
+
+    uint8_t             payload[5U] {1U, 2U, 3U, 4U, 5U};
+    uint16_t const      trailer {0xBEEFU};
+    ASSERT_TRUE(egress.PutMultipart(std::chrono::microseconds::zero(), 0xCAFEF00DU, Span<uint8_t const> {payload, 5U},
+                                    trailer)
+                    .IsSuccess());
+    ASSERT_EQ((sizeof(uint32_t) + 5U + sizeof(uint16_t)), ring.InputBytesAvailable());
+
+    uint8_t rx[11U] {};
+    ASSERT_TRUE(ring.Request(Span<uint8_t> {rx, 11U}, std::chrono::microseconds::zero()).IsSuccess());
+
+    uint32_t header {0U};
+    uint16_t rx_trailer {0U};
+    std::memcpy(&header, rx, sizeof(uint32_t));
+    std::memcpy(&rx_trailer, (rx + 9U), sizeof(uint16_t));
+    EXPECT_EQ(0xCAFEF00DU, header);
+    EXPECT_EQ(0, std::memcmp(payload, (rx + 4U), 5U));
+    EXPECT_EQ(0xBEEFU, rx_trailer);
+
+    // Nothing is posted when the parts don't fit together
+    uint8_t large[30U] {};
+    EXPECT_TRUE(
+        egress.PutMultipart(std::chrono::microseconds::zero(), 0U, Span<uint8_t const> {large, 30U}).IsFailure());
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+}
+
+/**
+ * @brief Test that reserved space is published by commit and that peeked data is released by consume
+ *
+ */
+TEST(Session_RingSession, reserve_commit_peek_consume)
+{
+    RingSession<8U> ring;
+
+    Span<uint8_t> reserved {ring.Reserve(4U)};
+    ASSERT_EQ(4U, reserved.size());
+    EXPECT_EQ(0U, ring.InputBytesAvailable()); // Nothing visible until committed
+    reserved[0] = 0xDE;
+    reserved[1] = 0xAD;
+    EXPECT_TRUE(ring.Commit(5U).IsFailure()); // Larger than the reservation
+    ASSERT_TRUE(ring.Commit(2U).IsSuccess());
+    EXPECT_EQ(2U, ring.InputBytesAvailable());
+    EXPECT_TRUE(ring.Commit(1U).IsFailure()); // Reservation is spent
+
+    EXPECT_EQ(0U, ring.Peek(3U).size());
+    Span<uint8_t const> peeked {ring.Peek(2U)};
+    ASSERT_EQ(2U, peeked.size());
+    EXPECT_EQ(0xDE, peeked[0]);
+    EXPECT_EQ(0xAD, peeked[1]);
+    EXPECT_EQ(2U, ring.InputBytesAvailable()); // Peeking does not consume
+    ASSERT_TRUE(ring.Consume(2U).IsSuccess());
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+    EXPECT_TRUE(ring.Consume(1U).IsFailure());
+
+    // Space straddling the end of the ring can't be lent out, Post still works
+    EXPECT_EQ(0U, ring.Reserve(7U).size());
+    uint8_t tx[7U] {1U, 2U, 3U, 4U, 5U, 6U, 7U};
+    ASSERT_TRUE(ring.Post(Span<uint8_t const> {tx, 7U}, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(0U, ring.Peek(7U).size());
+}
+
+/**
+ * @brief Test that a value put to an Egress is readable in place by an Ingress sharing a RingSession
+ *
+ */
+TEST(Session_RingSession, egress_to_ingress_in_place)
+{
+    RingSession<16U>  ring;
+    Egress<uint64_t>  egress {ring};
+    Ingress<uint64_t> ingress {ring};
+
+    ASSERT_TRUE(egress.Put(0x0123456789ABCDEFU).IsSuccess());
+    Span<uint8_t const> peeked {ring.Peek(sizeof(uint64_t))};
+    ASSERT_EQ(sizeof(uint64_t), peeked.size());
+
+    uint64_t in_place {0U};
+    std::memcpy(&in_place, peeked.data(), sizeof(uint64_t));
+    EXPECT_EQ(0x0123456789ABCDEFU, in_place);
+
+    uint64_t value {0U};
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    EXPECT_EQ(0x0123456789ABCDEFU, value);
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+}
+
+/**
+ * @brief Test that a burst put to an Egress is encoded in place as one transmission, cut short when the ring fills
+ *
+ */
+TEST(Session_RingSession, egress_put_many_in_place)
+{
+    RingSession<16U>  ring;
+    Egress<uint32_t>  egress {ring};
+    Ingress<uint32_t> ingress {ring};
+
+    uint32_t const values[6U] {10U, 11U, 12U, 13U, 14U, 15U};
+    EXPECT_EQ(4U, egress.PutMany(Span<uint32_t const> {values}, std::chrono::microseconds::zero()));
+    EXPECT_EQ(0U, ring.OutputBytesAvailable());
+    EXPECT_EQ(0U, egress.PutMany(Span<uint32_t const> {values}, std::chrono::microseconds::zero()));
+
+    for (size_t i = 0U; i < 4U; i++)
+    {
+        uint32_t value {0U};
+        ASSERT_TRUE(ingress.Get(value).IsSuccess());
+        EXPECT_EQ(values[i], value);
+    }
+}
+
+/**
+ * @brief Test that a block fetched from an Ingress is decoded in place, limited to the whole objects in the ring
+ *
+ */
+TEST(Session_RingSession, ingress_get_many_in_place)
+{
+    RingSession<16U>  ring;
+    Egress<uint32_t>  egress {ring};
+    Ingress<uint32_t> ingress {ring};
+
+    uint32_t const values[3U] {20U, 21U, 22U};
+    ASSERT_EQ(3U, egress.PutMany(Span<uint32_t const> {values}, std::chrono::microseconds::zero()));
+
+    uint32_t received[4U] {};
+    EXPECT_EQ(3U, ingress.GetMany(Span<uint32_t> {received}, std::chrono::microseconds::zero()));
+    EXPECT_EQ(0, std::memcmp(values, received, sizeof(values)));
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+    EXPECT_EQ(0U, ingress.GetMany(Span<uint32_t> {received}, std::chrono::microseconds::zero()));
+}
+
+/**
+ * @brief Test that a StaticEgress and StaticIngress bound to a RingSession at compile time exchange values, and that
+ * neither carries a virtual table
+ *
+ */
+TEST(Session_RingSession, static_egress_to_static_ingress)
+{
+    using Session = RingSession<32U>;
+
+    static_assert(!std::is_polymorphic<StaticEgress<uint32_t, Session>>::value, "StaticEgress must not be virtual");
+    static_assert(!std::is_polymorphic<StaticIngress<uint32_t, Session>>::value, "StaticIngress must not be virtual");
+    static_assert(is_egress_v<StaticEgress<uint32_t, Session>>, "StaticEgress must be an Egress");
+    static_assert(is_ingress_v<StaticIngress<uint32_t, Session>>, "StaticIngress must be an Ingress");
+
+    Session                          ring;
+    StaticEgress<uint32_t, Session>  egress {ring};
+    StaticIngress<uint32_t, Session> ingress {ring};
+
+    ASSERT_TRUE(egress.Put(0xA5A5A5A5U).IsSuccess());
+    uint32_t const burst[3U] {1U, 2U, 3U};
+    ASSERT_EQ(3U, egress.PutMany(Span<uint32_t const> {burst}, std::chrono::microseconds::zero()));
+    ASSERT_TRUE(egress.PutMultipart(std::chrono::microseconds::zero(), 4U, uint32_t {5U}).IsSuccess());
+
+    uint32_t value {0U};
+    ASSERT_TRUE(ingress.Get(value).IsSuccess());
+    EXPECT_EQ(0xA5A5A5A5U, value);
+
+    uint32_t received[5U] {};
+    ASSERT_EQ(5U, ingress.GetMany(Span<uint32_t> {received}, std::chrono::microseconds::zero()));
+    for (uint32_t i = 0U; i < 5U; i++)
+        EXPECT_EQ((i + 1U), received[i]);
+
+    EXPECT_TRUE(ingress.Get(value).IsFailure());
+}
+
+/**
+ * @brief Test that an Egress and an Ingress on separate threads exchange a stream of values through a RingSession
+ *
+ */
+TEST(Session_RingSession, cross_thread_egress_to_ingress)
+{
+    constexpr uint32_t kNumValues {10000U};
+
+    RingSession<64U> ring;
+
+    std::thread producer {[&]()
+                          {
+                              Egress<uint32_t> egress {ring};
+                              for (uint32_t i = 0U; i < kNumValues; i++)
+                              {
+                                  while (egress.Put(i).IsFailure())
+                                      std::this_thread::yield();
+                              }
+                          }};
+
+    Ingress<uint32_t> ingress {ring};
+    for (uint32_t i = 0U; i < kNumValues; i++)
+    {
+        uint32_t value {0U};
+        while (ingress.Get(value, std::chrono::microseconds {1000}).IsFailure())
+            std::this_thread::yield();
+        ASSERT_EQ(i, value);
+    }
+
+    producer.join();
+    EXPECT_EQ(0U, ring.InputBytesAvailable());
+}
+
+/**
+ * @brief Test that a request left waiting on an empty ring times out without burning the processor the whole time
+ *
+ */
+TEST(Session_RingSession, timed_out_request_backs_off)
+{
+    constexpr std::chrono::milliseconds kTimeout {50};
+
+    RingSession<16U> ring;
+
+    uint8_t                                     rx[4U] {};
+    std::clock_t const                          kCpuStart {std::clock()};
+    std::chrono::steady_clock::time_point const kWallStart {std::chrono::steady_clock::now()};
+    EXPECT_TRUE(ring.Request(Span<uint8_t> {rx}, kTimeout).IsFailure());
+    std::chrono::steady_clock::duration const kWallElapsed {std::chrono::steady_clock::now() - kWallStart};
+    std::clock_t const                        kCpuEnd {std::clock()};
+
+    EXPECT_GE(kWallElapsed, kTimeout);
+
+    // A spinning wait burns about as much processor time as the timeout lasted
+    double const kCpuMs {(1000.0 * static_cast<double>(kCpuEnd - kCpuStart)) / CLOCKS_PER_SEC};
+    EXPECT_LT(kCpuMs, (static_cast<double>(kTimeout.count()) / 2.0));
+}
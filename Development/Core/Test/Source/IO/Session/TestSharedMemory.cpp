@@ -0,0 +1,179 @@
+#include <Core/Data/Decode.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/SharedMemory.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <thread>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Sample = data::packet_t<uint32_t, uint16_t>;
+
+/// @brief Shared-memory ring named uniquely for the test process, removed afterwards
+class SharedMemoryRing : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        static_cast<void>(std::snprintf(m_name, sizeof(m_name), "/shmit-test-%d", static_cast<int>(getpid())));
+        static_cast<void>(unlink_shared_memory(m_name));
+    }
+
+    void TearDown() override
+    {
+        static_cast<void>(unlink_shared_memory(m_name));
+    }
+
+    char m_name[SharedMemoryFormat::kMaxNameSizeBytes] {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  SharedMemory tests              ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST_F(SharedMemoryRing, egress_to_ingress)
+{
+    SharedMemoryInbound  inbound {m_name, 64U};
+    SharedMemoryOutbound outbound {m_name, 64U};
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+    ASSERT_TRUE(outbound.Open().IsSuccess());
+    EXPECT_EQ(outbound.OutputBytesAvailable(), 64U);
+
+    Egress<Sample>  egress {outbound};
+    Ingress<Sample> ingress {inbound};
+
+    // Enough samples to wrap the ring several times, so both the in place and copying paths are taken
+    for (uint32_t i = 0U; i < 50U; i++)
+    {
+        ASSERT_TRUE(egress.Put(Sample {i, static_cast<uint16_t>(i + 1U)}).IsSuccess());
+        ASSERT_EQ(inbound.InputBytesAvailable(), Sample::kSizeBytes);
+
+        Sample received {};
+        ASSERT_TRUE(ingress.Get(received).IsSuccess());
+        EXPECT_EQ(data::packet_field_value<0U>(received), i);
+        EXPECT_EQ(data::packet_field_value<1U>(received), (i + 1U));
+    }
+
+    EXPECT_EQ(inbound.InputBytesAvailable(), 0U);
+}
+
+TEST_F(SharedMemoryRing, capacity_must_agree)
+{
+    SharedMemoryInbound inbound {m_name, 64U};
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+
+    SharedMemoryOutbound mismatched {m_name, 128U};
+    EXPECT_TRUE(mismatched.Open().IsFailure());
+    EXPECT_EQ(mismatched.OutputBytesAvailable(), 0U);
+
+    SharedMemoryOutbound not_power_of_two {"/shmit-test-invalid", 100U};
+    EXPECT_TRUE(not_power_of_two.Open().IsFailure());
+}
+
+TEST_F(SharedMemoryRing, full_ring_times_out)
+{
+    SharedMemoryOutbound outbound {m_name, 16U};
+    SharedMemoryInbound  inbound {m_name, 16U};
+    ASSERT_TRUE(outbound.Open().IsSuccess());
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+
+    std::array<uint8_t, 12U> const kBlock {};
+    Span<uint8_t const> const      block_span {kBlock.data(), kBlock.size()};
+    ASSERT_TRUE(outbound.Post(block_span, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_TRUE(outbound.Post(block_span, std::chrono::microseconds {100}).IsFailure());
+
+    // Straddles the end of the ring, so it can only be requested
+    std::array<uint8_t, 12U> received {};
+    Span<uint8_t> const      received_span {received.data(), received.size()};
+    ASSERT_TRUE(inbound.Request(received_span, std::chrono::microseconds::zero()).IsSuccess());
+    ASSERT_TRUE(outbound.Post(block_span, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_EQ(inbound.Peek(kBlock.size()).size(), 0U);
+    EXPECT_TRUE(inbound.Request(received_span, std::chrono::microseconds::zero()).IsSuccess());
+    EXPECT_TRUE(inbound.Request(received_span, std::chrono::microseconds {100}).IsFailure());
+}
+
+TEST_F(SharedMemoryRing, sleeping_consumer_is_woken)
+{
+    SharedMemoryInbound inbound {m_name, 256U};
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+
+    std::thread producer {[this]()
+                          {
+                              SharedMemoryOutbound outbound {m_name, 256U};
+                              if (outbound.Open().IsFailure())
+                                  return;
+
+                              // Long enough for the consumer to be asleep on the ring
+                              std::this_thread::sleep_for(std::chrono::milliseconds {20});
+
+                              uint8_t const kByte {0x5AU};
+                              static_cast<void>(
+                                  outbound.Post(Span<uint8_t const> {&kByte, 1U}, std::chrono::microseconds::zero()));
+                          }};
+
+    uint8_t received {0U};
+    EXPECT_TRUE(inbound.Request(Span<uint8_t> {&received, 1U}, std::chrono::seconds {5}).IsSuccess());
+    EXPECT_EQ(received, 0x5AU);
+    producer.join();
+}
+
+TEST_F(SharedMemoryRing, across_processes)
+{
+    constexpr static uint32_t kNumSamples {10000U};
+
+    SharedMemoryInbound inbound {m_name, 1024U};
+    ASSERT_TRUE(inbound.Open().IsSuccess());
+
+    pid_t const child {fork()};
+    ASSERT_GE(child, 0);
+    if (child == 0)
+    {
+        SharedMemoryOutbound outbound {m_name, 1024U};
+        if (outbound.Open().IsFailure())
+            _exit(1);
+
+        // Egress rejects puts while the ring is full, back off until the consumer catches up
+        Egress<Sample> egress {outbound};
+        for (uint32_t i = 0U; i < kNumSamples; i++)
+        {
+            while (egress.Put(Sample {i, uint16_t {0xBEEFU}}).IsFailure())
+                std::this_thread::yield();
+        }
+
+        _exit(0);
+    }
+
+    // Requests wait on the ring, sleeping whenever the producer falls behind
+    uint32_t num_in_order {0U};
+    for (uint32_t i = 0U; i < kNumSamples; i++)
+    {
+        std::array<uint8_t, Sample::kSizeBytes> encoded {};
+        if (inbound.Request(Span<uint8_t> {encoded.data(), encoded.size()}, std::chrono::seconds {5}).IsFailure())
+            break;
+
+        Sample received {};
+        size_t bits_decoded {0U};
+        if (data::decode(Span<uint8_t const> {encoded.data(), encoded.size()}, bits_decoded, received).IsSuccess()
+            && (data::packet_field_value<0U>(received) == i))
+            num_in_order++;
+    }
+
+    int status {-1};
+    ASSERT_EQ(waitpid(child, &status, 0), child);
+    EXPECT_TRUE(WIFEXITED(status) && (WEXITSTATUS(status) == 0));
+    EXPECT_EQ(num_in_order, kNumSamples);
+}
@@ -0,0 +1,167 @@
+#include <Core/IO/Session/Egress.hpp>
+#include <Core/IO/Session/Ingress.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+#include <Core/IO/Session/Transference.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <thread>
+
+using namespace shmit;
+using namespace shmit::io::session;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Transference tests              ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that a Transference starts out pending, completes once its result is set, and invokes its callback
+ *
+ */
+TEST(Session_Transference, complete_and_callback)
+{
+    struct Context
+    {
+        Transference* completed {nullptr};
+        size_t        num_calls {0U};
+    };
+
+    auto on_complete {[](Transference& transference, void* context)
+                      {
+                          Context* test_context {static_cast<Context*>(context)};
+                          test_context->completed = &transference;
+                          test_context->num_calls++;
+                      }};
+
+    Context      context;
+    uint8_t      bytes[4U] {};
+    Transference transference {Span<uint8_t> {bytes}, on_complete, &context};
+    EXPECT_TRUE(transference.IsPending());
+    EXPECT_EQ(4U, transference.GetData().size());
+    EXPECT_EQ(bytes, transference.GetWritableData().data());
+
+    // Still pending, no callback
+    transference.SetResult(Transference::Result {Transference::ResultCode::kPending});
+    EXPECT_TRUE(transference.IsPending());
+    EXPECT_EQ(0U, context.num_calls);
+    EXPECT_TRUE(transference.Wait(std::chrono::microseconds {100}) == Transference::ResultCode::kPending);
+
+    transference.SetResult(Transference::Result::Success());
+    EXPECT_FALSE(transference.IsPending());
+    EXPECT_TRUE(transference.GetResult().IsSuccess());
+    EXPECT_EQ(&transference, context.completed);
+    EXPECT_EQ(1U, context.num_calls);
+
+    transference.Reset();
+    EXPECT_TRUE(transference.IsPending());
+
+    // Read-only bytes can't be written to
+    uint8_t const      read_only[2U] {};
+    Transference const read_only_transference {Span<uint8_t const> {read_only}};
+    EXPECT_EQ(2U, read_only_transference.GetData().size());
+    EXPECT_EQ(0U, read_only_transference.GetWritableData().size());
+}
+
+/**
+ * @brief Test that sessions without asynchronous hardware complete transferences before PostAsync and RequestAsync
+ * return
+ *
+ */
+TEST(Session_Transference, synchronous_session_default)
+{
+    RingSession<8U> ring;
+
+    uint8_t      tx[3U] {1U, 2U, 3U};
+    Transference post {Span<uint8_t const> {tx}};
+    ASSERT_TRUE(ring.PostAsync(post).IsSuccess());
+    EXPECT_TRUE(post.GetResult().IsSuccess());
+
+    uint8_t      rx[3U] {};
+    Transference request {Span<uint8_t> {rx}};
+    ASSERT_TRUE(ring.RequestAsync(request).IsSuccess());
+    EXPECT_TRUE(request.GetResult().IsSuccess());
+    EXPECT_EQ(0, std::memcmp(tx, rx, 3U));
+
+    // Rejected outright, completed as failed
+    Transference empty {Span<uint8_t> {rx}};
+    EXPECT_TRUE(ring.RequestAsync(empty).IsFailure());
+    EXPECT_TRUE(empty.GetResult().IsFailure());
+}
+
+/**
+ * @brief Test that an Egress returns from PutAsync right away while the session completes the transmission later from
+ * another context
+ *
+ */
+TEST(Session_Transference, egress_put_async)
+{
+    // Outbound session that hands transmissions off to a "DMA" thread
+    class DeferredOutbound : public Outbound
+    {
+    public:
+        virtual size_t OutputBytesAvailable() const noexcept override
+        {
+            return sizeof(received);
+        }
+
+        virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override
+        {
+            static_cast<void>(tx);      // Avoid unused parameter
+            static_cast<void>(timeout); // Avoid unused parameter
+            return Result::Failure();
+        }
+
+        virtual Result PostAsync(Transference& transference) noexcept override
+        {
+            in_flight.store(&transference, std::memory_order_release);
+            return Result::Success();
+        }
+
+        void CompleteFromIsr()
+        {
+            Transference* transference {nullptr};
+            while ((transference = in_flight.load(std::memory_order_acquire)) == nullptr)
+                std::this_thread::yield();
+
+            std::memcpy(received, transference->GetData().data(), transference->GetData().size());
+            transference->SetResult(Transference::Result::Success());
+        }
+
+        std::atomic<Transference*> in_flight {nullptr};
+        uint8_t                    received[sizeof(uint32_t)] {};
+    };
+
+    DeferredOutbound session;
+    Egress<uint32_t> egress {session};
+
+    auto on_complete {[](Transference& transference, void* context)
+                      {
+                          static_cast<void>(transference); // Avoid unused parameter
+                          static_cast<std::atomic<bool>*>(context)->store(true);
+                      }};
+
+    std::atomic<bool> completed {false};
+
+    uint8_t      encoded[sizeof(uint32_t)] {};
+    Transference transference {Span<uint8_t> {encoded}, on_complete, &completed};
+
+    // Wrongly sized transferences are rejected
+    uint8_t      too_small[2U] {};
+    Transference wrong_size {Span<uint8_t> {too_small}};
+    EXPECT_TRUE(egress.PutAsync(0x12345678U, wrong_size).IsFailure());
+
+    ASSERT_TRUE(egress.PutAsync(0x12345678U, transference).IsSuccess());
+    EXPECT_TRUE(transference.IsPending()); // Still in flight
+
+    std::thread isr {[&]() { session.CompleteFromIsr(); }};
+    EXPECT_TRUE(transference.Wait(std::chrono::microseconds {1000000}).IsSuccess());
+    isr.join();
+
+    EXPECT_TRUE(completed.load());
+    uint32_t value {0U};
+    std::memcpy(&value, session.received, sizeof(uint32_t));
+    EXPECT_EQ(0x12345678U, value);
+}
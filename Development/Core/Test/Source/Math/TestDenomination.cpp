@@ -0,0 +1,166 @@
+#include <Core/Math/Denomination.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <ratio>
+
+using namespace shmit;
+using namespace shmit::math;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Exact integer scale of a value, truncated toward zero
+template<intmax_t NumeratorV, intmax_t DenominatorV>
+static __int128 reference_scale(__int128 value)
+{
+    return ((value * NumeratorV) / DenominatorV);
+}
+
+/// @brief Converts every value in a range from Base to Out and checks it against the exact integer result
+template<class Out, class Base, intmax_t NumeratorV, intmax_t DenominatorV>
+static void check_range(int64_t first, int64_t last, int64_t step)
+{
+    using InRep = typename Base::Rep;
+    for (int64_t value = first; value <= last; value += step)
+    {
+        InRep const in {static_cast<InRep>(value)};
+        auto const  expected {static_cast<typename Out::Rep>(reference_scale<NumeratorV, DenominatorV>(in))};
+        ASSERT_EQ((denomination_cast<Out, Base>(in)), expected) << "value " << value;
+    }
+}
+
+using Base32  = BaseDenomination<int32_t>;
+using BaseU16 = BaseDenomination<uint16_t>;
+using Base64  = BaseDenomination<int64_t>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  denomination_cast tests              ///////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Math_Denomination, integer_multiply)
+{
+    using Thousandths = Denomination<int32_t, std::ratio<1000, 1>>;
+    check_range<Thousandths, Base32, 1000, 1>(-2000000, 2000000, 997);
+
+    static_assert(denomination_cast<Thousandths, Base32>(-7) == -7000);
+}
+
+TEST(Math_Denomination, power_of_two_shift)
+{
+    // ADC counts with 12 fractional bits, to whole units
+    using Counts = Denomination<int32_t, std::ratio<4096, 1>>;
+    check_range<Base32, Counts, 1, 4096>(-1000000, 1000000, 313);
+
+    static_assert(denomination_cast<Base32, Counts>(-4097) == -1); // Truncates toward zero
+    static_assert(denomination_cast<Base32, Counts>(8191) == 1);
+}
+
+TEST(Math_Denomination, reciprocal_multiply)
+{
+    using Thousandths = Denomination<int32_t, std::ratio<1000, 1>>;
+    check_range<Base32, Thousandths, 1, 1000>(std::numeric_limits<int32_t>::min(), std::numeric_limits<int32_t>::max(),
+                                              65537);
+    check_range<Base32, Thousandths, 1, 1000>(-5000, 5000, 1);
+
+    // Scale with both a numerator and a denominator
+    using Sevenths = Denomination<uint16_t, std::ratio<7, 3>>;
+    check_range<BaseU16, Sevenths, 3, 7>(0, std::numeric_limits<uint16_t>::max(), 1);
+
+    static_assert(denomination_cast<Base32, Thousandths>(std::numeric_limits<int32_t>::min()) == -2147483);
+}
+
+TEST(Math_Denomination, product_too_wide_for_reciprocal)
+{
+    // The widened product of an int64 and the numerator can overflow, so the value is split around the divisor
+    using Scaled = Denomination<int64_t, std::ratio<3, 1000>>;
+    int64_t const kValue {std::numeric_limits<int64_t>::max() / 2};
+    EXPECT_EQ((denomination_cast<Base64, Scaled>(kValue)), static_cast<int64_t>(reference_scale<1000, 3>(kValue)));
+    EXPECT_EQ((denomination_cast<Base64, Scaled>(-kValue)), static_cast<int64_t>(reference_scale<1000, 3>(-kValue)));
+    EXPECT_EQ((denomination_cast<Base64, Scaled>(int64_t {-2})), -666);
+}
+
+TEST(Math_Denomination, narrowing_result)
+{
+    // The scale is applied in the widened type before narrowing, so a large input still converts correctly
+    using Wide        = BaseDenomination<int64_t>;
+    using Thousandths = Denomination<int16_t, std::ratio<1, 1000>>;
+    EXPECT_EQ((denomination_cast<Thousandths, Wide>(int64_t {12345678})), int16_t {12345});
+}
+
+TEST(Math_Denomination, floating_point)
+{
+    using Volts      = BaseDenomination<float>;
+    using Millivolts = Denomination<int32_t, std::ratio<1000, 1>>;
+    using Microvolts = Denomination<double, std::ratio<1000000, 1>>;
+
+    EXPECT_FLOAT_EQ((denomination_cast<Volts, Millivolts>(1500)), 1.5F);
+    EXPECT_EQ((denomination_cast<Millivolts, Volts>(2.25F)), 2250);
+    EXPECT_DOUBLE_EQ((denomination_cast<Microvolts, Volts>(0.5F)), 500000.0);
+}
+
+TEST(Math_Denomination, bulk_matches_scalar)
+{
+    using Thousandths = Denomination<int32_t, std::ratio<1000, 1>>;
+    using Counts      = Denomination<int32_t, std::ratio<4096, 1>>;
+    using Volts       = BaseDenomination<float>;
+    using Millivolts  = Denomination<float, std::ratio<1000, 1>>;
+
+    // Odd lengths leave a tail for the unrolled and scalar loops
+    std::array<int32_t, 37U> values {};
+    for (size_t i = 0U; i < values.size(); i++)
+        values[i] = static_cast<int32_t>((i * 104729U) - 1000000U) * ((i % 2U) ? 1 : -1);
+    values[0U] = std::numeric_limits<int32_t>::min();
+    values[1U] = std::numeric_limits<int32_t>::max();
+
+    std::array<int32_t, 37U> results {};
+    Span<int32_t const>      values_span {values.data(), values.size()};
+    Span<int32_t>            results_span {results.data(), results.size()};
+
+    ASSERT_EQ((denomination_cast<Base32, Thousandths>(values_span, results_span)), values.size());
+    for (size_t i = 0U; i < values.size(); i++)
+        EXPECT_EQ(results[i], (denomination_cast<Base32, Thousandths>(values[i])));
+
+    ASSERT_EQ((denomination_cast<Base32, Counts>(values_span, results_span)), values.size());
+    for (size_t i = 0U; i < values.size(); i++)
+        EXPECT_EQ(results[i], (denomination_cast<Base32, Counts>(values[i])));
+
+    ASSERT_EQ((denomination_cast<Thousandths, Base32>(values_span, results_span)), values.size());
+    for (size_t i = 0U; i < values.size(); i++)
+        EXPECT_EQ(results[i], (denomination_cast<Thousandths, Base32>(values[i])));
+
+    // Mismatched counts convert only what fits
+    EXPECT_EQ((denomination_cast<Base32, Thousandths>(values_span, results_span.subspan(0U, 5U))), 5U);
+
+    std::array<float, 19U> volts {};
+    for (size_t i = 0U; i < volts.size(); i++)
+        volts[i] = (static_cast<float>(i) * 0.37F) - 3.0F;
+
+    std::array<float, 19U> millivolts {};
+    ASSERT_EQ((denomination_cast<Millivolts, Volts>(Span<float const> {volts.data(), volts.size()},
+                                                    Span<float> {millivolts.data(), millivolts.size()})),
+              volts.size());
+    for (size_t i = 0U; i < volts.size(); i++)
+        EXPECT_EQ(millivolts[i], (denomination_cast<Millivolts, Volts>(volts[i])));
+}
+
+TEST(Math_Denomination, bulk_in_place)
+{
+    using Counts = Denomination<uint16_t, std::ratio<7, 3>>;
+
+    std::array<uint16_t, 21U> samples {};
+    for (size_t i = 0U; i < samples.size(); i++)
+        samples[i] = static_cast<uint16_t>(i * 3000U);
+
+    std::array<uint16_t, 21U> const kOriginal {samples};
+    Span<uint16_t>                  samples_span {samples.data(), samples.size()};
+    ASSERT_EQ((denomination_cast<BaseU16, Counts>(Span<uint16_t const> {samples.data(), samples.size()}, samples_span)),
+              samples.size());
+
+    for (size_t i = 0U; i < samples.size(); i++)
+        EXPECT_EQ(samples[i], (denomination_cast<BaseU16, Counts>(kOriginal[i])));
+}
@@ -0,0 +1,109 @@
+#include <Core/Math/FixedRatio.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <ratio>
+
+using namespace shmit;
+using namespace shmit::math;
+
+using Q16 = FixedRatio<16>;
+using Q8  = FixedRatio<8, int16_t>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FixedRatio tests                ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Math_FixedRatio, construction)
+{
+    static_assert(Q16::kOne == 65536);
+    static_assert(Q16::FromInteger(3).GetRaw() == (3 * 65536));
+    static_assert(Q16::FromInteger(-3).GetRaw() == (-3 * 65536));
+    static_assert(Q16::FromStaticRatio<std::ratio<1, 4>>().GetRaw() == 16384);
+    static_assert(Q16::FromStaticRatio<std::ratio<-5, 2>>().GetRaw() == (-5 * 32768));
+
+    // 1/3 rounds to nearest in either direction
+    static_assert(Q8::FromStaticRatio<std::ratio<1, 3>>().GetRaw() == 85);
+    static_assert(Q8::FromStaticRatio<std::ratio<2, 3>>().GetRaw() == 171);
+    static_assert(Q8::FromStaticRatio<std::ratio<-2, 3>>().GetRaw() == -171);
+
+    constexpr Ratio kOneAndAHalf {create_ratio<3, 2>()};
+    EXPECT_EQ(Q16::FromRatio(kOneAndAHalf), Q16::FromRaw(98304));
+    EXPECT_DOUBLE_EQ(static_cast<double>(Q16::FromRatio(kOneAndAHalf)), 1.5);
+}
+
+TEST(Math_FixedRatio, arithmetic)
+{
+    constexpr Q16 kHalf {Q16::FromStaticRatio<std::ratio<1, 2>>()};
+    constexpr Q16 kThree {Q16::FromInteger(3)};
+
+    static_assert((kThree + kHalf) == Q16::FromStaticRatio<std::ratio<7, 2>>());
+    static_assert((kHalf - kThree) == Q16::FromStaticRatio<std::ratio<-5, 2>>());
+    static_assert((kThree * kHalf) == Q16::FromStaticRatio<std::ratio<3, 2>>());
+    static_assert((kHalf / kThree) == Q16::FromRaw(65536 / 6));
+    static_assert(-kHalf < kHalf);
+    static_assert((kThree * -kThree) == Q16::FromInteger(-9));
+
+    Q16 accumulator {};
+    for (int i = 0; i < 10; i++)
+        accumulator += kHalf * kHalf;
+    EXPECT_EQ(accumulator, (Q16::FromStaticRatio<std::ratio<5, 2>>()));
+
+    accumulator /= kHalf;
+    EXPECT_EQ(accumulator, Q16::FromInteger(5));
+    accumulator -= kThree;
+    accumulator *= kThree;
+    EXPECT_EQ(accumulator, Q16::FromInteger(6));
+}
+
+TEST(Math_FixedRatio, rounding)
+{
+    // The smallest step squared rounds to nearest, ties up
+    constexpr Q8 kStep {Q8::FromRaw(1)};
+    static_assert((kStep * kStep).GetRaw() == 0);
+    static_assert((Q8::FromRaw(16) * Q8::FromRaw(8)).GetRaw() == 1); // 0.5 steps rounds up
+    static_assert((Q8::FromRaw(16) * Q8::FromRaw(7)).GetRaw() == 0);
+
+    constexpr Q16 kThird {Q16::FromStaticRatio<std::ratio<1, 3>>()};
+    static_assert(kThird.Scale(300) == 100);
+    static_assert(kThird.Scale(-300) == -100);
+    static_assert(Q16::FromInteger(2).Scale<int16_t>(-12345) == -24690);
+}
+
+TEST(Math_FixedRatio, normalize)
+{
+    constexpr Q16 kThreeQuarters {Q16::FromStaticRatio<std::ratio<3, 4>>()};
+
+    // ToRatio is exact but left over 2^16, Normalize simplifies it once
+    constexpr Ratio kUnsimplified {kThreeQuarters.ToRatio()};
+    static_assert(kUnsimplified.numerator == 49152);
+    static_assert(kUnsimplified.denominator == 65536);
+
+    constexpr Ratio kNormalized {kThreeQuarters.Normalize()};
+    static_assert(kNormalized.numerator == 3);
+    static_assert(kNormalized.denominator == 4);
+
+    constexpr Ratio kZero {Q16 {}.Normalize()};
+    static_assert(kZero.numerator == 0);
+    static_assert(kZero.denominator == 1);
+
+    // Round trips through Ratio are exact
+    Q16 const value {Q16::FromRaw(-123457)};
+    EXPECT_EQ(Q16::FromRatio(value.Normalize()), value);
+}
+
+TEST(Math_FixedRatio, denomination_scale)
+{
+    using Millivolts = Denomination<int32_t, std::ratio<1000, 1>>;
+    using Volts      = BaseDenomination<int32_t>;
+    using Counts     = Denomination<int32_t, std::ratio<40960, 33>>; // 12-bit ADC over 3.3V
+
+    constexpr Q16 kCountsToMillivolts {denomination_scale<Q16, Millivolts, Counts>()};
+    static_assert(kCountsToMillivolts.Scale(4096) == 3300);
+    static_assert(kCountsToMillivolts.Scale(2048) == 1650);
+
+    constexpr Q16 kMillivoltsToVolts {denomination_scale<Q16, Volts, Millivolts>()};
+    EXPECT_EQ(kMillivoltsToVolts.Scale(1400), 1);
+    EXPECT_EQ(kMillivoltsToVolts.Scale(1600), 2);
+}
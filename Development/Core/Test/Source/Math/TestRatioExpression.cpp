@@ -0,0 +1,70 @@
+#include <Core/Math/RatioExpression.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <type_traits>
+
+using namespace shmit;
+using namespace shmit::math;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  RatioExpression tests           ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Math_RatioExpression, builds_a_tree)
+{
+    constexpr Ratio kHalf {create_ratio<1, 2>()};
+    constexpr Ratio kThird {create_ratio<1, 3>()};
+
+    constexpr auto kExpression {lazy(kHalf) * kThird + kHalf / kThird};
+    static_assert(is_ratio_expression_v<std::remove_const_t<decltype(kExpression)>>);
+
+    // Nothing is simplified until the expression is evaluated
+    constexpr _detail::WideRatio kWide {kExpression.EvaluateWide()};
+    static_assert(kWide.numerator == 20);
+    static_assert(kWide.denominator == 12);
+
+    constexpr Ratio kResult = kExpression;
+    static_assert(kResult.numerator == 5);
+    static_assert(kResult.denominator == 3);
+}
+
+TEST(Math_RatioExpression, matches_eager_arithmetic)
+{
+    Ratio const a {create_ratio<3, 7>()};
+    Ratio const b {create_ratio<-5, 11>()};
+    Ratio const c {create_ratio<2, 9>()};
+    Ratio const d {create_ratio<4, -13>()};
+
+    Ratio const eager {Ratio::Simplify(((a * b) + (c / d)) - (a / b))};
+    Ratio const result = (lazy(a) * b) + (c / lazy(d)) - (a / lazy(b));
+    EXPECT_EQ(result, eager);
+    EXPECT_GT(result.denominator, 0);
+
+    Ratio const negated = lazy(d) / b;
+    EXPECT_EQ(negated, Ratio::Simplify(d / b));
+}
+
+TEST(Math_RatioExpression, widened_intermediates)
+{
+    // Each denominator is near 2^31, so the two-term products overflow intmax_t but not 128 bits
+    constexpr Ratio kCoefficient {create_ratio<2147483647, 2147483646>()};
+    constexpr Ratio kInverse {create_ratio<2147483646, 2147483647>()};
+
+    constexpr Ratio kProduct = lazy(kCoefficient) * kCoefficient * kInverse * kInverse;
+    static_assert(kProduct.numerator == 1);
+    static_assert(kProduct.denominator == 1);
+
+    constexpr Ratio kSum = lazy(kCoefficient) * kCoefficient + lazy(kInverse) * kInverse;
+    static_assert(kSum.numerator >= kSum.denominator);
+}
+
+TEST(Math_RatioExpression, static_ratios)
+{
+    using Gain   = StaticRatio<3, 8>;
+    using Offset = StaticRatio<-1, 4>;
+
+    constexpr Ratio kCombined = lazy(Gain::value) * Gain::value + Offset::value;
+    static_assert(kCombined == add_t<multiply_t<Gain, Gain>, Offset>::value);
+}
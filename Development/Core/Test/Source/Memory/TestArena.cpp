@@ -0,0 +1,89 @@
+#include <Core/Memory/Arena.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+using namespace shmit;
+using namespace shmit::memory;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Arena tests                     ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Memory_Arena, allocates_aligned_until_full)
+{
+    Arena<64U, 16U> arena {};
+
+    Span<uint8_t> const first {arena.Allocate(3U, 1U)};
+    ASSERT_EQ(first.size(), 3U);
+
+    Span<uint8_t> const second {arena.Allocate(8U, 8U)};
+    ASSERT_EQ(second.size(), 8U);
+    EXPECT_EQ((reinterpret_cast<uintptr_t>(second.data()) % 8U), 0U);
+    EXPECT_EQ(second.data(), (first.data() + 8U));
+    EXPECT_EQ(arena.BytesUsed(), 16U);
+
+    // Alignments past the arena's own can't be honoured
+    EXPECT_EQ(arena.Allocate(1U, 32U).size(), 0U);
+    EXPECT_EQ(arena.Allocate(1U, 3U).size(), 0U);
+
+    EXPECT_EQ(arena.Allocate(48U).size(), 48U);
+    EXPECT_EQ(arena.BytesAvailable(), 0U);
+    EXPECT_EQ(arena.Allocate(1U, 1U).size(), 0U);
+
+    arena.Reset();
+    EXPECT_EQ(arena.BytesAvailable(), 64U);
+    EXPECT_EQ(arena.Allocate(64U).data(), first.data());
+}
+
+TEST(Memory_Arena, concurrent_allocations_never_overlap)
+{
+    constexpr size_t  kThreadCount {4U};
+    constexpr size_t  kAllocationSizeBytes {8U};
+    Arena<4096U, 8U>  arena {};
+    std::atomic<bool> is_running {false};
+
+    std::vector<std::vector<uint8_t*>> allocations(kThreadCount);
+    std::vector<std::thread>           threads {};
+    for (size_t i = 0U; i < kThreadCount; i++)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                while (!is_running.load())
+                    std::this_thread::yield();
+
+                Span<uint8_t> allocation {arena.Allocate(kAllocationSizeBytes)};
+                while (allocation.size() > 0U)
+                {
+                    std::fill(allocation.begin(), allocation.end(), static_cast<uint8_t>(i + 1U));
+                    allocations[i].push_back(allocation.data());
+                    allocation = arena.Allocate(kAllocationSizeBytes);
+                }
+            });
+    }
+
+    is_running.store(true);
+    for (std::thread& thread : threads)
+        thread.join();
+
+    // Every allocation still holds what its own thread wrote
+    size_t allocation_count {0U};
+    for (size_t i = 0U; i < kThreadCount; i++)
+    {
+        for (uint8_t const* allocation : allocations[i])
+        {
+            for (size_t j = 0U; j < kAllocationSizeBytes; j++)
+                ASSERT_EQ(allocation[j], (i + 1U));
+        }
+        allocation_count += allocations[i].size();
+    }
+
+    EXPECT_EQ(allocation_count, (4096U / kAllocationSizeBytes));
+    EXPECT_EQ(arena.BytesAvailable(), 0U);
+}
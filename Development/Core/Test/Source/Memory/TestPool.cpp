@@ -0,0 +1,139 @@
+#include <Core/Data/Packet.hpp>
+#include <Core/Memory/Pool.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace shmit;
+using namespace shmit::memory;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Pool tests                      ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Memory_Pool, allocate_and_free)
+{
+    Pool<12U, 3U, 8U> pool {};
+    static_assert(decltype(pool)::kBlockSizeBytes == 16U);
+    ASSERT_EQ(pool.BlocksAvailable(), 3U);
+
+    Span<uint8_t> const first {pool.Allocate()};
+    Span<uint8_t> const second {pool.Allocate()};
+    Span<uint8_t> const third {pool.Allocate()};
+    ASSERT_EQ(first.size(), 16U);
+    ASSERT_EQ(second.size(), 16U);
+    ASSERT_EQ(third.size(), 16U);
+    EXPECT_NE(first.data(), second.data());
+    EXPECT_NE(second.data(), third.data());
+    EXPECT_EQ(pool.BlocksAvailable(), 0U);
+    EXPECT_EQ(pool.Allocate().size(), 0U);
+
+    // Only the start of one of the pool's own blocks may be freed
+    uint8_t foreign {0U};
+    EXPECT_FALSE(pool.Free(&foreign));
+    EXPECT_FALSE(pool.Free(second.data() + 1U));
+
+    EXPECT_TRUE(pool.Free(second.data()));
+    EXPECT_EQ(pool.BlocksAvailable(), 1U);
+    EXPECT_EQ(pool.Allocate().data(), second.data());
+}
+
+TEST(Memory_Pool, block_handles_free_themselves)
+{
+    Pool<8U, 2U> pool {};
+    {
+        auto first {pool.Acquire()};
+        auto second {pool.Acquire()};
+        ASSERT_TRUE(first.IsValid());
+        ASSERT_TRUE(second.IsValid());
+        EXPECT_FALSE(pool.Acquire().IsValid());
+
+        auto moved {std::move(first)};
+        EXPECT_FALSE(first.IsValid());
+        EXPECT_EQ(moved.GetSpan().size(), decltype(pool)::kBlockSizeBytes);
+        EXPECT_EQ(first.GetSpan().size(), 0U);
+
+        second.Reset();
+        EXPECT_EQ(pool.BlocksAvailable(), 1U);
+    }
+    EXPECT_EQ(pool.BlocksAvailable(), 2U);
+}
+
+TEST(Memory_Pool, tag_wraps_without_losing_blocks)
+{
+    // Every allocation and free bumps the 16-bit tag, run it around several times
+    Pool<8U, 2U> pool {};
+    for (uint32_t i = 0U; i < (4U * 65536U); i++)
+    {
+        Span<uint8_t> const kBlock {pool.Allocate()};
+        ASSERT_EQ(kBlock.size(), decltype(pool)::kBlockSizeBytes);
+        ASSERT_TRUE(pool.Free(kBlock.data()));
+    }
+
+    EXPECT_EQ(pool.BlocksAvailable(), 2U);
+    EXPECT_TRUE(pool.Allocate().size() > 0U);
+    EXPECT_TRUE(pool.Allocate().size() > 0U);
+    EXPECT_EQ(pool.Allocate().size(), 0U);
+}
+
+TEST(Memory_Pool, sized_from_packet_footprints)
+{
+    using Small = data::packet_t<uint8_t, uint16_t>;
+    using Large = data::packet_t<uint32_t, uint64_t, uint8_t>;
+
+    using Staging = PacketPool<4U, Small, Large>;
+    static_assert(Staging::kBlockSizeBytes >= data::footprint_size_bytes_v<Large>);
+    static_assert(Staging::kBlockSizeBytes < (data::footprint_size_bytes_v<Large> + Staging::kAlignment));
+    static_assert(Staging::kBlockCount == 4U);
+}
+
+TEST(Memory_Pool, concurrent_allocate_and_free)
+{
+    constexpr size_t  kThreadCount {4U};
+    constexpr size_t  kIterationCount {20000U};
+    Pool<8U, 8U>      pool {};
+    std::atomic<bool> is_running {false};
+    std::atomic<bool> is_corrupt {false};
+
+    std::vector<std::thread> threads {};
+    for (size_t i = 0U; i < kThreadCount; i++)
+    {
+        threads.emplace_back(
+            [&, i]()
+            {
+                while (!is_running.load())
+                    std::this_thread::yield();
+
+                uint8_t const kTag {static_cast<uint8_t>(i + 1U)};
+                for (size_t j = 0U; j < kIterationCount; j++)
+                {
+                    Span<uint8_t> const block {pool.Allocate()};
+                    if (block.size() == 0U)
+                        continue;
+
+                    // No other thread may hold the block while this one does
+                    std::fill(block.begin(), block.end(), kTag);
+                    std::this_thread::yield();
+                    for (uint8_t byte : block)
+                    {
+                        if (byte != kTag)
+                            is_corrupt.store(true);
+                    }
+                    static_cast<void>(pool.Free(block.data()));
+                }
+            });
+    }
+
+    is_running.store(true);
+    for (std::thread& thread : threads)
+        thread.join();
+
+    EXPECT_FALSE(is_corrupt.load());
+    EXPECT_EQ(pool.BlocksAvailable(), 8U);
+}
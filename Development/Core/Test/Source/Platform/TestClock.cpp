@@ -0,0 +1,52 @@
+#include <Core/Platform/Clock.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+using namespace shmit;
+using namespace shmit::platform;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Clock tests                     ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that the precise clock never steps backwards and advances across a sleep
+ *
+ */
+TEST(Platform_Clock, monotonic)
+{
+    static_assert(Clock::is_steady, "Clock must be monotonic");
+
+    Clock::time_point const start {Clock::now()};
+    Clock::time_point       previous {start};
+    for (size_t i = 0U; i < 1000U; i++)
+    {
+        Clock::time_point const now {Clock::now()};
+        EXPECT_GE(now, previous);
+        previous = now;
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds {2});
+    EXPECT_GE((Clock::now() - start), std::chrono::milliseconds {2});
+}
+
+/**
+ * @brief Test that the coarse clock holds its cached time until updated, then catches up with the precise clock
+ *
+ */
+TEST(Platform_CoarseClock, cached_until_update)
+{
+    CoarseClock::time_point const updated {CoarseClock::Update()};
+    EXPECT_EQ(CoarseClock::now(), updated);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds {2});
+    EXPECT_EQ(CoarseClock::now(), updated);
+
+    Clock::time_point const       before_update {Clock::now()};
+    CoarseClock::time_point const refreshed {CoarseClock::Update()};
+    EXPECT_GE(refreshed.time_since_epoch(), before_update.time_since_epoch());
+    EXPECT_GE((refreshed - updated), std::chrono::milliseconds {2});
+}
@@ -0,0 +1,152 @@
+#include <Core/System/Executor.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+using namespace shmit;
+using namespace shmit::system;
+
+/// @brief Longest any test waits for its work to run
+constexpr static std::chrono::seconds kRunTimeout {5};
+
+/// @brief Waits until a counter reaches a value, or the timeout elapses
+static bool wait_for_count(std::atomic<size_t> const& counter, size_t expected)
+{
+    auto const kDeadline {std::chrono::steady_clock::now() + kRunTimeout};
+    while (counter.load(std::memory_order_acquire) < expected)
+    {
+        if (std::chrono::steady_clock::now() > kDeadline)
+            return false;
+        std::this_thread::yield();
+    }
+    return true;
+}
+
+static void count_work(void* context)
+{
+    static_cast<std::atomic<size_t>*>(context)->fetch_add(1U, std::memory_order_acq_rel);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Executor tests               ///////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(System_Executor, worker_count)
+{
+    EXPECT_EQ(3U, Executor {3U}.GetWorkerCount());
+    EXPECT_EQ(Executor::kMaxWorkerCount, Executor {Executor::kMaxWorkerCount + 1U}.GetWorkerCount());
+    EXPECT_GE(Executor {}.GetWorkerCount(), 1U);
+}
+
+TEST(System_Executor, runs_work_submitted_from_outside)
+{
+    constexpr size_t kNumWork {600U}; // More than one deque holds
+
+    std::atomic<size_t> counter {0U};
+    Executor            executor {4U};
+    Work*               work[kNumWork] {};
+    for (size_t i = 0U; i < kNumWork; i++)
+        work[i] = new Work {&count_work, &counter};
+
+    // Work submitted before starting waits for the workers
+    for (size_t i = 0U; i < kNumWork; i++)
+        EXPECT_TRUE(executor.Submit(*work[i]).IsSuccess());
+    EXPECT_TRUE(work[0]->IsPending());
+    EXPECT_FALSE(executor.Submit(*work[0]).IsSuccess()); // Already pending
+
+    ASSERT_TRUE(executor.Start().IsSuccess());
+    EXPECT_TRUE(executor.IsRunning());
+    EXPECT_FALSE(executor.Start().IsSuccess());
+    EXPECT_TRUE(wait_for_count(counter, kNumWork));
+
+    executor.Stop();
+    EXPECT_FALSE(executor.IsRunning());
+    for (size_t i = 0U; i < kNumWork; i++)
+    {
+        EXPECT_FALSE(work[i]->IsPending());
+        delete work[i];
+    }
+}
+
+/// @brief Fans out in to child work from a worker, so that the children land on its deque and are stolen
+struct FanOut
+{
+    constexpr static size_t kNumChildren {200U};
+
+    static void RunRoot(void* context)
+    {
+        FanOut& fan_out {*static_cast<FanOut*>(context)};
+        fan_out.root_thread = std::this_thread::get_id();
+        for (Work* child : fan_out.children)
+            static_cast<void>(fan_out.executor.Submit(*child));
+    }
+
+    static void RunChild(void* context)
+    {
+        FanOut& fan_out {*static_cast<FanOut*>(context)};
+        if (std::this_thread::get_id() != fan_out.root_thread)
+            fan_out.is_stolen.store(true, std::memory_order_relaxed);
+        fan_out.counter.fetch_add(1U, std::memory_order_acq_rel);
+
+        // Long enough that the other workers have time to steal
+        std::this_thread::sleep_for(std::chrono::microseconds {100});
+    }
+
+    Executor&           executor;
+    Work*               children[kNumChildren] {};
+    std::thread::id     root_thread {};
+    std::atomic<size_t> counter {0U};
+    std::atomic<bool>   is_stolen {false};
+};
+
+TEST(System_Executor, idle_workers_steal_work_submitted_from_a_worker)
+{
+    Executor executor {4U};
+    ASSERT_TRUE(executor.Start().IsSuccess());
+
+    FanOut fan_out {executor};
+    for (Work*& child : fan_out.children)
+        child = new Work {&FanOut::RunChild, &fan_out};
+
+    Work root {&FanOut::RunRoot, &fan_out};
+    ASSERT_TRUE(executor.Submit(root).IsSuccess());
+    EXPECT_TRUE(wait_for_count(fan_out.counter, FanOut::kNumChildren));
+    executor.Stop();
+
+    // Children were pushed on to the root's worker, the others only had them by stealing
+    EXPECT_TRUE(fan_out.is_stolen.load());
+    for (Work* child : fan_out.children)
+        delete child;
+}
+
+/// @brief Submits its own work item again until it has run a number of times
+struct Repeater
+{
+    static void Run(void* context)
+    {
+        Repeater& repeater {*static_cast<Repeater*>(context)};
+        if (repeater.counter.fetch_add(1U, std::memory_order_acq_rel) < (kNumRuns - 1U))
+            static_cast<void>(repeater.executor.Submit(repeater.work));
+    }
+
+    constexpr static size_t kNumRuns {1000U};
+
+    Executor&           executor;
+    Work                work {&Repeater::Run, this};
+    std::atomic<size_t> counter {0U};
+};
+
+TEST(System_Executor, handlers_may_resubmit_their_own_work)
+{
+    Executor executor {2U};
+    ASSERT_TRUE(executor.Start().IsSuccess());
+
+    Repeater repeater {executor};
+    ASSERT_TRUE(executor.Submit(repeater.work).IsSuccess());
+    EXPECT_TRUE(wait_for_count(repeater.counter, Repeater::kNumRuns));
+    executor.Stop();
+    EXPECT_EQ(Repeater::kNumRuns, repeater.counter.load());
+}
@@ -0,0 +1,113 @@
+#include <Core/System/Thread.hpp>
+
+#include <gtest/gtest.h>
+
+#include <sched.h>
+
+using namespace shmit;
+using namespace shmit::system;
+
+/// @brief Comfortably past PTHREAD_STACK_MIN on every host
+constexpr static size_t kStackSizeBytes {256U * 1024U};
+
+static ThreadStack<kStackSizeBytes> stack;
+
+struct ThreadRecord
+{
+    bool is_run;
+    int  cpu;
+    int  policy;
+};
+
+static void record_thread(void* context)
+{
+    ThreadRecord& record {*static_cast<ThreadRecord*>(context)};
+    record.is_run = true;
+    record.cpu    = sched_getcpu();
+
+    sched_param parameters {};
+    static_cast<void>(pthread_getschedparam(pthread_self(), &record.policy, &parameters));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Thread tests                 ///////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(System_Thread, start_join)
+{
+    ThreadRecord record {false, -1, -1};
+    Thread       thread {stack.GetSpan()};
+    EXPECT_FALSE(thread.IsJoinable());
+    EXPECT_FALSE(thread.Join().IsSuccess());
+
+    ASSERT_TRUE(thread.Start(&record_thread, &record).IsSuccess());
+    EXPECT_TRUE(thread.IsJoinable());
+    EXPECT_FALSE(thread.Start(&record_thread, &record).IsSuccess());
+
+    ASSERT_TRUE(thread.Join().IsSuccess());
+    EXPECT_FALSE(thread.IsJoinable());
+    EXPECT_TRUE(record.is_run);
+    EXPECT_EQ(SCHED_OTHER, record.policy);
+
+    // A joined thread may be started again on the same stack
+    record.is_run = false;
+    ASSERT_TRUE(thread.Start(&record_thread, &record).IsSuccess());
+    ASSERT_TRUE(thread.Join().IsSuccess());
+    EXPECT_TRUE(record.is_run);
+}
+
+TEST(System_Thread, pinned_core)
+{
+    // Pin to the last core this process may run on
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    ASSERT_EQ(0, sched_getaffinity(0, sizeof(cpu_set), &cpu_set));
+    size_t core {0U};
+    for (size_t i = 0U; i < CPU_SETSIZE; i++)
+    {
+        if (CPU_ISSET(i, &cpu_set))
+            core = i;
+    }
+
+    ThreadRecord record {false, -1, -1};
+    Thread       thread {stack.GetSpan()};
+    ASSERT_TRUE(thread.Start(&record_thread, &record, {core, ThreadOptions::kNormalPriority}).IsSuccess());
+    ASSERT_TRUE(thread.Join().IsSuccess());
+    EXPECT_TRUE(record.is_run);
+    EXPECT_EQ(static_cast<int>(core), record.cpu);
+
+    EXPECT_FALSE(thread.Start(&record_thread, &record, {CPU_SETSIZE, ThreadOptions::kNormalPriority}).IsSuccess());
+    EXPECT_FALSE(thread.IsJoinable());
+}
+
+TEST(System_Thread, real_time_priority)
+{
+    ThreadRecord record {false, -1, -1};
+    Thread       thread {stack.GetSpan()};
+    EXPECT_FALSE(thread.Start(&record_thread, &record, {ThreadOptions::kAnyCore, -1}).IsSuccess());
+    EXPECT_FALSE(
+        thread.Start(&record_thread, &record, {ThreadOptions::kAnyCore, ThreadOptions::kMaxPriority + 1}).IsSuccess());
+
+    // Real-time scheduling needs privileges that a test host may not grant, a refusal must leave nothing running
+    if (!thread.Start(&record_thread, &record, {ThreadOptions::kAnyCore, 10}).IsSuccess())
+    {
+        EXPECT_FALSE(thread.IsJoinable());
+        EXPECT_FALSE(record.is_run);
+        return;
+    }
+
+    ASSERT_TRUE(thread.Join().IsSuccess());
+    EXPECT_TRUE(record.is_run);
+    EXPECT_EQ(SCHED_FIFO, record.policy);
+}
+
+TEST(System_Thread, stack_too_small)
+{
+    static ThreadStack<64U> small_stack;
+
+    ThreadRecord record {false, -1, -1};
+    Thread       thread {small_stack.GetSpan()};
+    EXPECT_FALSE(thread.Start(&record_thread, &record).IsSuccess());
+    EXPECT_FALSE(thread.IsJoinable());
+    EXPECT_FALSE(thread.Join().IsSuccess());
+}
@@ -0,0 +1,115 @@
+#include <Core/Span.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <type_traits>
+
+using namespace shmit;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Span tests                  ////////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(Span, static_extent)
+{
+    uint8_t bytes[8U] {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U};
+
+    // Static extents are part of the type and take no storage
+    Span<uint8_t, 8U> static_span {bytes};
+    static_assert(decltype(static_span)::kExtent == 8U);
+    static_assert(Span<uint8_t>::kExtent == kDynamicExtent);
+    static_assert(sizeof(Span<uint8_t, 8U>) < sizeof(Span<uint8_t>));
+    static_assert(!std::is_constructible<Span<uint8_t, 4U>, uint8_t (&)[8U]>::value);
+    EXPECT_EQ(8U, static_span.count());
+    EXPECT_EQ(bytes, static_span.data());
+
+    // And convert to a dynamic extent over the same elements
+    Span<uint8_t> dynamic_span {static_span};
+    EXPECT_EQ(8U, dynamic_span.count());
+    EXPECT_EQ(bytes, dynamic_span.data());
+    static_assert(!std::is_convertible<Span<uint8_t>, Span<uint8_t, 8U>>::value);
+
+    Span<uint8_t const, 8U> const_span {span_cast<uint8_t const>(static_span)};
+    EXPECT_EQ(7U, const_span.back());
+}
+
+TEST(Span, first_last)
+{
+    uint8_t           bytes[8U] {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U};
+    Span<uint8_t, 8U> static_span {bytes};
+    Span<uint8_t>     dynamic_span {bytes};
+
+    auto static_first {static_span.first<3U>()};
+    static_assert(decltype(static_first)::kExtent == 3U);
+    EXPECT_EQ(0U, static_first.front());
+    EXPECT_EQ(2U, static_first.back());
+
+    auto static_last {dynamic_span.last<2U>()};
+    static_assert(decltype(static_last)::kExtent == 2U);
+    EXPECT_EQ(6U, static_last.front());
+    EXPECT_EQ(7U, static_last.back());
+
+    // Counts past the end are clamped
+    EXPECT_EQ(3U, dynamic_span.first(3U).count());
+    EXPECT_EQ(8U, dynamic_span.first(100U).count());
+    EXPECT_EQ(5U, static_span.last(3U).front());
+    EXPECT_EQ(8U, static_span.last(100U).count());
+    EXPECT_EQ(0U, static_span.last(100U).front());
+}
+
+TEST(Span, subspan)
+{
+    uint8_t           bytes[8U] {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U};
+    Span<uint8_t, 8U> static_span {bytes};
+    Span<uint8_t>     dynamic_span {bytes};
+
+    // Compile-time offsets keep static extents
+    auto middle {static_span.subspan<2U, 4U>()};
+    static_assert(decltype(middle)::kExtent == 4U);
+    EXPECT_EQ(2U, middle.front());
+    EXPECT_EQ(5U, middle.back());
+
+    auto tail {static_span.subspan<5U>()};
+    static_assert(decltype(tail)::kExtent == 3U);
+    EXPECT_EQ(5U, tail.front());
+
+    auto dynamic_tail {dynamic_span.subspan<5U>()};
+    static_assert(decltype(dynamic_tail)::kExtent == kDynamicExtent);
+    EXPECT_EQ(3U, dynamic_tail.count());
+
+    // Runtime offsets and counts are clamped to the span
+    EXPECT_EQ(4U, dynamic_span.subspan(2U, 4U).count());
+    EXPECT_EQ(6U, dynamic_span.subspan(2U).count());
+    EXPECT_EQ(6U, dynamic_span.subspan(2U, 100U).count());
+    EXPECT_EQ(0U, dynamic_span.subspan(100U).count());
+    EXPECT_EQ(dynamic_span.end(), dynamic_span.subspan(100U, 1U).begin());
+}
+
+TEST(Span, copy_fill)
+{
+    uint8_t src[8U] {0U, 1U, 2U, 3U, 4U, 5U, 6U, 7U};
+    uint8_t dest[6U] {};
+
+    // Copies as many elements as the shorter span holds
+    EXPECT_EQ(6U, span_copy(Span<uint8_t const> {src}, Span<uint8_t> {dest}));
+    for (size_t i = 0U; i < 6U; i++)
+        EXPECT_EQ(src[i], dest[i]);
+
+    EXPECT_EQ(4U, span_copy(Span<uint8_t, 8U> {src}.first<4U>(), Span<uint8_t, 6U> {dest}.subspan<2U>()));
+    EXPECT_EQ(3U, dest[5U]);
+
+    span_fill(Span<uint8_t> {dest}, 0xA5);
+    for (uint8_t byte : dest)
+        EXPECT_EQ(0xA5, byte);
+
+    // Elements that aren't trivially copyable are assigned one by one
+    std::string strings[3U] {"one", "two", "three"};
+    std::string copies[3U] {};
+    EXPECT_EQ(3U, span_copy(Span<std::string const> {strings}, Span<std::string> {copies}));
+    EXPECT_EQ("three", copies[2U]);
+
+    span_fill(Span<std::string> {copies}, std::string {"four"});
+    EXPECT_EQ("four", copies[0U]);
+    EXPECT_EQ("four", copies[2U]);
+}
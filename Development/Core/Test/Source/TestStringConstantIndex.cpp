@@ -0,0 +1,122 @@
+#include <Core/StringConstant.hpp>
+#include <Core/StringConstantIndex.hpp>
+
+#include <gtest/gtest.h>
+
+#include <string>
+#include <utility>
+
+using namespace shmit;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using Start  = string_constant("start");
+using Stop   = string_constant("stop");
+using Status = string_constant("status");
+using Reset  = string_constant("reset");
+
+using CommandIndex = StringConstantIndex<Start, Stop, Status, Reset>;
+
+/// @brief Numbered command name, "cmd000" through "cmd999"
+template<size_t I>
+using numbered_command_t = StringConstant<char, 'c', 'm', 'd', static_cast<char>('0' + ((I / 100U) % 10U)),
+                                          static_cast<char>('0' + ((I / 10U) % 10U)), static_cast<char>('0' + (I % 10U))>;
+
+template<typename SequenceT>
+struct numbered_command_index;
+
+template<size_t... Is>
+struct numbered_command_index<std::index_sequence<Is...>>
+{
+    using type = StringConstantIndex<numbered_command_t<Is>...>;
+};
+
+/// @brief About the size of a full command dictionary
+using LargeCommandIndex = typename numbered_command_index<std::make_index_sequence<200U>>::type;
+
+static int handle_start(int argument)
+{
+    return argument + 1;
+}
+
+static int handle_stop(int argument)
+{
+    return argument + 2;
+}
+
+static int handle_status(int argument)
+{
+    return argument + 3;
+}
+
+static int handle_reset(int argument)
+{
+    return argument + 4;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StringConstantIndex tests       ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(StringConstantIndex, Find_keys_return_their_index)
+{
+    EXPECT_EQ(CommandIndex::Find("start"), 0U);
+    EXPECT_EQ(CommandIndex::Find("stop"), 1U);
+    EXPECT_EQ(CommandIndex::Find("status"), 2U);
+    EXPECT_EQ(CommandIndex::Find("reset"), 3U);
+}
+
+TEST(StringConstantIndex, Find_other_strings_are_not_found)
+{
+    EXPECT_EQ(CommandIndex::Find(""), CommandIndex::kNotFound);
+    EXPECT_EQ(CommandIndex::Find("sta"), CommandIndex::kNotFound);
+    EXPECT_EQ(CommandIndex::Find("start "), CommandIndex::kNotFound);
+    EXPECT_EQ(CommandIndex::Find("Reset"), CommandIndex::kNotFound);
+    EXPECT_EQ(CommandIndex::Find("halt"), CommandIndex::kNotFound);
+}
+
+TEST(StringConstantIndex, Find_is_constant_expression)
+{
+    static_assert(CommandIndex::Find("status") == 2U);
+    static_assert(CommandIndex::IndexOf<Reset>() == 3U);
+    static_assert(CommandIndex::Find("halt") == CommandIndex::kNotFound);
+}
+
+TEST(StringConstantIndex, Find_large_key_set)
+{
+    for (size_t i = 0U; i < LargeCommandIndex::kKeyCount; i++)
+    {
+        std::string name {"cmd000"};
+        name[3U] = static_cast<char>('0' + ((i / 100U) % 10U));
+        name[4U] = static_cast<char>('0' + ((i / 10U) % 10U));
+        name[5U] = static_cast<char>('0' + (i % 10U));
+
+        EXPECT_EQ(LargeCommandIndex::Find(name), i);
+    }
+
+    EXPECT_EQ(LargeCommandIndex::Find("cmd200"), LargeCommandIndex::kNotFound);
+    EXPECT_EQ(LargeCommandIndex::Find("cmd"), LargeCommandIndex::kNotFound);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StringDispatchTable tests       ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST(StringDispatchTable, Find_dispatches_to_handler)
+{
+    using Handler = int (*)(int);
+    constexpr StringDispatchTable<Handler, Start, Stop, Status, Reset> kTable {
+        {&handle_start, &handle_stop, &handle_status, &handle_reset}};
+
+    Handler const* handler {kTable.Find("status")};
+    ASSERT_NE(handler, nullptr);
+    EXPECT_EQ((*handler)(10), 13);
+
+    handler = kTable.Find("reset");
+    ASSERT_NE(handler, nullptr);
+    EXPECT_EQ((*handler)(10), 14);
+
+    EXPECT_EQ(kTable.Find("halt"), nullptr);
+}
@@ -0,0 +1,178 @@
+#include <Core/Time/Timer.hpp>
+#include <Core/Time/TimerWheel.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace shmit;
+using namespace shmit::time;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Clock that only moves when told to, and counts how often it is read
+ *
+ */
+struct ManualClock
+{
+    using duration   = std::chrono::nanoseconds;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = std::chrono::time_point<ManualClock>;
+
+    constexpr static bool is_steady {true};
+
+    static time_point now() noexcept
+    {
+        num_reads++;
+        return current;
+    }
+
+    static time_point current;
+    static size_t     num_reads;
+};
+
+ManualClock::time_point ManualClock::current {};
+size_t                  ManualClock::num_reads {0U};
+
+using TestWheel = TimerWheel<6U, 4U, ManualClock, std::chrono::milliseconds>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  TimerWheel tests                ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that a timer expires in the tick of its deadline and not before
+ *
+ */
+TEST(Time_TimerWheel, expires_at_deadline)
+{
+    TestWheel  wheel {};
+    WheelTimer timer {wheel, std::chrono::milliseconds {10}};
+
+    EXPECT_EQ(wheel.AdvanceTo(9U), 0U);
+    EXPECT_FALSE(timer.IsExpired());
+
+    EXPECT_EQ(wheel.AdvanceTo(10U), 1U);
+    EXPECT_TRUE(timer.IsExpired());
+    EXPECT_FALSE(timer.IsOverExpired());
+
+    EXPECT_EQ(wheel.AdvanceTo(21U), 0U);
+    EXPECT_TRUE(timer.IsOverExpired());
+}
+
+/**
+ * @brief Test that one Tick reads the clock once, however many timers are registered and fire
+ *
+ */
+TEST(Time_TimerWheel, tick_reads_clock_once)
+{
+    ManualClock::current = ManualClock::time_point {};
+    TestWheel wheel {};
+
+    size_t     num_calls {0U};
+    auto const count_call {[&](WheelTimer&) { num_calls++; }};
+
+    WheelTimer timer_a {wheel, std::chrono::milliseconds {5}, count_call};
+    WheelTimer timer_b {wheel, std::chrono::milliseconds {5}, count_call};
+    WheelTimer timer_c {wheel, std::chrono::milliseconds {50}, count_call};
+
+    ManualClock::num_reads = 0U;
+    ManualClock::current += std::chrono::milliseconds {5};
+    EXPECT_EQ(wheel.Tick(), 2U);
+    EXPECT_EQ(ManualClock::num_reads, 1U);
+    EXPECT_EQ(num_calls, 2U);
+    EXPECT_FALSE(timer_c.IsExpired());
+}
+
+/**
+ * @brief Test that timers far enough out to live on the upper levels cascade down and fire on their exact tick
+ *
+ */
+TEST(Time_TimerWheel, cascades_upper_levels)
+{
+    TestWheel  wheel {};
+    WheelTimer level_1 {wheel, std::chrono::milliseconds {100}};
+    WheelTimer level_2 {wheel, std::chrono::milliseconds {5000}};
+    WheelTimer level_3 {wheel, std::chrono::milliseconds {300000}};
+
+    EXPECT_EQ(wheel.AdvanceTo(99U), 0U);
+    EXPECT_EQ(wheel.AdvanceTo(100U), 1U);
+    EXPECT_TRUE(level_1.IsExpired());
+
+    EXPECT_EQ(wheel.AdvanceTo(4999U), 0U);
+    EXPECT_EQ(wheel.AdvanceTo(5000U), 1U);
+    EXPECT_TRUE(level_2.IsExpired());
+
+    EXPECT_EQ(wheel.AdvanceTo(299999U), 0U);
+    EXPECT_EQ(wheel.AdvanceTo(300000U), 1U);
+    EXPECT_TRUE(level_3.IsExpired());
+}
+
+/**
+ * @brief Test that a deadline past the span of the whole wheel still fires on its exact tick
+ *
+ */
+TEST(Time_TimerWheel, beyond_wheel_span)
+{
+    using SmallWheel = TimerWheel<2U, 2U, ManualClock, std::chrono::milliseconds>;
+    static_assert(SmallWheel::kSpanTicks == 16U, "Unexpected wheel span");
+
+    SmallWheel wheel {};
+    WheelTimer timer {wheel, std::chrono::milliseconds {100}};
+
+    EXPECT_EQ(wheel.AdvanceTo(99U), 0U);
+    EXPECT_FALSE(timer.IsExpired());
+    EXPECT_EQ(wheel.AdvanceTo(100U), 1U);
+    EXPECT_TRUE(timer.IsExpired());
+}
+
+/**
+ * @brief Test that a cancelled or destroyed timer never fires
+ *
+ */
+TEST(Time_TimerWheel, cancel)
+{
+    TestWheel  wheel {};
+    WheelTimer cancelled {wheel, std::chrono::milliseconds {10}};
+    cancelled.Cancel();
+
+    {
+        WheelTimer destroyed {wheel, std::chrono::milliseconds {10}};
+    }
+
+    EXPECT_EQ(wheel.AdvanceTo(20U), 0U);
+    EXPECT_FALSE(cancelled.IsExpired());
+}
+
+/**
+ * @brief Test that a callback may reset its own timer, and that PeriodicTimer drives a WheelTimer without drift
+ *
+ */
+TEST(Time_TimerWheel, periodic)
+{
+    TestWheel wheel {};
+
+    size_t     num_calls {0U};
+    auto const rearm {[&](WheelTimer& timer)
+                      {
+                          num_calls++;
+                          timer.Reset();
+                      }};
+
+    WheelTimer self_resetting {wheel, std::chrono::milliseconds {10}, rearm};
+    EXPECT_EQ(wheel.AdvanceTo(100U), 10U);
+    EXPECT_EQ(num_calls, 10U);
+    EXPECT_EQ(self_resetting.GetDeadline(), 110U);
+
+    WheelTimer    polled {wheel, std::chrono::milliseconds {4}};
+    PeriodicTimer periodic {polled};
+
+    static_cast<void>(wheel.AdvanceTo(105U));
+    EXPECT_TRUE(periodic.IsExpired());
+    EXPECT_FALSE(periodic.IsExpired());
+    EXPECT_EQ(polled.GetDeadline(), 108U);
+}
@@ -0,0 +1,145 @@
+#include <Core/Data/Decode.hpp>
+#include <Core/Data/Packet.hpp>
+#include <Core/IO/Session/RingSession.hpp>
+#include <Core/StringConstant.hpp>
+#include <Core/Trace/TraceRing.hpp>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+using namespace shmit;
+using namespace shmit::trace;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Test fixtures                   ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using PutEvent   = string_constant("egress.put");
+using TimerEvent = string_constant("timer.fired");
+
+using PutPayload = data::packet_t<uint32_t, uint16_t>;
+
+using TestRing = TraceRing<4U, 8U>;
+
+/// @brief Decodes the header of the record at an index within a drained byte stream
+static TraceRecordHeader decode_header(Span<uint8_t const> drained, size_t index)
+{
+    TraceRecordHeader header {uint64_t {0U}, uint32_t {0U}, uint16_t {0U}, uint16_t {0U}};
+    size_t            bits_decoded {0U};
+    EXPECT_TRUE(
+        data::decode(drained.subspan((index * TestRing::kRecordSizeBytes), TestRing::kRecordSizeBytes), bits_decoded,
+                     header)
+            .IsSuccess());
+    return header;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  TraceRing tests                 ////////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @brief Test that event IDs are hashed from their names at compile time
+ *
+ */
+TEST(Trace_TraceRing, event_ids)
+{
+    static_assert(trace_event_id_v<PutEvent> == fnv1a_hash(std::string_view {"egress.put"}), "");
+    static_assert(trace_event_id_v<PutEvent> != trace_event_id_v<TimerEvent>, "");
+}
+
+/**
+ * @brief Test that logged events drain to a session in order, with their headers and payloads intact
+ *
+ */
+TEST(Trace_TraceRing, log_and_drain)
+{
+    TestRing                       ring;
+    io::session::RingSession<256U> session;
+
+    EXPECT_TRUE(ring.Log<PutEvent>(PutPayload {uint32_t {0xDEADBEEF}, uint16_t {42U}}));
+    EXPECT_TRUE(ring.Log<TimerEvent>());
+    EXPECT_EQ(2U, ring.GetPendingCount());
+
+    EXPECT_EQ(2U, ring.Drain(session, std::chrono::microseconds::zero()));
+    EXPECT_EQ(0U, ring.GetPendingCount());
+    ASSERT_EQ((2U * TestRing::kRecordSizeBytes), session.InputBytesAvailable());
+
+    uint8_t drained[2U * TestRing::kRecordSizeBytes];
+    ASSERT_TRUE(session.Request(Span<uint8_t> {drained}, std::chrono::microseconds::zero()).IsSuccess());
+    Span<uint8_t const> drained_span {drained, sizeof(drained)};
+
+    TraceRecordHeader const put_header {decode_header(drained_span, 0U)};
+    EXPECT_EQ(trace_event_id_v<PutEvent>, data::packet_field_value<1>(put_header));
+    EXPECT_EQ(PutPayload::kSizeBytes, data::packet_field_value<2>(put_header));
+    EXPECT_EQ(0U, data::packet_field_value<3>(put_header));
+
+    PutPayload payload {uint32_t {0U}, uint16_t {0U}};
+    size_t     bits_decoded {0U};
+    ASSERT_TRUE(data::decode(drained_span.subspan(kTraceRecordHeaderSizeBytes, PutPayload::kSizeBytes), bits_decoded,
+                             payload)
+                    .IsSuccess());
+    EXPECT_EQ(0xDEADBEEF, data::packet_field_value<0>(payload));
+    EXPECT_EQ(42U, data::packet_field_value<1>(payload));
+
+    TraceRecordHeader const timer_header {decode_header(drained_span, 1U)};
+    EXPECT_EQ(trace_event_id_v<TimerEvent>, data::packet_field_value<1>(timer_header));
+    EXPECT_EQ(0U, data::packet_field_value<2>(timer_header));
+    EXPECT_EQ(1U, data::packet_field_value<3>(timer_header));
+    EXPECT_GE(data::packet_field_value<0>(timer_header), data::packet_field_value<0>(put_header));
+}
+
+/**
+ * @brief Test that a full ring drops new events, counting them and leaving a gap in the sequence
+ *
+ */
+TEST(Trace_TraceRing, drops_when_full)
+{
+    TestRing                       ring;
+    io::session::RingSession<256U> session;
+
+    for (size_t i = 0U; i < TestRing::kRecordCount; i++)
+        EXPECT_TRUE(ring.Log<TimerEvent>());
+
+    EXPECT_FALSE(ring.Log<TimerEvent>());
+    EXPECT_EQ(1U, ring.GetDroppedCount());
+
+    EXPECT_EQ(TestRing::kRecordCount, ring.Drain(session, std::chrono::microseconds::zero()));
+    EXPECT_TRUE(ring.Log<TimerEvent>());
+    EXPECT_EQ(1U, ring.Drain(session, std::chrono::microseconds::zero()));
+
+    uint8_t drained[(TestRing::kRecordCount + 1U) * TestRing::kRecordSizeBytes];
+    ASSERT_TRUE(session.Request(Span<uint8_t> {drained}, std::chrono::microseconds::zero()).IsSuccess());
+    TraceRecordHeader const header {decode_header(Span<uint8_t const> {drained, sizeof(drained)},
+                                                  TestRing::kRecordCount)};
+    EXPECT_EQ((TestRing::kRecordCount + 1U), data::packet_field_value<3>(header));
+}
+
+/**
+ * @brief Test that records wrapping around the end of the ring drain as one transmission, limited by session space
+ *
+ */
+TEST(Trace_TraceRing, drain_wraps_and_respects_space)
+{
+    TestRing                      ring;
+    io::session::RingSession<64U> session;
+    constexpr size_t              kSessionRecords {64U / TestRing::kRecordSizeBytes};
+
+    for (size_t i = 0U; i < 3U; i++)
+        EXPECT_TRUE(ring.Log<TimerEvent>());
+
+    EXPECT_EQ(2U, ring.Drain(session, std::chrono::microseconds::zero()));
+    EXPECT_EQ(1U, ring.GetPendingCount());
+
+    uint8_t discard[kSessionRecords * TestRing::kRecordSizeBytes];
+    ASSERT_TRUE(session.Request(Span<uint8_t> {discard, (2U * TestRing::kRecordSizeBytes)},
+                                std::chrono::microseconds::zero())
+                    .IsSuccess());
+
+    // Three more records wrap around the end of the four record ring, only two fit in the session
+    for (size_t i = 0U; i < 3U; i++)
+        EXPECT_TRUE(ring.Log<TimerEvent>());
+
+    EXPECT_EQ(kSessionRecords, ring.Drain(session, std::chrono::microseconds::zero()));
+    EXPECT_EQ((4U - kSessionRecords), ring.GetPendingCount());
+}
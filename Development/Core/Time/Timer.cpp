@@ -0,0 +1,44 @@
+#include <Core/Time/Timer.hpp>
+
+namespace shmit
+{
+namespace time
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PeriodicTimer constructor definitions           ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+PeriodicTimer::PeriodicTimer(Timer& timer) noexcept : m_timer {timer}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PeriodicTimer method definitions in alphabetical order          ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+bool PeriodicTimer::IsExpired() const noexcept
+{
+    if (!m_timer.IsExpired())
+        return false;
+
+    m_timer.Reset();
+    return true;
+}
+
+bool PeriodicTimer::IsOverExpired() const noexcept
+{
+    return m_timer.IsOverExpired();
+}
+
+void PeriodicTimer::Reset() noexcept
+{
+    m_timer.Reset();
+}
+
+} // namespace time
+} // namespace shmit
@@ -0,0 +1,59 @@
+#include <Core/Time/TimerWheel.hpp>
+
+namespace shmit
+{
+namespace time
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  WheelTimer constructor definitions              ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+WheelTimer::~WheelTimer() noexcept
+{
+    m_wheel.Cancel(*this);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  WheelTimer method definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+void WheelTimer::Cancel() noexcept
+{
+    m_wheel.Cancel(*this);
+}
+
+uint64_t WheelTimer::GetDeadline() const noexcept
+{
+    return m_deadline;
+}
+
+bool WheelTimer::IsExpired() const noexcept
+{
+    return m_is_expired;
+}
+
+bool WheelTimer::IsOverExpired() const noexcept
+{
+    uint64_t const current_tick {m_wheel.GetCurrentTick()};
+    return (m_is_expired && ((current_tick - m_deadline) > m_duration_ticks));
+}
+
+void WheelTimer::Reset() noexcept
+{
+    // Carry on from the previous deadline unless the timer was restarted early or fell behind
+    uint64_t reset_start {m_deadline};
+    if (!IsExpired() || IsOverExpired())
+        reset_start = m_wheel.GetCurrentTick();
+
+    m_deadline   = (reset_start + m_duration_ticks);
+    m_is_expired = false;
+    m_wheel.Schedule(*this);
+}
+
+} // namespace time
+} // namespace shmit
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <array>
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#include <cstring>
+#endif
+
+namespace shmit
+{
+namespace data
+{
+
+/// @brief Running CRC-32 state before any bytes are added
+constexpr static uint32_t kCrc32Initial {0xFFFFFFFFU};
+
+/// @brief Running CRC-8 state before any bytes are added
+constexpr static uint8_t kCrc8Initial {0x00U};
+
+namespace _detail
+{
+
+/// @brief Reflected form of the CRC-32 (IEEE 802.3) polynomial
+constexpr static uint32_t kCrc32Polynomial {0xEDB88320U};
+
+/// @brief CRC-8 (SMBus) polynomial
+constexpr static uint8_t kCrc8Polynomial {0x07U};
+
+constexpr static std::array<uint32_t, 256U> make_crc32_table() noexcept
+{
+    std::array<uint32_t, 256U> table {};
+    for (uint32_t i = 0U; i < 256U; i++)
+    {
+        uint32_t value {i};
+        for (size_t bit = 0U; bit < 8U; bit++)
+            value = ((value & 1U) != 0U) ? ((value >> 1U) ^ kCrc32Polynomial) : (value >> 1U);
+
+        table[i] = value;
+    }
+
+    return table;
+}
+
+constexpr static std::array<uint8_t, 256U> make_crc8_table() noexcept
+{
+    std::array<uint8_t, 256U> table {};
+    for (uint32_t i = 0U; i < 256U; i++)
+    {
+        uint8_t value {static_cast<uint8_t>(i)};
+        for (size_t bit = 0U; bit < 8U; bit++)
+            value = static_cast<uint8_t>(((value & 0x80U) != 0U) ? ((value << 1U) ^ kCrc8Polynomial) : (value << 1U));
+
+        table[i] = value;
+    }
+
+    return table;
+}
+
+constexpr static std::array<uint32_t, 256U> kCrc32Table {make_crc32_table()};
+constexpr static std::array<uint8_t, 256U>  kCrc8Table {make_crc8_table()};
+
+} // namespace _detail
+
+/**!
+ * @brief Adds bytes to a running CRC-32 (IEEE 802.3, as used by Ethernet and zlib). Uses the ARMv8 CRC instructions
+ * where the target has them, and a 256 entry table otherwise.
+ *
+ * @param[in] state Running state, kCrc32Initial to start
+ * @param[in] bytes Bytes to add
+ * @return Updated running state, pass to crc32_finalize for the checksum
+ */
+inline uint32_t crc32_update(uint32_t state, Span<uint8_t const> bytes) noexcept
+{
+    uint8_t const* data {bytes.data()};
+    size_t         size_bytes {bytes.size()};
+
+#if defined(__ARM_FEATURE_CRC32)
+    for (; size_bytes >= sizeof(uint32_t); size_bytes -= sizeof(uint32_t), data += sizeof(uint32_t))
+    {
+        uint32_t word {0U};
+        static_cast<void>(std::memcpy(&word, data, sizeof(word)));
+        state = __crc32w(state, word);
+    }
+
+    for (; size_bytes > 0U; size_bytes--, data++)
+        state = __crc32b(state, *data);
+#else
+    for (; size_bytes > 0U; size_bytes--, data++)
+        state = (_detail::kCrc32Table[(state ^ *data) & 0xFFU] ^ (state >> 8U));
+#endif
+
+    return state;
+}
+
+/**!
+ * @brief Finishes a running CRC-32
+ *
+ * @param[in] state Running state
+ * @return Checksum
+ */
+constexpr static uint32_t crc32_finalize(uint32_t state) noexcept
+{
+    return ~state;
+}
+
+/**!
+ * @brief CRC-32 of a span of bytes, see crc32_update
+ *
+ * @param[in] bytes Bytes to check
+ * @return Checksum
+ */
+inline uint32_t crc32(Span<uint8_t const> bytes) noexcept
+{
+    return crc32_finalize(crc32_update(kCrc32Initial, bytes));
+}
+
+/**!
+ * @brief Adds bytes to a running CRC-8 (SMBus), meant for short headers
+ *
+ * @param[in] state Running state, kCrc8Initial to start
+ * @param[in] bytes Bytes to add
+ * @return Updated running state, which is also the checksum
+ */
+inline uint8_t crc8_update(uint8_t state, Span<uint8_t const> bytes) noexcept
+{
+    for (uint8_t byte : bytes)
+        state = _detail::kCrc8Table[state ^ byte];
+
+    return state;
+}
+
+/**!
+ * @brief CRC-8 of a span of bytes, see crc8_update
+ *
+ * @param[in] bytes Bytes to check
+ * @return Checksum
+ */
+inline uint8_t crc8(Span<uint8_t const> bytes) noexcept
+{
+    return crc8_update(kCrc8Initial, bytes);
+}
+
+} // namespace data
+} // namespace shmit
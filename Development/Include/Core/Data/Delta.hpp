@@ -0,0 +1,259 @@
+#pragma once
+
+#include "Packet.hpp"
+
+#include "Core/Math/Memory.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace shmit
+{
+namespace data
+{
+
+namespace _detail
+{
+
+/// @brief Number of bits compared or copied at a time between images
+constexpr static size_t kDeltaChunkSizeBits {64U};
+
+/**!
+ * @brief Copy a number of bits between two arbitrary bit offsets. Destination bits outside of the copied range are
+ * preserved.
+ *
+ * @param[in] dest Destination address
+ * @param[in] dest_offset_bits Start bit offset for copying to the destination
+ * @param[in] src Source address
+ * @param[in] src_offset_bits Start bit offset for copying from the source
+ * @param[in] size_bits Number of bits to copy
+ */
+static void copy_delta_bits(uint8_t* dest, size_t dest_offset_bits, uint8_t const* src, size_t src_offset_bits,
+                            size_t size_bits) noexcept
+{
+    uint8_t chunk[kDeltaChunkSizeBits / 8U];
+    for (size_t position = 0U; position < size_bits; position += kDeltaChunkSizeBits)
+    {
+        size_t const kChunkSizeBits {std::min(kDeltaChunkSizeBits, (size_bits - position))};
+        decode_bits(chunk, src, (src_offset_bits + position), kChunkSizeBits);
+        encode_bits(dest, chunk, (dest_offset_bits + position), kChunkSizeBits);
+    }
+}
+
+/**!
+ * @brief Checks whether a range of bits differs between two images of the same footprint
+ *
+ * @param[in] lhs First image
+ * @param[in] rhs Second image
+ * @param[in] layout Placement of the range within both images
+ * @retval true if any bit of the range differs
+ * @retval false if the range is identical
+ */
+static bool delta_field_differs(uint8_t const* lhs, uint8_t const* rhs, FieldLayout const& layout) noexcept
+{
+    // Byte-aligned fields compare whole bytes, the final partial byte is left to the bitwise comparison
+    size_t position {0U};
+    if ((layout.offset_bits % 8U) == 0U)
+    {
+        size_t const kWholeBytes {layout.size_bits / 8U};
+        size_t const kStartByte {layout.offset_bits / 8U};
+        if (std::memcmp((lhs + kStartByte), (rhs + kStartByte), kWholeBytes) != 0)
+            return true;
+        position = kWholeBytes * 8U;
+    }
+
+    uint8_t lhs_chunk[kDeltaChunkSizeBits / 8U];
+    uint8_t rhs_chunk[kDeltaChunkSizeBits / 8U];
+    for (; position < layout.size_bits; position += kDeltaChunkSizeBits)
+    {
+        size_t const kChunkSizeBits {std::min(kDeltaChunkSizeBits, (layout.size_bits - position))};
+        size_t const kChunkSizeBytes {math::bytes_to_contain(kChunkSizeBits)};
+        decode_bits(lhs_chunk, lhs, (layout.offset_bits + position), kChunkSizeBits);
+        decode_bits(rhs_chunk, rhs, (layout.offset_bits + position), kChunkSizeBits);
+        if (std::memcmp(lhs_chunk, rhs_chunk, kChunkSizeBytes) != 0)
+            return true;
+    }
+
+    return false;
+}
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Metafunction definitions                     ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Size in bytes of the field presence bitmap heading every delta of a Packet
+ *
+ * @tparam PacketT Packet specialization
+ */
+template<typename PacketT>
+constexpr static size_t delta_presence_size_bytes_v {math::bytes_to_contain(PacketT::kNumFields)};
+
+/**!
+ * @brief Largest size in bytes that a delta of a Packet may take, when every field has changed
+ *
+ * @tparam PacketT Packet specialization
+ */
+template<typename PacketT>
+constexpr static size_t delta_max_size_bytes_v {delta_presence_size_bytes_v<PacketT> +
+                                                math::bytes_to_contain(PacketT::kSizeBits)};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function declarations              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Encodes a Packet as a delta against a reference image of its footprint: a field presence bitmap, one bit per
+ * field with field 0 in the least significant bit of the first byte, followed by the bits of only the fields that
+ * differ from the reference, packed back to back in field order. The delta is padded to end on a byte boundary.
+ *
+ * On success the reference is updated to the image of the Packet, so that a stream of deltas may be encoded against a
+ * single retained baseline. Padding bits of the reference are left as they are.
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, and ConstBitField are stored as-is while unwrapped types will be wrapped by Field.
+ * @param[in] packet Packet to encode
+ * @param[inout] reference Encoded footprint that the receiver holds as its baseline, at least kSizeBytes long
+ * @param[in] buffer Encoding destination
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start
+ * from. Updated to the tail byte boundary of the delta.
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if the reference is too small or the buffer cannot hold the delta, nothing is
+ * written
+ */
+template<typename... FieldT>
+BinaryResult encode_delta(Packet<FieldT...> const& packet, Span<uint8_t> reference, Span<uint8_t> buffer,
+                          size_t& offset_bits) noexcept;
+
+/**!
+ * @brief Applies a delta produced by encode_delta to a retained baseline image, then decodes the Packet from it
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, and ConstBitField are stored as-is while unwrapped types will be wrapped by Field.
+ * @param[in] buffer Data source
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to the tail byte boundary of the delta.
+ * @param[inout] baseline Encoded footprint matching the sender's reference, at least kSizeBytes long. Updated with
+ * every field present in the delta.
+ * @param[out] packet Decoding destination
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if the baseline is too small or the buffer does not hold the whole delta, nothing
+ * is written
+ */
+template<typename... FieldT>
+BinaryResult decode_delta(Span<uint8_t const> buffer, size_t& offset_bits, Span<uint8_t> baseline,
+                          Packet<FieldT...>& packet) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... FieldT>
+BinaryResult decode_delta(Span<uint8_t const> buffer, size_t& offset_bits, Span<uint8_t> baseline,
+                          Packet<FieldT...>& packet) noexcept
+{
+    using PacketT = Packet<FieldT...>;
+
+    constexpr auto&  kLayout {_detail::packet_layout<PacketT>::value};
+    constexpr size_t kPresenceSizeBytes {delta_presence_size_bytes_v<PacketT>};
+
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+    if ((baseline.size() < PacketT::kSizeBytes) || ((kDataStartOffsetBytes + kPresenceSizeBytes) > buffer.size()))
+        return BinaryResult::Failure();
+
+    // The bitmap determines how long the delta is, check it fits before touching the baseline
+    uint8_t const* presence {buffer.data() + kDataStartOffsetBytes};
+    size_t         delta_size_bits {0U};
+    for (size_t i = 0U; i < PacketT::kNumFields; i++)
+    {
+        if (((presence[i / 8U] >> (i % 8U)) & 1U) != 0U)
+            delta_size_bits += kLayout[i].size_bits;
+    }
+
+    size_t const kDeltaSizeBytes {kPresenceSizeBytes + math::bytes_to_contain(delta_size_bits)};
+    if ((kDataStartOffsetBytes + kDeltaSizeBytes) > buffer.size())
+        return BinaryResult::Failure();
+
+    // Move each present field from its packed position to its place in the footprint
+    uint8_t const* src {presence + kPresenceSizeBytes};
+    size_t         src_offset_bits {0U};
+    for (size_t i = 0U; i < PacketT::kNumFields; i++)
+    {
+        if (((presence[i / 8U] >> (i % 8U)) & 1U) != 0U)
+        {
+            _detail::copy_delta_bits(baseline.data(), kLayout[i].offset_bits, src, src_offset_bits,
+                                     kLayout[i].size_bits);
+            src_offset_bits += kLayout[i].size_bits;
+        }
+    }
+
+    _detail::decode_packet_fields_recursive<0U, PacketT::kNumFields, PacketT>::Do(baseline.data(), packet);
+
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes + kDeltaSizeBytes);
+    return BinaryResult::Success();
+}
+
+template<typename... FieldT>
+BinaryResult encode_delta(Packet<FieldT...> const& packet, Span<uint8_t> reference, Span<uint8_t> buffer,
+                          size_t& offset_bits) noexcept
+{
+    using PacketT = Packet<FieldT...>;
+
+    constexpr auto&  kLayout {_detail::packet_layout<PacketT>::value};
+    constexpr size_t kPresenceSizeBytes {delta_presence_size_bytes_v<PacketT>};
+
+    if (reference.size() < PacketT::kSizeBytes)
+        return BinaryResult::Failure();
+
+    // Encode the whole packet once, then compare it against the reference field by field
+    uint8_t image[PacketT::kSizeBytes] {};
+    _detail::encode_packet_fields_recursive<0U, PacketT::kNumFields, PacketT>::Do(image, packet);
+
+    uint8_t presence[kPresenceSizeBytes] {};
+    size_t  delta_size_bits {0U};
+    for (size_t i = 0U; i < PacketT::kNumFields; i++)
+    {
+        if (_detail::delta_field_differs(image, reference.data(), kLayout[i]))
+        {
+            presence[i / 8U] = static_cast<uint8_t>(presence[i / 8U] | (1U << (i % 8U)));
+            delta_size_bits += kLayout[i].size_bits;
+        }
+    }
+
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+    size_t const kDeltaSizeBytes {kPresenceSizeBytes + math::bytes_to_contain(delta_size_bits)};
+    if ((kDataStartOffsetBytes + kDeltaSizeBytes) > buffer.size())
+        return BinaryResult::Failure();
+
+    // Pack each changed field back to back behind the bitmap, padding bits of the final byte are cleared
+    uint8_t* dest {buffer.data() + kDataStartOffsetBytes};
+    static_cast<void>(std::memcpy(dest, presence, kPresenceSizeBytes));
+    static_cast<void>(std::memset((dest + kPresenceSizeBytes), 0, (kDeltaSizeBytes - kPresenceSizeBytes)));
+
+    size_t dest_offset_bits {math::bits_to_contain(kPresenceSizeBytes)};
+    for (size_t i = 0U; i < PacketT::kNumFields; i++)
+    {
+        if (((presence[i / 8U] >> (i % 8U)) & 1U) != 0U)
+        {
+            _detail::copy_delta_bits(dest, dest_offset_bits, image, kLayout[i].offset_bits, kLayout[i].size_bits);
+            _detail::copy_delta_bits(reference.data(), kLayout[i].offset_bits, image, kLayout[i].offset_bits,
+                                     kLayout[i].size_bits);
+            dest_offset_bits += kLayout[i].size_bits;
+        }
+    }
+
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes + kDeltaSizeBytes);
+    return BinaryResult::Success();
+}
+
+} // namespace data
+} // namespace shmit
@@ -10,6 +10,8 @@
 #include "Core/Result.hpp"
 #include "Core/Span.hpp"
 
+#include <cstring>
+#include <limits>
 #include <type_traits>
 #include <utility>
 
@@ -30,13 +32,18 @@ namespace data
  * not be destroyed during processing.
  *
  * @tparam T Value type of the Field, must be a pointer or arithmetic type. CV and reference qualifiers are removed.
+ * @tparam OrderV Byte order of the encoded value, host order by default. Conversion is folded in to encoding and
+ * decoding and compiles away entirely when the order is native.
  */
-template<typename T>
+template<typename T, ByteOrder OrderV = ByteOrder::kNative>
 struct Field
 {
     /// @brief Stored value type
     using value_type = std::decay_t<T>;
 
+    /// @brief Byte order of the encoded value
+    constexpr static ByteOrder kByteOrder {OrderV};
+
     static_assert(std::is_arithmetic<value_type>::value || std::is_pointer<value_type>::value, "`T` must be an "
                                                                                                "arithmetic type or "
                                                                                                "pointer");
@@ -95,6 +102,22 @@ struct BitField<1>
 /// @brief Alias for unit mutable bitfield
 using Bit = BitField<1U>;
 
+/**!
+ * @brief Alias for a Field encoded most significant byte first
+ *
+ * @tparam T Value type of the Field
+ */
+template<typename T>
+using BigEndianField = Field<T, ByteOrder::kBig>;
+
+/**!
+ * @brief Alias for a Field encoded least significant byte first
+ *
+ * @tparam T Value type of the Field
+ */
+template<typename T>
+using LittleEndianField = Field<T, ByteOrder::kLittle>;
+
 /**!
  * @brief Value storage for a reserved section within an organized structure of memory. ConstBitField subscribes to
  * the same same alternative lifestyle as a regular BitField except that the stored value may not be modified once set.
@@ -125,6 +148,93 @@ struct ConstBitField
 /// @brief Alias for unit reserved bitfield
 using ConstBit = ConstBitField<1U>;
 
+/**!
+ * @brief Value storage for an integer whose encoded size depends on its value. The value is encoded as a LEB128
+ * varint, 7 bits per byte with the high bit of each byte set if another follows, so that counters and identifiers
+ * which are usually small take only as many bytes as they need. Signed values are zigzag encoded first so that small
+ * negative values stay small too.
+ *
+ * @note kSizeBits is the largest size the encoded value may take, the actual size is given by encoded_size_bytes.
+ * Packets holding a VarField are encoded and decoded field by field rather than at fixed positions.
+ *
+ * @tparam T Value type of the VarField, must be an integral type other than bool. CV and reference qualifiers are
+ * removed.
+ */
+template<typename T>
+struct VarField
+{
+    /// @brief Stored value type
+    using value_type = std::decay_t<T>;
+
+    static_assert(std::is_integral<value_type>::value && !std::is_same<value_type, bool>::value, "`T` must be an "
+                                                                                                 "integral type "
+                                                                                                 "other than bool");
+
+    /// @brief Largest size of the encoded value in bytes
+    constexpr static size_t kMaxSizeBytes {
+        (footprint_size_bits_v<value_type> + (_detail::kVarintGroupSizeBits - 1U)) / _detail::kVarintGroupSizeBits};
+
+    /// @brief Largest size of the encoded value in bits
+    constexpr static size_t kSizeBits {math::bits_to_contain(kMaxSizeBytes)};
+
+    /// @brief Stored value
+    value_type value;
+};
+
+/**!
+ * @brief View of a variable number of elements, up to a fixed maximum, preceded on the wire by their count. Only the
+ * occupied elements are encoded, with a single copy. The stored value is a Span rather than an owned array, so that
+ * encoding reads straight from the caller's storage and decoding points straight in to the source buffer.
+ *
+ * @note The count is encoded as the smallest unsigned type that holds MaxCountV, in host byte order, padded to the
+ * alignment of T and followed by the elements as they are laid out in memory. Elements are aligned relative to the
+ * start of the field, so a field encoded at an offset aligned for T decodes in place.
+ *
+ * @warning A decoded ArrayField points in to the buffer it was decoded from, which must outlive any use of its value
+ *
+ * @tparam T Element type, must be trivially copyable. CV qualifiers are removed.
+ * @tparam MaxCountV Largest number of elements
+ */
+template<typename T, size_t MaxCountV>
+struct ArrayField
+{
+    /// @brief Element type
+    using element_type = std::remove_cv_t<T>;
+
+    /// @brief Stored value type, a view of the elements
+    using value_type = Span<element_type const>;
+
+    /// @brief Type of the encoded element count
+    using count_type = smallest_unsigned_t<_detail::significant_bits(MaxCountV)>;
+
+    static_assert(std::is_trivially_copyable<element_type>::value, "`T` must be trivially copyable");
+    static_assert(MaxCountV > 0U, "`MaxCountV` must be nonzero");
+
+    /// @brief Largest number of elements
+    constexpr static size_t kMaxCount {MaxCountV};
+
+    /// @brief Size of the encoded element count in bytes
+    constexpr static size_t kCountSizeBytes {sizeof(count_type)};
+
+    /// @brief Size of the encoded element count and its padding in bytes, the offset of the elements within the field
+    constexpr static size_t kPrefixSizeBytes {((kCountSizeBytes + alignof(element_type) - 1U) / alignof(element_type)) *
+                                              alignof(element_type)};
+
+    /// @brief Largest size of the encoded count and elements in bits
+    constexpr static size_t kSizeBits {math::bits_to_contain(kPrefixSizeBytes + (MaxCountV * sizeof(element_type)))};
+
+    /// @brief Stored value, empty by default
+    value_type value {nullptr, size_t {0U}};
+};
+
+/**!
+ * @brief Alias for an ArrayField of raw bytes
+ *
+ * @tparam MaxSizeBytesV Largest number of bytes
+ */
+template<size_t MaxSizeBytesV>
+using BlobField = ArrayField<uint8_t, MaxSizeBytesV>;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Namespace metafunction declarations              ////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -155,6 +265,7 @@ struct to_data;
  * @note Padding is provided so that space for the encoded data begins and ends on a byte boundary
  *
  * @tparam T Value type of the Field, must be a pointer or arithmetic type. CV and reference qualifiers are removed.
+ * @tparam OrderV Byte order of the encoded value
  * @param[in] field Field to encode
  * @param[in] buffer Encoding destination
  * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start from.
@@ -162,8 +273,8 @@ struct to_data;
  * @retval BinaryResult::kSuccessCode if successful
  * @retval BinaryResult::kFailureCode otherwise
  */
-template<typename T>
-BinaryResult encode(Field<T> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept;
+template<typename T, ByteOrder OrderV>
+BinaryResult encode(Field<T, OrderV> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept;
 
 /**!
  * @brief Copies the entirety of a BitField's footprint from an instance of the BitField to a byte buffer
@@ -199,6 +310,7 @@ BinaryResult encode(ConstBitField<SizeBitsV> const& bitfield, Span<uint8_t> buff
  * // TODO mention padding
  *
  * @tparam T Value type of the Field, must be a pointer or arithmetic type. CV and reference qualifiers are removed.
+ * @tparam OrderV Byte order of the encoded value
  * @param[in] buffer Data source
  * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
  * Updated to include the size, in bits, of the decoded space on success.
@@ -206,8 +318,8 @@ BinaryResult encode(ConstBitField<SizeBitsV> const& bitfield, Span<uint8_t> buff
  * @retval BinaryResult::kSuccessCode if successful
  * @retval BinaryResult::kFailureCode otherwise
  */
-template<typename T>
-BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, Field<T>& field) noexcept;
+template<typename T, ByteOrder OrderV>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, Field<T, OrderV>& field) noexcept;
 
 /**!
  * @brief Copies the entirety of a BitField's footprint from a byte buffer to an instance of the BitField
@@ -241,6 +353,91 @@ BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, BitField<Si
 template<size_t SizeBitsV>
 BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, ConstBitField<SizeBitsV>& bitfield) noexcept;
 
+/**!
+ * @brief Encodes a VarField to a byte buffer, taking only as many bytes as its value needs
+ *
+ * @note Padding is provided so that space for the encoded data begins and ends on a byte boundary
+ *
+ * @tparam T Value type of the VarField
+ * @param[in] field VarField to encode
+ * @param[in] buffer Encoding destination
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start from.
+ * Updated to the tail byte boundary of the encoded value on success.
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename T>
+BinaryResult encode(VarField<T> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept;
+
+/**!
+ * @brief Decodes a VarField from a byte buffer
+ *
+ * @tparam T Value type of the VarField
+ * @param[in] buffer Data source
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to the tail byte boundary of the decoded value on success.
+ * @param[out] field Decoding destination
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if the value is truncated, or too large for `T`
+ */
+template<typename T>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, VarField<T>& field) noexcept;
+
+/**!
+ * @brief Copies the count and occupied elements of an ArrayField to a byte buffer
+ *
+ * @note Padding is provided so that space for the encoded data begins and ends on a byte boundary
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] field ArrayField to encode
+ * @param[in] buffer Encoding destination
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start from.
+ * Updated to the tail byte boundary of the encoded elements on success.
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if the field holds more than MaxCountV elements or the buffer is too small
+ */
+template<typename T, size_t MaxCountV>
+BinaryResult encode(ArrayField<T, MaxCountV> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept;
+
+/**!
+ * @brief Decodes an ArrayField from a byte buffer without copying, the field's value points at the elements within the
+ * buffer
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] buffer Data source, must outlive any use of the decoded value
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to the tail byte boundary of the decoded elements on success.
+ * @param[out] field Decoding destination
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if the count exceeds MaxCountV, the buffer ends early, or the elements are not
+ * aligned for `T` within the buffer
+ */
+template<typename T, size_t MaxCountV>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, ArrayField<T, MaxCountV>& field) noexcept;
+
+/**!
+ * @brief Size an ArrayField takes when encoded
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] field ArrayField to measure
+ * @return Encoded size of the count and occupied elements in bytes
+ */
+template<typename T, size_t MaxCountV>
+size_t encoded_size_bytes(ArrayField<T, MaxCountV> const& field) noexcept;
+
+/**!
+ * @brief Size a VarField takes when encoded
+ *
+ * @tparam T Value type of the VarField
+ * @param[in] field VarField to measure
+ * @return Encoded size in bytes, no more than VarField<T>::kMaxSizeBytes
+ */
+template<typename T>
+size_t encoded_size_bytes(VarField<T> const& field) noexcept;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Namespace metafunction definitions in alphabetical order             ////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -251,10 +448,10 @@ struct to_data
     using type = std::decay_t<T>;
 };
 
-template<typename T>
-struct to_data<Field<T>>
+template<typename T, ByteOrder OrderV>
+struct to_data<Field<T, OrderV>>
 {
-    using type = typename Field<T>::value_type;
+    using type = typename Field<T, OrderV>::value_type;
 };
 
 template<size_t SizeBitsV>
@@ -269,6 +466,18 @@ struct to_data<ConstBitField<SizeBitsV>>
     using type = typename ConstBitField<SizeBitsV>::value_type;
 };
 
+template<typename T>
+struct to_data<VarField<T>>
+{
+    using type = typename VarField<T>::value_type;
+};
+
+template<typename T, size_t MaxCountV>
+struct to_data<ArrayField<T, MaxCountV>>
+{
+    using type = typename ArrayField<T, MaxCountV>::value_type;
+};
+
 /**!
  * @brief Convenience alias to access the returned type of to_data
  *
@@ -283,10 +492,10 @@ struct to_field
     using type = Field<T>;
 };
 
-template<typename T>
-struct to_field<Field<T>>
+template<typename T, ByteOrder OrderV>
+struct to_field<Field<T, OrderV>>
 {
-    using type = Field<T>;
+    using type = Field<T, OrderV>;
 };
 
 template<size_t SizeBitsV>
@@ -301,6 +510,18 @@ struct to_field<ConstBitField<SizeBitsV>>
     using type = ConstBitField<SizeBitsV>;
 };
 
+template<typename T>
+struct to_field<VarField<T>>
+{
+    using type = VarField<T>;
+};
+
+template<typename T, size_t MaxCountV>
+struct to_field<ArrayField<T, MaxCountV>>
+{
+    using type = ArrayField<T, MaxCountV>;
+};
+
 /**!
  * @brief Convenience alias to access the returned type of to_field
  *
@@ -314,10 +535,10 @@ using to_field_t = typename to_field<T>::type;
  *
  * @tparam T Value type of the Field, must be a pointer or arithmetic type. CV and reference qualifiers are removed.
  */
-template<typename T>
-struct footprint_size_bits<Field<T>>
+template<typename T, ByteOrder OrderV>
+struct footprint_size_bits<Field<T, OrderV>>
 {
-    constexpr static size_t value {Field<T>::kSizeBits};
+    constexpr static size_t value {Field<T, OrderV>::kSizeBits};
 };
 
 /**!
@@ -342,15 +563,38 @@ struct footprint_size_bits<ConstBitField<SizeBitsV>>
     constexpr static size_t value {ConstBitField<SizeBitsV>::kSizeBits};
 };
 
+/**!
+ * @brief VarField specialization of footprint_size_bits, the largest size the encoded value may take
+ *
+ * @tparam T Value type of the VarField
+ */
+template<typename T>
+struct footprint_size_bits<VarField<T>>
+{
+    constexpr static size_t value {VarField<T>::kSizeBits};
+};
+
+/**!
+ * @brief ArrayField specialization of footprint_size_bits, the largest size the count and elements may take
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ */
+template<typename T, size_t MaxCountV>
+struct footprint_size_bits<ArrayField<T, MaxCountV>>
+{
+    constexpr static size_t value {ArrayField<T, MaxCountV>::kSizeBits};
+};
+
 /**!
  * @brief Field specialization of footprint_size_bytes
  *
  * @tparam T Value type of the Field, must be a pointer or arithmetic type. CV and reference qualifiers are removed.
  */
-template<typename T>
-struct footprint_size_bytes<Field<T>>
+template<typename T, ByteOrder OrderV>
+struct footprint_size_bytes<Field<T, OrderV>>
 {
-    constexpr static size_t value {math::bytes_to_contain(Field<T>::kSizeBits)};
+    constexpr static size_t value {math::bytes_to_contain(Field<T, OrderV>::kSizeBits)};
 };
 
 /**!
@@ -375,15 +619,39 @@ struct footprint_size_bytes<ConstBitField<SizeBitsV>>
     constexpr static size_t value {math::bytes_to_contain(ConstBitField<SizeBitsV>::kSizeBits)};
 };
 
+/**!
+ * @brief VarField specialization of footprint_size_bytes, the largest size the encoded value may take
+ *
+ * @tparam T Value type of the VarField
+ */
+template<typename T>
+struct footprint_size_bytes<VarField<T>>
+{
+    constexpr static size_t value {VarField<T>::kMaxSizeBytes};
+};
+
+/**!
+ * @brief ArrayField specialization of footprint_size_bytes, the largest size the count and elements may take
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ */
+template<typename T, size_t MaxCountV>
+struct footprint_size_bytes<ArrayField<T, MaxCountV>>
+{
+    constexpr static size_t value {math::bytes_to_contain(ArrayField<T, MaxCountV>::kSizeBits)};
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-BinaryResult encode(Field<T> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept
+template<typename T, ByteOrder OrderV>
+BinaryResult encode(Field<T, OrderV> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept
 {
-    // Pass through to value_type specialized encoding
-    return encode(field.value, buffer, offset_bits);
+    // Pass through to value_type specialized encoding, in wire byte order
+    typename Field<T, OrderV>::value_type const kValue {_detail::convert_byte_order<OrderV>(field.value)};
+    return encode(kValue, buffer, offset_bits);
 }
 
 template<size_t SizeBitsV>
@@ -420,11 +688,71 @@ BinaryResult encode(ConstBitField<SizeBitsV> const& bitfield, Span<uint8_t> buff
     return BinaryResult::Success();
 }
 
+template<typename T, size_t MaxCountV>
+BinaryResult encode(ArrayField<T, MaxCountV> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept
+{
+    using Array = ArrayField<T, MaxCountV>;
+    using Count = typename Array::count_type;
+
+    // Determine byte offset, if nonzero must move to next boundary
+    size_t const kDataStartByteOffset {math::bytes_to_contain(offset_bits)};
+
+    // Guard against attempts at overflowing the buffer, only the occupied elements are required
+    size_t const kSizeBytes {encoded_size_bytes(field)};
+    if ((field.value.count() > Array::kMaxCount) || ((kDataStartByteOffset + kSizeBytes) > buffer.size()))
+        return BinaryResult::Failure();
+
+    Count const kCount {static_cast<Count>(field.value.count())};
+    uint8_t*    dest {buffer.data() + kDataStartByteOffset};
+    static_cast<void>(std::memcpy(dest, &kCount, Array::kCountSizeBytes));
+    static_cast<void>(std::memset((dest + Array::kCountSizeBytes), 0U,
+                                  (Array::kPrefixSizeBytes - Array::kCountSizeBytes))); // Padding to the elements
+    if (kCount > 0U)
+        static_cast<void>(std::memcpy((dest + Array::kPrefixSizeBytes), field.value.data(), field.value.size()));
+
+    offset_bits = math::bits_to_contain(kDataStartByteOffset + kSizeBytes);
+    return BinaryResult::Success();
+}
+
+template<typename T>
+BinaryResult encode(VarField<T> const& field, Span<uint8_t> buffer, size_t& offset_bits) noexcept
+{
+    // Determine byte offset, if nonzero must move to next boundary
+    size_t const kDataStartByteOffset {math::bytes_to_contain(offset_bits)};
+
+    // Guard against attempts at overflowing the buffer, only the bytes the value needs are required
+    size_t const kSizeBytes {encoded_size_bytes(field)};
+    if ((kDataStartByteOffset + kSizeBytes) > buffer.size())
+        return BinaryResult::Failure();
+
+    uint8_t* dest {buffer.data() + kDataStartByteOffset};
+    static_cast<void>(_detail::encode_varint(dest, _detail::to_varint(field.value)));
+
+    offset_bits = math::bits_to_contain(kDataStartByteOffset + kSizeBytes);
+    return BinaryResult::Success();
+}
+
+template<typename T, size_t MaxCountV>
+size_t encoded_size_bytes(ArrayField<T, MaxCountV> const& field) noexcept
+{
+    return ArrayField<T, MaxCountV>::kPrefixSizeBytes + field.value.size();
+}
+
 template<typename T>
-BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, Field<T>& field) noexcept
+size_t encoded_size_bytes(VarField<T> const& field) noexcept
 {
-    // Pass through to value_type specialized decoding
-    return decode(buffer, offset_bits, field.value);
+    return _detail::varint_size_bytes(_detail::to_varint(field.value));
+}
+
+template<typename T, ByteOrder OrderV>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, Field<T, OrderV>& field) noexcept
+{
+    // Pass through to value_type specialized decoding, then restore host byte order
+    BinaryResult const kResult {decode(buffer, offset_bits, field.value)};
+    if (kResult.IsSuccess())
+        field.value = _detail::convert_byte_order<OrderV>(field.value);
+
+    return kResult;
 }
 
 template<size_t SizeBitsV>
@@ -456,5 +784,65 @@ BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, ConstBitFie
     return BinaryResult::Success();
 }
 
+template<typename T, size_t MaxCountV>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, ArrayField<T, MaxCountV>& field) noexcept
+{
+    using Array = ArrayField<T, MaxCountV>;
+    using Count = typename Array::count_type;
+
+    // Determine byte offset, if nonzero must move to next boundary
+    size_t const kDataStartByteOffset {math::bytes_to_contain(offset_bits)};
+    if ((kDataStartByteOffset + Array::kPrefixSizeBytes) > buffer.size())
+        return BinaryResult::Failure();
+
+    Count          count {0U};
+    uint8_t const* src {buffer.data() + kDataStartByteOffset};
+    static_cast<void>(std::memcpy(&count, src, Array::kCountSizeBytes));
+
+    // Guard against counts beyond the field's capacity and against underflowing the buffer
+    size_t const kSizeBytes {Array::kPrefixSizeBytes + (count * sizeof(typename Array::element_type))};
+    if ((count > Array::kMaxCount) || ((kDataStartByteOffset + kSizeBytes) > buffer.size()))
+        return BinaryResult::Failure();
+
+    // The elements are used in place, so the field must have been placed where they come out aligned for their type
+    uint8_t const* elements {src + Array::kPrefixSizeBytes};
+    if ((reinterpret_cast<uintptr_t>(elements) % alignof(typename Array::element_type)) != 0U)
+        return BinaryResult::Failure();
+
+    field.value = typename Array::value_type {reinterpret_cast<typename Array::element_type const*>(elements), count};
+
+    offset_bits = math::bits_to_contain(kDataStartByteOffset + kSizeBytes);
+    return BinaryResult::Success();
+}
+
+template<typename T>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, VarField<T>& field) noexcept
+{
+    using Value    = typename VarField<T>::value_type;
+    using Unsigned = std::make_unsigned_t<Value>;
+
+    // Determine byte offset, if nonzero must move to next boundary
+    size_t const kDataStartByteOffset {math::bytes_to_contain(offset_bits)};
+    if (kDataStartByteOffset > buffer.size())
+        return BinaryResult::Failure();
+
+    uint64_t     word {0U};
+    size_t const kSizeBytes {_detail::decode_varint((buffer.data() + kDataStartByteOffset),
+                                                    (buffer.size() - kDataStartByteOffset), word)};
+
+    // Reject truncated values, and values that don't fit the stored type
+    if ((kSizeBytes == 0U) || (kSizeBytes > VarField<T>::kMaxSizeBytes) ||
+        (word > std::numeric_limits<Unsigned>::max()))
+        return BinaryResult::Failure();
+
+    if constexpr (std::is_signed<Value>::value)
+        field.value = static_cast<Value>(_detail::zigzag_decode(word));
+    else
+        field.value = static_cast<Value>(word);
+
+    offset_bits = math::bits_to_contain(kDataStartByteOffset + kSizeBytes);
+    return BinaryResult::Success();
+}
+
 } // namespace data
 } // namespace shmit
\ No newline at end of file
@@ -40,6 +40,15 @@ struct footprint_size_bytes;
 template<size_t BitSizeV, typename T>
 struct check_if_fits;
 
+/**!
+ * @brief Checks if the encoded footprint of a type matches its in-memory representation byte for byte, so that it may
+ * be encoded and decoded with a single copy of footprint_size_bytes
+ *
+ * @tparam T Any type
+ */
+template<typename T>
+struct is_wire_identical;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //  Namespace metafunction definitions              ////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -98,5 +107,18 @@ using check_if_fits_t = typename check_if_fits<BitSizeV, T>::type;
 template<size_t BitSizeV, typename T>
 constexpr static bool check_if_fits_v {check_if_fits<BitSizeV, T>::value};
 
+template<typename T>
+struct is_wire_identical : public std::false_type
+{
+};
+
+/**!
+ * @brief Convenience alias to access the returned value of is_wire_identical
+ *
+ * @tparam T Any type
+ */
+template<typename T>
+constexpr static bool is_wire_identical_v {is_wire_identical<T>::value};
+
 } // namespace data
 } // namespace shmit
\ No newline at end of file
@@ -0,0 +1,342 @@
+#pragma once
+
+#include "Packet.hpp"
+
+#include "Core/Math/Memory.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <array>
+#include <type_traits>
+#include <utility>
+
+namespace shmit
+{
+namespace data
+{
+
+/**!
+ * @brief Byte image of a Packet's encoded footprint
+ *
+ * @tparam PacketT Packet specialization
+ */
+template<typename PacketT>
+using PacketImage = std::array<uint8_t, PacketT::kSizeBytes>;
+
+namespace _detail
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Reads bits from an image one byte at a time, least significant bit first
+ *
+ * @param[in] image Image to read from
+ * @param[in] offset_bits Offset of the first bit in the image
+ * @param[in] size_bits Number of bits to read, no more than 64
+ * @return Read bits, in the low bits of the word
+ */
+template<size_t SizeBytesV>
+constexpr static uint64_t extract_image_bits(std::array<uint8_t, SizeBytesV> const& image, size_t offset_bits,
+                                             size_t size_bits) noexcept
+{
+    uint64_t bits {0U};
+    size_t   position {0U};
+    while (position < size_bits)
+    {
+        size_t const  kShiftBits {(offset_bits + position) % 8U};
+        size_t const  kTakeBits {std::min((8U - kShiftBits), (size_bits - position))};
+        uint8_t const kMask {static_cast<uint8_t>((1U << kTakeBits) - 1U)};
+
+        uint8_t const kByte {image[(offset_bits + position) / 8U]};
+        bits |= (static_cast<uint64_t>((kByte >> kShiftBits) & kMask) << position);
+        position += kTakeBits;
+    }
+    return bits;
+}
+
+/**!
+ * @brief Writes bits in to an image one byte at a time, least significant bit first. Bits of the image outside of the
+ * written range are preserved.
+ *
+ * @param[inout] image Image to write to
+ * @param[in] offset_bits Offset of the first bit in the image
+ * @param[in] bits Bits to write, in the low bits of the word
+ * @param[in] size_bits Number of bits to write, no more than 64
+ */
+template<size_t SizeBytesV>
+constexpr static void insert_image_bits(std::array<uint8_t, SizeBytesV>& image, size_t offset_bits, uint64_t bits,
+                                        size_t size_bits) noexcept
+{
+    size_t position {0U};
+    while (position < size_bits)
+    {
+        size_t const  kShiftBits {(offset_bits + position) % 8U};
+        size_t const  kTakeBits {std::min((8U - kShiftBits), (size_bits - position))};
+        uint8_t const kMask {static_cast<uint8_t>(((1U << kTakeBits) - 1U) << kShiftBits)};
+
+        uint8_t&      byte {image[(offset_bits + position) / 8U]};
+        uint8_t const kValue {static_cast<uint8_t>((bits >> position) << kShiftBits)};
+        byte = static_cast<uint8_t>((byte & ~kMask) | (kValue & kMask));
+        position += kTakeBits;
+    }
+}
+
+/**!
+ * @brief Reinterprets the bits of an arithmetic value as an unsigned word, in a constant expression
+ *
+ * @tparam T Arithmetic type
+ * @param[in] value Value to reinterpret
+ * @return Bits of the value
+ */
+template<typename T>
+constexpr static uint64_t image_value_bits(T value) noexcept
+{
+    static_assert(std::is_arithmetic<T>::value, "Only arithmetic values may be placed in a constant image");
+
+    using Word = smallest_unsigned_t<math::bits_to_contain(sizeof(T))>;
+    return static_cast<uint64_t>(__builtin_bit_cast(Word, value));
+}
+
+/// @brief Booleans are 1 or 0, whatever their object representation
+constexpr static uint64_t image_value_bits(bool value) noexcept
+{
+    return (value ? 1U : 0U);
+}
+
+/**!
+ * @brief Reinterprets an unsigned word as an arithmetic value, in a constant expression
+ *
+ * @tparam T Arithmetic type
+ * @param[in] bits Bits of the value, in the low bits of the word
+ * @return Value
+ */
+template<typename T>
+constexpr static T image_value_from_bits(uint64_t bits) noexcept
+{
+    static_assert(std::is_arithmetic<T>::value, "Only arithmetic values may be read from a constant image");
+
+    if constexpr (std::is_same<T, bool>::value)
+    {
+        return (bits != 0U);
+    }
+    else
+    {
+        using Word = smallest_unsigned_t<math::bits_to_contain(sizeof(T))>;
+        return __builtin_bit_cast(T, static_cast<Word>(bits));
+    }
+}
+
+template<size_t SizeBytesV, typename PacketT, size_t... IndexV>
+constexpr static void encode_image_fields(std::array<uint8_t, SizeBytesV>& image, size_t offset_bits,
+                                          PacketT const& packet, std::index_sequence<IndexV...>) noexcept;
+
+template<size_t SizeBytesV, typename PacketT, size_t... IndexV>
+constexpr static void decode_image_fields(std::array<uint8_t, SizeBytesV> const& image, size_t offset_bits,
+                                          PacketT& packet, std::index_sequence<IndexV...>) noexcept;
+
+/**!
+ * @brief Places a Field's value in an image, byte by byte in its wire byte order
+ *
+ * @param[inout] image Image to write to
+ * @param[in] offset_bits Offset of the Field within the image, byte aligned
+ * @param[in] field Field to encode
+ */
+template<size_t SizeBytesV, typename T, ByteOrder OrderV>
+constexpr static void encode_image_field(std::array<uint8_t, SizeBytesV>& image, size_t offset_bits,
+                                         Field<T, OrderV> const& field) noexcept
+{
+    constexpr size_t kSizeBytes {footprint_size_bytes_v<T>};
+    uint64_t const   kBits {image_value_bits(field.value)};
+
+    size_t const kStartByte {math::bytes_to_contain(offset_bits)};
+    for (size_t i = 0U; i < kSizeBytes; i++)
+    {
+        size_t const kByte {(OrderV == ByteOrder::kBig) ? (kSizeBytes - 1U - i) : i};
+        image[kStartByte + kByte] = static_cast<uint8_t>(kBits >> math::bits_to_contain(i));
+    }
+}
+
+/**!
+ * @brief Places a nested Packet in an image
+ *
+ * @param[inout] image Image to write to
+ * @param[in] offset_bits Offset of the nested Packet within the image, byte aligned
+ * @param[in] field Nested Packet to encode
+ */
+template<size_t SizeBytesV, typename... FieldT>
+constexpr static void encode_image_field(std::array<uint8_t, SizeBytesV>& image, size_t offset_bits,
+                                         Field<Packet<FieldT...>> const& field) noexcept
+{
+    using NestedPacket = typename Field<Packet<FieldT...>>::value_type;
+    encode_image_fields(image, math::next_boundary_bit_pos(offset_bits), field.value,
+                        std::make_index_sequence<NestedPacket::kNumFields> {});
+}
+
+/**!
+ * @brief Places a BitField's value in an image at its bit position
+ *
+ * @param[inout] image Image to write to
+ * @param[in] offset_bits Offset of the BitField within the image
+ * @param[in] bitfield BitField to encode
+ */
+template<size_t SizeBytesV, size_t SizeBitsV>
+constexpr static void encode_image_field(std::array<uint8_t, SizeBytesV>& image, size_t offset_bits,
+                                         BitField<SizeBitsV> const& bitfield) noexcept
+{
+    insert_image_bits(image, offset_bits, image_value_bits(bitfield.value), SizeBitsV);
+}
+
+/**!
+ * @brief Places a ConstBitField's value in an image at its bit position
+ *
+ * @param[inout] image Image to write to
+ * @param[in] offset_bits Offset of the ConstBitField within the image
+ * @param[in] bitfield ConstBitField to encode
+ */
+template<size_t SizeBytesV, size_t SizeBitsV>
+constexpr static void encode_image_field(std::array<uint8_t, SizeBytesV>& image, size_t offset_bits,
+                                         ConstBitField<SizeBitsV> const& bitfield) noexcept
+{
+    insert_image_bits(image, offset_bits, image_value_bits(bitfield.value), SizeBitsV);
+}
+
+template<size_t SizeBytesV, typename PacketT, size_t... IndexV>
+constexpr static void encode_image_fields(std::array<uint8_t, SizeBytesV>& image, size_t offset_bits,
+                                          PacketT const& packet, std::index_sequence<IndexV...>) noexcept
+{
+    static_cast<void>(offset_bits); // Avoid unused warning for empty packets
+    (encode_image_field(image, (offset_bits + packet_field_layout<IndexV, PacketT>::kOffsetBits),
+                        PacketAccess::Get<IndexV>(packet)),
+     ...);
+}
+
+/**!
+ * @brief Reads a Field's value from an image, byte by byte in its wire byte order
+ *
+ * @param[in] image Image to read from
+ * @param[in] offset_bits Offset of the Field within the image, byte aligned
+ * @param[out] field Decoding destination
+ */
+template<size_t SizeBytesV, typename T, ByteOrder OrderV>
+constexpr static void decode_image_field(std::array<uint8_t, SizeBytesV> const& image, size_t offset_bits,
+                                         Field<T, OrderV>& field) noexcept
+{
+    constexpr size_t kSizeBytes {footprint_size_bytes_v<T>};
+    uint64_t         bits {0U};
+
+    size_t const kStartByte {math::bytes_to_contain(offset_bits)};
+    for (size_t i = 0U; i < kSizeBytes; i++)
+    {
+        size_t const kByte {(OrderV == ByteOrder::kBig) ? (kSizeBytes - 1U - i) : i};
+        bits |= (static_cast<uint64_t>(image[kStartByte + kByte]) << math::bits_to_contain(i));
+    }
+
+    field.value = image_value_from_bits<typename Field<T, OrderV>::value_type>(bits);
+}
+
+/**!
+ * @brief Reads a nested Packet from an image
+ *
+ * @param[in] image Image to read from
+ * @param[in] offset_bits Offset of the nested Packet within the image, byte aligned
+ * @param[out] field Decoding destination
+ */
+template<size_t SizeBytesV, typename... FieldT>
+constexpr static void decode_image_field(std::array<uint8_t, SizeBytesV> const& image, size_t offset_bits,
+                                         Field<Packet<FieldT...>>& field) noexcept
+{
+    using NestedPacket = typename Field<Packet<FieldT...>>::value_type;
+    decode_image_fields(image, math::next_boundary_bit_pos(offset_bits), field.value,
+                        std::make_index_sequence<NestedPacket::kNumFields> {});
+}
+
+/**!
+ * @brief Reads a BitField's value from an image at its bit position
+ *
+ * @param[in] image Image to read from
+ * @param[in] offset_bits Offset of the BitField within the image
+ * @param[out] bitfield Decoding destination
+ */
+template<size_t SizeBytesV, size_t SizeBitsV>
+constexpr static void decode_image_field(std::array<uint8_t, SizeBytesV> const& image, size_t offset_bits,
+                                         BitField<SizeBitsV>& bitfield) noexcept
+{
+    using Value    = typename BitField<SizeBitsV>::value_type;
+    bitfield.value = image_value_from_bits<Value>(extract_image_bits(image, offset_bits, SizeBitsV));
+}
+
+/**!
+ * @brief ConstBitFields can't be reassigned, nothing is decoded
+ *
+ * @param[in] image Unused
+ * @param[in] offset_bits Unused
+ * @param[in] bitfield Unused
+ */
+template<size_t SizeBytesV, size_t SizeBitsV>
+constexpr static void decode_image_field(std::array<uint8_t, SizeBytesV> const& image, size_t offset_bits,
+                                         ConstBitField<SizeBitsV>& bitfield) noexcept
+{
+    static_cast<void>(image);       // Avoid unused warning
+    static_cast<void>(offset_bits); // Avoid unused warning
+    static_cast<void>(bitfield);    // Avoid unused warning
+}
+
+template<size_t SizeBytesV, typename PacketT, size_t... IndexV>
+constexpr static void decode_image_fields(std::array<uint8_t, SizeBytesV> const& image, size_t offset_bits,
+                                          PacketT& packet, std::index_sequence<IndexV...>) noexcept
+{
+    static_cast<void>(offset_bits); // Avoid unused warning for empty packets
+    (decode_image_field(image, (offset_bits + packet_field_layout<IndexV, PacketT>::kOffsetBits),
+                        PacketAccess::Get<IndexV>(packet)),
+     ...);
+}
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Decodes a Packet from a byte image of its footprint. Usable in constant expressions.
+ *
+ * @note Produces the same Packet as decode. ConstBitFields keep the value that PacketT initializes them with.
+ *
+ * @tparam PacketT Packet specialization, fields must hold arithmetic values
+ * @param[in] image Encoded footprint
+ * @return Decoded Packet
+ */
+template<typename PacketT>
+constexpr static PacketT decode_from_array(PacketImage<PacketT> const& image) noexcept
+{
+    static_assert(is_packet_v<PacketT>, "`PacketT` must be a `shmit::data::Packet` specialization");
+
+    PacketT packet {};
+    _detail::decode_image_fields(image, 0U, packet, std::make_index_sequence<PacketT::kNumFields> {});
+    return packet;
+}
+
+/**!
+ * @brief Encodes a Packet to a byte image of its footprint. Usable in constant expressions, so that Packets known at
+ * build time may be encoded once by the compiler and placed in read-only memory:
+ *
+ * `constexpr auto kImage {encode_to_array(Command {kOpcode, kArgument})};`
+ *
+ * @note Produces the same bytes as encode, with padding bits cleared
+ *
+ * @tparam FieldT Field types of the Packet, fields must hold arithmetic values
+ * @param[in] packet Packet to encode
+ * @return Encoded footprint
+ */
+template<typename... FieldT>
+constexpr static PacketImage<Packet<FieldT...>> encode_to_array(Packet<FieldT...> const& packet) noexcept
+{
+    PacketImage<Packet<FieldT...>> image {};
+    _detail::encode_image_fields(image, 0U, packet, std::make_index_sequence<Packet<FieldT...>::kNumFields> {});
+    return image;
+}
+
+} // namespace data
+} // namespace shmit
@@ -10,6 +10,8 @@
 #include "Core/Result.hpp"
 #include "Core/Span.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <tuple>
 #include <type_traits>
 
@@ -18,6 +20,28 @@ namespace shmit
 namespace data
 {
 
+/**!
+ * @brief In-memory storage layout of the fields of a Packet
+ */
+using PacketStorageLayout = _detail::PacketStorageLayout;
+
+/**!
+ * @brief Returns the in-memory storage layout of a Packet. By default fields are held in the order that they are
+ * presented at their natural alignment. Specialize for a Packet's sanitized type to change it.
+ *
+ * @note The encoded footprint of a Packet and the way its fields are accessed are the same for every layout
+ * @warning A specialization must be visible before the Packet is first used, and the same in every translation unit.
+ * Spell the Packet out with every field wrapped, such as `Packet<Field<uint8_t>, Bit>`, as naming it through packet_t
+ * uses it.
+ *
+ * @tparam PacketT Sanitized Packet specialization
+ */
+template<typename PacketT>
+struct packet_storage_layout
+{
+    constexpr static PacketStorageLayout value {false, 0U};
+};
+
 /**!
  * @brief Data's final form, Packet contains a collection of value wrappers -- fields -- that comprise an organized
  * structure of memory.
@@ -90,32 +114,35 @@ public:
     /// @brief Total size in bytes required to contain the memory structure defined by Fields including padding between elements
     constexpr static size_t kSizeBytes {math::bytes_to_contain(kSizeBits)};
 
+    /// @brief In-memory storage layout of the fields, see packet_storage_layout
+    constexpr static PacketStorageLayout kStorageLayout {packet_storage_layout<type>::value};
+
     /**!
      * @brief Initializing constructor. Takes arguments for every field.
      *
      * @param[in] args Values to initialize each field, in order
      */
     template<typename... ArgT>
-    Packet(ArgT&&... args) noexcept;
+    constexpr Packet(ArgT&&... args) noexcept;
 
     /**!
      * @brief Initializing constructor. Takes another Packet of the same specialization and forwards to the copy constructor.
      *
      * @param[in] initialize Reference to Packet specialization to initialize with
      */
-    Packet(Packet& initialize) noexcept;
+    constexpr Packet(Packet& initialize) noexcept;
 
     // Packet is trivially default, copy, and move constructible... and destructible
 
-    Packet() noexcept                   = default;
-    Packet(Packet const& copy) noexcept = default;
-    Packet(Packet&& move) noexcept      = default;
-    ~Packet() noexcept                  = default;
+    constexpr Packet() noexcept                   = default;
+    constexpr Packet(Packet const& copy) noexcept = default;
+    constexpr Packet(Packet&& move) noexcept      = default;
+    ~Packet() noexcept                            = default;
 
     // Packet is trivially copy and move assignable
 
-    Packet& operator=(Packet const& copy) noexcept = default;
-    Packet& operator=(Packet&& move) noexcept      = default;
+    constexpr Packet& operator=(Packet const& copy) noexcept = default;
+    constexpr Packet& operator=(Packet&& move) noexcept      = default;
 
     /**!
      * @brief Copies the entirety of a Packet's footprint from an instance's held fields to a byte buffer in the order
@@ -125,6 +152,7 @@ public:
      * @note Padding is applied to all Field specializations held by the packet
      * @note Bitpacking is applied to any groups of sequential BitField and/or ConstBitField specializations held by the
      * packet
+     * @note Packets holding a VarField or ArrayField are encoded field by field, each taking only the bytes it needs
      *
      * @tparam AltFieldT Type parameter list representing the values to be held as fields by the Packet. Fields are
      * stored in the order they are presented and are accessible through their positional index, starting at 0. Wrapped
@@ -151,7 +179,8 @@ public:
      * @param[in] buffer Data source
      * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
      * Updated to include the size, in bits, of the decoded space on success.
-     * @param[out] packet Decoding destination, reference to Packet instance
+     * @param[out] packet Decoding destination, reference to Packet instance. For Packets holding a variable-size
+     * field, fields ahead of a failure may have been overwritten.
      * @retval BinaryResult::kSuccessCode if successful
      * @retval BinaryResult::kFailureCode otherwise
      */
@@ -169,7 +198,8 @@ public:
      * @return Reference to stored value
      */
     template<size_t IndexV, typename... AltFieldT>
-    friend typename Packet<AltFieldT...>::value_reference_t<IndexV> packet_field_value(Packet<AltFieldT...>& packet) noexcept;
+    friend constexpr typename Packet<AltFieldT...>::value_reference_t<IndexV>
+        packet_field_value(Packet<AltFieldT...>& packet) noexcept;
 
     /**!
      * @brief Fetch a const value reference from a field held by a packet
@@ -182,12 +212,15 @@ public:
      * @return Const reference to stored value
      */
     template<size_t IndexV, typename... AltFieldT>
-    friend typename Packet<AltFieldT...>::const_value_reference_t<IndexV>
+    friend constexpr typename Packet<AltFieldT...>::const_value_reference_t<IndexV>
         packet_field_value(Packet<AltFieldT...> const& packet) noexcept;
 
 private:
-    /// @brief Container of fields
-    Fields m_fields;
+    friend struct _detail::PacketAccess;
+
+    /// @brief Container of fields, held in the order given by kStorageLayout
+    _detail::PacketStorage<kStorageLayout.is_sorted_by_alignment, kStorageLayout.alignment_bytes, to_field_t<FieldT>...>
+        m_fields;
 };
 
 /**!
@@ -253,6 +286,22 @@ struct footprint_size_bytes<Packet<FieldT...>>
     constexpr static size_t value {Packet<FieldT...>::kSizeBytes};
 };
 
+/**!
+ * @brief Packet specialization of is_wire_identical. Holds for Packets of byte-aligned Fields in native byte order,
+ * held in the order they are presented, where no field needs padding in memory to meet its alignment.
+ *
+ * @note Encoding and decoding such a Packet, alone or in a batch, is a single copy
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, and ConstBitField are stored as-is while unwrapped types will be wrapped by Field.
+ */
+template<typename... FieldT>
+struct is_wire_identical<Packet<FieldT...>> :
+    public std::integral_constant<bool, _detail::packet_is_wire_identical<Packet<FieldT...>>::value>
+{
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Namespace metafunction definitions               ////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -281,18 +330,139 @@ using is_packet_t = typename is_packet<T>::type;
 template<typename T>
 constexpr static bool is_packet_v {is_packet<T>::value};
 
+/**!
+ * @brief Describes the placement of a single field within the encoded footprint of a Packet
+ */
+using FieldLayout = _detail::FieldLayout;
+
+/**!
+ * @brief Returns the compile-time placement of a field within the encoded footprint of a Packet. Offsets are relative
+ * to the beginning of the Packet.
+ *
+ * @tparam IndexV Field index
+ * @tparam PacketT Packet specialization
+ */
+template<size_t IndexV, typename PacketT>
+using packet_field_layout = _detail::packet_field_layout<IndexV, PacketT>;
+
+/**!
+ * @brief Convenience alias to access the returned value of packet_field_layout
+ *
+ * @tparam IndexV Field index
+ * @tparam PacketT Packet specialization
+ */
+template<size_t IndexV, typename PacketT>
+constexpr static FieldLayout packet_field_layout_v {packet_field_layout<IndexV, PacketT>::value};
+
+/**!
+ * @brief Returns a table of the compile-time placement of every field within the encoded footprint of a Packet, in
+ * the order that they are stored
+ *
+ * @tparam PacketT Packet specialization
+ */
+template<typename PacketT>
+using packet_layout = _detail::packet_layout<PacketT>;
+
+/**!
+ * @brief Convenience alias to access the returned value of packet_layout
+ *
+ * @tparam PacketT Packet specialization
+ */
+template<typename PacketT>
+constexpr static auto packet_layout_v {packet_layout<PacketT>::value};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function declarations              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Encodes a batch of Packets back to back in to a byte buffer. Capacity is checked once for the entire batch, if
+ * the buffer cannot hold every Packet then only as many as fit are encoded.
+ *
+ * @note Every Packet footprint begins and ends on a byte boundary, so Packets are placed kSizeBytes apart
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, and ConstBitField are stored as-is while unwrapped types will be wrapped by Field.
+ * @param[in] packets Packets to encode
+ * @param[in] buffer Encoding destination
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start
+ * from. Updated to the tail byte boundary of the last encoded Packet.
+ * @return Number of Packets encoded
+ */
+template<typename... FieldT>
+size_t encode_batch(Span<Packet<FieldT...> const> packets, Span<uint8_t> buffer, size_t& offset_bits) noexcept;
+
+/**!
+ * @brief Decodes a batch of Packets laid back to back within a byte buffer. Capacity is checked once for the entire
+ * batch, if the buffer does not hold every Packet then only as many as are available are decoded.
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, and ConstBitField are stored as-is while unwrapped types will be wrapped by Field.
+ * @param[in] buffer Data source
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to the tail byte boundary of the last decoded Packet.
+ * @param[out] packets Decoding destination
+ * @return Number of Packets decoded
+ */
+template<typename... FieldT>
+size_t decode_batch(Span<uint8_t const> buffer, size_t& offset_bits, Span<Packet<FieldT...>> packets) noexcept;
+
+/**!
+ * @brief Size a Packet takes when encoded. Fixed-size Packets always take kSizeBytes, while Packets holding a VarField
+ * or ArrayField depend on the values they hold and take no more than kSizeBytes.
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, ConstBitField, VarField, and ArrayField are stored as-is while unwrapped types will be wrapped by Field.
+ * @param[in] packet Packet to measure
+ * @return Encoded size in bytes
+ */
+template<typename... FieldT>
+size_t encoded_size_bytes(Packet<FieldT...> const& packet) noexcept;
+
+/**!
+ * @brief Encodes a fixed-size Packet at the start of a buffer of static extent. The buffer is checked against the
+ * Packet's footprint at compile time, so no check is made at runtime.
+ *
+ * @tparam ExtentV Size of the buffer in bytes, no less than the Packet's kSizeBytes
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, and ConstBitField are stored as-is while unwrapped types will be wrapped by Field.
+ * @param[in] packet Packet to encode
+ * @param[in] buffer Encoding destination
+ */
+template<size_t ExtentV, typename... FieldT>
+void encode(Packet<FieldT...> const& packet, Span<uint8_t, ExtentV> buffer) noexcept;
+
+/**!
+ * @brief Decodes a fixed-size Packet from the start of a buffer of static extent. The buffer is checked against the
+ * Packet's footprint at compile time, so no check is made at runtime.
+ *
+ * @tparam ExtentV Size of the buffer in bytes, no less than the Packet's kSizeBytes
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their index, starting at 0. Wrapped types such as Field,
+ * BitField, and ConstBitField are stored as-is while unwrapped types will be wrapped by Field.
+ * @param[in] buffer Data source
+ * @param[out] packet Decoding destination
+ */
+template<size_t ExtentV, typename... FieldT>
+void decode(Span<uint8_t const, ExtentV> buffer, Packet<FieldT...>& packet) noexcept;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Packet constructor definitions               ////////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename... FieldT>
 template<typename... ArgT>
-Packet<FieldT...>::Packet(ArgT&&... args) noexcept : m_fields {to_field_t<FieldT> {args}...}
+constexpr Packet<FieldT...>::Packet(ArgT&&... args) noexcept : m_fields {to_field_t<FieldT> {args}...}
 {
 }
 
 template<typename... FieldT>
-Packet<FieldT...>::Packet(Packet<FieldT...>& initialize) noexcept : Packet {const_cast<const Packet&>(initialize)}
+constexpr Packet<FieldT...>::Packet(Packet<FieldT...>& initialize) noexcept :
+    Packet {const_cast<const Packet&>(initialize)}
 {
 }
 
@@ -301,66 +471,189 @@ Packet<FieldT...>::Packet(Packet<FieldT...>& initialize) noexcept : Packet {cons
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 template<typename... FieldT>
-BinaryResult encode(Packet<FieldT...> const& packet, Span<uint8_t> buffer, size_t& offset_bits) noexcept
+size_t decode_batch(Span<uint8_t const> buffer, size_t& offset_bits, Span<Packet<FieldT...>> packets) noexcept
 {
-    using Fields = typename Packet<FieldT...>::Fields;
+    using PacketT = Packet<FieldT...>;
 
     // Determine start offset, must be on byte boundary
     size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
-    size_t       encode_offset_bits {math::bits_to_contain(kDataStartOffsetBytes)};
+    if (kDataStartOffsetBytes > buffer.size())
+        return 0U;
+
+    // Single capacity check for the entire batch
+    size_t const kNumAvailable {(buffer.size() - kDataStartOffsetBytes) / PacketT::kSizeBytes};
+    size_t const kNumPackets {std::min(packets.count(), kNumAvailable)};
+    if (kNumPackets == 0U)
+        return 0U;
+
+    uint8_t const* src {buffer.data() + kDataStartOffsetBytes};
+    PacketT*       packet {packets.data()};
+    if constexpr (is_wire_identical<PacketT>::value)
+        static_cast<void>(std::memcpy(reinterpret_cast<uint8_t*>(packet), src, (kNumPackets * PacketT::kSizeBytes)));
+    else
+    {
+        for (size_t i = 0U; i < kNumPackets; i++)
+            _detail::decode_packet_fields_recursive<0U, PacketT::kNumFields, PacketT>::Do(
+                (src + (i * PacketT::kSizeBytes)), packet[i]);
+    }
 
-    // Guard against attempts at overflowing the buffer
-    if ((kDataStartOffsetBytes + Packet<FieldT...>::kSizeBytes) > buffer.size())
-        return BinaryResult::Failure();
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes + (kNumPackets * PacketT::kSizeBytes));
+    return kNumPackets;
+}
 
-    // Perform recursive encoding of Packet fields
-    BinaryResult result {_detail::encode_packet_fields_recursive<0U, Packet<FieldT...>::kNumFields, Packet<FieldT...>>::Do(
-        buffer, encode_offset_bits, packet.m_fields)};
+template<typename... FieldT>
+BinaryResult encode(Packet<FieldT...> const& packet, Span<uint8_t> buffer, size_t& offset_bits) noexcept
+{
+    // Variable-size fields have no fixed placement, their packets take the streaming path
+    if constexpr (_detail::packet_has_variable_size_fields<Packet<FieldT...>>::value)
+        return _detail::encode_packet_streaming(packet, buffer, offset_bits);
+    else
+    {
+        // Determine start offset, must be on byte boundary
+        size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+
+        // Guard against attempts at overflowing the buffer
+        // This is the only check required, every field is placed at a fixed offset within the Packet's footprint
+        if ((kDataStartOffsetBytes + Packet<FieldT...>::kSizeBytes) > buffer.size())
+            return BinaryResult::Failure();
+
+        // Perform encoding of Packet fields at their compile-time offsets, in one copy if memory already matches
+        if constexpr (is_wire_identical<Packet<FieldT...>>::value)
+            static_cast<void>(std::memcpy((buffer.data() + kDataStartOffsetBytes),
+                                          reinterpret_cast<uint8_t const*>(&packet), Packet<FieldT...>::kSizeBytes));
+        else
+            _detail::encode_packet_fields_recursive<0U, Packet<FieldT...>::kNumFields, Packet<FieldT...>>::Do(
+                (buffer.data() + kDataStartOffsetBytes), packet);
+
+        // Footprint includes padding so that it ends on a byte boundary
+        offset_bits = math::bits_to_contain(kDataStartOffsetBytes) + Packet<FieldT...>::kSizeBits;
+        return BinaryResult::Success();
+    }
+}
 
-    // Apply padding to the offset result, if encoding was successful, so that it ends on a byte boundary
-    if (result.IsSuccess())
-        offset_bits = math::next_boundary_bit_pos(encode_offset_bits);
+template<typename... FieldT>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, Packet<FieldT...>& packet) noexcept
+{
+    // Variable-size fields have no fixed placement, their packets take the streaming path
+    if constexpr (_detail::packet_has_variable_size_fields<Packet<FieldT...>>::value)
+        return _detail::decode_packet_streaming(buffer, offset_bits, packet);
+    else
+    {
+        // Determine start offset, must be on byte boundary
+        size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+
+        // Guard against attempts at underflowing the buffer
+        // This is the only check required, every field is placed at a fixed offset within the Packet's footprint
+        if ((kDataStartOffsetBytes + Packet<FieldT...>::kSizeBytes) > buffer.size())
+            return BinaryResult::Failure();
+
+        // Perform decoding of Packet fields from their compile-time offsets, in one copy if memory already matches
+        if constexpr (is_wire_identical<Packet<FieldT...>>::value)
+            static_cast<void>(std::memcpy(reinterpret_cast<uint8_t*>(&packet), (buffer.data() + kDataStartOffsetBytes),
+                                          Packet<FieldT...>::kSizeBytes));
+        else
+            _detail::decode_packet_fields_recursive<0U, Packet<FieldT...>::kNumFields, Packet<FieldT...>>::Do(
+                (buffer.data() + kDataStartOffsetBytes), packet);
+
+        // Footprint includes padding so that it ends on a byte boundary
+        offset_bits = math::bits_to_contain(kDataStartOffsetBytes) + Packet<FieldT...>::kSizeBits;
+        return BinaryResult::Success();
+    }
+}
 
-    return result;
+template<size_t ExtentV, typename... FieldT>
+void decode(Span<uint8_t const, ExtentV> buffer, Packet<FieldT...>& packet) noexcept
+{
+    static_assert((ExtentV != kDynamicExtent), "`buffer` must have a static extent");
+    static_assert(!_detail::packet_has_variable_size_fields<Packet<FieldT...>>::value,
+                  "`Packet` must not hold variable-size fields");
+    static_assert((ExtentV >= Packet<FieldT...>::kSizeBytes), "`buffer` must hold the footprint of the Packet");
+
+    if constexpr (is_wire_identical<Packet<FieldT...>>::value)
+        static_cast<void>(
+            std::memcpy(reinterpret_cast<uint8_t*>(&packet), buffer.data(), Packet<FieldT...>::kSizeBytes));
+    else
+        _detail::decode_packet_fields_recursive<0U, Packet<FieldT...>::kNumFields, Packet<FieldT...>>::Do(buffer.data(),
+                                                                                                         packet);
+}
+
+template<size_t ExtentV, typename... FieldT>
+void encode(Packet<FieldT...> const& packet, Span<uint8_t, ExtentV> buffer) noexcept
+{
+    static_assert((ExtentV != kDynamicExtent), "`buffer` must have a static extent");
+    static_assert(!_detail::packet_has_variable_size_fields<Packet<FieldT...>>::value,
+                  "`Packet` must not hold variable-size fields");
+    static_assert((ExtentV >= Packet<FieldT...>::kSizeBytes), "`buffer` must hold the footprint of the Packet");
+
+    if constexpr (is_wire_identical<Packet<FieldT...>>::value)
+        static_cast<void>(
+            std::memcpy(buffer.data(), reinterpret_cast<uint8_t const*>(&packet), Packet<FieldT...>::kSizeBytes));
+    else
+        _detail::encode_packet_fields_recursive<0U, Packet<FieldT...>::kNumFields, Packet<FieldT...>>::Do(buffer.data(),
+                                                                                                         packet);
 }
 
 template<typename... FieldT>
-BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, Packet<FieldT...>& packet) noexcept
+size_t encode_batch(Span<Packet<FieldT...> const> packets, Span<uint8_t> buffer, size_t& offset_bits) noexcept
 {
-    using Fields = typename Packet<FieldT...>::Fields;
+    using PacketT = Packet<FieldT...>;
 
     // Determine start offset, must be on byte boundary
     size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
-    size_t       encode_offset_bits {math::bits_to_contain(kDataStartOffsetBytes)};
-
-    // Guard against attempts at underflowing the buffer
-    if ((kDataStartOffsetBytes + Packet<FieldT...>::kSizeBytes) > buffer.size())
-        return BinaryResult::Failure();
-
-    // Perform recursive decoding of Packet fields
-    BinaryResult result {_detail::decode_packet_fields_recursive<0U, Packet<FieldT...>::kNumFields, Packet<FieldT...>>::Do(
-        buffer, encode_offset_bits, packet.m_fields)};
+    if (kDataStartOffsetBytes > buffer.size())
+        return 0U;
+
+    // Single capacity check for the entire batch
+    size_t const kNumAvailable {(buffer.size() - kDataStartOffsetBytes) / PacketT::kSizeBytes};
+    size_t const kNumPackets {std::min(packets.count(), kNumAvailable)};
+    if (kNumPackets == 0U)
+        return 0U;
+
+    uint8_t*       dest {buffer.data() + kDataStartOffsetBytes};
+    PacketT const* packet {packets.data()};
+    if constexpr (is_wire_identical<PacketT>::value)
+        static_cast<void>(
+            std::memcpy(dest, reinterpret_cast<uint8_t const*>(packet), (kNumPackets * PacketT::kSizeBytes)));
+    else
+    {
+        for (size_t i = 0U; i < kNumPackets; i++)
+            _detail::encode_packet_fields_recursive<0U, PacketT::kNumFields, PacketT>::Do(
+                (dest + (i * PacketT::kSizeBytes)), packet[i]);
+    }
 
-    // Apply padding to the offset result, if decoding was successful, so that it ends on a byte boundary
-    if (result.IsSuccess())
-        offset_bits = math::next_boundary_bit_pos(encode_offset_bits);
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes + (kNumPackets * PacketT::kSizeBytes));
+    return kNumPackets;
+}
 
-    return result;
+template<typename... FieldT>
+size_t encoded_size_bytes(Packet<FieldT...> const& packet) noexcept
+{
+    if constexpr (_detail::packet_has_variable_size_fields<Packet<FieldT...>>::value)
+    {
+        constexpr std::make_index_sequence<Packet<FieldT...>::kNumFields> kIndices {};
+        return math::bytes_to_contain(_detail::streaming_packet_size_bits(packet, kIndices));
+    }
+    else
+    {
+        static_cast<void>(packet); // Avoid unused warning
+        return Packet<FieldT...>::kSizeBytes;
+    }
 }
 
 template<size_t IndexV, typename... FieldT>
-typename Packet<FieldT...>::value_reference_t<IndexV> packet_field_value(Packet<FieldT...>& packet) noexcept
+constexpr typename Packet<FieldT...>::value_reference_t<IndexV> packet_field_value(Packet<FieldT...>& packet) noexcept
 {
     using Field = typename _detail::fetch_packet_field_type_info<IndexV, Packet<FieldT...>>::type;
-    Field& field {std::get<IndexV>(packet.m_fields)};
+    Field& field {_detail::get_packet_field<IndexV>(packet.m_fields)};
     return field.value;
 }
 
 template<size_t IndexV, typename... FieldT>
-typename Packet<FieldT...>::const_value_reference_t<IndexV> packet_field_value(Packet<FieldT...> const& packet) noexcept
+constexpr typename Packet<FieldT...>::const_value_reference_t<IndexV>
+packet_field_value(Packet<FieldT...> const& packet) noexcept
 {
     using Field = typename _detail::fetch_packet_field_type_info<IndexV, Packet<FieldT...>>::type;
-    Field const& field {std::get<IndexV>(packet.m_fields)};
+    Field const& field {_detail::get_packet_field<IndexV>(packet.m_fields)};
     return field.value;
 }
 
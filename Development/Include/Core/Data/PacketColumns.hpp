@@ -0,0 +1,293 @@
+#pragma once
+
+#include "Packet.hpp"
+
+#include "Core/Math/Memory.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace shmit
+{
+namespace data
+{
+
+namespace _detail
+{
+
+/**!
+ * @brief Field type that a column is decoded through. ConstBitFields are never decoded, so their bits are read
+ * through a BitField of the same size, which takes the same place within the footprint.
+ *
+ * @tparam FieldT Field type
+ */
+template<typename FieldT>
+struct column_field
+{
+    using type = FieldT;
+};
+
+template<size_t SizeBitsV>
+struct column_field<ConstBitField<SizeBitsV>>
+{
+    using type = BitField<SizeBitsV>;
+};
+
+template<typename FieldT>
+using column_field_t = typename column_field<FieldT>::type;
+
+/// @brief Value type held by the column of a field
+template<typename FieldT>
+using column_value_type_t = typename column_field_t<to_field_t<FieldT>>::value_type;
+
+struct PacketColumnsAccess;
+
+} // namespace _detail
+
+/**!
+ * @brief Structure-of-arrays container of decoded Packets. Every field is held in its own contiguous column, so that
+ * scanning a single field across many Packets streams through memory instead of striding across whole rows.
+ *
+ * Columns hold the decoded value of each field, ConstBitField columns hold the bits found on the wire. Storage is
+ * held inline, place large containers in static storage.
+ *
+ * @tparam CapacityV Maximum number of rows
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Must not hold a
+ * variable-size field or a nested Packet.
+ */
+template<size_t CapacityV, typename... FieldT>
+class PacketColumns
+{
+public:
+    /// @brief Packet whose fields make up the rows
+    using packet_type = packet_t<FieldT...>;
+
+    /**!
+     * @brief Value type held by a column
+     *
+     * @tparam IndexV Field index
+     */
+    template<size_t IndexV>
+    using column_value_t = std::tuple_element_t<IndexV, std::tuple<_detail::column_value_type_t<FieldT>...>>;
+
+    /// @brief Maximum number of rows
+    constexpr static size_t kCapacity {CapacityV};
+
+    /// @brief Number of columns
+    constexpr static size_t kNumFields {sizeof...(FieldT)};
+
+    static_assert(CapacityV > 0U, "`CapacityV` must be nonzero");
+    static_assert(!_detail::packet_has_variable_size_fields<packet_type>::value, "Columns can only hold packets of a "
+                                                                                 "fixed layout");
+    static_assert(!(_detail::is_packet<typename to_field_t<FieldT>::value_type>::value || ...), "Nested Packets can't "
+                                                                                               "be held in columns");
+
+    /// @brief Default constructor, holds no rows
+    PacketColumns() noexcept = default;
+
+    /// @brief Number of rows held
+    size_t Count() const noexcept;
+
+    /// @brief Drops every row
+    void Clear() noexcept;
+
+    /**!
+     * @brief Access a column
+     *
+     * @tparam IndexV Field index
+     * @return Span over the values of every row held
+     */
+    template<size_t IndexV>
+    Span<column_value_t<IndexV>> GetColumn() noexcept;
+
+    /**!
+     * @brief Access a column
+     *
+     * @tparam IndexV Field index
+     * @return Const span over the values of every row held
+     */
+    template<size_t IndexV>
+    Span<column_value_t<IndexV> const> GetColumn() const noexcept;
+
+    /**!
+     * @brief Decodes Packets laid back to back within a byte buffer straight in to columns, appending a row for
+     * every Packet. Capacity is checked once for the entire batch, if the buffer or the container can't hold every
+     * Packet then only as many as fit are decoded.
+     *
+     * @tparam CapacityAltV Maximum number of rows
+     * @tparam AltFieldT Type parameter list representing the values to be held as fields by the Packet
+     * @param[in] buffer Data source
+     * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+     * Updated to the tail byte boundary of the last decoded Packet.
+     * @param[inout] columns Decoding destination
+     * @return Number of Packets decoded
+     */
+    template<size_t CapacityAltV, typename... AltFieldT>
+    friend size_t decode_into_columns(Span<uint8_t const> buffer, size_t& offset_bits,
+                                      PacketColumns<CapacityAltV, AltFieldT...>& columns) noexcept;
+
+private:
+    friend struct _detail::PacketColumnsAccess;
+
+    /// @brief Packet each row is staged in while decoding, laid out the same as packet_type
+    using StagingPacket = Packet<_detail::column_field_t<to_field_t<FieldT>>...>;
+
+    using Columns = std::tuple<std::array<_detail::column_value_type_t<FieldT>, CapacityV>...>;
+
+    static_assert((StagingPacket::kSizeBits == packet_type::kSizeBits), "Staging packet must share the footprint");
+
+    /**!
+     * @brief Decodes Packets laid back to back in to a range of rows, which must be within capacity. Distinct ranges
+     * may be decoded from different threads at the same time.
+     *
+     * @param[in] src Address of the first byte of the first Packet's footprint
+     * @param[in] first_row Row that the first Packet is decoded in to
+     * @param[in] count Number of Packets to decode
+     */
+    void DecodeRows(uint8_t const* src, size_t first_row, size_t count) noexcept;
+
+    template<size_t... IndexV>
+    void StoreRow(StagingPacket const& row, size_t row_index, std::index_sequence<IndexV...>) noexcept;
+
+    Columns m_columns {};
+    size_t  m_count {0U};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function declarations              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<size_t CapacityV, typename... FieldT>
+size_t decode_into_columns(Span<uint8_t const> buffer, size_t& offset_bits,
+                           PacketColumns<CapacityV, FieldT...>& columns) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PacketColumns method definitions in alphabetical order      ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t CapacityV, typename... FieldT>
+void PacketColumns<CapacityV, FieldT...>::Clear() noexcept
+{
+    m_count = 0U;
+}
+
+template<size_t CapacityV, typename... FieldT>
+size_t PacketColumns<CapacityV, FieldT...>::Count() const noexcept
+{
+    return m_count;
+}
+
+template<size_t CapacityV, typename... FieldT>
+template<size_t IndexV>
+Span<typename PacketColumns<CapacityV, FieldT...>::template column_value_t<IndexV>>
+PacketColumns<CapacityV, FieldT...>::GetColumn() noexcept
+{
+    return Span<column_value_t<IndexV>> {std::get<IndexV>(m_columns).data(), m_count};
+}
+
+template<size_t CapacityV, typename... FieldT>
+template<size_t IndexV>
+Span<typename PacketColumns<CapacityV, FieldT...>::template column_value_t<IndexV> const>
+PacketColumns<CapacityV, FieldT...>::GetColumn() const noexcept
+{
+    return Span<column_value_t<IndexV> const> {std::get<IndexV>(m_columns).data(), m_count};
+}
+
+//  Private     ========================================================================================================
+
+template<size_t CapacityV, typename... FieldT>
+void PacketColumns<CapacityV, FieldT...>::DecodeRows(uint8_t const* src, size_t first_row, size_t count) noexcept
+{
+    // Each row is decoded through the Packet's own fast path, then scattered across the columns while it is hot
+    StagingPacket row {};
+    for (size_t i = 0U; i < count; i++)
+    {
+        _detail::decode_packet_fields_recursive<0U, StagingPacket::kNumFields, StagingPacket>::Do(
+            (src + (i * packet_type::kSizeBytes)), row);
+        StoreRow(row, (first_row + i), std::index_sequence_for<FieldT...> {});
+    }
+}
+
+template<size_t CapacityV, typename... FieldT>
+template<size_t... IndexV>
+void PacketColumns<CapacityV, FieldT...>::StoreRow(StagingPacket const& row, size_t row_index,
+                                                   std::index_sequence<IndexV...>) noexcept
+{
+    ((std::get<IndexV>(m_columns)[row_index] = _detail::PacketAccess::Get<IndexV>(row).value), ...);
+}
+
+namespace _detail
+{
+
+/// @brief Grants procedures within this namespace access to the rows held by PacketColumns
+struct PacketColumnsAccess
+{
+    /**!
+     * @brief Decodes Packets laid back to back in to a range of rows, see PacketColumns::DecodeRows
+     *
+     * @param[inout] columns Decoding destination
+     * @param[in] src Address of the first byte of the first Packet's footprint
+     * @param[in] first_row Row that the first Packet is decoded in to
+     * @param[in] count Number of Packets to decode
+     */
+    template<typename ColumnsT>
+    static void DecodeRows(ColumnsT& columns, uint8_t const* src, size_t first_row, size_t count) noexcept
+    {
+        columns.DecodeRows(src, first_row, count);
+    }
+
+    /**!
+     * @brief Appends rows without filling them in
+     *
+     * @param[inout] columns Container to grow
+     * @param[in] count Number of rows to append, must be within the remaining capacity
+     * @return Index of the first appended row
+     */
+    template<typename ColumnsT>
+    static size_t Grow(ColumnsT& columns, size_t count) noexcept
+    {
+        size_t const kFirstRow {columns.m_count};
+        columns.m_count += count;
+        return kFirstRow;
+    }
+};
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<size_t CapacityV, typename... FieldT>
+size_t decode_into_columns(Span<uint8_t const> buffer, size_t& offset_bits,
+                           PacketColumns<CapacityV, FieldT...>& columns) noexcept
+{
+    using PacketT = typename PacketColumns<CapacityV, FieldT...>::packet_type;
+
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+    if (kDataStartOffsetBytes > buffer.size())
+        return 0U;
+
+    // Single capacity check for the entire batch
+    size_t const kNumAvailable {(buffer.size() - kDataStartOffsetBytes) / PacketT::kSizeBytes};
+    size_t const kNumPackets {std::min((CapacityV - columns.m_count), kNumAvailable)};
+    if (kNumPackets == 0U)
+        return 0U;
+
+    size_t const kFirstRow {_detail::PacketColumnsAccess::Grow(columns, kNumPackets)};
+    _detail::PacketColumnsAccess::DecodeRows(columns, (buffer.data() + kDataStartOffsetBytes), kFirstRow, kNumPackets);
+
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes + (kNumPackets * PacketT::kSizeBytes));
+    return kNumPackets;
+}
+
+} // namespace data
+} // namespace shmit
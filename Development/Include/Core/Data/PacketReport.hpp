@@ -0,0 +1,165 @@
+#pragma once
+
+#include "Footprint.hpp"
+#include "Packet.hpp"
+
+#include "Core/Math/Memory.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <array>
+#include <limits>
+#include <tuple>
+#include <utility>
+
+namespace shmit
+{
+namespace data
+{
+
+/**!
+ * @brief Compile-time summary of what a Packet costs on the wire, in memory and to encode
+ */
+struct PacketReport
+{
+    /// @brief Number of fields held by the Packet
+    size_t field_count;
+
+    /// @brief Size of the encoded footprint in bytes
+    size_t wire_bytes;
+
+    /// @brief Bits of the encoded footprint that hold no field: alignment padding plus the tail to a byte boundary
+    size_t wire_padding_bits;
+
+    /// @brief Size of the Packet in memory in bytes
+    size_t memory_bytes;
+
+    /// @brief Bytes of the Packet in memory that hold no field
+    size_t memory_padding_bytes;
+
+    /// @brief Number of moves that the encoder makes per Packet. Coalesced runs and BitField groups each count once.
+    size_t run_count;
+
+    /// @brief Number of BitField groups encoded through a single working word
+    size_t bit_group_count;
+
+    /// @brief Encoded by a single copy, see is_wire_identical
+    bool is_wire_identical;
+};
+
+/**!
+ * @brief Size limits that a Packet may be checked against at compile time through is_within_budget
+ */
+struct PacketBudget
+{
+    /// @brief No limit
+    constexpr static size_t kUnbounded {std::numeric_limits<size_t>::max()};
+
+    /// @brief Largest encoded footprint allowed, in bytes
+    size_t max_wire_bytes {kUnbounded};
+
+    /// @brief Largest in-memory size allowed, in bytes
+    size_t max_memory_bytes {kUnbounded};
+
+    /// @brief Most in-memory padding allowed, in bytes
+    size_t max_memory_padding_bytes {kUnbounded};
+};
+
+namespace _detail
+{
+
+/**!
+ * @brief Counts the runs that the encoder moves a packet's fields in, and how many of them are BitField groups
+ *
+ * @tparam IndexV Start of the current run
+ * @tparam PacketT Packet specialization
+ * @tparam IsEndV Whether every field has been counted
+ */
+template<size_t IndexV, typename PacketT, bool IsEndV = (IndexV >= PacketT::kNumFields)>
+struct packet_run_counts
+{
+private:
+    constexpr static size_t kRunEnd {packet_field_run_end<IndexV, PacketT::kNumFields, PacketT>::value};
+
+public:
+    constexpr static size_t kRunCount {1U + packet_run_counts<kRunEnd, PacketT>::kRunCount};
+    constexpr static size_t kBitGroupCount {(is_packet_bit_group<IndexV, kRunEnd, PacketT>::value ? 1U : 0U) +
+                                            packet_run_counts<kRunEnd, PacketT>::kBitGroupCount};
+};
+
+template<size_t IndexV, typename PacketT>
+struct packet_run_counts<IndexV, PacketT, true>
+{
+    constexpr static size_t kRunCount {0U};
+    constexpr static size_t kBitGroupCount {0U};
+};
+
+/**!
+ * @brief Builds the report of a packet
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexV Every field index
+ */
+template<typename PacketT, size_t... IndexV>
+constexpr static PacketReport make_packet_report(std::index_sequence<IndexV...>) noexcept
+{
+    constexpr std::array<FieldLayout, PacketT::kNumFields> kLayout {packet_layout<PacketT>::value};
+    constexpr size_t kFieldStorageBytes {(sizeof(typename std::tuple_element<IndexV, typename PacketT::Fields>::type) +
+                                          ... + 0U)};
+
+    size_t field_bits {0U};
+    for (FieldLayout const& field_layout : kLayout)
+        field_bits += field_layout.size_bits;
+
+    return PacketReport {PacketT::kNumFields,
+                         PacketT::kSizeBytes,
+                         (math::bits_to_contain(PacketT::kSizeBytes) - field_bits),
+                         sizeof(PacketT),
+                         (sizeof(PacketT) - kFieldStorageBytes),
+                         packet_run_counts<0U, PacketT>::kRunCount,
+                         packet_run_counts<0U, PacketT>::kBitGroupCount,
+                         is_wire_identical_v<PacketT>};
+}
+
+} // namespace _detail
+
+/**!
+ * @brief Returns the compile-time report of a Packet
+ *
+ * @tparam PacketT Packet specialization
+ */
+template<typename PacketT>
+struct packet_report
+{
+    static_assert(_detail::is_packet<PacketT>::value, "`PacketT` must be a `shmit::data::Packet` specialization");
+
+    constexpr static PacketReport value {
+        _detail::make_packet_report<PacketT>(std::make_index_sequence<PacketT::kNumFields> {})};
+};
+
+/**!
+ * @brief Convenience alias to access the returned value of packet_report
+ *
+ * @tparam PacketT Packet specialization
+ */
+template<typename PacketT>
+constexpr static PacketReport packet_report_v {packet_report<PacketT>::value};
+
+/**!
+ * @brief Checks a report against a budget, for use in a static_assert so that the build fails once a Packet outgrows
+ * it:
+ *
+ * `static_assert(is_within_budget(packet_report_v<StatusPacket>, PacketBudget {16U, 24U, 0U}), "...");`
+ *
+ * @param[in] report Packet report
+ * @param[in] budget Size limits
+ * @retval true if every limit is met
+ * @retval false otherwise
+ */
+constexpr static bool is_within_budget(PacketReport const& report, PacketBudget const& budget) noexcept
+{
+    return (report.wire_bytes <= budget.max_wire_bytes) && (report.memory_bytes <= budget.max_memory_bytes) &&
+           (report.memory_padding_bytes <= budget.max_memory_padding_bytes);
+}
+
+} // namespace data
+} // namespace shmit
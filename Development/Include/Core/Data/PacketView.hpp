@@ -0,0 +1,307 @@
+#pragma once
+
+#include "Packet.hpp"
+#include "_Detail/PacketView.hpp"
+
+#include "Core/Math/Memory.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <type_traits>
+
+namespace shmit
+{
+namespace data
+{
+
+/**!
+ * @brief Read-only window over the encoded footprint of a Packet. Fields are decoded on demand from their compile-time
+ * positions, only the fields that are asked for are ever touched.
+ *
+ * @note PacketView does not own the footprint it looks at, the underlying buffer must outlive it
+ *
+ * @tparam FieldT Type parameter list representing the values held as fields by the viewed Packet. Fields are stored
+ * in the order they are presented and are accessible through their positional index, starting at 0. Wrapped types such
+ * as Field, BitField, and ConstBitField are used as-is while unwrapped types will become wrapped by Field.
+ */
+template<typename... FieldT>
+class PacketView
+{
+public:
+    /// @brief Alias to sanitized type identification
+    using type = PacketView<to_field_t<FieldT>...>;
+
+    /// @brief Alias to the viewed Packet specialization
+    using packet_type = packet_t<FieldT...>;
+
+    /**!
+     * @brief Value type returned when reading a field
+     *
+     * @tparam IndexV Field index
+     */
+    template<size_t IndexV>
+    using value_type_t = std::remove_const_t<typename packet_type::template value_type_t<IndexV>>;
+
+    /// @brief Size in bits of the viewed footprint
+    constexpr static size_t kSizeBits {packet_type::kSizeBits};
+
+    /// @brief Size in bytes of the viewed footprint
+    constexpr static size_t kSizeBytes {packet_type::kSizeBytes};
+
+    /// @brief Default constructor, the view is not bound to any footprint
+    PacketView() noexcept = default;
+
+    /**!
+     * @brief Binds the view to the first bytes of a footprint. Bounds are not checked, prefer decode.
+     *
+     * @param[in] footprint Address of the first byte of an encoded Packet
+     */
+    constexpr explicit PacketView(uint8_t const* footprint) noexcept;
+
+    /**!
+     * @brief Fetch the viewed footprint
+     *
+     * @return Span over the viewed bytes, empty if the view is not bound
+     */
+    constexpr Span<uint8_t const> Footprint() const noexcept;
+
+private:
+    /// @brief First byte of the viewed footprint
+    uint8_t const* m_footprint {nullptr};
+};
+
+/**!
+ * @brief Mutable window over the encoded footprint of a Packet. Individual fields may be read or written in place, a
+ * write only touches the bits belonging to its field.
+ *
+ * @note PacketRef does not own the footprint it refers to, the underlying buffer must outlive it
+ *
+ * @tparam FieldT Type parameter list representing the values held as fields by the referenced Packet. Fields are
+ * stored in the order they are presented and are accessible through their positional index, starting at 0. Wrapped
+ * types such as Field, BitField, and ConstBitField are used as-is while unwrapped types will become wrapped by Field.
+ */
+template<typename... FieldT>
+class PacketRef
+{
+public:
+    /// @brief Alias to sanitized type identification
+    using type = PacketRef<to_field_t<FieldT>...>;
+
+    /// @brief Alias to the referenced Packet specialization
+    using packet_type = packet_t<FieldT...>;
+
+    /**!
+     * @brief Value type read from or written to a field
+     *
+     * @tparam IndexV Field index
+     */
+    template<size_t IndexV>
+    using value_type_t = std::remove_const_t<typename packet_type::template value_type_t<IndexV>>;
+
+    /// @brief Size in bits of the referenced footprint
+    constexpr static size_t kSizeBits {packet_type::kSizeBits};
+
+    /// @brief Size in bytes of the referenced footprint
+    constexpr static size_t kSizeBytes {packet_type::kSizeBytes};
+
+    /// @brief Default constructor, the reference is not bound to any footprint
+    PacketRef() noexcept = default;
+
+    /**!
+     * @brief Binds the reference to the first bytes of a footprint. Bounds are not checked, prefer decode.
+     *
+     * @param[in] footprint Address of the first byte of an encoded Packet
+     */
+    constexpr explicit PacketRef(uint8_t* footprint) noexcept;
+
+    /**!
+     * @brief Fetch the referenced footprint
+     *
+     * @return Span over the referenced bytes, empty if the reference is not bound
+     */
+    constexpr Span<uint8_t> Footprint() const noexcept;
+
+    /**!
+     * @brief Read-only view over the same footprint
+     *
+     * @return PacketView specialization
+     */
+    constexpr operator PacketView<FieldT...>() const noexcept;
+
+private:
+    /// @brief First byte of the referenced footprint
+    uint8_t* m_footprint {nullptr};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function declarations              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Binds a PacketView to an encoded Packet within a byte buffer without copying any of its fields
+ *
+ * @tparam FieldT Type parameter list representing the values held as fields by the viewed Packet
+ * @param[in] buffer Data source
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that the footprint may start from.
+ * Updated to the tail byte boundary of the footprint on success.
+ * @param[out] view View to bind
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename... FieldT>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, PacketView<FieldT...>& view) noexcept;
+
+/**!
+ * @brief Binds a PacketRef to an encoded Packet within a byte buffer without copying any of its fields
+ *
+ * @tparam FieldT Type parameter list representing the values held as fields by the referenced Packet
+ * @param[in] buffer Data source, remains writable through the reference
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that the footprint may start from.
+ * Updated to the tail byte boundary of the footprint on success.
+ * @param[out] ref Reference to bind
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename... FieldT>
+BinaryResult decode(Span<uint8_t> buffer, size_t& offset_bits, PacketRef<FieldT...>& ref) noexcept;
+
+/**!
+ * @brief Decode a single field from the footprint behind a view
+ *
+ * @warning The view must be bound to a footprint
+ *
+ * @tparam IndexV Field index to read
+ * @tparam FieldT Type parameter list representing the values held as fields by the viewed Packet
+ * @param[in] view View to read from
+ * @return Decoded value
+ */
+template<size_t IndexV, typename... FieldT>
+typename PacketView<FieldT...>::template value_type_t<IndexV> packet_field_value(PacketView<FieldT...> view) noexcept;
+
+/**!
+ * @brief Decode a single field from the footprint behind a reference
+ *
+ * @warning The reference must be bound to a footprint
+ *
+ * @tparam IndexV Field index to read
+ * @tparam FieldT Type parameter list representing the values held as fields by the referenced Packet
+ * @param[in] ref Reference to read from
+ * @return Decoded value
+ */
+template<size_t IndexV, typename... FieldT>
+typename PacketRef<FieldT...>::template value_type_t<IndexV> packet_field_value(PacketRef<FieldT...> ref) noexcept;
+
+/**!
+ * @brief Encode a single field in place within the footprint behind a reference. Neighboring fields are untouched.
+ *
+ * @warning The reference must be bound to a footprint
+ *
+ * @tparam IndexV Field index to write, may not be a ConstBitField
+ * @tparam FieldT Type parameter list representing the values held as fields by the referenced Packet
+ * @param[in] ref Reference to write through
+ * @param[in] value Value to encode
+ */
+template<size_t IndexV, typename... FieldT>
+void set_packet_field_value(PacketRef<FieldT...> ref,
+                            typename PacketRef<FieldT...>::template value_type_t<IndexV> const& value) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PacketView method definitions                ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... FieldT>
+constexpr PacketView<FieldT...>::PacketView(uint8_t const* footprint) noexcept : m_footprint {footprint}
+{
+}
+
+template<typename... FieldT>
+constexpr Span<uint8_t const> PacketView<FieldT...>::Footprint() const noexcept
+{
+    return Span<uint8_t const> {m_footprint, (m_footprint == nullptr) ? 0U : kSizeBytes};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// PacketRef method definitions                 ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... FieldT>
+constexpr PacketRef<FieldT...>::PacketRef(uint8_t* footprint) noexcept : m_footprint {footprint}
+{
+}
+
+template<typename... FieldT>
+constexpr Span<uint8_t> PacketRef<FieldT...>::Footprint() const noexcept
+{
+    return Span<uint8_t> {m_footprint, (m_footprint == nullptr) ? 0U : kSizeBytes};
+}
+
+template<typename... FieldT>
+constexpr PacketRef<FieldT...>::operator PacketView<FieldT...>() const noexcept
+{
+    return PacketView<FieldT...> {m_footprint};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... FieldT>
+BinaryResult decode(Span<uint8_t const> buffer, size_t& offset_bits, PacketView<FieldT...>& view) noexcept
+{
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+
+    // Every field lies at a fixed offset within the footprint, so one check covers them all
+    if ((kDataStartOffsetBytes + PacketView<FieldT...>::kSizeBytes) > buffer.size())
+        return BinaryResult::Failure();
+
+    view        = PacketView<FieldT...> {buffer.data() + kDataStartOffsetBytes};
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes) + PacketView<FieldT...>::kSizeBits;
+    return BinaryResult::Success();
+}
+
+template<typename... FieldT>
+BinaryResult decode(Span<uint8_t> buffer, size_t& offset_bits, PacketRef<FieldT...>& ref) noexcept
+{
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+
+    // Every field lies at a fixed offset within the footprint, so one check covers them all
+    if ((kDataStartOffsetBytes + PacketRef<FieldT...>::kSizeBytes) > buffer.size())
+        return BinaryResult::Failure();
+
+    ref         = PacketRef<FieldT...> {buffer.data() + kDataStartOffsetBytes};
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes) + PacketRef<FieldT...>::kSizeBits;
+    return BinaryResult::Success();
+}
+
+template<size_t IndexV, typename... FieldT>
+typename PacketView<FieldT...>::template value_type_t<IndexV> packet_field_value(PacketView<FieldT...> view) noexcept
+{
+    using PacketT = typename PacketView<FieldT...>::packet_type;
+    using Field   = typename _detail::fetch_packet_field_type_info<IndexV, PacketT>::type;
+
+    return _detail::read_field_at(view.Footprint().data(), packet_field_layout<IndexV, PacketT>::kOffsetBits,
+                                  static_cast<Field const*>(nullptr));
+}
+
+template<size_t IndexV, typename... FieldT>
+typename PacketRef<FieldT...>::template value_type_t<IndexV> packet_field_value(PacketRef<FieldT...> ref) noexcept
+{
+    return packet_field_value<IndexV>(static_cast<PacketView<FieldT...>>(ref));
+}
+
+template<size_t IndexV, typename... FieldT>
+void set_packet_field_value(PacketRef<FieldT...> ref,
+                            typename PacketRef<FieldT...>::template value_type_t<IndexV> const& value) noexcept
+{
+    using PacketT = typename PacketRef<FieldT...>::packet_type;
+    using Field   = typename _detail::fetch_packet_field_type_info<IndexV, PacketT>::type;
+
+    static_assert(!std::is_const<typename Field::value_type>::value, "ConstBitField values may not be reassigned");
+
+    _detail::write_field_at<Field>(ref.Footprint().data(), packet_field_layout<IndexV, PacketT>::kOffsetBits, value);
+}
+
+} // namespace data
+} // namespace shmit
@@ -0,0 +1,346 @@
+#pragma once
+
+#include "Packet.hpp"
+#include "PacketColumns.hpp"
+
+#include "Core/Math/Memory.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+
+#ifdef NATIVE_SHMIT
+
+#include <system_error>
+#include <thread>
+
+#endif
+
+namespace shmit
+{
+namespace data
+{
+
+/// @brief Range of records, from begin up to but not including end, decoded by one partition of a bulk decode
+struct DecodePartition
+{
+    size_t begin;
+    size_t end;
+};
+
+/// @brief Fewest records worth handing to a partition of its own, smaller batches are spread over fewer partitions
+constexpr static size_t kMinDecodePartitionRecords {256U};
+
+/// @brief Most threads that a parallel decode spreads across, including the calling thread
+constexpr static size_t kMaxDecodeThreads {64U};
+
+/**!
+ * @brief Splits a number of records in to contiguous, balanced partitions. Partitions differ in size by at most one
+ * record, and together cover every record exactly once.
+ *
+ * @param[in] record_count Number of records to split
+ * @param[in] partition Index of the partition, less than `partition_count`
+ * @param[in] partition_count Number of partitions
+ * @return Range of records belonging to the partition, empty if `partition` is out of range
+ */
+constexpr static DecodePartition decode_partition_range(size_t record_count, size_t partition,
+                                                        size_t partition_count) noexcept
+{
+    if (partition >= partition_count)
+        return DecodePartition {record_count, record_count};
+
+    // The leading partitions each take one of the records left over
+    size_t const kBaseCount {record_count / partition_count};
+    size_t const kExtraCount {record_count % partition_count};
+    size_t const kBegin {(partition * kBaseCount) + std::min(partition, kExtraCount)};
+    return DecodePartition {kBegin, (kBegin + kBaseCount + ((partition < kExtraCount) ? 1U : 0U))};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function declarations              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Decodes one partition of a batch of fixed-size Packets laid back to back within a byte buffer. The batch is
+ * as many Packets as both the buffer and the destination hold, see decode_batch. Every partition is independent, so
+ * that partitions may be decoded on any threads or executor at the same time.
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Must not hold a
+ * variable-size field.
+ * @param[in] buffer Data source
+ * @param[in] offset_bits Minimum offset, in bits, from beginning of the source that the batch starts from
+ * @param[out] packets Decoding destination for the whole batch, only the partition's Packets are written
+ * @param[in] partition Index of the partition to decode
+ * @param[in] partition_count Number of partitions the batch is split in to
+ * @return Number of Packets decoded by the partition
+ */
+template<typename... FieldT>
+size_t decode_batch_partition(Span<uint8_t const> buffer, size_t offset_bits, Span<Packet<FieldT...>> packets,
+                              size_t partition, size_t partition_count) noexcept;
+
+/**!
+ * @brief Decodes one partition of a set of records found at known byte offsets within a buffer, such as the payloads
+ * located by a sync-scan pass over a framed log. Records whose footprint runs past the buffer are skipped.
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet
+ * @param[in] buffer Data source
+ * @param[in] record_offsets_bytes Byte offset of each record within the buffer
+ * @param[out] packets Decoding destination, one Packet per record offset
+ * @param[in] partition Index of the partition to decode
+ * @param[in] partition_count Number of partitions the records are split in to
+ * @return Number of records decoded by the partition
+ */
+template<typename... FieldT>
+size_t decode_records_partition(Span<uint8_t const> buffer, Span<size_t const> record_offsets_bytes,
+                                Span<Packet<FieldT...>> packets, size_t partition, size_t partition_count) noexcept;
+
+#ifdef NATIVE_SHMIT
+
+/**!
+ * @brief Decodes a batch of fixed-size Packets laid back to back within a byte buffer across several threads, see
+ * decode_batch. The calling thread decodes a partition of its own and returns once every partition is done.
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Must not hold a
+ * variable-size field.
+ * @param[in] buffer Data source
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to the tail byte boundary of the last decoded Packet.
+ * @param[out] packets Decoding destination
+ * @param[in] thread_count Most threads to decode on, including the calling thread. 0 uses every hardware thread.
+ * @return Number of Packets decoded
+ */
+template<typename... FieldT>
+size_t decode_batch_parallel(Span<uint8_t const> buffer, size_t& offset_bits, Span<Packet<FieldT...>> packets,
+                             size_t thread_count = 0U) noexcept;
+
+/**!
+ * @brief Decodes records found at known byte offsets within a buffer across several threads, see
+ * decode_records_partition
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet
+ * @param[in] buffer Data source
+ * @param[in] record_offsets_bytes Byte offset of each record within the buffer
+ * @param[out] packets Decoding destination, one Packet per record offset
+ * @param[in] thread_count Most threads to decode on, including the calling thread. 0 uses every hardware thread.
+ * @return Number of records decoded
+ */
+template<typename... FieldT>
+size_t decode_records_parallel(Span<uint8_t const> buffer, Span<size_t const> record_offsets_bytes,
+                               Span<Packet<FieldT...>> packets, size_t thread_count = 0U) noexcept;
+
+/**!
+ * @brief Decodes fixed-size Packets laid back to back within a byte buffer straight in to columns across several
+ * threads, see decode_into_columns
+ *
+ * @tparam CapacityV Maximum number of rows
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet
+ * @param[in] buffer Data source
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to the tail byte boundary of the last decoded Packet.
+ * @param[inout] columns Decoding destination
+ * @param[in] thread_count Most threads to decode on, including the calling thread. 0 uses every hardware thread.
+ * @return Number of Packets decoded
+ */
+template<size_t CapacityV, typename... FieldT>
+size_t decode_into_columns_parallel(Span<uint8_t const> buffer, size_t& offset_bits,
+                                    PacketColumns<CapacityV, FieldT...>& columns, size_t thread_count = 0U) noexcept;
+
+#endif
+
+namespace _detail
+{
+
+/**!
+ * @brief Number of Packets in a batch laid back to back within a byte buffer
+ *
+ * @param[in] buffer_size_bytes Size of the source in bytes
+ * @param[in] offset_bits Minimum offset, in bits, from beginning of the source that the batch starts from
+ * @param[in] packet_size_bytes Size of each Packet in bytes
+ * @param[in] max_count Most Packets the destination holds
+ * @return Number of Packets in the batch
+ */
+constexpr static size_t decode_batch_count(size_t buffer_size_bytes, size_t offset_bits, size_t packet_size_bytes,
+                                           size_t max_count) noexcept
+{
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+    if (kDataStartOffsetBytes > buffer_size_bytes)
+        return 0U;
+
+    return std::min(max_count, ((buffer_size_bytes - kDataStartOffsetBytes) / packet_size_bytes));
+}
+
+#ifdef NATIVE_SHMIT
+
+/**!
+ * @brief Number of partitions to split a number of records in to
+ *
+ * @param[in] record_count Number of records
+ * @param[in] thread_count Most threads requested, 0 for every hardware thread
+ * @return Number of partitions, at least 1
+ */
+static size_t decode_partition_count(size_t record_count, size_t thread_count) noexcept
+{
+    if (thread_count == 0U)
+        thread_count = std::thread::hardware_concurrency();
+
+    size_t const kWorthwhileCount {record_count / kMinDecodePartitionRecords};
+    return std::max(size_t {1U}, std::min({thread_count, kWorthwhileCount, kMaxDecodeThreads}));
+}
+
+/**!
+ * @brief Runs every partition of a bulk decode, one per thread with the first on the calling thread. Partitions whose
+ * thread can't be started are run on the calling thread instead.
+ *
+ * @tparam PartitionFunctionT Callable taking a partition index and returning the number of records it decoded
+ * @param[in] partition_count Number of partitions, no more than kMaxDecodeThreads
+ * @param[in] decode_partition Decodes a single partition
+ * @return Number of records decoded across every partition
+ */
+template<typename PartitionFunctionT>
+static size_t run_decode_partitions(size_t partition_count, PartitionFunctionT const& decode_partition) noexcept
+{
+    std::thread threads[kMaxDecodeThreads];
+    size_t      counts[kMaxDecodeThreads] {};
+
+    for (size_t i = 1U; i < partition_count; i++)
+    {
+        try
+        {
+            threads[i] = std::thread {[&counts, &decode_partition, i]() { counts[i] = decode_partition(i); }};
+        }
+        catch (std::system_error const& error)
+        {
+            static_cast<void>(error); // Avoid unused warning
+            counts[i] = decode_partition(i);
+        }
+    }
+
+    counts[0] = decode_partition(0U);
+
+    size_t total {0U};
+    for (size_t i = 0U; i < partition_count; i++)
+    {
+        if (threads[i].joinable())
+            threads[i].join();
+        total += counts[i];
+    }
+
+    return total;
+}
+
+#endif
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... FieldT>
+size_t decode_batch_partition(Span<uint8_t const> buffer, size_t offset_bits, Span<Packet<FieldT...>> packets,
+                              size_t partition, size_t partition_count) noexcept
+{
+    using PacketT = Packet<FieldT...>;
+
+    static_assert(!_detail::packet_has_variable_size_fields<PacketT>::value, "Only packets of a fixed layout may be "
+                                                                             "decoded in partitions");
+
+    size_t const kNumPackets {
+        _detail::decode_batch_count(buffer.size(), offset_bits, PacketT::kSizeBytes, packets.count())};
+    DecodePartition const kRange {decode_partition_range(kNumPackets, partition, partition_count)};
+
+    // Record i sits at a fixed offset, so every partition can find its own start without looking at the others
+    uint8_t const* src {buffer.data() + math::bytes_to_contain(offset_bits)};
+    PacketT*       packet {packets.data()};
+    for (size_t i = kRange.begin; i < kRange.end; i++)
+        _detail::decode_packet_fields_recursive<0U, PacketT::kNumFields, PacketT>::Do(
+            (src + (i * PacketT::kSizeBytes)), packet[i]);
+
+    return (kRange.end - kRange.begin);
+}
+
+#ifdef NATIVE_SHMIT
+
+template<typename... FieldT>
+size_t decode_batch_parallel(Span<uint8_t const> buffer, size_t& offset_bits, Span<Packet<FieldT...>> packets,
+                             size_t thread_count) noexcept
+{
+    using PacketT = Packet<FieldT...>;
+
+    size_t const kNumPackets {
+        _detail::decode_batch_count(buffer.size(), offset_bits, PacketT::kSizeBytes, packets.count())};
+    if (kNumPackets == 0U)
+        return 0U;
+
+    size_t const kStartOffsetBits {offset_bits};
+    size_t const kPartitionCount {_detail::decode_partition_count(kNumPackets, thread_count)};
+    size_t const kNumDecoded {_detail::run_decode_partitions(kPartitionCount, [&](size_t partition) -> size_t {
+        return decode_batch_partition(buffer, kStartOffsetBits, packets, partition, kPartitionCount);
+    })};
+
+    offset_bits = math::bits_to_contain(math::bytes_to_contain(kStartOffsetBits) + (kNumDecoded * PacketT::kSizeBytes));
+    return kNumDecoded;
+}
+
+template<size_t CapacityV, typename... FieldT>
+size_t decode_into_columns_parallel(Span<uint8_t const> buffer, size_t& offset_bits,
+                                    PacketColumns<CapacityV, FieldT...>& columns, size_t thread_count) noexcept
+{
+    using PacketT = typename PacketColumns<CapacityV, FieldT...>::packet_type;
+
+    size_t const kNumPackets {
+        _detail::decode_batch_count(buffer.size(), offset_bits, PacketT::kSizeBytes, (CapacityV - columns.Count()))};
+    if (kNumPackets == 0U)
+        return 0U;
+
+    // Rows are claimed up front, each partition then fills in its own
+    uint8_t const* src {buffer.data() + math::bytes_to_contain(offset_bits)};
+    size_t const   kFirstRow {_detail::PacketColumnsAccess::Grow(columns, kNumPackets)};
+    size_t const   kPartitionCount {_detail::decode_partition_count(kNumPackets, thread_count)};
+    size_t const   kNumDecoded {_detail::run_decode_partitions(kPartitionCount, [&](size_t partition) -> size_t {
+        DecodePartition const kRange {decode_partition_range(kNumPackets, partition, kPartitionCount)};
+        _detail::PacketColumnsAccess::DecodeRows(columns, (src + (kRange.begin * PacketT::kSizeBytes)),
+                                                 (kFirstRow + kRange.begin), (kRange.end - kRange.begin));
+        return (kRange.end - kRange.begin);
+    })};
+
+    offset_bits = math::bits_to_contain(math::bytes_to_contain(offset_bits) + (kNumDecoded * PacketT::kSizeBytes));
+    return kNumDecoded;
+}
+
+template<typename... FieldT>
+size_t decode_records_parallel(Span<uint8_t const> buffer, Span<size_t const> record_offsets_bytes,
+                               Span<Packet<FieldT...>> packets, size_t thread_count) noexcept
+{
+    size_t const kNumRecords {std::min(record_offsets_bytes.count(), packets.count())};
+    if (kNumRecords == 0U)
+        return 0U;
+
+    size_t const kPartitionCount {_detail::decode_partition_count(kNumRecords, thread_count)};
+    return _detail::run_decode_partitions(kPartitionCount, [&](size_t partition) -> size_t {
+        return decode_records_partition(buffer, record_offsets_bytes, packets, partition, kPartitionCount);
+    });
+}
+
+#endif
+
+template<typename... FieldT>
+size_t decode_records_partition(Span<uint8_t const> buffer, Span<size_t const> record_offsets_bytes,
+                                Span<Packet<FieldT...>> packets, size_t partition, size_t partition_count) noexcept
+{
+    size_t const          kNumRecords {std::min(record_offsets_bytes.count(), packets.count())};
+    DecodePartition const kRange {decode_partition_range(kNumRecords, partition, partition_count)};
+
+    size_t num_decoded {0U};
+    for (size_t i = kRange.begin; i < kRange.end; i++)
+    {
+        size_t offset_bits {math::bits_to_contain(record_offsets_bytes[i])};
+        if (decode(buffer, offset_bits, packets[i]).IsSuccess())
+            num_decoded++;
+    }
+
+    return num_decoded;
+}
+
+} // namespace data
+} // namespace shmit
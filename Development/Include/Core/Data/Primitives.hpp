@@ -9,6 +9,22 @@ namespace shmit
 namespace data
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Namespace type definitions              ////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Order in which the bytes of a multi-byte value are placed within an encoded footprint
+enum class ByteOrder : uint8_t
+{
+    kLittle, ///< Least significant byte first
+    kBig,    ///< Most significant byte first
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    kNative = kBig ///< Byte order of the host
+#else
+    kNative = kLittle ///< Byte order of the host
+#endif
+};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //  Namespace metafunction declarations             ////////////////////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
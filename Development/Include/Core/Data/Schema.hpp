@@ -0,0 +1,242 @@
+#pragma once
+
+#include "Packet.hpp"
+
+#include "Core/Math/Memory.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+#include "Core/StringConstantIndex.hpp"
+
+#include <array>
+#include <limits>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace shmit
+{
+namespace data
+{
+
+/// @brief Source index of a field that an older layout does not hold, such fields are default-filled on decode
+constexpr static size_t kAddedField {std::numeric_limits<size_t>::max()};
+
+/**!
+ * @brief Names every field of a Packet layout, so that two versions of a layout may be matched field by field
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam NameT StringConstant names, one per field in field order. Names must be distinct.
+ */
+template<typename PacketT, typename... NameT>
+struct PacketSchema
+{
+    static_assert(_detail::is_packet<PacketT>::value, "`PacketT` must be a `shmit::data::Packet` specialization");
+    static_assert((sizeof...(NameT) == PacketT::kNumFields), "Every field of `PacketT` must be named");
+
+    using packet_type = PacketT;
+
+    /// @brief Index from field name to field index
+    using Names = StringConstantIndex<NameT...>;
+
+    static_assert((Names::kKeyCount == PacketT::kNumFields), "Field names must be distinct");
+};
+
+/**!
+ * @brief Compile-time mapping from the fields of an older Packet layout to those of a newer one
+ *
+ * @tparam FromPacketT Packet specialization of the older layout, must not hold a variable-size field
+ * @tparam ToPacketT Packet specialization of the newer layout
+ * @tparam SourceIndexV One per field of ToPacketT: the index of the FromPacketT field it is decoded from, or
+ * kAddedField
+ */
+template<typename FromPacketT, typename ToPacketT, size_t... SourceIndexV>
+struct SchemaMapping
+{
+    static_assert(_detail::is_packet<FromPacketT>::value, "`FromPacketT` must be a `shmit::data::Packet` "
+                                                          "specialization");
+    static_assert(_detail::is_packet<ToPacketT>::value, "`ToPacketT` must be a `shmit::data::Packet` specialization");
+    static_assert((sizeof...(SourceIndexV) == ToPacketT::kNumFields), "Every field of `ToPacketT` must be mapped");
+    static_assert((((SourceIndexV < FromPacketT::kNumFields) || (SourceIndexV == kAddedField)) && ...),
+                  "Source indices must be within `FromPacketT` field count");
+
+    using from_packet_type = FromPacketT;
+    using to_packet_type   = ToPacketT;
+
+    /// @brief Source field index of each field of ToPacketT
+    constexpr static std::array<size_t, sizeof...(SourceIndexV)> kSourceIndices {{SourceIndexV...}};
+};
+
+namespace _detail
+{
+
+/**!
+ * @brief Index of a named field within an older schema
+ *
+ * @tparam NamesT StringConstantIndex of the older schema's field names
+ * @tparam NameT Field name to find
+ * @return Field index, or kAddedField if the older schema does not hold the name
+ */
+template<typename NamesT, typename NameT>
+constexpr static size_t schema_source_index() noexcept
+{
+    constexpr size_t kIndex {NamesT::Find(detail::string_constant_key_v<NameT>)};
+    return ((kIndex == NamesT::kNotFound) ? kAddedField : kIndex);
+}
+
+} // namespace _detail
+
+/**!
+ * @brief Builds the SchemaMapping between two PacketSchemas by matching field names. Fields of the newer schema
+ * whose name the older schema does not hold are mapped to kAddedField, fields dropped from the older schema are
+ * skipped over.
+ *
+ * @tparam FromSchemaT PacketSchema of the older layout
+ * @tparam ToSchemaT PacketSchema of the newer layout
+ */
+template<typename FromSchemaT, typename ToSchemaT>
+struct schema_mapping;
+
+template<typename FromPacketT, typename... FromNameT, typename ToPacketT, typename... ToNameT>
+struct schema_mapping<PacketSchema<FromPacketT, FromNameT...>, PacketSchema<ToPacketT, ToNameT...>>
+{
+private:
+    using FromNames = typename PacketSchema<FromPacketT, FromNameT...>::Names;
+    using ToNames   = typename PacketSchema<ToPacketT, ToNameT...>::Names;
+
+public:
+    using type = SchemaMapping<FromPacketT, ToPacketT, _detail::schema_source_index<FromNames, ToNameT>()...>;
+};
+
+template<typename FromSchemaT, typename ToSchemaT>
+using schema_mapping_t = typename schema_mapping<FromSchemaT, ToSchemaT>::type;
+
+namespace _detail
+{
+
+/**!
+ * @brief Field type that a mapped field is decoded in to before conversion. ConstBitFields are never decoded, so
+ * their bits are read through a BitField of the same size instead.
+ *
+ * @tparam FieldT Field type of the older layout
+ */
+template<typename FieldT>
+struct migration_source
+{
+    using type = FieldT;
+};
+
+template<size_t SizeBitsV>
+struct migration_source<ConstBitField<SizeBitsV>>
+{
+    using type = BitField<SizeBitsV>;
+};
+
+/**!
+ * @brief Decodes a single field of the newer layout straight from an encoding of the older layout
+ *
+ * @tparam IndexV Field index within the newer layout
+ * @tparam MappingT SchemaMapping specialization
+ * @param[in] src Address of the first byte of the older layout's footprint
+ * @param[out] packet Decoding destination
+ */
+template<size_t IndexV, typename MappingT>
+static void decode_migrated_field(uint8_t const* src, typename MappingT::to_packet_type& packet) noexcept
+{
+    using FromPacket = typename MappingT::from_packet_type;
+    using ToField    = std::tuple_element_t<IndexV, typename MappingT::to_packet_type::Fields>;
+    using ToValue    = typename ToField::value_type;
+
+    constexpr size_t kSourceIndex {MappingT::kSourceIndices[IndexV]};
+    auto&            field {PacketAccess::Get<IndexV>(packet)};
+
+    // ConstBitFields hold their value whatever the encoding says
+    if constexpr (std::is_const<ToValue>::value)
+    {
+        static_cast<void>(src);   // Avoid unused warning
+        static_cast<void>(field); // Avoid unused warning
+    }
+    else if constexpr (kSourceIndex == kAddedField)
+    {
+        static_cast<void>(src); // Avoid unused warning
+        field.value = ToValue {};
+    }
+    else
+    {
+        using FromField = std::tuple_element_t<kSourceIndex, typename FromPacket::Fields>;
+
+        constexpr size_t kOffsetBits {packet_field_layout<kSourceIndex, FromPacket>::kOffsetBits};
+
+        // Unchanged fields decode in place, anything else is decoded as it was and converted
+        if constexpr (std::is_same<FromField, ToField>::value)
+            decode_field_at(src, kOffsetBits, field);
+        else
+        {
+            using Source = typename migration_source<FromField>::type;
+            static_assert(std::is_convertible<typename Source::value_type, ToValue>::value,
+                          "Mapped fields must hold convertible values");
+
+            Source source {};
+            decode_field_at(src, kOffsetBits, source);
+            field.value = static_cast<ToValue>(source.value);
+        }
+    }
+}
+
+template<typename MappingT, size_t... IndexV>
+static void decode_migrated_fields(uint8_t const* src, typename MappingT::to_packet_type& packet,
+                                   std::index_sequence<IndexV...>) noexcept
+{
+    (decode_migrated_field<IndexV, MappingT>(src, packet), ...);
+}
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function declarations              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Decodes a Packet of a newer layout directly from an encoding of an older one, without an intermediate
+ * Packet of the older layout. Every mapped field is read from its compile-time offset within the older footprint and
+ * converted to its new value type, added fields are default-filled and ConstBitFields are left as they are.
+ *
+ * @note Values are converted with static_cast, narrowing a field's size or range is left to the mapping's author
+ *
+ * @tparam MappingT SchemaMapping specialization, see schema_mapping_t to build one from field names
+ * @param[in] buffer Data source, holding an encoding of the older layout
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to include the size, in bits, of the older layout's footprint on success.
+ * @param[out] packet Decoding destination
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if the buffer does not hold the older layout's footprint, nothing is written
+ */
+template<typename MappingT>
+BinaryResult decode_migrated(Span<uint8_t const> buffer, size_t& offset_bits,
+                             typename MappingT::to_packet_type& packet) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename MappingT>
+BinaryResult decode_migrated(Span<uint8_t const> buffer, size_t& offset_bits,
+                             typename MappingT::to_packet_type& packet) noexcept
+{
+    using FromPacket = typename MappingT::from_packet_type;
+    using ToPacket   = typename MappingT::to_packet_type;
+
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+    if ((kDataStartOffsetBytes + FromPacket::kSizeBytes) > buffer.size())
+        return BinaryResult::Failure();
+
+    _detail::decode_migrated_fields<MappingT>((buffer.data() + kDataStartOffsetBytes), packet,
+                                              std::make_index_sequence<ToPacket::kNumFields> {});
+
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes) + FromPacket::kSizeBits;
+    return BinaryResult::Success();
+}
+
+} // namespace data
+} // namespace shmit
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "Packet.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+
+namespace shmit
+{
+namespace data
+{
+
+namespace _detail
+{
+
+/**!
+ * @brief Encodes one field of a Packet at its compile-time position within an existing footprint. Neighboring bits
+ * are preserved.
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexV Field index
+ * @param[in] dest Address of the first byte of the footprint
+ * @param[in] packet Source packet
+ */
+template<typename PacketT, size_t IndexV>
+static void encode_tracked_field(uint8_t* dest, PacketT const& packet) noexcept
+{
+    encode_field_at(PacketAccess::Get<IndexV>(packet), dest, packet_field_layout<IndexV, PacketT>::kOffsetBits);
+}
+
+template<typename PacketT, typename IndexSequenceT = std::make_index_sequence<PacketT::kNumFields>>
+struct tracked_field_encoders;
+
+/**!
+ * @brief Table of per-field encoders for a Packet, indexed by field position
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexV Field positions
+ */
+template<typename PacketT, size_t... IndexV>
+struct tracked_field_encoders<PacketT, std::index_sequence<IndexV...>>
+{
+    using Encoder = void (*)(uint8_t*, PacketT const&) noexcept;
+
+    constexpr static Encoder value[sizeof...(IndexV)] {&encode_tracked_field<PacketT, IndexV>...};
+};
+
+} // namespace _detail
+
+/**!
+ * @brief Long-lived Packet that remembers which of its fields have changed since it was last encoded, so that
+ * encode_incremental only has to rewrite those fields in to a persistent encoded image. The work done per encode is
+ * proportional to the number of changed fields rather than the size of the Packet.
+ *
+ * Fields are marked as changed when they are written through packet_field_value or set_packet_field_value. Every field
+ * starts out changed, so the first incremental encode writes the whole image.
+ *
+ * @note TrackedPacket is not thread-safe, writes and encodes must not run concurrently
+ *
+ * @tparam FieldT Type parameter list representing the values to be held as fields by the Packet. Fields are stored
+ * in the order they are presented and are accessible through their positional index, starting at 0. Wrapped types such
+ * as Field, BitField, and ConstBitField are stored as-is while unwrapped types will become wrapped by Field.
+ */
+template<typename... FieldT>
+class TrackedPacket
+{
+public:
+    /// @brief Alias to sanitized type identification
+    using type = TrackedPacket<to_field_t<FieldT>...>;
+
+    /// @brief Alias to the tracked Packet specialization
+    using packet_type = packet_t<FieldT...>;
+
+    /**!
+     * @brief Value type read from or written to a field
+     *
+     * @tparam IndexV Field index
+     */
+    template<size_t IndexV>
+    using value_type_t = std::remove_const_t<typename packet_type::template value_type_t<IndexV>>;
+
+    /// @brief Total number of fields held by the Packet
+    constexpr static size_t kNumFields {packet_type::kNumFields};
+
+    /// @brief Size in bits of the encoded footprint
+    constexpr static size_t kSizeBits {packet_type::kSizeBits};
+
+    /// @brief Size in bytes of the encoded footprint
+    constexpr static size_t kSizeBytes {packet_type::kSizeBytes};
+
+    static_assert(kNumFields > 0U, "A TrackedPacket must hold at least one field");
+
+    /// @brief Default constructor, every field starts out changed
+    TrackedPacket() noexcept;
+
+    /**!
+     * @brief Initializing constructor. Takes arguments for every field, every field starts out changed.
+     *
+     * @param[in] args Values to initialize each field, in order
+     */
+    template<typename... ArgT, typename = std::enable_if_t<(sizeof...(ArgT) > 0U)>>
+    explicit TrackedPacket(ArgT&&... args) noexcept;
+
+    /// @brief Number of fields changed since the last encode
+    size_t DirtyCount() const noexcept;
+
+    /// @brief Fetch the tracked Packet, for reading or full encoding
+    packet_type const& GetPacket() const noexcept;
+
+    /**!
+     * @brief Checks whether a field has changed since the last encode
+     *
+     * @tparam IndexV Field index
+     */
+    template<size_t IndexV>
+    bool IsDirty() const noexcept;
+
+    /// @brief Marks every field as changed, so that the next encode rewrites the entire image
+    void MarkAllDirty() noexcept;
+
+    /**!
+     * @brief Marks a field as changed
+     *
+     * @tparam IndexV Field index
+     */
+    template<size_t IndexV>
+    void MarkDirty() noexcept;
+
+    /**!
+     * @brief Rewrites every changed field in to a persistent encoded image, then marks every field as clean
+     *
+     * @note Bits belonging to unchanged fields are left as they are, so the image must hold what the previous encode
+     * wrote. Padding bits are never written.
+     *
+     * @tparam AltFieldT Type parameter list of the TrackedPacket
+     * @param[inout] tracked Packet to encode
+     * @param[inout] image Encoded footprint, at least kSizeBytes long
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if the image is too small, nothing is written
+     */
+    template<typename... AltFieldT>
+    friend BinaryResult encode_incremental(TrackedPacket<AltFieldT...>& tracked, Span<uint8_t> image) noexcept;
+
+private:
+    /// @brief Number of bits in a word of the dirty mask
+    constexpr static size_t kMaskWordSizeBits {64U};
+
+    /// @brief Number of words in the dirty mask
+    constexpr static size_t kMaskWordCount {(kNumFields + (kMaskWordSizeBits - 1U)) / kMaskWordSizeBits};
+
+    template<size_t IndexV, typename... AltFieldT>
+    friend typename TrackedPacket<AltFieldT...>::packet_type::template value_reference_t<IndexV>
+        packet_field_value(TrackedPacket<AltFieldT...>& tracked) noexcept;
+
+    packet_type m_packet;
+
+    /// @brief One bit per field, set while the field has changed since the last encode
+    uint64_t m_dirty_mask[kMaskWordCount];
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function declarations              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Fetch a value reference from a field held by a TrackedPacket. The field is marked as changed.
+ *
+ * @tparam IndexV Field index to access
+ * @tparam FieldT Type parameter list of the TrackedPacket
+ * @param[in] tracked TrackedPacket to fetch field from
+ * @return Reference to stored value
+ */
+template<size_t IndexV, typename... FieldT>
+typename TrackedPacket<FieldT...>::packet_type::template value_reference_t<IndexV>
+packet_field_value(TrackedPacket<FieldT...>& tracked) noexcept;
+
+/**!
+ * @brief Fetch a const value reference from a field held by a TrackedPacket
+ *
+ * @tparam IndexV Field index to access
+ * @tparam FieldT Type parameter list of the TrackedPacket
+ * @param[in] tracked TrackedPacket to fetch field from
+ * @return Const reference to stored value
+ */
+template<size_t IndexV, typename... FieldT>
+typename TrackedPacket<FieldT...>::packet_type::template const_value_reference_t<IndexV>
+packet_field_value(TrackedPacket<FieldT...> const& tracked) noexcept;
+
+/**!
+ * @brief Assign a field held by a TrackedPacket. Arithmetic fields are only marked as changed if the value differs.
+ *
+ * @tparam IndexV Field index to write, may not be a ConstBitField
+ * @tparam FieldT Type parameter list of the TrackedPacket
+ * @param[in] tracked TrackedPacket to write to
+ * @param[in] value Value to assign
+ */
+template<size_t IndexV, typename... FieldT>
+void set_packet_field_value(TrackedPacket<FieldT...>&                                          tracked,
+                            typename TrackedPacket<FieldT...>::template value_type_t<IndexV> const& value) noexcept;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TrackedPacket constructor definitions                ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... FieldT>
+TrackedPacket<FieldT...>::TrackedPacket() noexcept : m_packet {}
+{
+    MarkAllDirty();
+}
+
+template<typename... FieldT>
+template<typename... ArgT, typename>
+TrackedPacket<FieldT...>::TrackedPacket(ArgT&&... args) noexcept : m_packet {std::forward<ArgT>(args)...}
+{
+    MarkAllDirty();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// TrackedPacket method definitions in alphabetical order               ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename... FieldT>
+size_t TrackedPacket<FieldT...>::DirtyCount() const noexcept
+{
+    size_t count {0U};
+    for (uint64_t const kWord : m_dirty_mask)
+        count += static_cast<size_t>(__builtin_popcountll(kWord));
+    return count;
+}
+
+template<typename... FieldT>
+typename TrackedPacket<FieldT...>::packet_type const& TrackedPacket<FieldT...>::GetPacket() const noexcept
+{
+    return m_packet;
+}
+
+template<typename... FieldT>
+template<size_t IndexV>
+bool TrackedPacket<FieldT...>::IsDirty() const noexcept
+{
+    static_assert(IndexV < kNumFields, "`IndexV` must be within the field count");
+    return ((m_dirty_mask[IndexV / kMaskWordSizeBits] >> (IndexV % kMaskWordSizeBits)) & 1U) != 0U;
+}
+
+template<typename... FieldT>
+void TrackedPacket<FieldT...>::MarkAllDirty() noexcept
+{
+    for (size_t i = 0U; i < kMaskWordCount; i++)
+    {
+        size_t const kFieldsInWord {std::min(kMaskWordSizeBits, (kNumFields - (i * kMaskWordSizeBits)))};
+        m_dirty_mask[i] = (kFieldsInWord == kMaskWordSizeBits) ? ~uint64_t {0U}
+                                                                : ((uint64_t {1U} << kFieldsInWord) - 1U);
+    }
+}
+
+template<typename... FieldT>
+template<size_t IndexV>
+void TrackedPacket<FieldT...>::MarkDirty() noexcept
+{
+    static_assert(IndexV < kNumFields, "`IndexV` must be within the field count");
+    m_dirty_mask[IndexV / kMaskWordSizeBits] |= (uint64_t {1U} << (IndexV % kMaskWordSizeBits));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename... FieldT>
+BinaryResult encode_incremental(TrackedPacket<FieldT...>& tracked, Span<uint8_t> image) noexcept
+{
+    using Tracked  = TrackedPacket<FieldT...>;
+    using Encoders = _detail::tracked_field_encoders<typename Tracked::packet_type>;
+
+    // Every field lies at a fixed offset within the footprint, so one check covers them all
+    if (image.size() < Tracked::kSizeBytes)
+        return BinaryResult::Failure();
+
+    // Visit only the set bits of the mask, lowest field first
+    for (size_t i = 0U; i < Tracked::kMaskWordCount; i++)
+    {
+        uint64_t word {tracked.m_dirty_mask[i]};
+        while (word != 0U)
+        {
+            size_t const kIndex {(i * Tracked::kMaskWordSizeBits) + static_cast<size_t>(__builtin_ctzll(word))};
+            Encoders::value[kIndex](image.data(), tracked.m_packet);
+            word &= (word - 1U);
+        }
+        tracked.m_dirty_mask[i] = 0U;
+    }
+
+    return BinaryResult::Success();
+}
+
+template<size_t IndexV, typename... FieldT>
+typename TrackedPacket<FieldT...>::packet_type::template value_reference_t<IndexV>
+packet_field_value(TrackedPacket<FieldT...>& tracked) noexcept
+{
+    tracked.template MarkDirty<IndexV>();
+    return packet_field_value<IndexV>(tracked.m_packet);
+}
+
+template<size_t IndexV, typename... FieldT>
+typename TrackedPacket<FieldT...>::packet_type::template const_value_reference_t<IndexV>
+packet_field_value(TrackedPacket<FieldT...> const& tracked) noexcept
+{
+    return packet_field_value<IndexV>(tracked.GetPacket());
+}
+
+template<size_t IndexV, typename... FieldT>
+void set_packet_field_value(TrackedPacket<FieldT...>&                                          tracked,
+                            typename TrackedPacket<FieldT...>::template value_type_t<IndexV> const& value) noexcept
+{
+    using Value = typename TrackedPacket<FieldT...>::template value_type_t<IndexV>;
+
+    static_assert(!std::is_const<typename TrackedPacket<FieldT...>::packet_type::template value_type_t<IndexV>>::value,
+                  "ConstBitField values may not be reassigned");
+
+    if constexpr (std::is_arithmetic<Value>::value)
+    {
+        TrackedPacket<FieldT...> const& kTracked {tracked};
+        if (packet_field_value<IndexV>(kTracked) == value)
+            return;
+    }
+
+    // Writing through the mutable accessor marks the field as changed
+    packet_field_value<IndexV>(tracked) = value;
+}
+
+} // namespace data
+} // namespace shmit
@@ -1,10 +1,12 @@
 #pragma once
 
+#include "Core/Data/Primitives.hpp"
 #include "Core/Math/Memory.hpp"
 #include "Core/StdTypes.hpp"
 
 #include <algorithm>
-#include <array>
+#include <cstring>
+#include <type_traits>
 
 namespace shmit
 {
@@ -13,103 +15,441 @@ namespace data
 namespace _detail
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace constant definitions               ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief Size of the working word used by the bit copy kernel, in bytes
+constexpr static size_t kBitsWordSizeBytes {sizeof(uint64_t)};
+
+/// @brief Size of the working word used by the bit copy kernel, in bits
+constexpr static size_t kBitsWordSizeBits {math::bits_to_contain(kBitsWordSizeBytes)};
+
+/// @brief Largest whole-byte chunk that may be shifted by up to 7 bits and still fit in the working word
+constexpr static size_t kBitsUnalignedChunkSizeBits {kBitsWordSizeBits - math::bits_to_contain(1U)};
+
+/// @brief Number of value bits carried by each byte of a varint
+constexpr static size_t kVarintGroupSizeBits {7U};
+
+/// @brief Set in every byte of a varint except the last
+constexpr static uint8_t kVarintContinueBit {0x80};
+
+/// @brief Largest number of bytes a 64-bit varint may take
+constexpr static size_t kVarintMaxSizeBytes {(64U + (kVarintGroupSizeBits - 1U)) / kVarintGroupSizeBits};
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 // Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+/**!
+ * @brief Creates a mask for the low bits of a working word
+ *
+ * @param[in] size_bits Number of bits to mask, saturates at the size of the working word
+ * @retval Word with the lowest `size_bits` bits set
+ */
+constexpr static uint64_t bits_word_mask(size_t size_bits) noexcept
+{
+    return (size_bits >= kBitsWordSizeBits) ? ~uint64_t {0U} : ((uint64_t {1U} << size_bits) - 1U);
+}
+
+/**!
+ * @brief Loads up to a working word's worth of bytes in to a little-endian ordered word
+ *
+ * @note A full word is moved with a single load, anything less with at most one 4, one 2 and one 1 byte load picked by
+ * the bits of the size, so that no size takes a loop and a constant size compiles to straight-line code
+ *
+ * @param[in] src Source address
+ * @param[in] size_bytes Number of bytes to load, must not exceed the size of the working word
+ * @retval Loaded word with the first byte of the source in its least significant position
+ */
+static uint64_t load_bits_word(uint8_t const* src, size_t size_bytes) noexcept
+{
+    uint64_t word {0U};
+    if (size_bytes == kBitsWordSizeBytes)
+    {
+        static_cast<void>(std::memcpy(&word, src, kBitsWordSizeBytes));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        word = __builtin_bswap64(word);
+#endif
+        return word;
+    }
+
+    size_t offset_bytes {0U};
+    if ((size_bytes & sizeof(uint32_t)) != 0U)
+    {
+        uint32_t part {0U};
+        static_cast<void>(std::memcpy(&part, src, sizeof(part)));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        part = __builtin_bswap32(part);
+#endif
+        word = part;
+        offset_bytes += sizeof(part);
+    }
+
+    if ((size_bytes & sizeof(uint16_t)) != 0U)
+    {
+        uint16_t part {0U};
+        static_cast<void>(std::memcpy(&part, (src + offset_bytes), sizeof(part)));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        part = __builtin_bswap16(part);
+#endif
+        word |= (static_cast<uint64_t>(part) << math::bits_to_contain(offset_bytes));
+        offset_bytes += sizeof(part);
+    }
+
+    if ((size_bytes & sizeof(uint8_t)) != 0U)
+        word |= (static_cast<uint64_t>(src[offset_bytes]) << math::bits_to_contain(offset_bytes));
+
+    return word;
+}
+
+/**!
+ * @brief Stores up to a working word's worth of bytes from a little-endian ordered word
+ *
+ * @note A full word is moved with a single store, anything less with at most one 4, one 2 and one 1 byte store, see
+ * load_bits_word
+ *
+ * @param[in] dest Destination address
+ * @param[in] word Word to store, least significant byte first
+ * @param[in] size_bytes Number of bytes to store, must not exceed the size of the working word
+ */
+static void store_bits_word(uint8_t* dest, uint64_t word, size_t size_bytes) noexcept
+{
+    if (size_bytes == kBitsWordSizeBytes)
+    {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        word = __builtin_bswap64(word);
+#endif
+        static_cast<void>(std::memcpy(dest, &word, kBitsWordSizeBytes));
+        return;
+    }
+
+    size_t offset_bytes {0U};
+    if ((size_bytes & sizeof(uint32_t)) != 0U)
+    {
+        uint32_t part {static_cast<uint32_t>(word)};
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        part = __builtin_bswap32(part);
+#endif
+        static_cast<void>(std::memcpy(dest, &part, sizeof(part)));
+        offset_bytes += sizeof(part);
+    }
+
+    if ((size_bytes & sizeof(uint16_t)) != 0U)
+    {
+        uint16_t part {static_cast<uint16_t>(word >> math::bits_to_contain(offset_bytes))};
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+        part = __builtin_bswap16(part);
+#endif
+        static_cast<void>(std::memcpy((dest + offset_bytes), &part, sizeof(part)));
+        offset_bytes += sizeof(part);
+    }
+
+    if ((size_bytes & sizeof(uint8_t)) != 0U)
+        dest[offset_bytes] = static_cast<uint8_t>(word >> math::bits_to_contain(offset_bytes));
+}
+
 /**!
  * @brief Copy a number of bits from a byte-aligned source to a destination memory address and bit offset
  *
+ * @note Bits are moved a working word at a time. Destination bits outside of the copied range are preserved.
+ *
  * @param[in] dest Destination address
  * @param[in] src Source address
  * @param[in] offset_bits Start bit offset for copying to the destination
  * @param[in] size_bits Number of bits to copy
  */
-static void encode_bits(uint8_t* dest, uint8_t const* src, size_t offset_bits, size_t size_bits)
+static void encode_bits(uint8_t* dest, uint8_t const* src, size_t offset_bits, size_t size_bits) noexcept
 {
-    constexpr size_t                                  kModulo8Mask {0x7};
-    constexpr size_t                                  kBitsPerByte {math::bits_to_contain(1U)};
-    constexpr std::array<uint8_t, (kBitsPerByte + 1)> kBitMasks {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+    constexpr size_t kModulo8Mask {0x7};
+    constexpr size_t kDivideBy8Shift {3U};
 
     // Determine byte and relative positional bit offsets
-    size_t offset_bytes {math::bytes_to_contain(offset_bits)};
-    offset_bits &= kModulo8Mask; // Cap bit offset at 8, keep remainder
+    size_t const kShiftBits {offset_bits & kModulo8Mask};
+    dest = dest + (offset_bits >> kDivideBy8Shift);
 
-    // bytes_to_contain() will ceiling the returned value because at least 1 byte is required to hold any non-zero
-    // amount of bits. If not beginning at a byte boundary, or within the first byte, roll the byte offset back to the
-    // previous, partially-populated position.
-    if ((offset_bits > 0U) && (offset_bytes > 0U))
-        offset_bytes -= 1;
-
-    // Move destination address up by the byte offset
-    dest = dest + offset_bytes;
+    // Byte-aligned copies may use the entire working word, unaligned copies must leave room for the shift
+    size_t const kChunkSizeBits {(kShiftBits == 0U) ? kBitsWordSizeBits : kBitsUnalignedChunkSizeBits};
 
     // Encode data
-    size_t const kStartByteBitsAvailable {kBitsPerByte - offset_bits};
     while (size_bits > 0U)
     {
-        // Encode the bits that fit from the offset position to the next byte boundary
-        size_t const kFrontBitsThatFit {std::min(kStartByteBitsAvailable, size_bits)};
-        *dest++ |= ((*src & kBitMasks[kFrontBitsThatFit]) << offset_bits);
-        size_bits -= kFrontBitsThatFit;
-        if ((offset_bits > 0U) && (size_bits > 0U))
-        {
-            // Value wraps over byte boundary, clean up leftovers from the current source byte
-            // Mask the resultant tail so that residue from the copy is not left over.
-            size_t const kLeftoverBits {std::min(offset_bits, size_bits)};
-            *dest = ((*src >> kFrontBitsThatFit) & kBitMasks[kLeftoverBits]);
-            size_bits -= kLeftoverBits;
-        }
+        size_t const kCopySizeBits {std::min(kChunkSizeBits, size_bits)};
+        size_t const kDestSizeBytes {math::bytes_to_contain(kShiftBits + kCopySizeBits)};
+
+        // Splice the shifted source bits in to the destination word without disturbing its neighbors
+        uint64_t const kMask {bits_word_mask(kCopySizeBits) << kShiftBits};
+        uint64_t const kValue {load_bits_word(src, math::bytes_to_contain(kCopySizeBits)) << kShiftBits};
+        uint64_t const kWord {load_bits_word(dest, kDestSizeBytes)};
+        store_bits_word(dest, ((kWord & ~kMask) | (kValue & kMask)), kDestSizeBytes);
 
-        src++;
+        src += math::bytes_to_contain(kCopySizeBits);
+        dest += math::bytes_to_contain(kCopySizeBits);
+        size_bits -= kCopySizeBits;
     }
 }
 
 /**!
  * @brief Copy a number of bits from a source memory address and bit offset in to a byte-aligned destination
  *
+ * @note Bits are moved a working word at a time. Unused bits of the final destination byte are cleared.
+ *
  * @param dest Destination address
  * @param src Source address
  * @param offset_bits Start bit offset for copying from the source
  * @param size_bits Number of bits to copy
  */
-static void decode_bits(uint8_t* dest, uint8_t const* src, size_t offset_bits, size_t size_bits)
+static void decode_bits(uint8_t* dest, uint8_t const* src, size_t offset_bits, size_t size_bits) noexcept
 {
-    constexpr size_t                                  kModulo8Mask {0x7};
-    constexpr size_t                                  kBitsPerByte {math::bits_to_contain(1U)};
-    constexpr std::array<uint8_t, (kBitsPerByte + 1)> kBitMasks {0x00, 0x01, 0x03, 0x07, 0x0F, 0x1F, 0x3F, 0x7F, 0xFF};
+    constexpr size_t kModulo8Mask {0x7};
+    constexpr size_t kDivideBy8Shift {3U};
 
     // Determine byte and relative positional bit offsets
-    size_t offset_bytes {math::bytes_to_contain(offset_bits)};
-    offset_bits &= kModulo8Mask; // Cap bit offset at 8, keep remainder
-
-    // bytes_to_contain() will ceiling the returned value because at least 1 byte is required to hold any non-zero
-    // amount of bits. If not beginning at a byte boundary, or within the first byte, roll the byte offset back to the
-    // previous, partially-populated position.
-    if ((offset_bits > 0U) && (offset_bytes > 0U))
-        offset_bytes -= 1;
+    size_t const kShiftBits {offset_bits & kModulo8Mask};
+    src = src + (offset_bits >> kDivideBy8Shift);
 
-    // Move source address up by the byte offset
-    src = src + offset_bytes;
+    // Byte-aligned copies may use the entire working word, unaligned copies must leave room for the shift
+    size_t const kChunkSizeBits {(kShiftBits == 0U) ? kBitsWordSizeBits : kBitsUnalignedChunkSizeBits};
 
     // Decode data
-    size_t const kStartByteBitsAvailable {kBitsPerByte - offset_bits};
     while (size_bits > 0U)
     {
-        // Encode the bits that fit from the offset position to the next byte boundary
-        size_t const kFrontBitsThatFit {std::min(kStartByteBitsAvailable, size_bits)};
-        *dest = ((*src++ >> offset_bits) & kBitMasks[kFrontBitsThatFit]);
-        size_bits -= kFrontBitsThatFit;
-        if ((offset_bits > 0U) && (size_bits > 0U))
+        size_t const kCopySizeBits {std::min(kChunkSizeBits, size_bits)};
+        size_t const kSrcSizeBytes {math::bytes_to_contain(kShiftBits + kCopySizeBits)};
+
+        // Extract the source bits and realign them to the start of the destination
+        uint64_t const kWord {(load_bits_word(src, kSrcSizeBytes) >> kShiftBits) & bits_word_mask(kCopySizeBits)};
+        store_bits_word(dest, kWord, math::bytes_to_contain(kCopySizeBits));
+
+        src += math::bytes_to_contain(kCopySizeBits);
+        dest += math::bytes_to_contain(kCopySizeBits);
+        size_bits -= kCopySizeBits;
+    }
+}
+
+/**!
+ * @brief Number of bits needed to hold a value, up to and including its highest set bit
+ *
+ * @param[in] value Unsigned value
+ * @return Number of significant bits, zero takes a single bit like one does
+ */
+constexpr static size_t significant_bits(uint64_t value) noexcept
+{
+    return 64U - static_cast<size_t>(__builtin_clzll(value | 1U));
+}
+
+/**!
+ * @brief Number of bytes a value takes when encoded as a varint
+ *
+ * @param[in] value Unsigned value
+ * @return Encoded size in bytes, between 1 and kVarintMaxSizeBytes
+ */
+constexpr static size_t varint_size_bytes(uint64_t value) noexcept
+{
+    return (significant_bits(value) + (kVarintGroupSizeBits - 1U)) / kVarintGroupSizeBits;
+}
+
+/**!
+ * @brief Encodes a value as a varint, least significant group of 7 bits first
+ *
+ * @note No bounds checking is performed, the destination must hold varint_size_bytes(value) bytes
+ *
+ * @param[in] dest Destination address
+ * @param[in] value Unsigned value
+ * @return Number of bytes written
+ */
+static size_t encode_varint(uint8_t* dest, uint64_t value) noexcept
+{
+    size_t size_bytes {0U};
+    while (value >= kVarintContinueBit)
+    {
+        dest[size_bytes++] = static_cast<uint8_t>(value | kVarintContinueBit);
+        value >>= kVarintGroupSizeBits;
+    }
+    dest[size_bytes++] = static_cast<uint8_t>(value);
+    return size_bytes;
+}
+
+/**!
+ * @brief Decodes a varint
+ *
+ * @note When at least a working word of source bytes is available, varints of up to 8 bytes are decoded without a
+ * per-byte loop: the word is loaded at once, its length found with a bit scan over the continuation bits and its
+ * groups packed together with three masked shifts. Longer varints, and those near the end of the source, fall back to
+ * a bytewise loop.
+ *
+ * @param[in] src Source address
+ * @param[in] available_bytes Number of bytes readable from the source
+ * @param[out] value Decoded value
+ * @return Number of bytes consumed, 0 if the varint is truncated, longer than kVarintMaxSizeBytes or wider than 64 bits
+ */
+static size_t decode_varint(uint8_t const* src, size_t available_bytes, uint64_t& value) noexcept
+{
+    constexpr uint64_t kContinueBits {0x8080808080808080U};
+
+    if (available_bytes >= kBitsWordSizeBytes)
+    {
+        uint64_t const kWord {load_bits_word(src, kBitsWordSizeBytes)};
+        uint64_t const kStopBits {~kWord & kContinueBits};
+        if (kStopBits != 0U)
         {
-            // Value wraps over byte boundary, copy over tail for current destination byte
-            size_t const kLeftoverBits {std::min(offset_bits, size_bits)};
-            *dest |= ((*src & kBitMasks[kLeftoverBits]) << kFrontBitsThatFit);
-            size_bits -= kLeftoverBits;
+            size_t const kSizeBytes {(static_cast<size_t>(__builtin_ctzll(kStopBits)) / 8U) + 1U};
+
+            // Drop the continuation bits and anything past the varint, then close the gaps between groups
+            uint64_t groups {kWord & ~kContinueBits & bits_word_mask(math::bits_to_contain(kSizeBytes))};
+            groups = ((groups & 0x7F007F007F007F00U) >> 1U) | (groups & 0x007F007F007F007FU);
+            groups = ((groups & 0x3FFF00003FFF0000U) >> 2U) | (groups & 0x00003FFF00003FFFU);
+            groups = ((groups & 0x0FFFFFFF00000000U) >> 4U) | (groups & 0x000000000FFFFFFFU);
+
+            value = groups;
+            return kSizeBytes;
         }
+    }
 
-        dest++;
+    size_t const kLimitBytes {std::min(available_bytes, kVarintMaxSizeBytes)};
+    uint64_t     decoded {0U};
+    for (size_t i = 0U; i < kLimitBytes; i++)
+    {
+        // The last byte holds only the top bit of the value, anything above it can't be represented
+        if ((i == (kVarintMaxSizeBytes - 1U)) && ((src[i] & 0x7EU) != 0U))
+            return 0U;
+
+        decoded |= (static_cast<uint64_t>(src[i] & ~kVarintContinueBit) << (i * kVarintGroupSizeBits));
+        if ((src[i] & kVarintContinueBit) == 0U)
+        {
+            value = decoded;
+            return i + 1U;
+        }
     }
+
+    return 0U;
+}
+
+/**!
+ * @brief Maps a signed value on to an unsigned one so that values of small magnitude stay small: 0, -1, 1, -2, ...
+ * become 0, 1, 2, 3, ...
+ *
+ * @param[in] value Signed value
+ * @return Zigzag encoded value
+ */
+constexpr static uint64_t zigzag_encode(int64_t value) noexcept
+{
+    return (static_cast<uint64_t>(value) << 1U) ^ static_cast<uint64_t>(value >> 63U);
+}
+
+/**!
+ * @brief Reverses zigzag_encode
+ *
+ * @param[in] value Zigzag encoded value
+ * @return Signed value
+ */
+constexpr static int64_t zigzag_decode(uint64_t value) noexcept
+{
+    return static_cast<int64_t>(value >> 1U) ^ -static_cast<int64_t>(value & 1U);
+}
+
+/**!
+ * @brief Widens an integer to the unsigned word that is encoded as a varint, zigzag encoding signed values
+ *
+ * @tparam T Integral type
+ * @param[in] value Value to widen
+ * @return Unsigned word
+ */
+template<typename T>
+constexpr static uint64_t to_varint(T value) noexcept
+{
+    if constexpr (std::is_signed<T>::value)
+        return zigzag_encode(static_cast<int64_t>(value));
+    else
+        return static_cast<uint64_t>(value);
+}
+
+/**!
+ * @brief Reverses the bytes of an unsigned word
+ *
+ * @param[in] word Word to swap
+ * @return Swapped word
+ */
+constexpr static uint8_t swap_word_bytes(uint8_t word) noexcept
+{
+    return word;
+}
+
+constexpr static uint16_t swap_word_bytes(uint16_t word) noexcept
+{
+    return __builtin_bswap16(word);
+}
+
+constexpr static uint32_t swap_word_bytes(uint32_t word) noexcept
+{
+    return __builtin_bswap32(word);
+}
+
+constexpr static uint64_t swap_word_bytes(uint64_t word) noexcept
+{
+    return __builtin_bswap64(word);
+}
+
+/**!
+ * @brief Converts a value between host byte order and a wire byte order. Conversion is its own inverse, so the same
+ * procedure serves both encoding and decoding.
+ *
+ * @tparam SwapV Whether the byte orders differ
+ */
+template<bool SwapV>
+struct byte_order_conversion
+{
+    /**!
+     * @brief Byte orders match, the value passes through untouched
+     *
+     * @tparam T Value type
+     * @param[in] value Value to convert
+     * @return value
+     */
+    template<typename T>
+    static T Do(T value) noexcept
+    {
+        return value;
+    }
+};
+
+template<>
+struct byte_order_conversion<true>
+{
+    /**!
+     * @brief Byte orders differ, the bytes of the value are reversed
+     *
+     * @tparam T Value type, must be an arithmetic or pointer type
+     * @param[in] value Value to convert
+     * @return Value with its bytes reversed
+     */
+    template<typename T>
+    static T Do(T value) noexcept
+    {
+        using Word = smallest_unsigned_t<math::bits_to_contain(sizeof(T))>;
+        static_assert(sizeof(Word) == sizeof(T), "`T` must be a 1, 2, 4, or 8 byte type");
+
+        Word word {};
+        static_cast<void>(std::memcpy(&word, &value, sizeof(T)));
+        word = swap_word_bytes(word);
+        static_cast<void>(std::memcpy(&value, &word, sizeof(T)));
+        return value;
+    }
+};
+
+/**!
+ * @brief Converts a value between host byte order and a wire byte order. Compiles away when the wire order is native
+ * or when the value is a single byte.
+ *
+ * @tparam OrderV Wire byte order
+ * @tparam T Value type
+ * @param[in] value Value to convert
+ * @return Converted value
+ */
+template<ByteOrder OrderV, typename T>
+static T convert_byte_order(T value) noexcept
+{
+    return byte_order_conversion<((OrderV != ByteOrder::kNative) && (sizeof(T) > 1U))>::Do(value);
 }
 
 } // namespace _detail
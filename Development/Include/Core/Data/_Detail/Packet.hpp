@@ -6,13 +6,21 @@
 #include "Core/Math/Memory.hpp"
 #include "Core/StdTypes.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 namespace shmit
 {
 namespace data
 {
+
+template<typename... FieldT>
+class Packet;
+
 namespace _detail
 {
 
@@ -21,120 +29,1019 @@ struct PacketBase
 {
 };
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-/**!
- * @brief Adds the size of a Field's stored value type in bits
+/// @brief Placement of a single field within the encoded footprint of a Packet
+struct FieldLayout
+{
+    /// @brief Offset of the field from the beginning of the Packet, in bits
+    size_t offset_bits;
+
+    /// @brief Size of the field, in bits
+    size_t size_bits;
+
+    /// @brief Padding placed ahead of the field so that it meets its alignment requirements, in bits
+    size_t padding_bits;
+};
+
+/// @brief In-memory storage layout of the fields of a Packet, the encoded footprint is the same for every layout
+struct PacketStorageLayout
+{
+    /// @brief Hold fields by descending alignment rather than in the order they are presented, removing the padding
+    /// between them
+    bool is_sorted_by_alignment;
+
+    /// @brief Minimum alignment of the Packet in bytes, such as a cache line. 0 keeps the natural alignment of its
+    /// fields.
+    size_t alignment_bytes;
+};
+
+/**!
+ * @brief Holds a single field of a Packet, tagged with its position so that identical field types remain distinct
+ *
+ * @tparam IndexV Position of the field within the Packet
+ * @tparam FieldT Field type
+ */
+template<size_t IndexV, typename FieldT>
+struct PacketFieldStorage
+{
+    FieldT field {};
+};
+
+/**!
+ * @brief Order in which the fields of a Packet are held in memory, by descending alignment. Fields of equal alignment
+ * keep the order that they are presented in.
+ *
+ * @tparam FieldT Field types
+ * @return Field positions, in storage order
+ */
+template<typename... FieldT>
+constexpr static std::array<size_t, sizeof...(FieldT)> packet_storage_order_by_alignment() noexcept
+{
+    constexpr size_t kAlignments[] {alignof(FieldT)..., 0U};
+
+    std::array<size_t, sizeof...(FieldT)> order {};
+    for (size_t i = 0U; i < order.size(); i++)
+    {
+        // Insertion sort, stable so that equally aligned fields stay in their presented order
+        size_t j {i};
+        for (; (j > 0U) && (kAlignments[order[j - 1U]] < kAlignments[i]); j--)
+            order[j] = order[j - 1U];
+        order[j] = i;
+    }
+
+    return order;
+}
+
+/**!
+ * @brief Alignment of Packet storage, the strictest of its fields and the alignment asked for by its layout
+ *
+ * @tparam AlignmentBytesV Alignment asked for by the storage layout, 0 if none
+ * @tparam FieldT Field types
+ */
+template<size_t AlignmentBytesV, typename... FieldT>
+constexpr static size_t kPacketStorageAlignment {std::max({AlignmentBytesV, size_t {1U}, alignof(FieldT)...})};
+
+template<bool IsSortedV, typename IndexSequenceT, typename... FieldT>
+struct packet_storage_order;
+
+/**!
+ * @brief Returns the order in which the fields of a Packet are held in memory as an index sequence
+ *
+ * @tparam IsSortedV Whether fields are held by descending alignment, or in the order that they are presented
+ * @tparam IndexV Positions of the fields within the Packet
+ * @tparam FieldT Field types
+ */
+template<bool IsSortedV, size_t... IndexV, typename... FieldT>
+struct packet_storage_order<IsSortedV, std::index_sequence<IndexV...>, FieldT...>
+{
+private:
+    constexpr static std::array<size_t, sizeof...(FieldT)> kSortedOrder {
+        packet_storage_order_by_alignment<FieldT...>()};
+
+public:
+    using type = std::conditional_t<IsSortedV, std::index_sequence<kSortedOrder[IndexV]...>,
+                                    std::index_sequence<IndexV...>>;
+};
+
+template<size_t AlignmentBytesV, typename StorageOrderT, typename... FieldT>
+struct PacketStorageImpl;
+
+/**!
+ * @brief In-memory storage for the fields of a Packet. By default fields are held in the order that they are
+ * presented, the same order in which they are placed in the encoded footprint, so that runs of fields can be moved
+ * together. Each field is tagged with its position, so that it is found the same way whatever order it is held in.
+ *
+ * @tparam AlignmentBytesV Minimum alignment of the storage, 0 for the natural alignment of its fields
+ * @tparam OrderV Positions of the fields within the Packet, in the order that they are held
+ * @tparam FieldT Field types, in the order that they are presented
+ */
+template<size_t AlignmentBytesV, size_t... OrderV, typename... FieldT>
+struct alignas(kPacketStorageAlignment<AlignmentBytesV, FieldT...>)
+    PacketStorageImpl<AlignmentBytesV, std::index_sequence<OrderV...>, FieldT...> :
+    public PacketFieldStorage<OrderV, std::tuple_element_t<OrderV, std::tuple<FieldT...>>>...
+{
+    constexpr PacketStorageImpl() noexcept = default;
+
+    template<bool NonEmptyV = (sizeof...(FieldT) > 0U), typename = std::enable_if_t<NonEmptyV>>
+    constexpr explicit PacketStorageImpl(FieldT const&... fields) noexcept :
+        PacketFieldStorage<OrderV, std::tuple_element_t<OrderV, std::tuple<FieldT...>>> {
+            std::get<OrderV>(std::forward_as_tuple(fields...))}...
+    {
+    }
+};
+
+/**!
+ * @brief Convenience alias to the storage specialization for a list of fields
+ *
+ * @tparam IsSortedV Whether fields are held by descending alignment, see PacketStorageLayout
+ * @tparam AlignmentBytesV Minimum alignment of the storage, see PacketStorageLayout
+ * @tparam FieldT Field types
+ */
+template<bool IsSortedV, size_t AlignmentBytesV, typename... FieldT>
+using PacketStorage =
+    PacketStorageImpl<AlignmentBytesV,
+                      typename packet_storage_order<IsSortedV, std::index_sequence_for<FieldT...>, FieldT...>::type,
+                      FieldT...>;
+
+/**!
+ * @brief Fetch a field from Packet storage by position
+ *
+ * @tparam IndexV Position of the field
+ * @tparam FieldT Field type, deduced
+ * @param[in] storage Packet storage
+ * @return Reference to the field
+ */
+template<size_t IndexV, typename FieldT>
+constexpr static FieldT& get_packet_field(PacketFieldStorage<IndexV, FieldT>& storage) noexcept
+{
+    return storage.field;
+}
+
+/**!
+ * @brief Fetch a field from Packet storage by position
+ *
+ * @tparam IndexV Position of the field
+ * @tparam FieldT Field type, deduced
+ * @param[in] storage Packet storage
+ * @return Const reference to the field
+ */
+template<size_t IndexV, typename FieldT>
+constexpr static FieldT const& get_packet_field(PacketFieldStorage<IndexV, FieldT> const& storage) noexcept
+{
+    return storage.field;
+}
+
+/// @brief Grants procedures within this namespace access to the fields held by a Packet
+struct PacketAccess
+{
+    /**!
+     * @brief Fetch a field held by a Packet
+     *
+     * @tparam IndexV Field index
+     * @tparam PacketT Packet specialization
+     * @param[in] packet Packet to fetch the field from
+     * @return Reference to the field
+     */
+    template<size_t IndexV, typename PacketT>
+    constexpr static auto& Get(PacketT& packet) noexcept
+    {
+        return get_packet_field<IndexV>(packet.m_fields);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace metafunction declarations              ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<size_t IndexV, size_t EndV, typename PacketT>
+struct encode_packet_fields_recursive;
+
+template<size_t IndexV, size_t EndV, typename PacketT>
+struct decode_packet_fields_recursive;
+
+template<size_t BeginV, size_t EndV, typename PacketT, bool SingleV = ((BeginV + 1U) == EndV)>
+struct encode_packet_field_run;
+
+template<size_t BeginV, size_t EndV, typename PacketT, bool SingleV = ((BeginV + 1U) == EndV)>
+struct decode_packet_field_run;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Adds the size of a Field's stored value type in bits
+ *
+ * @tparam T Value type of the Field, cv and reference qualifiers are removed
+ * @param[in] aggregate Value to add the Field's size to
+ * @param[in] field Field instance
+ * @retval Aggregated size of the Field
+ */
+template<typename T, ByteOrder OrderV>
+constexpr static size_t add_field_size_bits(size_t aggregate, Field<T, OrderV> field)
+{
+    size_t const kAggregateBytes {math::bytes_to_contain(aggregate)};
+    return math::bits_to_contain(kAggregateBytes) + Field<T, OrderV>::kSizeBits;
+}
+
+/**!
+ * @brief Adds the size of a BitField's stored value in bits
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] aggregate Value to add the Field's size to
+ * @param[in] field Field instance
+ * @retval Aggregated size of the Field
+ */
+template<size_t SizeBitsV>
+constexpr static size_t add_field_size_bits(size_t aggregate, BitField<SizeBitsV> field)
+{
+    return aggregate + BitField<SizeBitsV>::kSizeBits;
+}
+
+/**!
+ * @brief Adds the size of a ConstBitField's stored value type in bits
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] aggregate Value to add the Field's size to
+ * @param[in] field Field instance
+ * @retval Aggregated size of the Field
+ */
+template<size_t SizeBitsV>
+constexpr static size_t add_field_size_bits(size_t aggregate, ConstBitField<SizeBitsV> field)
+{
+    return aggregate + ConstBitField<SizeBitsV>::kSizeBits;
+}
+
+/**!
+ * @brief Adds the largest size an ArrayField's count and elements may take in bits
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] aggregate Value to add the ArrayField's size to
+ * @param[in] field ArrayField instance
+ * @retval Aggregated size of the ArrayField
+ */
+template<typename T, size_t MaxCountV>
+constexpr static size_t add_field_size_bits(size_t aggregate, ArrayField<T, MaxCountV> field)
+{
+    size_t const kAggregateBytes {math::bytes_to_contain(aggregate)};
+    return math::bits_to_contain(kAggregateBytes) + ArrayField<T, MaxCountV>::kSizeBits;
+}
+
+/**!
+ * @brief Adds the largest size a VarField's encoded value may take in bits
+ *
+ * @tparam T Value type of the VarField
+ * @param[in] aggregate Value to add the VarField's size to
+ * @param[in] field VarField instance
+ * @retval Aggregated size of the VarField
+ */
+template<typename T>
+constexpr static size_t add_field_size_bits(size_t aggregate, VarField<T> field)
+{
+    size_t const kAggregateBytes {math::bytes_to_contain(aggregate)};
+    return math::bits_to_contain(kAggregateBytes) + VarField<T>::kSizeBits;
+}
+
+/**!
+ * @brief Decodes a Field from a fixed, byte-aligned position within a packet's footprint
+ *
+ * @tparam T Value type of the Field
+ * @tparam OrderV Byte order of the encoded value
+ * @param[in] src Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the Field from the beginning of the packet, in bits
+ * @param[out] field Decoding destination
+ */
+template<typename T, ByteOrder OrderV>
+static void decode_field_at(uint8_t const* src, size_t offset_bits, Field<T, OrderV>& field) noexcept
+{
+    uint8_t const* field_src {src + math::bytes_to_contain(offset_bits)};
+    static_cast<void>(std::memcpy(&field.value, field_src, footprint_size_bytes_v<T>));
+    field.value = convert_byte_order<OrderV>(field.value);
+}
+
+/**!
+ * @brief Decodes a nested Packet from a fixed, byte-aligned position within a packet's footprint
+ *
+ * @tparam FieldT Field types of the nested Packet
+ * @param[in] src Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the nested Packet from the beginning of the packet, in bits
+ * @param[out] field Decoding destination
+ */
+template<typename... FieldT>
+static void decode_field_at(uint8_t const* src, size_t offset_bits, Field<Packet<FieldT...>>& field) noexcept
+{
+    using NestedPacket = typename Field<Packet<FieldT...>>::value_type;
+    decode_packet_fields_recursive<0U, NestedPacket::kNumFields, NestedPacket>::Do(
+        (src + math::bytes_to_contain(offset_bits)), field.value);
+}
+
+/**!
+ * @brief Decodes a BitField from a fixed bit position within a packet's footprint
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] src Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the BitField from the beginning of the packet, in bits
+ * @param[out] bitfield Decoding destination
+ */
+template<size_t SizeBitsV>
+static void decode_field_at(uint8_t const* src, size_t offset_bits, BitField<SizeBitsV>& bitfield) noexcept
+{
+    decode_bits(reinterpret_cast<uint8_t*>(&bitfield.value), src, offset_bits, SizeBitsV);
+}
+
+/**!
+ * @brief ConstBitFields can't be reassigned, nothing is decoded
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] src Unused
+ * @param[in] offset_bits Unused
+ * @param[in] bitfield Unused
+ */
+template<size_t SizeBitsV>
+static void decode_field_at(uint8_t const* src, size_t offset_bits, ConstBitField<SizeBitsV>& bitfield) noexcept
+{
+    static_cast<void>(src);         // Avoid unused warning
+    static_cast<void>(offset_bits); // Avoid unused warning
+    static_cast<void>(bitfield);    // Avoid unused warning
+}
+
+/**!
+ * @brief Encodes a Field at a fixed, byte-aligned position within a packet's footprint
+ *
+ * @tparam T Value type of the Field
+ * @tparam OrderV Byte order of the encoded value
+ * @param[in] field Field to encode
+ * @param[in] dest Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the Field from the beginning of the packet, in bits
+ */
+template<typename T, ByteOrder OrderV>
+static void encode_field_at(Field<T, OrderV> const& field, uint8_t* dest, size_t offset_bits) noexcept
+{
+    typename Field<T, OrderV>::value_type const kValue {convert_byte_order<OrderV>(field.value)};
+
+    uint8_t* field_dest {dest + math::bytes_to_contain(offset_bits)};
+    static_cast<void>(std::memcpy(field_dest, &kValue, footprint_size_bytes_v<T>));
+}
+
+/**!
+ * @brief Encodes a nested Packet at a fixed, byte-aligned position within a packet's footprint
+ *
+ * @tparam FieldT Field types of the nested Packet
+ * @param[in] field Nested Packet to encode
+ * @param[in] dest Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the nested Packet from the beginning of the packet, in bits
+ */
+template<typename... FieldT>
+static void encode_field_at(Field<Packet<FieldT...>> const& field, uint8_t* dest, size_t offset_bits) noexcept
+{
+    using NestedPacket = typename Field<Packet<FieldT...>>::value_type;
+    encode_packet_fields_recursive<0U, NestedPacket::kNumFields, NestedPacket>::Do(
+        (dest + math::bytes_to_contain(offset_bits)), field.value);
+}
+
+/**!
+ * @brief Encodes a BitField at a fixed bit position within a packet's footprint
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] bitfield BitField to encode
+ * @param[in] dest Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the BitField from the beginning of the packet, in bits
+ */
+template<size_t SizeBitsV>
+static void encode_field_at(BitField<SizeBitsV> const& bitfield, uint8_t* dest, size_t offset_bits) noexcept
+{
+    encode_bits(dest, reinterpret_cast<uint8_t const*>(&bitfield.value), offset_bits, SizeBitsV);
+}
+
+/**!
+ * @brief Encodes a ConstBitField at a fixed bit position within a packet's footprint
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] bitfield ConstBitField to encode
+ * @param[in] dest Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the ConstBitField from the beginning of the packet, in bits
+ */
+template<size_t SizeBitsV>
+static void encode_field_at(ConstBitField<SizeBitsV> const& bitfield, uint8_t* dest, size_t offset_bits) noexcept
+{
+    encode_bits(dest, reinterpret_cast<uint8_t const*>(&bitfield.value), offset_bits, SizeBitsV);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace metafunction definitions               ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Checks if type is a Packet specialization
+ *
+ * @tparam T Potential Packet type
+ */
+template<typename T>
+using is_packet = typename std::is_base_of<_detail::PacketBase, T>::type;
+
+/**!
+ * @brief Checks if a field's encoded size is only known at runtime, such as a VarField or ArrayField
+ *
+ * @tparam FieldT Field type
+ */
+template<typename FieldT>
+struct is_variable_size_field : public std::false_type
+{
+};
+
+template<typename T>
+struct is_variable_size_field<VarField<T>> : public std::true_type
+{
+};
+
+template<typename T, size_t MaxCountV>
+struct is_variable_size_field<ArrayField<T, MaxCountV>> : public std::true_type
+{
+};
+
+/**!
+ * @brief Checks if a Packet holds a variable-size field, directly or within a nested Packet
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexSequenceT Sequence of field indices to check
+ */
+template<typename PacketT, typename IndexSequenceT = std::make_index_sequence<PacketT::kNumFields>>
+struct packet_has_variable_size_fields;
+
+template<typename FieldT>
+struct field_has_variable_size : public is_variable_size_field<FieldT>
+{
+};
+
+template<typename... FieldT>
+struct field_has_variable_size<Field<Packet<FieldT...>>> : public packet_has_variable_size_fields<Packet<FieldT...>>
+{
+};
+
+template<typename PacketT, size_t... IndexV>
+struct packet_has_variable_size_fields<PacketT, std::index_sequence<IndexV...>> :
+    public std::disjunction<field_has_variable_size<std::tuple_element_t<IndexV, typename PacketT::Fields>>...>
+{
+};
+
+/**!
+ * @brief Accumulates the size of fields held by a packet
+ *
+ * @tparam IndexV Current field position
+ * @tparam EndV Endpoint for recursion
+ * @tparam PacketT Packet specialization
+ */
+template<size_t IndexV, size_t EndV, typename PacketT>
+struct accumulate_packet_field_size_bits_recursive
+{
+    static_assert(is_packet<PacketT>::value, "`PacketT` must be a `shmit::data::Packet` specialization");
+    static_assert((IndexV < PacketT::kNumFields), "`IndexV` must be within `PacketT` field count");
+    static_assert(IndexV < EndV, "`IndexV` must be within `EndV` bounds");
+
+private:
+    using FieldPack = typename PacketT::Fields;
+    using Field     = typename std::tuple_element<IndexV, FieldPack>::type;
+
+public:
+    /**
+     * @brief Accumulate size of current field position
+     *
+     * @param[in] aggregate Starting value
+     * @retval Accumulated value
+     */
+    constexpr static size_t Do(size_t aggregate)
+    {
+        aggregate = add_field_size_bits(aggregate, Field {});
+        return accumulate_packet_field_size_bits_recursive<IndexV + 1, EndV, PacketT>::Do(aggregate);
+    }
+};
+
+/**!
+ * @brief Base case for recursive accumulation of Packet field size; `IndexV == EndV`
+ *
+ * @tparam IndexV Index of field to accumulate size for, reached endpoint
+ * @tparam PacketT Packet specialization
+ */
+template<size_t IndexV, typename PacketT>
+struct accumulate_packet_field_size_bits_recursive<IndexV, IndexV, PacketT>
+{
+    /**
+     * @brief At end of packet, do nothing
+     *
+     * @param[in] aggregate Unused
+     * @retval aggregate
+     */
+    constexpr static size_t Do(size_t aggregate)
+    {
+        return aggregate;
+    }
+};
+
+/**!
+ * @brief Returns the compile-time placement of a field within the encoded footprint of a packet
+ *
+ * @tparam IndexV Index of field within Packet
+ * @tparam PacketT Packet specialization
+ */
+template<size_t IndexV, typename PacketT>
+struct packet_field_layout
+{
+    static_assert(is_packet<PacketT>::value, "`PacketT` must be a `shmit::data::Packet` specialization");
+    static_assert((IndexV < PacketT::kNumFields), "`IndexV` must be within `PacketT` field count");
+    static_assert(!packet_has_variable_size_fields<PacketT>::value, "Fields of a Packet holding a variable-size field "
+                                                                    "have no fixed placement");
+
+private:
+    using FieldPack = typename PacketT::Fields;
+    using Field     = typename std::tuple_element<IndexV, FieldPack>::type;
+
+    constexpr static size_t kPrecedingSizeBits {
+        accumulate_packet_field_size_bits_recursive<0U, IndexV, PacketT>::Do(0U)};
+
+public:
+    /// @brief Size of the field, in bits
+    constexpr static size_t kSizeBits {Field::kSizeBits};
+
+    /// @brief Offset of the field from the beginning of the packet, in bits
+    constexpr static size_t kOffsetBits {add_field_size_bits(kPrecedingSizeBits, Field {}) - kSizeBits};
+
+    /// @brief Padding placed ahead of the field, in bits
+    constexpr static size_t kPaddingBits {kOffsetBits - kPrecedingSizeBits};
+
+    constexpr static FieldLayout value {kOffsetBits, kSizeBits, kPaddingBits};
+};
+
+/**!
+ * @brief Returns the compile-time placement of every field within the encoded footprint of a packet as a table
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexSequenceT Sequence of field indices to tabulate
+ */
+template<typename PacketT, typename IndexSequenceT = std::make_index_sequence<PacketT::kNumFields>>
+struct packet_layout;
+
+template<typename PacketT, size_t... IndexV>
+struct packet_layout<PacketT, std::index_sequence<IndexV...>>
+{
+    static_assert(is_packet<PacketT>::value, "`PacketT` must be a `shmit::data::Packet` specialization");
+
+    constexpr static std::array<FieldLayout, sizeof...(IndexV)> value {
+        {packet_field_layout<IndexV, PacketT>::value...}};
+};
+
+/**!
+ * @brief Checks if a field may be moved together with its neighbors as part of a contiguous run of bytes. Only
+ * byte-aligned Fields of arithmetic or pointer types held in native byte order qualify, nested Packets and BitFields
+ * do not.
+ *
+ * @tparam FieldT Field type
+ */
+template<typename FieldT>
+struct is_coalescable_field : public std::false_type
+{
+};
+
+template<typename T>
+struct is_coalescable_field<Field<T>> :
+    public std::integral_constant<bool, !is_packet<typename Field<T>::value_type>::value>
+{
+};
+
+/**!
+ * @brief Checks if a field is bit-packed against its neighbors, either a BitField or a ConstBitField
+ *
+ * @tparam FieldT Field type
+ */
+template<typename FieldT>
+struct is_bit_packed_field : public std::false_type
+{
+};
+
+template<size_t SizeBitsV>
+struct is_bit_packed_field<BitField<SizeBitsV>> : public std::true_type
+{
+};
+
+template<size_t SizeBitsV>
+struct is_bit_packed_field<ConstBitField<SizeBitsV>> : public std::true_type
+{
+};
+
+/**!
+ * @brief Returns a table of which fields held by a packet may be coalesced with their neighbors
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexSequenceT Sequence of field indices to tabulate
+ */
+template<typename PacketT, typename IndexSequenceT = std::make_index_sequence<PacketT::kNumFields>>
+struct packet_coalescable_fields;
+
+template<typename PacketT, size_t... IndexV>
+struct packet_coalescable_fields<PacketT, std::index_sequence<IndexV...>>
+{
+    constexpr static std::array<bool, sizeof...(IndexV)> value {
+        {is_coalescable_field<typename std::tuple_element<IndexV, typename PacketT::Fields>::type>::value...}};
+};
+
+/**!
+ * @brief Returns a table of which fields held by a packet are bit-packed against their neighbors
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexSequenceT Sequence of field indices to tabulate
+ */
+template<typename PacketT, typename IndexSequenceT = std::make_index_sequence<PacketT::kNumFields>>
+struct packet_bit_packed_fields;
+
+template<typename PacketT, size_t... IndexV>
+struct packet_bit_packed_fields<PacketT, std::index_sequence<IndexV...>>
+{
+    constexpr static std::array<bool, sizeof...(IndexV)> value {
+        {is_bit_packed_field<typename std::tuple_element<IndexV, typename PacketT::Fields>::type>::value...}};
+};
+
+/**!
+ * @brief Returns the index one past the end of the run of fields beginning at a field position which may be moved
+ * together. Runs are either coalescable fields, or bit-packed fields whose combined footprint fits within a single
+ * working word. Any other field forms a run of its own.
+ *
+ * @note A Field always ends on a byte boundary, so no padding can exist between consecutive coalescable fields
+ * @note Bit-packed fields are never padded, so no gaps can exist between consecutive bit-packed fields
+ *
+ * @tparam IndexV Start of the run
+ * @tparam EndV Upper bound of the run
+ * @tparam PacketT Packet specialization
+ */
+template<size_t IndexV, size_t EndV, typename PacketT>
+struct packet_field_run_end
+{
+    static_assert(IndexV < EndV, "`IndexV` must be within `EndV` bounds");
+
+private:
+    constexpr static size_t Find() noexcept
+    {
+        constexpr std::array<bool, PacketT::kNumFields> kCoalescable {packet_coalescable_fields<PacketT>::value};
+        constexpr std::array<bool, PacketT::kNumFields> kBitPacked {packet_bit_packed_fields<PacketT>::value};
+        constexpr std::array<FieldLayout, PacketT::kNumFields> kLayout {packet_layout<PacketT>::value};
+
+        size_t end {IndexV + 1U};
+        if (kCoalescable[IndexV])
+        {
+            while ((end < EndV) && kCoalescable[end])
+                end++;
+        }
+        else if (kBitPacked[IndexV])
+        {
+            // The whole group, including the head's shift within its first byte, must fit in one working word
+            size_t const kShiftBits {kLayout[IndexV].offset_bits % math::bits_to_contain(1U)};
+            while ((end < EndV) && kBitPacked[end] &&
+                   ((kShiftBits + kLayout[end].offset_bits + kLayout[end].size_bits - kLayout[IndexV].offset_bits) <=
+                    kBitsWordSizeBits))
+                end++;
+        }
+
+        return end;
+    }
+
+public:
+    constexpr static size_t value {Find()};
+};
+
+/**!
+ * @brief Checks if the encoded footprint of a packet matches its in-memory storage byte for byte. Every field must be
+ * coalescable, held in the order it is presented, and sit at its natural alignment with nothing between fields or
+ * after the last one.
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexSequenceT Sequence of field indices to check
+ */
+template<typename PacketT, typename IndexSequenceT = std::make_index_sequence<PacketT::kNumFields>>
+struct packet_is_wire_identical;
+
+template<typename PacketT, size_t... IndexV>
+struct packet_is_wire_identical<PacketT, std::index_sequence<IndexV...>>
+{
+private:
+    template<size_t FieldIndexV>
+    using FieldAt = typename std::tuple_element<FieldIndexV, typename PacketT::Fields>::type;
+
+    constexpr static bool Check() noexcept
+    {
+        constexpr std::array<bool, PacketT::kNumFields> kCoalescable {packet_coalescable_fields<PacketT>::value};
+        constexpr std::array<FieldLayout, PacketT::kNumFields> kLayout {packet_layout<PacketT>::value};
+        constexpr size_t kSizesBytes[] {sizeof(typename FieldAt<IndexV>::value_type)..., 0U};
+        constexpr size_t kAlignments[] {alignof(FieldAt<IndexV>)..., 1U};
+
+        if ((PacketT::kNumFields == 0U) || PacketT::kStorageLayout.is_sorted_by_alignment)
+            return false;
+
+        size_t offset_bytes {0U};
+        for (size_t i = 0U; i < PacketT::kNumFields; i++)
+        {
+            if (!kCoalescable[i] || ((offset_bytes % kAlignments[i]) != 0U) ||
+                (kLayout[i].offset_bits != math::bits_to_contain(offset_bytes)) ||
+                (kLayout[i].size_bits != math::bits_to_contain(kSizesBytes[i])))
+                return false;
+
+            offset_bytes += kSizesBytes[i];
+        }
+
+        return (offset_bytes == PacketT::kSizeBytes) && (sizeof(PacketT) == PacketT::kSizeBytes);
+    }
+
+public:
+    constexpr static bool value {Check()};
+};
+
+/**!
+ * @brief Checks if a run of fields is a group of two or more bit-packed fields
+ *
+ * @tparam BeginV Start of the run
+ * @tparam EndV One past the end of the run
+ * @tparam PacketT Packet specialization
+ */
+template<size_t BeginV, size_t EndV, typename PacketT>
+struct is_packet_bit_group :
+    public std::integral_constant<bool, (((BeginV + 1U) < EndV) &&
+                                         is_bit_packed_field<typename std::tuple_element<
+                                             BeginV, typename PacketT::Fields>::type>::value)>
+{
+};
+
+/**
+ * @brief Encodes a group of bit-packed fields. Every value in the group is shifted in to place within a working word
+ * held in a register, which is then spliced in to the packet's footprint with a single read-modify-write.
+ *
+ * @tparam BeginV Start of the group
+ * @tparam EndV One past the end of the group
+ * @tparam PacketT Packet specialization
+ */
+template<size_t BeginV, size_t EndV, typename PacketT>
+struct encode_packet_bit_group
+{
+private:
+    using Head = packet_field_layout<BeginV, PacketT>;
+    using Tail = packet_field_layout<(EndV - 1U), PacketT>;
+
+    constexpr static size_t kShiftBits {Head::kOffsetBits % math::bits_to_contain(1U)};
+    constexpr static size_t kGroupSizeBits {Tail::kOffsetBits + Tail::kSizeBits - Head::kOffsetBits};
+    constexpr static size_t kWordSizeBytes {math::bytes_to_contain(kShiftBits + kGroupSizeBits)};
+
+    template<size_t IndexV>
+    static uint64_t Pack(PacketT const& packet, std::integral_constant<size_t, IndexV>) noexcept
+    {
+        using Layout = packet_field_layout<IndexV, PacketT>;
+
+        uint64_t const kValue {static_cast<uint64_t>(PacketAccess::Get<IndexV>(packet).value) &
+                               bits_word_mask(Layout::kSizeBits)};
+        return (kValue << (kShiftBits + Layout::kOffsetBits - Head::kOffsetBits)) |
+               Pack(packet, std::integral_constant<size_t, (IndexV + 1U)> {});
+    }
+
+    static uint64_t Pack(PacketT const& packet, std::integral_constant<size_t, EndV>) noexcept
+    {
+        static_cast<void>(packet); // Avoid unused warning
+        return 0U;
+    }
+
+public:
+    /**
+     * @brief Encode the group in to its place within the packet's footprint
+     *
+     * @param[in] dest Address of the first byte of the packet's footprint
+     * @param[in] packet Source packet
+     */
+    static void Do(uint8_t* dest, PacketT const& packet) noexcept
+    {
+        uint64_t const kMask {bits_word_mask(kGroupSizeBits) << kShiftBits};
+        uint64_t const kValue {Pack(packet, std::integral_constant<size_t, BeginV> {})};
+
+        uint8_t*       word_dest {dest + (Head::kOffsetBits / math::bits_to_contain(1U))};
+        uint64_t const kWord {load_bits_word(word_dest, kWordSizeBytes)};
+        store_bits_word(word_dest, ((kWord & ~kMask) | kValue), kWordSizeBytes);
+    }
+};
+
+/**
+ * @brief Decodes a group of bit-packed fields. The group's footprint is loaded in to a single working word, from which
+ * every value is extracted in register.
+ *
+ * @note ConstBitFields within the group can't be reassigned and are skipped
+ *
+ * @tparam BeginV Start of the group
+ * @tparam EndV One past the end of the group
+ * @tparam PacketT Packet specialization
+ */
+template<size_t BeginV, size_t EndV, typename PacketT>
+struct decode_packet_bit_group
+{
+private:
+    using Head = packet_field_layout<BeginV, PacketT>;
+    using Tail = packet_field_layout<(EndV - 1U), PacketT>;
+
+    constexpr static size_t kShiftBits {Head::kOffsetBits % math::bits_to_contain(1U)};
+    constexpr static size_t kGroupSizeBits {Tail::kOffsetBits + Tail::kSizeBits - Head::kOffsetBits};
+    constexpr static size_t kWordSizeBytes {math::bytes_to_contain(kShiftBits + kGroupSizeBits)};
+
+    template<size_t SizeBitsV>
+    static void Unpack(uint64_t word, BitField<SizeBitsV>& bitfield) noexcept
+    {
+        using value_type = typename BitField<SizeBitsV>::value_type;
+        bitfield.value   = static_cast<value_type>(word & bits_word_mask(SizeBitsV));
+    }
+
+    template<size_t SizeBitsV>
+    static void Unpack(uint64_t word, ConstBitField<SizeBitsV>& bitfield) noexcept
+    {
+        static_cast<void>(word);     // Avoid unused warning
+        static_cast<void>(bitfield); // Avoid unused warning
+    }
+
+    template<size_t IndexV>
+    static void UnpackAll(uint64_t word, PacketT& packet, std::integral_constant<size_t, IndexV>) noexcept
+    {
+        using Layout = packet_field_layout<IndexV, PacketT>;
+
+        Unpack((word >> (kShiftBits + Layout::kOffsetBits - Head::kOffsetBits)), PacketAccess::Get<IndexV>(packet));
+        UnpackAll(word, packet, std::integral_constant<size_t, (IndexV + 1U)> {});
+    }
+
+    static void UnpackAll(uint64_t word, PacketT& packet, std::integral_constant<size_t, EndV>) noexcept
+    {
+        static_cast<void>(word);   // Avoid unused warning
+        static_cast<void>(packet); // Avoid unused warning
+    }
+
+public:
+    /**
+     * @brief Decode the group from its place within the packet's footprint
+     *
+     * @param[in] src Address of the first byte of the packet's footprint
+     * @param[out] packet Decoding destination
+     */
+    static void Do(uint8_t const* src, PacketT& packet) noexcept
+    {
+        uint64_t const kWord {load_bits_word((src + (Head::kOffsetBits / math::bits_to_contain(1U))), kWordSizeBytes)};
+        UnpackAll(kWord, packet, std::integral_constant<size_t, BeginV> {});
+    }
+};
+
+/**
+ * @brief Encodes a run of coalescable fields. If the fields are also contiguous in memory the entire run is moved with
+ * a single copy, otherwise the head of the run is encoded on its own and the remainder is tried again.
  *
- * @tparam T Value type of the Field, cv and reference qualifiers are removed
- * @param[in] aggregate Value to add the Field's size to
- * @param[in] field Field instance
- * @retval Aggregated size of the Field
+ * @tparam BeginV Start of the run
+ * @tparam EndV One past the end of the run
+ * @tparam PacketT Packet specialization
+ * @tparam SingleV Whether the run contains exactly one field
  */
-template<typename T>
-constexpr static size_t add_field_size_bits(size_t aggregate, Field<T> field)
+template<size_t BeginV, size_t EndV, typename PacketT, bool SingleV>
+struct encode_packet_field_run
 {
-    size_t const kAggregateBytes {math::bytes_to_contain(aggregate)};
-    return math::bits_to_contain(kAggregateBytes) + Field<T>::kSizeBits;
-}
+private:
+    using Head = packet_field_layout<BeginV, PacketT>;
+    using Tail = packet_field_layout<(EndV - 1U), PacketT>;
 
-/**!
- * @brief Adds the size of a BitField's stored value in bits
- *
- * @tparam SizeBitsV Size of the stored value in bits
- * @param[in] aggregate Value to add the Field's size to
- * @param[in] field Field instance
- * @retval Aggregated size of the Field
- */
-template<size_t SizeBitsV>
-constexpr static size_t add_field_size_bits(size_t aggregate, BitField<SizeBitsV> field)
-{
-    return aggregate + BitField<SizeBitsV>::kSizeBits;
-}
+    constexpr static size_t kRunSizeBytes {
+        math::bytes_to_contain(Tail::kOffsetBits + Tail::kSizeBits - Head::kOffsetBits)};
 
-/**!
- * @brief Adds the size of a ConstBitField's stored value type in bits
- *
- * @tparam SizeBitsV Size of the stored value in bits
- * @param[in] aggregate Value to add the Field's size to
- * @param[in] field Field instance
- * @retval Aggregated size of the Field
- */
-template<size_t SizeBitsV>
-constexpr static size_t add_field_size_bits(size_t aggregate, ConstBitField<SizeBitsV> field)
-{
-    return aggregate + ConstBitField<SizeBitsV>::kSizeBits;
-}
+public:
+    /**
+     * @brief Check whether the stored values of the run are laid out back to back in memory
+     *
+     * @note Layout of the storage is fixed for the type, so this resolves to a constant when optimized
+     *
+     * @param[in] packet Packet holding the run
+     * @retval true if the run can be copied as a single block
+     * @retval false otherwise
+     */
+    static bool IsContiguous(PacketT const& packet) noexcept
+    {
+        uint8_t const* head {reinterpret_cast<uint8_t const*>(&PacketAccess::Get<BeginV>(packet).value)};
+        uint8_t const* next {reinterpret_cast<uint8_t const*>(&PacketAccess::Get<(BeginV + 1U)>(packet).value)};
+        return ((head + math::bytes_to_contain(Head::kSizeBits)) == next) &&
+               encode_packet_field_run<(BeginV + 1U), EndV, PacketT>::IsContiguous(packet);
+    }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-// Namespace metafunction definitions               ////////////////////////////////////////////////////////////////////
-////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /**
+     * @brief Encode the run in to its place within the packet's footprint
+     *
+     * @param[in] dest Address of the first byte of the packet's footprint
+     * @param[in] packet Source packet
+     */
+    static void Do(uint8_t* dest, PacketT const& packet) noexcept
+    {
+        if (IsContiguous(packet))
+        {
+            uint8_t const* src {reinterpret_cast<uint8_t const*>(&PacketAccess::Get<BeginV>(packet).value)};
+            static_cast<void>(std::memcpy((dest + math::bytes_to_contain(Head::kOffsetBits)), src, kRunSizeBytes));
+            return;
+        }
 
-/**!
- * @brief Checks if type is a Packet specialization
+        encode_field_at(PacketAccess::Get<BeginV>(packet), dest, Head::kOffsetBits);
+        encode_packet_field_run<(BeginV + 1U), EndV, PacketT>::Do(dest, packet);
+    }
+};
+
+/**
+ * @brief Base case for encoding a run of fields; the run holds a single field
  *
- * @tparam T Potential Packet type
+ * @tparam BeginV Position of the field
+ * @tparam EndV One past the position of the field
+ * @tparam PacketT Packet specialization
  */
-template<typename T>
-using is_packet = typename std::is_base_of<_detail::PacketBase, T>::type;
+template<size_t BeginV, size_t EndV, typename PacketT>
+struct encode_packet_field_run<BeginV, EndV, PacketT, true>
+{
+    /**
+     * @brief A single field is always contiguous with itself
+     *
+     * @param[in] packet Unused
+     * @retval true
+     */
+    static bool IsContiguous(PacketT const& packet) noexcept
+    {
+        static_cast<void>(packet); // Avoid unused warning
+        return true;
+    }
 
-/**!
- * @brief Accumulates the size of fields held by a packet
+    /**
+     * @brief Encode the field in to its place within the packet's footprint
+     *
+     * @param[in] dest Address of the first byte of the packet's footprint
+     * @param[in] packet Source packet
+     */
+    static void Do(uint8_t* dest, PacketT const& packet) noexcept
+    {
+        encode_field_at(PacketAccess::Get<BeginV>(packet), dest, packet_field_layout<BeginV, PacketT>::kOffsetBits);
+    }
+};
+
+/**
+ * @brief Decodes a run of coalescable fields. If the fields are also contiguous in memory the entire run is moved with
+ * a single copy, otherwise the head of the run is decoded on its own and the remainder is tried again.
  *
- * @tparam IndexV Current field position
- * @tparam EndV Endpoint for recursion
+ * @tparam BeginV Start of the run
+ * @tparam EndV One past the end of the run
  * @tparam PacketT Packet specialization
+ * @tparam SingleV Whether the run contains exactly one field
  */
-template<size_t IndexV, size_t EndV, typename PacketT>
-struct accumulate_packet_field_size_bits_recursive
+template<size_t BeginV, size_t EndV, typename PacketT, bool SingleV>
+struct decode_packet_field_run
 {
-    static_assert(is_packet<PacketT>::value, "`PacketT` must be a `shmit::data::Packet` specialization");
-    static_assert((IndexV < PacketT::kNumFields), "`IndexV` must be within `PacketT` field count");
-    static_assert(IndexV < EndV, "`IndexV` must be within `EndV` bounds");
-
 private:
-    using FieldPack = typename PacketT::Fields;
-    using Field     = typename std::tuple_element<IndexV, FieldPack>::type;
+    using Head = packet_field_layout<BeginV, PacketT>;
+    using Tail = packet_field_layout<(EndV - 1U), PacketT>;
+
+    constexpr static size_t kRunSizeBytes {
+        math::bytes_to_contain(Tail::kOffsetBits + Tail::kSizeBits - Head::kOffsetBits)};
 
 public:
     /**
-     * @brief Accumulate size of current field position
+     * @brief Decode the run from its place within the packet's footprint
      *
-     * @param[in] aggregate Starting value
-     * @retval Accumulated value
+     * @param[in] src Address of the first byte of the packet's footprint
+     * @param[out] packet Decoding destination
      */
-    constexpr static size_t Do(size_t aggregate)
+    static void Do(uint8_t const* src, PacketT& packet) noexcept
     {
-        aggregate = add_field_size_bits(aggregate, Field {});
-        return accumulate_packet_field_size_bits_recursive<IndexV + 1, EndV, PacketT>::Do(aggregate);
+        if (encode_packet_field_run<BeginV, EndV, PacketT>::IsContiguous(packet))
+        {
+            uint8_t* dest {reinterpret_cast<uint8_t*>(&PacketAccess::Get<BeginV>(packet).value)};
+            static_cast<void>(std::memcpy(dest, (src + math::bytes_to_contain(Head::kOffsetBits)), kRunSizeBytes));
+            return;
+        }
+
+        decode_field_at(src, Head::kOffsetBits, PacketAccess::Get<BeginV>(packet));
+        decode_packet_field_run<(BeginV + 1U), EndV, PacketT>::Do(src, packet);
     }
 };
 
-/**!
- * @brief Base case for recursive accumulation of Packet field size; `IndexV == EndV`
+/**
+ * @brief Base case for decoding a run of fields; the run holds a single field
  *
- * @tparam IndexV Index of field to accumulate size for, reached endpoint
+ * @tparam BeginV Position of the field
+ * @tparam EndV One past the position of the field
  * @tparam PacketT Packet specialization
  */
-template<size_t IndexV, typename PacketT>
-struct accumulate_packet_field_size_bits_recursive<IndexV, IndexV, PacketT>
+template<size_t BeginV, size_t EndV, typename PacketT>
+struct decode_packet_field_run<BeginV, EndV, PacketT, true>
 {
     /**
-     * @brief At end of packet, do nothing
+     * @brief Decode the field from its place within the packet's footprint
      *
-     * @param[in] aggregate Unused
-     * @retval aggregate
+     * @param[in] src Address of the first byte of the packet's footprint
+     * @param[out] packet Decoding destination
      */
-    constexpr static size_t Do(size_t aggregate)
+    static void Do(uint8_t const* src, PacketT& packet) noexcept
     {
-        return aggregate;
+        decode_field_at(src, packet_field_layout<BeginV, PacketT>::kOffsetBits, PacketAccess::Get<BeginV>(packet));
     }
 };
 
 /**
- * @brief Sequentially encodes the fields held by a packet in to a byte buffer
+ * @brief Sequentially encodes the fields held by a packet in to their fixed positions within a byte buffer
+ *
+ * @note No bounds checking is performed, the caller must guarantee that the entire footprint of the packet fits
  *
  * @tparam IndexV Current field position
  * @tparam EndV Endpoint for recursion
@@ -148,27 +1055,23 @@ struct encode_packet_fields_recursive
     static_assert(IndexV < EndV, "`IndexV` must be within `EndV` bounds");
 
 private:
-    using FieldPack = typename PacketT::Fields;
+    constexpr static size_t kRunEndV {packet_field_run_end<IndexV, EndV, PacketT>::value};
 
 public:
     /**
-     * @brief Encode value at current field position in to byte buffer
+     * @brief Encode the run of fields starting at the current field position in to their place within the packet's
+     * footprint
      *
-     * @param[in] buffer Encoding destination
-     * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start
-     * from. Updated to the tail byte boundary of the object's encoded footprint on success.
-     * @param[in] data Source packet fields pack (tuple specialization)
-     * @retval BinaryResult::kSuccessCode if successful
-     * @retval BinaryResult::kFailureCode otherwise
+     * @param[in] dest Address of the first byte of the packet's footprint
+     * @param[in] packet Source packet
      */
-    static BinaryResult Do(Span<uint8_t> buffer, size_t& offset_bits, FieldPack const& data)
+    static void Do(uint8_t* dest, PacketT const& packet) noexcept
     {
-        auto&        field {std::get<IndexV>(data)};
-        BinaryResult result {encode(field, buffer, offset_bits)};
-        if (result.IsFailure())
-            return result;
-
-        return encode_packet_fields_recursive<(IndexV + 1U), EndV, PacketT>::Do(buffer, offset_bits, data);
+        using Run = std::conditional_t<is_packet_bit_group<IndexV, kRunEndV, PacketT>::value,
+                                       encode_packet_bit_group<IndexV, kRunEndV, PacketT>,
+                                       encode_packet_field_run<IndexV, kRunEndV, PacketT>>;
+        Run::Do(dest, packet);
+        encode_packet_fields_recursive<kRunEndV, EndV, PacketT>::Do(dest, packet);
     }
 };
 
@@ -181,30 +1084,23 @@ public:
 template<size_t IndexV, typename PacketT>
 struct encode_packet_fields_recursive<IndexV, IndexV, PacketT>
 {
-private:
-    using FieldPack = typename PacketT::Fields;
-
-public:
     /**
      * @brief At end of packet, do nothing
      *
-     * @param[in] buffer Encoding destination
-     * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start
-     * from. Updated to the tail byte boundary of the object's encoded footprint on success.
-     * @param[out] data Source packet fields pack (tuple specialization)
-     * @retval BinaryResult::kSuccessCode
+     * @param[in] dest Unused
+     * @param[in] packet Unused
      */
-    static BinaryResult Do(Span<uint8_t> buffer, size_t& offset_bits, FieldPack const& data)
+    static void Do(uint8_t* dest, PacketT const& packet) noexcept
     {
-        static_cast<void>(buffer);      // Avoid unused warning
-        static_cast<void>(offset_bits); // Avoid unused warning
-        static_cast<void>(data);        // Avoid unused warning
-        return BinaryResult::Success();
+        static_cast<void>(dest);   // Avoid unused warning
+        static_cast<void>(packet); // Avoid unused warning
     }
 };
 
 /**
- * @brief Sequentially decodes the fields held by a packet from a byte buffer
+ * @brief Sequentially decodes the fields held by a packet from their fixed positions within a byte buffer
+ *
+ * @note No bounds checking is performed, the caller must guarantee that the entire footprint of the packet fits
  *
  * @tparam IndexV Current field position
  * @tparam EndV Endpoint for recursion
@@ -218,27 +1114,23 @@ struct decode_packet_fields_recursive
     static_assert(IndexV < EndV, "`IndexV` must be within `EndV` bounds");
 
 private:
-    using FieldPack = typename PacketT::Fields;
+    constexpr static size_t kRunEndV {packet_field_run_end<IndexV, EndV, PacketT>::value};
 
 public:
     /**
-     * @brief Decode value from a byte buffer in to the current field position
+     * @brief Decode the run of fields starting at the current field position from their place within the packet's
+     * footprint
      *
-     * @param[in] buffer Data source
-     * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
-     * Updated to include the size, in bits, of the decoded space on success.
-     * @param[out] data Decoding destination, Packet fields pack (tuple specialization)
-     * @retval BinaryResult::kSuccessCode if successful
-     * @retval BinaryResult::kFailureCode otherwise
+     * @param[in] src Address of the first byte of the packet's footprint
+     * @param[out] packet Decoding destination
      */
-    static BinaryResult Do(Span<uint8_t const> buffer, size_t& offset_bits, FieldPack& data)
+    static void Do(uint8_t const* src, PacketT& packet) noexcept
     {
-        auto&        field {std::get<IndexV>(data)};
-        BinaryResult result {decode(buffer, offset_bits, field)};
-        if (result.IsFailure())
-            return result;
-
-        return decode_packet_fields_recursive<(IndexV + 1U), EndV, PacketT>::Do(buffer, offset_bits, data);
+        using Run = std::conditional_t<is_packet_bit_group<IndexV, kRunEndV, PacketT>::value,
+                                       decode_packet_bit_group<IndexV, kRunEndV, PacketT>,
+                                       decode_packet_field_run<IndexV, kRunEndV, PacketT>>;
+        Run::Do(src, packet);
+        decode_packet_fields_recursive<kRunEndV, EndV, PacketT>::Do(src, packet);
     }
 };
 
@@ -251,26 +1143,16 @@ public:
 template<size_t IndexV, typename PacketT>
 struct decode_packet_fields_recursive<IndexV, IndexV, PacketT>
 {
-private:
-    using FieldPack = typename PacketT::Fields;
-
-public:
     /**
      * @brief At end of packet, do nothing
      *
-     * @param[in] buffer Data source
-     * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
-     * Updated to include the size, in bits, of the decoded space on success.
-     * @param[out] packet Decoding destination, reference to Packet instance
-     * @retval BinaryResult::kSuccessCode
+     * @param[in] src Unused
+     * @param[out] packet Unused
      */
-    static BinaryResult Do(Span<uint8_t const> buffer, size_t& offset_bits, FieldPack& data)
+    static void Do(uint8_t const* src, PacketT& packet) noexcept
     {
-        // At end of packet, do nothing
-        static_cast<void>(buffer);      // Avoid unused warning
-        static_cast<void>(offset_bits); // Avoid unused warning
-        static_cast<void>(data);        // Avoid unused warning
-        return BinaryResult::Success();
+        static_cast<void>(src);    // Avoid unused warning
+        static_cast<void>(packet); // Avoid unused warning
     }
 };
 
@@ -316,6 +1198,340 @@ public:
     constexpr static size_t value {math::next_boundary_bit_pos(kAccumulatedFieldsSizeBits)};
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Streaming function definitions               ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+// Packets holding a variable-size field can't place their fields at fixed offsets. Their fields are instead encoded one
+// after the other, each starting where the previous one ended, following the same alignment rules as the fixed
+// placement.
+
+/**!
+ * @brief Decodes a fixed-size field from a running position, checking that it fits the source
+ *
+ * @tparam FieldT Field type
+ * @param[in] src Address of the first byte of the packet's encoding
+ * @param[in] size_bytes Number of bytes readable from the source
+ * @param[inout] offset_bits Position the field may start from, updated to the end of the field
+ * @param[out] field Decoding destination
+ * @retval true if the field was decoded
+ * @retval false if the source ends before the field does
+ */
+template<typename FieldT>
+static bool decode_field_streaming(uint8_t const* src, size_t size_bytes, size_t& offset_bits, FieldT& field) noexcept
+{
+    size_t const kEndBits {add_field_size_bits(offset_bits, FieldT {})};
+    if (kEndBits > math::bits_to_contain(size_bytes))
+        return false;
+
+    decode_field_at(src, offset_bits, field);
+    offset_bits = kEndBits;
+    return true;
+}
+
+/**!
+ * @brief Decodes an ArrayField from a running position, checking that it fits the source. The field's value points in
+ * to the source.
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] src Address of the first byte of the packet's encoding
+ * @param[in] size_bytes Number of bytes readable from the source
+ * @param[inout] offset_bits Position the field may start from, updated to the end of the field
+ * @param[out] field Decoding destination
+ * @retval true if the field was decoded
+ * @retval false if the source ends before the field does, or the count or alignment of the elements is invalid
+ */
+template<typename T, size_t MaxCountV>
+static bool decode_field_streaming(uint8_t const* src, size_t size_bytes, size_t& offset_bits,
+                                   ArrayField<T, MaxCountV>& field) noexcept
+{
+    return decode(Span<uint8_t const> {src, size_bytes}, offset_bits, field).IsSuccess();
+}
+
+/**!
+ * @brief Decodes a VarField from a running position, checking that it fits the source
+ *
+ * @tparam T Value type of the VarField
+ * @param[in] src Address of the first byte of the packet's encoding
+ * @param[in] size_bytes Number of bytes readable from the source
+ * @param[inout] offset_bits Position the field may start from, updated to the end of the field
+ * @param[out] field Decoding destination
+ * @retval true if the field was decoded
+ * @retval false if the source ends before the field does, or the value is malformed
+ */
+template<typename T>
+static bool decode_field_streaming(uint8_t const* src, size_t size_bytes, size_t& offset_bits,
+                                   VarField<T>& field) noexcept
+{
+    return decode(Span<uint8_t const> {src, size_bytes}, offset_bits, field).IsSuccess();
+}
+
+/**!
+ * @brief Encodes a fixed-size field at a running position
+ *
+ * @tparam FieldT Field type
+ * @param[in] field Field to encode
+ * @param[in] dest Address of the first byte of the packet's encoding
+ * @param[in] offset_bits Position the field may start from
+ * @return Position of the end of the field
+ */
+template<typename FieldT>
+static size_t encode_field_streaming(FieldT const& field, uint8_t* dest, size_t offset_bits) noexcept
+{
+    encode_field_at(field, dest, offset_bits);
+    return add_field_size_bits(offset_bits, FieldT {});
+}
+
+/**!
+ * @brief Encodes an ArrayField at a running position, taking only as many bytes as its occupied elements need
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] field ArrayField to encode, holding no more than MaxCountV elements
+ * @param[in] dest Address of the first byte of the packet's encoding
+ * @param[in] offset_bits Position the field may start from
+ * @return Position of the end of the field
+ */
+template<typename T, size_t MaxCountV>
+static size_t encode_field_streaming(ArrayField<T, MaxCountV> const& field, uint8_t* dest, size_t offset_bits) noexcept
+{
+    // Capacity was checked for the whole packet, the span only has to reach the end of the field
+    Span<uint8_t> const kDest {dest, (math::bytes_to_contain(offset_bits) + encoded_size_bytes(field))};
+    static_cast<void>(encode(field, kDest, offset_bits));
+    return offset_bits;
+}
+
+/**!
+ * @brief Encodes a VarField at a running position, taking only as many bytes as its value needs
+ *
+ * @tparam T Value type of the VarField
+ * @param[in] field VarField to encode
+ * @param[in] dest Address of the first byte of the packet's encoding
+ * @param[in] offset_bits Position the field may start from
+ * @return Position of the end of the field
+ */
+template<typename T>
+static size_t encode_field_streaming(VarField<T> const& field, uint8_t* dest, size_t offset_bits) noexcept
+{
+    size_t const kStartBytes {math::bytes_to_contain(offset_bits)};
+    return math::bits_to_contain(kStartBytes + encode_varint((dest + kStartBytes), to_varint(field.value)));
+}
+
+/**!
+ * @brief Decodes every field of a packet holding variable-size fields, one after the other
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexV Field positions
+ * @param[in] src Address of the first byte of the packet's encoding
+ * @param[in] size_bytes Number of bytes readable from the source
+ * @param[out] packet Decoding destination, fields before a failure are overwritten
+ * @param[out] size_bits Size of the packet's encoding, padded to a byte boundary
+ * @retval true if every field was decoded
+ * @retval false if the source ends early or holds a malformed variable-size field
+ */
+template<typename PacketT, size_t... IndexV>
+static bool decode_packet_fields_streaming(uint8_t const* src, size_t size_bytes, PacketT& packet, size_t& size_bits,
+                                           std::index_sequence<IndexV...>) noexcept
+{
+    size_t     offset_bits {0U};
+    bool const kDecoded {(decode_field_streaming(src, size_bytes, offset_bits, PacketAccess::Get<IndexV>(packet)) &&
+                          ...)};
+
+    size_bits = math::next_boundary_bit_pos(offset_bits);
+    return kDecoded;
+}
+
+/**!
+ * @brief Encodes every field of a packet holding variable-size fields, one after the other
+ *
+ * @note No bounds checking is performed, the destination must hold streaming_packet_size_bits of the packet
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexV Field positions
+ * @param[in] dest Address of the first byte of the packet's encoding
+ * @param[in] packet Source packet
+ * @return Size of the packet's encoding, padded to a byte boundary
+ */
+template<typename PacketT, size_t... IndexV>
+static size_t encode_packet_fields_streaming(uint8_t* dest, PacketT const& packet,
+                                             std::index_sequence<IndexV...>) noexcept
+{
+    size_t offset_bits {0U};
+    static_cast<void>(((offset_bits = encode_field_streaming(PacketAccess::Get<IndexV>(packet), dest, offset_bits)),
+                       ...));
+    return math::next_boundary_bit_pos(offset_bits);
+}
+
+/**!
+ * @brief Adds the size of a fixed-size field at a running position
+ *
+ * @tparam FieldT Field type
+ * @param[in] aggregate Position the field may start from
+ * @param[in] field Field instance
+ * @return Position of the end of the field
+ */
+template<typename FieldT>
+static size_t add_field_streaming_size_bits(size_t aggregate, FieldT const& field) noexcept
+{
+    static_cast<void>(field); // Avoid unused warning
+    return add_field_size_bits(aggregate, FieldT {});
+}
+
+/**!
+ * @brief Adds the encoded size of an ArrayField's count and occupied elements at a running position
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] aggregate Position the field may start from
+ * @param[in] field ArrayField instance
+ * @return Position of the end of the field
+ */
+template<typename T, size_t MaxCountV>
+static size_t add_field_streaming_size_bits(size_t aggregate, ArrayField<T, MaxCountV> const& field) noexcept
+{
+    return math::bits_to_contain(math::bytes_to_contain(aggregate) + encoded_size_bytes(field));
+}
+
+/**!
+ * @brief Adds the encoded size of a VarField's value at a running position
+ *
+ * @tparam T Value type of the VarField
+ * @param[in] aggregate Position the field may start from
+ * @param[in] field VarField instance
+ * @return Position of the end of the field
+ */
+template<typename T>
+static size_t add_field_streaming_size_bits(size_t aggregate, VarField<T> const& field) noexcept
+{
+    return math::bits_to_contain(math::bytes_to_contain(aggregate) + encoded_size_bytes(field));
+}
+
+/**!
+ * @brief Checks that a fixed-size field can be encoded, which it always can
+ *
+ * @tparam FieldT Field type
+ * @param[in] field Unused
+ * @retval true
+ */
+template<typename FieldT>
+static bool is_field_streamable(FieldT const& field) noexcept
+{
+    static_cast<void>(field); // Avoid unused warning
+    return true;
+}
+
+/**!
+ * @brief Checks that an ArrayField holds no more elements than it may encode
+ *
+ * @tparam T Element type
+ * @tparam MaxCountV Largest number of elements
+ * @param[in] field ArrayField to check
+ * @retval true if the field holds no more than MaxCountV elements
+ * @retval false otherwise
+ */
+template<typename T, size_t MaxCountV>
+static bool is_field_streamable(ArrayField<T, MaxCountV> const& field) noexcept
+{
+    return (field.value.count() <= MaxCountV);
+}
+
+/**!
+ * @brief Checks that every field of a packet holding variable-size fields can be encoded
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexV Field positions
+ * @param[in] packet Packet to check
+ * @retval true if every field can be encoded
+ * @retval false if an ArrayField holds too many elements
+ */
+template<typename PacketT, size_t... IndexV>
+static bool is_packet_streamable(PacketT const& packet, std::index_sequence<IndexV...>) noexcept
+{
+    return (is_field_streamable(PacketAccess::Get<IndexV>(packet)) && ...);
+}
+
+/**!
+ * @brief Size that a packet holding variable-size fields takes when encoded, given the values it currently holds
+ *
+ * @tparam PacketT Packet specialization
+ * @tparam IndexV Field positions
+ * @param[in] packet Packet to measure
+ * @return Size of the packet's encoding, padded to a byte boundary
+ */
+template<typename PacketT, size_t... IndexV>
+static size_t streaming_packet_size_bits(PacketT const& packet, std::index_sequence<IndexV...>) noexcept
+{
+    size_t size_bits {0U};
+    static_cast<void>(((size_bits = add_field_streaming_size_bits(size_bits, PacketAccess::Get<IndexV>(packet))), ...));
+    return math::next_boundary_bit_pos(size_bits);
+}
+
+/**!
+ * @brief Decodes a packet holding variable-size fields, see decode
+ *
+ * @tparam PacketT Packet specialization
+ * @param[in] buffer Data source
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the source that decoding may start from.
+ * Updated to the tail byte boundary of the packet's encoding on success.
+ * @param[out] packet Decoding destination, fields ahead of a failure may have been overwritten
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if the buffer ends early or holds a malformed variable-size field
+ */
+template<typename PacketT>
+static BinaryResult decode_packet_streaming(Span<uint8_t const> buffer, size_t& offset_bits, PacketT& packet) noexcept
+{
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+    if (kDataStartOffsetBytes > buffer.size())
+        return BinaryResult::Failure();
+
+    // Fields can only be bounds checked one at a time, as their positions come to light
+    size_t size_bits {0U};
+    uint8_t const* src {buffer.data() + kDataStartOffsetBytes};
+    if (!decode_packet_fields_streaming(src, (buffer.size() - kDataStartOffsetBytes), packet, size_bits,
+                                        std::make_index_sequence<PacketT::kNumFields> {}))
+        return BinaryResult::Failure();
+
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes) + size_bits;
+    return BinaryResult::Success();
+}
+
+/**!
+ * @brief Encodes a packet holding variable-size fields, see encode
+ *
+ * @tparam PacketT Packet specialization
+ * @param[in] packet Packet to encode
+ * @param[in] buffer Encoding destination
+ * @param[inout] offset_bits Minimum offset, in bits, from beginning of the destination that encoding may start
+ * from. Updated to the tail byte boundary of the packet's encoding on success.
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode if an ArrayField holds too many elements or the buffer cannot hold the packet's
+ * encoding, nothing is written
+ */
+template<typename PacketT>
+static BinaryResult encode_packet_streaming(PacketT const& packet, Span<uint8_t> buffer, size_t& offset_bits) noexcept
+{
+    constexpr std::make_index_sequence<PacketT::kNumFields> kIndices {};
+
+    // Determine start offset, must be on byte boundary
+    size_t const kDataStartOffsetBytes {math::bytes_to_contain(offset_bits)};
+
+    // ArrayFields holding more elements than they may encode can't be placed at all
+    if (!is_packet_streamable(packet, kIndices))
+        return BinaryResult::Failure();
+
+    // Measure the packet first so that a single capacity check covers every field
+    size_t const kSizeBits {streaming_packet_size_bits(packet, kIndices)};
+    if ((kDataStartOffsetBytes + math::bytes_to_contain(kSizeBits)) > buffer.size())
+        return BinaryResult::Failure();
+
+    static_cast<void>(encode_packet_fields_streaming((buffer.data() + kDataStartOffsetBytes), packet, kIndices));
+
+    offset_bits = math::bits_to_contain(kDataStartOffsetBytes) + kSizeBits;
+    return BinaryResult::Success();
+}
+
 } // namespace _detail
 } // namespace data
 } // namespace shmit
\ No newline at end of file
@@ -0,0 +1,99 @@
+#pragma once
+
+#include "Core/Data/Field.hpp"
+#include "Core/Data/_Detail/Packet.hpp"
+#include "Core/Math/Memory.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <cstring>
+#include <type_traits>
+
+namespace shmit
+{
+namespace data
+{
+namespace _detail
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions               ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Reads the value of a Field from its fixed, byte-aligned position within a packet's footprint
+ *
+ * @tparam T Value type of the Field
+ * @tparam OrderV Byte order of the encoded value
+ * @param[in] src Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the field, in bits, from the beginning of the footprint
+ * @param[in] tag Field type selector
+ * @return Decoded value
+ */
+template<typename T, ByteOrder OrderV>
+static typename Field<T, OrderV>::value_type read_field_at(uint8_t const* src, size_t offset_bits,
+                                                           Field<T, OrderV> const* tag) noexcept
+{
+    static_cast<void>(tag); // Avoid unused warning
+
+    Field<T, OrderV> field {};
+    decode_field_at(src, offset_bits, field);
+    return field.value;
+}
+
+/**!
+ * @brief Reads the value of a BitField from its fixed bit position within a packet's footprint
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] src Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the field, in bits, from the beginning of the footprint
+ * @param[in] tag Field type selector
+ * @return Decoded value
+ */
+template<size_t SizeBitsV>
+static typename BitField<SizeBitsV>::value_type read_field_at(uint8_t const* src, size_t offset_bits,
+                                                              BitField<SizeBitsV> const* tag) noexcept
+{
+    static_cast<void>(tag); // Avoid unused warning
+
+    BitField<SizeBitsV> bitfield {};
+    decode_field_at(src, offset_bits, bitfield);
+    return bitfield.value;
+}
+
+/**!
+ * @brief Reads the value of a ConstBitField from its fixed bit position within a packet's footprint. Unlike decoding
+ * in to a Packet, the encoded bits are returned as they are found.
+ *
+ * @tparam SizeBitsV Size of the stored value in bits
+ * @param[in] src Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the field, in bits, from the beginning of the footprint
+ * @param[in] tag Field type selector
+ * @return Decoded value
+ */
+template<size_t SizeBitsV>
+static typename BitField<SizeBitsV>::value_type read_field_at(uint8_t const* src, size_t offset_bits,
+                                                              ConstBitField<SizeBitsV> const* tag) noexcept
+{
+    static_cast<void>(tag); // Avoid unused warning
+    return read_field_at(src, offset_bits, static_cast<BitField<SizeBitsV> const*>(nullptr));
+}
+
+/**!
+ * @brief Writes the value of a field in to its fixed position within a packet's footprint, leaving every other field
+ * untouched
+ *
+ * @tparam FieldT Field type
+ * @param[in] dest Address of the first byte of the packet's footprint
+ * @param[in] offset_bits Offset of the field, in bits, from the beginning of the footprint
+ * @param[in] value Value to encode
+ */
+template<typename FieldT>
+static void write_field_at(uint8_t* dest, size_t offset_bits, typename FieldT::value_type const& value) noexcept
+{
+    FieldT const field {value};
+    encode_field_at(field, dest, offset_bits);
+}
+
+} // namespace _detail
+} // namespace data
+} // namespace shmit
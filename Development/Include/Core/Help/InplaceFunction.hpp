@@ -0,0 +1,199 @@
+#pragma once
+
+#include "Core/StdTypes.hpp"
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace shmit
+{
+namespace help
+{
+
+/**!
+ * @brief Fixed-capacity, non-allocating stand-in for std::function. Forms the specialization below.
+ *
+ * @tparam SignatureT Function signature, as in `bool(void)`
+ * @tparam CapacityBytesV Largest callable that may be stored, in bytes
+ */
+template<typename SignatureT, size_t CapacityBytesV>
+class InplaceFunction;
+
+/**!
+ * @brief Type-erased callable that is always stored within the object itself, so that it never touches the heap.
+ * Callables larger than the capacity, or more strictly aligned than std::max_align_t, are rejected at compile time.
+ *
+ * @tparam ReturnT Return type
+ * @tparam ArgT Argument types
+ * @tparam CapacityBytesV Largest callable that may be stored, in bytes
+ */
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+class InplaceFunction<ReturnT(ArgT...), CapacityBytesV>
+{
+public:
+    /// @brief Largest callable that may be stored, in bytes
+    constexpr static size_t kCapacityBytes {CapacityBytesV};
+
+    /// @brief Constructs an empty InplaceFunction
+    InplaceFunction() noexcept = default;
+
+    /**!
+     * @brief Stores a copy of a callable
+     *
+     * @tparam CallableT Callable type, must fit within kCapacityBytes
+     * @param[in] callable Callable to store
+     */
+    template<typename CallableT,
+             typename = std::enable_if_t<!std::is_same<std::decay_t<CallableT>, InplaceFunction>::value>>
+    InplaceFunction(CallableT&& callable) noexcept;
+
+    InplaceFunction(InplaceFunction const& copy) noexcept;
+
+    ~InplaceFunction() noexcept;
+
+    InplaceFunction& operator=(InplaceFunction const& copy) noexcept;
+
+    /**!
+     * @brief Invokes the stored callable
+     *
+     * @note Invoking an empty InplaceFunction does nothing and returns a value-initialized ReturnT
+     *
+     * @param[in] args Arguments forwarded to the callable
+     * @return Value returned by the callable
+     */
+    ReturnT operator()(ArgT... args) const;
+
+    /// @brief Checks if a callable is stored
+    explicit operator bool() const noexcept;
+
+private:
+    /// @brief Per-callable-type operations, one static instance for each type stored
+    struct Operations
+    {
+        ReturnT (*invoke)(void* callable, ArgT... args);
+        void (*copy)(void* dest, void const* src);
+        void (*destroy)(void* callable);
+    };
+
+    template<typename CallableT>
+    static ReturnT InvokeCallable(void* callable, ArgT... args);
+
+    template<typename CallableT>
+    static void CopyCallable(void* dest, void const* src);
+
+    template<typename CallableT>
+    static void DestroyCallable(void* callable);
+
+    template<typename CallableT>
+    constexpr static Operations kOperations {&InvokeCallable<CallableT>, &CopyCallable<CallableT>,
+                                             &DestroyCallable<CallableT>};
+
+    alignas(std::max_align_t) unsigned char m_storage[CapacityBytesV];
+    Operations const* m_operations {nullptr};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  InplaceFunction constructor definitions             ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+template<typename CallableT, typename>
+InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::InplaceFunction(CallableT&& callable) noexcept
+{
+    using StoredT = std::decay_t<CallableT>;
+
+    static_assert(sizeof(StoredT) <= CapacityBytesV, "Callable does not fit within the InplaceFunction's capacity");
+    static_assert(alignof(StoredT) <= alignof(std::max_align_t), "Callable is too strictly aligned");
+    static_assert(std::is_copy_constructible<StoredT>::value, "Callable must be copy constructible");
+
+    static_cast<void>(new (m_storage) StoredT(std::forward<CallableT>(callable)));
+    m_operations = &kOperations<StoredT>;
+}
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::InplaceFunction(InplaceFunction const& copy) noexcept :
+    m_operations {copy.m_operations}
+{
+    if (m_operations != nullptr)
+        m_operations->copy(m_storage, copy.m_storage);
+}
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::~InplaceFunction() noexcept
+{
+    if (m_operations != nullptr)
+        m_operations->destroy(m_storage);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  InplaceFunction operator definitions                ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+InplaceFunction<ReturnT(ArgT...), CapacityBytesV>&
+    InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::operator=(InplaceFunction const& copy) noexcept
+{
+    if (this == &copy)
+        return *this;
+
+    if (m_operations != nullptr)
+        m_operations->destroy(m_storage);
+
+    m_operations = copy.m_operations;
+    if (m_operations != nullptr)
+        m_operations->copy(m_storage, copy.m_storage);
+
+    return *this;
+}
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+ReturnT InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::operator()(ArgT... args) const
+{
+    if (m_operations == nullptr)
+        return ReturnT();
+
+    // Like std::function, a const InplaceFunction may invoke a mutable callable
+    return m_operations->invoke(const_cast<unsigned char*>(m_storage), std::forward<ArgT>(args)...);
+}
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::operator bool() const noexcept
+{
+    return (m_operations != nullptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  InplaceFunction method definitions in alphabetical order            ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Private     ========================================================================================================
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+template<typename CallableT>
+void InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::CopyCallable(void* dest, void const* src) // Static method
+{
+    static_cast<void>(new (dest) CallableT(*static_cast<CallableT const*>(src)));
+}
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+template<typename CallableT>
+void InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::DestroyCallable(void* callable) // Static method
+{
+    static_cast<CallableT*>(callable)->~CallableT();
+}
+
+template<typename ReturnT, typename... ArgT, size_t CapacityBytesV>
+template<typename CallableT>
+ReturnT InplaceFunction<ReturnT(ArgT...), CapacityBytesV>::InvokeCallable(void* callable, ArgT... args) // Static method
+{
+    return (*static_cast<CallableT*>(callable))(std::forward<ArgT>(args)...);
+}
+
+} // namespace help
+} // namespace shmit
@@ -1,19 +1,138 @@
 #pragma once
 
+#include "InplaceFunction.hpp"
+
 #include "Core/Platform/Clock.hpp"
+#include "Core/Time/Timer.hpp"
 
-#include <functional>
+#include <atomic>
+#include <chrono>
 
 namespace shmit
 {
 namespace help
 {
 
-using RepeatableCheck = std::function<bool(void)>;
+/// @brief Largest callable that a RepeatableCheck may hold, enough for a lambda capturing a handful of references
+constexpr static size_t kRepeatableCheckCapacityBytes {4U * sizeof(void*)};
+
+/// @brief Condition that is checked over and over, stored without allocating
+using RepeatableCheck = InplaceFunction<bool(void), kRepeatableCheckCapacityBytes>;
+
+/**!
+ * @brief Lets producers wake threads blocked on a pass condition as soon as the condition may have changed, rather than
+ * leaving them to notice on their next backoff
+ *
+ */
+class PassNotifier
+{
+public:
+    PassNotifier() noexcept = default;
+
+    ~PassNotifier() noexcept = default;
+
+    // PassNotifier is shared between producers and waiters and may not be copied or moved
+
+    PassNotifier(PassNotifier const& copy) = delete;
+    PassNotifier(PassNotifier&& move)      = delete;
+
+    PassNotifier& operator=(PassNotifier const& copy) = delete;
+    PassNotifier& operator=(PassNotifier&& move)      = delete;
+
+    /**!
+     * @brief Wake every thread blocked on this notifier so that it re-checks its condition. Call after making a
+     * condition pass.
+     *
+     */
+    void Notify() noexcept;
+
+    /**!
+     * @brief Block until notified after `epoch`, or a timeout elapses, whichever comes first
+     *
+     * @param[in] epoch Value returned by GetEpoch before the waiter last checked its condition
+     * @param[in] timeout Maximum time that will be spent blocked
+     */
+    void Wait(uint32_t epoch, std::chrono::microseconds timeout) const noexcept;
+
+    /// @brief Number of notifications so far. Read before checking a condition so that no notification is missed.
+    uint32_t GetEpoch() const noexcept;
+
+private:
+    std::atomic<uint32_t> m_epoch {0U};
+};
 
 void WaitForPassCondition(RepeatableCheck condition);
 
+/**!
+ * @brief Spin until a condition passes. Takes the condition by type so that every check may be inlined, with no type
+ * erasure and no allocation.
+ *
+ * @tparam CheckT Callable returning bool
+ * @param[in] condition Condition to wait on
+ */
+template<typename CheckT>
+void WaitForPassCondition(CheckT condition);
+
+/**!
+ * @brief Block until a condition passes. Checks back off from spinning, to yielding, to sleeping for exponentially
+ * longer slices up to kMaxBlockSlice, so that a long wait does not hold on to the processor.
+ *
+ * @param[in] condition Condition to wait on
+ */
 void BlockOnPassCondition(RepeatableCheck condition);
 
+/**!
+ * @brief Block until a condition passes or a timer expires, whichever comes first
+ *
+ * @param[in] condition Condition to wait on
+ * @param[in] timeout Timer that bounds the wait
+ * @retval true if the condition passed
+ * @retval false if the timer expired first
+ */
+bool BlockOnPassCondition(RepeatableCheck condition, time::Timer const& timeout);
+
+/**!
+ * @brief Block until a condition passes, waking early whenever the notifier is notified
+ *
+ * @param[in] condition Condition to wait on
+ * @param[in] notifier Notifier that producers notify after changing the condition
+ */
+void BlockOnPassCondition(RepeatableCheck condition, PassNotifier const& notifier);
+
+/**!
+ * @brief Block until a condition passes or a timer expires, whichever comes first, waking early whenever the notifier
+ * is notified
+ *
+ * @param[in] condition Condition to wait on
+ * @param[in] notifier Notifier that producers notify after changing the condition
+ * @param[in] timeout Timer that bounds the wait
+ * @retval true if the condition passed
+ * @retval false if the timer expired first
+ */
+bool BlockOnPassCondition(RepeatableCheck condition, PassNotifier const& notifier, time::Timer const& timeout);
+
+/// @brief Number of times a condition is checked back to back before a blocked thread starts yielding
+constexpr static size_t kSpinCheckCount {16U};
+
+/// @brief Number of times a condition is checked between yields before a blocked thread starts sleeping
+constexpr static size_t kYieldCheckCount {16U};
+
+/// @brief Longest a blocked thread sleeps between checks of its condition
+constexpr static std::chrono::microseconds kMaxBlockSlice {1000};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions               ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<typename CheckT>
+void WaitForPassCondition(CheckT condition)
+{
+    bool condition_passed {false};
+    do
+    {
+        condition_passed = condition();
+    } while (!condition_passed);
+}
+
 } // namespace help
-} // namespace shmit
\ No newline at end of file
+} // namespace shmit
@@ -1,8 +1,17 @@
 #pragma once
 
+#include "Port.hpp"
+
+#include "Core/IO/Session/Inbound.hpp"
 #include "Core/IO/Session/Outbound.hpp"
+#include "Core/Platform/Clock.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
 
-#include <iostream>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
 
 namespace shmit
 {
@@ -11,18 +20,302 @@ namespace io
 namespace serial
 {
 
-class Channel
+/**!
+ * @brief Serial link as a session. Posts are written straight from the caller's storage to the Port. Requests are read
+ * straight in to the caller's storage, after whatever is already buffered. Bytes read ahead of a request are kept in a
+ * receive buffer so that Ingress may decode them in place through Peek.
+ *
+ * @note Writes are not all-or-nothing. A post that times out part way through has already sent its leading bytes,
+ * since they can not be called back from the wire.
+ *
+ * @note A request that times out puts the bytes it did receive back in to the receive buffer, so that nothing is lost
+ * as long as they fit
+ *
+ * @note PostAsync hands the whole Transference to the port when it can write in the background, see Port::WriteAsync
+ *
+ * @tparam RxCapacityV Size of the receive buffer in bytes
+ */
+template<size_t RxCapacityV = 256U>
+class Channel final : public session::Outbound, public session::Inbound
 {
+    static_assert(RxCapacityV > 0U, "`RxCapacityV` must be nonzero");
+
 public:
-    Channel(std::streambuf& stream_buffer);
+    /// @brief Result type shared by both session interfaces
+    using Result = BinaryResult;
+
+    /// @brief Size of the receive buffer in bytes
+    constexpr static size_t kRxCapacityBytes {RxCapacityV};
+
+    /**!
+     * @brief Initializing constructor
+     *
+     * @param[in] port Transport, must outlive the Channel
+     */
+    explicit Channel(Port& port) noexcept;
+
+    // Channel is not trivially constructible and refers to its port, it may not be copied or moved
+
+    Channel() = delete;
+
+    Channel(Channel const& copy) = delete;
+    Channel(Channel&& move)      = delete;
+
+    Channel& operator=(Channel const& copy) = delete;
+    Channel& operator=(Channel&& move)      = delete;
+
+    ~Channel() noexcept = default;
 
-    std::iostream& GetStream();
+    /**!
+     * @brief Release the oldest buffered bytes
+     *
+     * @param[in] size_bytes Number of bytes to consume
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if fewer than `size_bytes` are buffered
+     */
+    virtual Result Consume(size_t size_bytes) noexcept override;
+
+    /// @brief Number of bytes buffered or waiting at the port
+    virtual size_t InputBytesAvailable() const noexcept override;
+
+    /// @brief Number of bytes that the port will take without blocking
+    virtual size_t OutputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Look at the oldest bytes in place, reading ahead from the port in to the receive buffer if need be. Never
+     * blocks.
+     *
+     * @param[in] size_bytes Number of bytes to look at
+     * @return Span over the bytes, empty if fewer than `size_bytes` have arrived or they don't fit the buffer
+     */
+    virtual Span<uint8_t const> Peek(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Write one span to the port
+     *
+     * @param[in] tx Bytes to write
+     * @param[in] timeout Maximum time that will be spent waiting on the port
+     * @retval BinaryResult::kSuccessCode if every byte was written
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Write several spans to the port, in order, each straight from the caller's storage
+     *
+     * @param[in] parts Spans to write
+     * @param[in] timeout Maximum time that will be spent waiting on the port, across every part
+     * @retval BinaryResult::kSuccessCode if every byte was written
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    virtual Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Start writing a Transference's bytes to the port and return right away. The port completes the
+     * Transference once they are sent. Ports that can't write in the background, or are busy, are written to
+     * synchronously with no timeout and the Transference is completed before returning.
+     *
+     * @param[in] transference Transmission to start, must outlive it
+     * @retval BinaryResult::kSuccessCode if the transmission was started, `transference` reports its outcome
+     * @retval BinaryResult::kFailureCode if it was rejected outright, `transference` is completed as failed
+     */
+    virtual Result PostAsync(session::Transference& transference) noexcept override;
+
+    /**!
+     * @brief Fill a span with the oldest bytes, reading from the port until it is full or the timeout elapses
+     *
+     * @param[in] rx Destination
+     * @param[in] timeout Maximum time that will be spent waiting on the port
+     * @retval BinaryResult::kSuccessCode if `rx` was filled
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
 
 private:
-    std::streambuf& m_stream_buffer;
-    std::iostream   m_iostream;
+    /// @brief Time left until a deadline, never negative
+    static std::chrono::microseconds GetTimeRemaining(platform::Clock::time_point deadline) noexcept;
+
+    /// @brief Reads whatever the port has ready in to the receive buffer, without blocking
+    void ReadAhead() noexcept;
+
+    /// @brief Writes one span, waiting on the port as long as the deadline allows
+    bool Write(Span<uint8_t const> tx, platform::Clock::time_point deadline) noexcept;
+
+    /// @brief Transport
+    Port& m_port;
+
+    /// @brief Bytes read ahead of any request, from m_read to m_write
+    uint8_t m_rx_buffer[RxCapacityV] {};
+    size_t  m_read {0U};
+    size_t  m_write {0U};
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Channel constructor definitions             ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t RxCapacityV>
+Channel<RxCapacityV>::Channel(Port& port) noexcept : m_port {port}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Channel method definitions in alphabetical order            ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t RxCapacityV>
+typename Channel<RxCapacityV>::Result Channel<RxCapacityV>::Consume(size_t size_bytes) noexcept
+{
+    if ((m_write - m_read) < size_bytes)
+        return Result::Failure();
+
+    m_read += size_bytes;
+    return Result::Success();
+}
+
+template<size_t RxCapacityV>
+size_t Channel<RxCapacityV>::InputBytesAvailable() const noexcept
+{
+    return ((m_write - m_read) + m_port.ReadBytesAvailable());
+}
+
+template<size_t RxCapacityV>
+size_t Channel<RxCapacityV>::OutputBytesAvailable() const noexcept
+{
+    return m_port.WriteBytesAvailable();
+}
+
+template<size_t RxCapacityV>
+Span<uint8_t const> Channel<RxCapacityV>::Peek(size_t size_bytes) noexcept
+{
+    if (size_bytes > RxCapacityV)
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    if ((m_write - m_read) < size_bytes)
+        ReadAhead();
+
+    if ((m_write - m_read) < size_bytes)
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    return Span<uint8_t const> {(m_rx_buffer + m_read), size_bytes};
+}
+
+template<size_t RxCapacityV>
+typename Channel<RxCapacityV>::Result Channel<RxCapacityV>::Post(Span<uint8_t const>       tx,
+                                                                 std::chrono::microseconds timeout) noexcept
+{
+    return (Write(tx, (platform::Clock::now() + timeout)) ? Result::Success() : Result::Failure());
+}
+
+template<size_t RxCapacityV>
+typename Channel<RxCapacityV>::Result Channel<RxCapacityV>::Post(Span<Span<uint8_t const> const> parts,
+                                                                 std::chrono::microseconds       timeout) noexcept
+{
+    platform::Clock::time_point const deadline {platform::Clock::now() + timeout};
+    for (Span<uint8_t const> const& part : parts)
+    {
+        if (!Write(part, deadline))
+            return Result::Failure();
+    }
+
+    return Result::Success();
+}
+
+template<size_t RxCapacityV>
+typename Channel<RxCapacityV>::Result Channel<RxCapacityV>::PostAsync(session::Transference& transference) noexcept
+{
+    if (m_port.WriteAsync(transference))
+        return Result::Success();
+
+    return session::Outbound::PostAsync(transference);
+}
+
+template<size_t RxCapacityV>
+typename Channel<RxCapacityV>::Result Channel<RxCapacityV>::Request(Span<uint8_t>             rx,
+                                                                    std::chrono::microseconds timeout) noexcept
+{
+    platform::Clock::time_point const deadline {platform::Clock::now() + timeout};
+
+    // Buffered bytes first, then read the rest straight in to the destination
+    size_t const num_buffered {std::min((m_write - m_read), rx.size())};
+    static_cast<void>(std::memcpy(rx.data(), (m_rx_buffer + m_read), num_buffered));
+    m_read += num_buffered;
+
+    size_t num_received {num_buffered};
+    while (num_received < rx.size())
+    {
+        std::chrono::microseconds const time_remaining {GetTimeRemaining(deadline)};
+        size_t const num_read {m_port.Read(rx.subspan(num_received), time_remaining)};
+        num_received += num_read;
+
+        if ((num_read == 0U) && (time_remaining == std::chrono::microseconds::zero()))
+            break;
+    }
+
+    if (num_received == rx.size())
+        return Result::Success();
+
+    // Out of time, put back what was received in front of anything still buffered
+    size_t const num_unread {m_write - m_read};
+    size_t const num_kept {std::min(num_received, (RxCapacityV - num_unread))};
+    static_cast<void>(std::memmove((m_rx_buffer + num_kept), (m_rx_buffer + m_read), num_unread));
+    static_cast<void>(std::memcpy(m_rx_buffer, rx.data(), num_kept));
+    m_read  = 0U;
+    m_write = (num_kept + num_unread);
+
+    return Result::Failure();
+}
+
+//  Private     ========================================================================================================
+
+template<size_t RxCapacityV>
+std::chrono::microseconds
+    Channel<RxCapacityV>::GetTimeRemaining(platform::Clock::time_point deadline) noexcept // Static method
+{
+    platform::Clock::time_point const now {platform::Clock::now()};
+    if (now >= deadline)
+        return std::chrono::microseconds::zero();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(deadline - now);
+}
+
+template<size_t RxCapacityV>
+void Channel<RxCapacityV>::ReadAhead() noexcept
+{
+    // Keep unread bytes at the front so that Peek always has the whole buffer to work with
+    if (m_read > 0U)
+    {
+        static_cast<void>(std::memmove(m_rx_buffer, (m_rx_buffer + m_read), (m_write - m_read)));
+        m_write -= m_read;
+        m_read = 0U;
+    }
+
+    size_t const num_ready {std::min(m_port.ReadBytesAvailable(), (RxCapacityV - m_write))};
+    if (num_ready > 0U)
+        m_write += m_port.Read(Span<uint8_t> {(m_rx_buffer + m_write), num_ready}, std::chrono::microseconds::zero());
+}
+
+template<size_t RxCapacityV>
+bool Channel<RxCapacityV>::Write(Span<uint8_t const> tx, platform::Clock::time_point deadline) noexcept
+{
+    size_t num_written {0U};
+    while (num_written < tx.size())
+    {
+        std::chrono::microseconds const time_remaining {GetTimeRemaining(deadline)};
+        size_t const num_sent {m_port.Write(tx.subspan(num_written), time_remaining)};
+        num_written += num_sent;
+
+        if ((num_sent == 0U) && (time_remaining == std::chrono::microseconds::zero()))
+            return false;
+    }
+
+    return true;
+}
+
 } // namespace serial
 } // namespace io
-} // namespace shmit
\ No newline at end of file
+} // namespace shmit
@@ -0,0 +1,60 @@
+#pragma once
+
+#include "Port.hpp"
+
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <chrono>
+
+namespace shmit
+{
+namespace io
+{
+namespace serial
+{
+
+/**!
+ * @brief Port over a POSIX file descriptor, such as an open tty, pipe or socket. Transfers are single `read` and
+ * `write` calls, waiting through `poll`. Native builds only.
+ *
+ * @note The descriptor should be non-blocking, otherwise a transfer may block past its timeout
+ */
+class FileDescriptorPort final : public Port
+{
+public:
+    /**!
+     * @brief Initializing constructor
+     *
+     * @param[in] file_descriptor Open descriptor, owned by the caller and must outlive the port
+     */
+    explicit FileDescriptorPort(int file_descriptor) noexcept;
+
+    /// @brief Number of bytes waiting to be read, as reported by FIONREAD
+    virtual size_t ReadBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Read up to a span's worth of bytes, waiting up to a timeout for the descriptor to become readable
+     *
+     * @param[in] rx Destination
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @return Number of bytes read, 0 if none arrived in time or the read failed
+     */
+    virtual size_t Read(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Write a span of bytes, waiting up to a timeout for the descriptor to take all of them
+     *
+     * @param[in] tx Bytes to write
+     * @param[in] timeout Maximum time that will be spent waiting on the descriptor
+     * @return Number of bytes written
+     */
+    virtual size_t Write(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+private:
+    int m_file_descriptor;
+};
+
+} // namespace serial
+} // namespace io
+} // namespace shmit
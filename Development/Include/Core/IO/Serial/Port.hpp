@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Core/IO/Session/Transference.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <chrono>
+#include <limits>
+
+namespace shmit
+{
+namespace io
+{
+namespace serial
+{
+
+/**!
+ * @brief Raw byte transport underneath a Channel, such as a file descriptor, a UART or a stream buffer. Transfers are
+ * whole blocks, never single characters, and may be partial.
+ *
+ */
+class Port
+{
+public:
+    virtual ~Port() = default;
+
+    /// @brief Number of bytes that may be read right now without blocking
+    virtual size_t ReadBytesAvailable() const noexcept = 0;
+
+    /**!
+     * @brief Read up to a span's worth of bytes, waiting up to a timeout for the first of them
+     *
+     * @param[in] rx Destination
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @return Number of bytes read, 0 if none arrived in time
+     */
+    virtual size_t Read(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept = 0;
+
+    /**!
+     * @brief Write a span of bytes, waiting up to a timeout for the transport to take all of them
+     *
+     * @param[in] tx Bytes to write
+     * @param[in] timeout Maximum time that will be spent waiting on the transport
+     * @return Number of bytes written, less than `tx.size()` if time ran out
+     */
+    virtual size_t Write(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept = 0;
+
+    /// @brief Number of bytes that may be written right now without blocking, unbounded if the transport can't tell
+    virtual size_t WriteBytesAvailable() const noexcept
+    {
+        return std::numeric_limits<size_t>::max();
+    }
+
+    /**!
+     * @brief Start writing a Transference's bytes and return right away. The transport completes the Transference from
+     * its own context once they are sent, such as a DMA completion interrupt, and borrows the bytes until then.
+     *
+     * @note The default implementation starts nothing, transports that can write in the background override this
+     *
+     * @param[in] transference Transmission to start, must outlive it
+     * @retval true if the write was started
+     * @retval false if the transport can't write in the background or is busy, `transference` is left untouched
+     */
+    virtual bool WriteAsync(session::Transference& transference) noexcept
+    {
+        static_cast<void>(transference); // Avoid unused warning
+        return false;
+    }
+};
+
+} // namespace serial
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Port.hpp"
+
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <streambuf>
+
+namespace shmit
+{
+namespace io
+{
+namespace serial
+{
+
+/**!
+ * @brief Port over a `std::streambuf`, for when a stream buffer is the only backend available. Every transfer is one
+ * `sgetn` or `sputn` of the whole block, no stream, locale or sentry is involved.
+ *
+ * @note Whether a transfer blocks is up to the stream buffer, timeouts only decide whether a read is attempted when
+ * no bytes are known to be waiting
+ */
+class StreamBufferPort final : public Port
+{
+public:
+    /**!
+     * @brief Initializing constructor
+     *
+     * @param[in] stream_buffer Stream buffer to transfer through, must outlive the port
+     */
+    explicit StreamBufferPort(std::streambuf& stream_buffer) noexcept : m_stream_buffer {stream_buffer}
+    {
+    }
+
+    /// @brief Number of bytes that the stream buffer has ready, which may undercount (see std::streambuf::in_avail)
+    virtual size_t ReadBytesAvailable() const noexcept override
+    {
+        std::streamsize const num_ready {m_stream_buffer.in_avail()};
+        return ((num_ready > 0) ? static_cast<size_t>(num_ready) : 0U);
+    }
+
+    /**!
+     * @brief Read up to a span's worth of bytes
+     *
+     * @param[in] rx Destination
+     * @param[in] timeout Nonzero to read even when no bytes are known to be waiting, which may block
+     * @return Number of bytes read
+     */
+    virtual size_t Read(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override
+    {
+        size_t size_bytes {std::min(ReadBytesAvailable(), rx.size())};
+        if ((size_bytes == 0U) && (timeout > std::chrono::microseconds::zero()))
+            size_bytes = rx.size();
+
+        if (size_bytes == 0U)
+            return 0U;
+
+        std::streamsize const num_read {
+            m_stream_buffer.sgetn(reinterpret_cast<char*>(rx.data()), static_cast<std::streamsize>(size_bytes))};
+        return ((num_read > 0) ? static_cast<size_t>(num_read) : 0U);
+    }
+
+    /**!
+     * @brief Write a span of bytes
+     *
+     * @param[in] tx Bytes to write
+     * @param[in] timeout Unused, the stream buffer decides whether to block
+     * @return Number of bytes written
+     */
+    virtual size_t Write(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override
+    {
+        static_cast<void>(timeout); // Avoid unused warning
+
+        std::streamsize const num_written {m_stream_buffer.sputn(reinterpret_cast<char const*>(tx.data()),
+                                                                 static_cast<std::streamsize>(tx.size()))};
+        return ((num_written > 0) ? static_cast<size_t>(num_written) : 0U);
+    }
+
+private:
+    std::streambuf& m_stream_buffer;
+};
+
+} // namespace serial
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "Port.hpp"
+
+#include "Core/IO/Session/RingSession.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace shmit
+{
+namespace io
+{
+namespace serial
+{
+
+/**!
+ * @brief Port over a Zephyr UART, driven through the asynchronous UART API so that whole blocks move by DMA where the
+ * driver supports it. Received bytes are queued by the driver callback in a lock-free ring until they are read.
+ * Zephyr builds only.
+ *
+ * @note Requires CONFIG_UART_ASYNC_API
+ */
+class UartPort final : public Port
+{
+public:
+    /// @brief Size of each buffer handed to the driver for reception
+    constexpr static size_t kRxChunkSizeBytes {32U};
+
+    /// @brief Size of the receive ring in bytes
+    constexpr static size_t kRxRingCapacityBytes {256U};
+
+    /// @brief Idle time after which the driver hands over a partially filled receive buffer
+    constexpr static std::chrono::microseconds kRxIdleTimeout {100};
+
+    /**!
+     * @brief Initializing constructor, see Open
+     *
+     * @param[in] device UART device, a `struct device const*`
+     */
+    explicit UartPort(void const* device) noexcept;
+
+    // UartPort is registered with its driver by address, it may not be copied or moved
+
+    UartPort(UartPort const& copy) = delete;
+    UartPort(UartPort&& move)      = delete;
+
+    UartPort& operator=(UartPort const& copy) = delete;
+    UartPort& operator=(UartPort&& move)      = delete;
+
+    ~UartPort() noexcept;
+
+    /**!
+     * @brief Registers with the driver and starts receiving
+     *
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if the driver rejected the callback or receiver
+     */
+    BinaryResult Open() noexcept;
+
+    /// @brief Number of received bytes waiting in the ring
+    virtual size_t ReadBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Read up to a span's worth of received bytes, waiting up to a timeout for the first of them
+     *
+     * @param[in] rx Destination
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @return Number of bytes read
+     */
+    virtual size_t Read(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Hands a span to the driver and waits for it to be sent. The span is aborted if time runs out.
+     *
+     * @param[in] tx Bytes to write
+     * @param[in] timeout Maximum time that will be spent waiting on the driver
+     * @return Number of bytes sent
+     */
+    virtual size_t Write(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Hands a Transference's bytes to the driver and returns right away. The Transference is completed from the
+     * driver callback, successfully only if every byte was sent.
+     *
+     * @param[in] transference Transmission to start, must outlive it
+     * @retval true if the driver took the transmission
+     * @retval false if a transmission is already in flight or the driver rejected it
+     */
+    virtual bool WriteAsync(session::Transference& transference) noexcept override;
+
+    /// @brief Driver callback, registered by Open
+    static void OnEvent(void const* device, void* event, void* port) noexcept;
+
+private:
+    /// @brief UART device
+    void const* m_device;
+
+    /// @brief Bytes received by the driver and not yet read, filled from the driver callback
+    session::RingSession<kRxRingCapacityBytes> m_rx_ring {};
+
+    /// @brief Buffers lent to the driver for reception, in turn
+    uint8_t m_rx_chunks[2U][kRxChunkSizeBytes] {};
+    size_t  m_next_rx_chunk {0U};
+
+    /// @brief Counts completed transmissions, so that Write may wait for its own
+    std::atomic<uint32_t> m_tx_generation {0U};
+
+    /// @brief Number of bytes that the last transmission sent
+    std::atomic<size_t> m_num_tx_sent {0U};
+
+    /// @brief Transmission started by WriteAsync and not yet completed by the driver
+    std::atomic<session::Transference*> m_tx_transference {nullptr};
+};
+
+} // namespace serial
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,347 @@
+#pragma once
+
+#if !defined(__cpp_impl_coroutine)
+#error "Core/IO/Session/Coroutine.hpp requires C++20 coroutine support"
+#endif
+
+#include "Transference.hpp"
+
+#include "Core/Data/Decode.hpp"
+#include "Core/Data/Footprint.hpp"
+#include "Core/Help/RoutineLogic.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <chrono>
+#include <coroutine>
+#include <cstring>
+#include <exception>
+#include <type_traits>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Return type for coroutines driven by a SessionExecutor. A SessionTask starts running as soon as it is called
+ * and frees itself once it finishes, so the caller does not need to hold on to it.
+ *
+ */
+class SessionTask
+{
+public:
+    struct promise_type
+    {
+        SessionTask get_return_object() noexcept
+        {
+            return SessionTask {};
+        }
+
+        std::suspend_never initial_suspend() const noexcept
+        {
+            return std::suspend_never {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return std::suspend_never {};
+        }
+
+        void return_void() const noexcept
+        {
+        }
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+    };
+};
+
+/**!
+ * @brief Single-threaded executor that resumes coroutines once the transferences that they are awaiting complete. One
+ * thread calling Poll or Run can drive any number of sessions, whichever context completes their transferences.
+ *
+ * Awaiting coroutines are kept in an intrusive list threaded through their awaitables, so the executor itself never
+ * allocates.
+ *
+ * @note Every member must be called from the executor's own thread, including from within the coroutines it resumes,
+ * except for NotifyCompletion which may be called from any context
+ */
+class SessionExecutor
+{
+public:
+    /// @brief Longest Run blocks between polls without being notified, a backstop for completions that are missed
+    constexpr static std::chrono::microseconds kRunWaitSlice {100000};
+
+    /// @brief Entry in the executor's list of suspended coroutines, embedded in each awaitable
+    struct Awaiter
+    {
+        /// @brief Transference that the coroutine is waiting on
+        Transference* transference {nullptr};
+
+        /// @brief Suspended coroutine
+        std::coroutine_handle<> handle {};
+
+        /// @brief Next suspended coroutine
+        Awaiter* next {nullptr};
+    };
+
+    SessionExecutor() noexcept = default;
+
+    ~SessionExecutor() noexcept = default;
+
+    // SessionExecutor owns the list of suspended coroutines and may not be copied or moved
+
+    SessionExecutor(SessionExecutor const& copy) = delete;
+    SessionExecutor(SessionExecutor&& move)      = delete;
+
+    SessionExecutor& operator=(SessionExecutor const& copy) = delete;
+    SessionExecutor& operator=(SessionExecutor&& move)      = delete;
+
+    /// @brief Checks if no coroutine is waiting on the executor
+    bool IsIdle() const noexcept
+    {
+        return (m_awaiters == nullptr);
+    }
+
+    /**!
+     * @brief Resume every suspended coroutine whose transference has completed
+     *
+     * @return Number of coroutines resumed
+     */
+    size_t Poll() noexcept
+    {
+        // Detach the list first, resumed coroutines may suspend again and schedule new awaiters
+        Awaiter* awaiters {m_awaiters};
+        m_awaiters = nullptr;
+
+        size_t num_resumed {0U};
+        while (awaiters != nullptr)
+        {
+            Awaiter* awaiter {awaiters};
+            awaiters = awaiter->next; // Read before resuming, the awaiter lives in the coroutine's frame
+
+            if (awaiter->transference->IsPending())
+            {
+                Schedule(*awaiter);
+            }
+            else
+            {
+                awaiter->handle.resume();
+                num_resumed++;
+            }
+        }
+
+        return num_resumed;
+    }
+
+    /// @brief Poll until no coroutine is waiting on the executor, blocking between polls until a transference completes
+    void Run() noexcept
+    {
+        while (!IsIdle())
+        {
+            // Read before polling so that a completion landing after the poll cuts the wait short
+            uint32_t const epoch {m_completions.GetEpoch()};
+            if (Poll() == 0U)
+                m_completions.Wait(epoch, kRunWaitSlice);
+        }
+    }
+
+    /**!
+     * @brief Transference::CompletionCallback waking a Run blocked on the executor, passed along with the executor as
+     * context. Safe to call from an ISR on ports whose platform::notify_all is.
+     *
+     * @param[in] transference Completed Transference
+     * @param[in] context Executor to wake
+     */
+    static void NotifyCompletion(Transference& transference, void* context) noexcept
+    {
+        static_cast<void>(transference); // Avoid unused warning
+        static_cast<SessionExecutor*>(context)->m_completions.Notify();
+    }
+
+    /**!
+     * @brief Suspend a coroutine until a transference completes
+     *
+     * @param[in] awaiter Awaiter naming the transference and the suspended coroutine, must live until resumed
+     */
+    void Schedule(Awaiter& awaiter) noexcept
+    {
+        awaiter.next = m_awaiters;
+        m_awaiters   = &awaiter;
+    }
+
+    /**!
+     * @brief Awaitable that encodes an object and posts it through an Egress, resuming once the post completes
+     *
+     * @tparam EgressT Egress or StaticEgress type
+     * @param[in] egress Egress to put to
+     * @param[in] data Object to put, copied in to the awaitable
+     * @return Awaitable resulting in BinaryResult::kSuccessCode if the post completed successfully
+     */
+    template<typename EgressT>
+    auto Put(EgressT& egress, typename EgressT::value_type const& data) noexcept;
+
+    /**!
+     * @brief Awaitable that requests an object through an Ingress, resuming once the request completes
+     *
+     * @tparam IngressT Ingress or StaticIngress type
+     * @param[in] ingress Ingress to get from
+     * @param[out] data Destination object, must outlive the awaitable
+     * @return Awaitable resulting in BinaryResult::kSuccessCode if the request completed and `data` was decoded
+     */
+    template<typename IngressT>
+    auto Get(IngressT& ingress, typename IngressT::value_type& data) noexcept;
+
+private:
+    /// @brief Suspended coroutines, most recently scheduled first
+    Awaiter* m_awaiters {nullptr};
+
+    /// @brief Notified each time a transference started by one of the executor's awaitables completes
+    help::PassNotifier m_completions {};
+};
+
+/**!
+ * @brief Awaitable returned by SessionExecutor::Put
+ *
+ * @tparam EgressT Egress or StaticEgress type
+ */
+template<typename EgressT>
+class PutAwaitable
+{
+public:
+    using value_type = typename EgressT::value_type;
+
+    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<value_type>};
+
+    PutAwaitable(SessionExecutor& executor, EgressT& egress, value_type const& data) noexcept :
+        m_executor {executor},
+        m_egress {egress},
+        m_data {data},
+        m_transference {Span<uint8_t> {m_encoded}, &SessionExecutor::NotifyCompletion, &executor}
+    {
+    }
+
+    // PutAwaitable is referred to by the session while in flight and may not be copied or moved
+
+    PutAwaitable(PutAwaitable const& copy) = delete;
+    PutAwaitable(PutAwaitable&& move)      = delete;
+
+    /// @brief Starts the post, a coroutine only suspends if it is still in flight
+    bool await_ready() noexcept
+    {
+        m_started = m_egress.PutAsync(m_data, m_transference).IsSuccess();
+        return (!m_started || !m_transference.IsPending());
+    }
+
+    /// @brief Hands the suspended coroutine to the executor
+    void await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        m_awaiter.transference = &m_transference;
+        m_awaiter.handle       = handle;
+        m_executor.Schedule(m_awaiter);
+    }
+
+    /// @brief Outcome of the post
+    BinaryResult await_resume() noexcept
+    {
+        return ((m_started && m_transference.GetResult().IsSuccess()) ? BinaryResult::Success()
+                                                                      : BinaryResult::Failure());
+    }
+
+private:
+    SessionExecutor&         m_executor;
+    EgressT&                 m_egress;
+    value_type               m_data;
+    uint8_t                  m_encoded[kDataSizeBytes] {};
+    Transference             m_transference;
+    SessionExecutor::Awaiter m_awaiter {};
+    bool                     m_started {false};
+};
+
+/**!
+ * @brief Awaitable returned by SessionExecutor::Get
+ *
+ * @tparam IngressT Ingress or StaticIngress type
+ */
+template<typename IngressT>
+class GetAwaitable
+{
+public:
+    using value_type = typename IngressT::value_type;
+
+    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<value_type>};
+
+    GetAwaitable(SessionExecutor& executor, IngressT& ingress, value_type& data) noexcept :
+        m_executor {executor},
+        m_ingress {ingress},
+        m_data {data},
+        m_transference {Span<uint8_t> {m_encoded}, &SessionExecutor::NotifyCompletion, &executor}
+    {
+    }
+
+    // GetAwaitable is referred to by the session while in flight and may not be copied or moved
+
+    GetAwaitable(GetAwaitable const& copy) = delete;
+    GetAwaitable(GetAwaitable&& move)      = delete;
+
+    /// @brief Starts the request, a coroutine only suspends if it is still in flight
+    bool await_ready() noexcept
+    {
+        m_started = m_ingress.GetAsync(m_transference).IsSuccess();
+        return (!m_started || !m_transference.IsPending());
+    }
+
+    /// @brief Hands the suspended coroutine to the executor
+    void await_suspend(std::coroutine_handle<> handle) noexcept
+    {
+        m_awaiter.transference = &m_transference;
+        m_awaiter.handle       = handle;
+        m_executor.Schedule(m_awaiter);
+    }
+
+    /// @brief Outcome of the request, decoding the received bytes in to the destination on success
+    BinaryResult await_resume() noexcept
+    {
+        if (!m_started || m_transference.GetResult().IsFailure())
+            return BinaryResult::Failure();
+
+        size_t bits_decoded {0U};
+        return data::decode(m_transference.GetData(), bits_decoded, m_data);
+    }
+
+private:
+    SessionExecutor&         m_executor;
+    IngressT&                m_ingress;
+    value_type&              m_data;
+    uint8_t                  m_encoded[kDataSizeBytes] {};
+    Transference             m_transference;
+    SessionExecutor::Awaiter m_awaiter {};
+    bool                     m_started {false};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  SessionExecutor method definitions in alphabetical order            ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename IngressT>
+auto SessionExecutor::Get(IngressT& ingress, typename IngressT::value_type& data) noexcept
+{
+    return GetAwaitable<IngressT> {*this, ingress, data};
+}
+
+template<typename EgressT>
+auto SessionExecutor::Put(EgressT& egress, typename EgressT::value_type const& data) noexcept
+{
+    return PutAwaitable<EgressT> {*this, egress, data};
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -36,6 +36,9 @@ public:
     /// @brief Type that is put to the Egress instance
     using value_type = typename Output<T>::value_type;
 
+    /// @brief Largest stack buffer that PutMany will stage an encoded burst in, unless one object is larger
+    constexpr static size_t kPutManyStagingSizeBytes {_detail::kEgressStagingSizeBytes};
+
     /**!
      * @brief Initializing constructor. Connects Egress to an Outbound session buffer.
      *
@@ -59,6 +62,27 @@ public:
     Egress& operator=(Egress const& copy) = default;
     Egress& operator=(Egress&& move)      = default;
 
+    /**!
+     * @brief Set aside space in the connected session for a number of objects ahead of time, waiting up to a duration
+     * for it to free up. Every following Put, and every object of a PutMany, spends credit before it looks at the
+     * session, so a producer that knows its burst up front checks for space once.
+     *
+     * @note Credit is held by the session on behalf of its one producer, so every Egress on the session shares it
+     *
+     * @param[in] count Number of objects to set space aside for, on top of any credit already held
+     * @param[in] duration Maximum time that will be spent waiting for space
+     * @retval BinaryResult::kSuccessCode if the credit was granted
+     * @retval BinaryResult::kFailureCode if the session has no FlowControl or the space didn't free up in time
+     */
+    BinaryResult AcquireCredit(size_t count, std::chrono::microseconds duration) noexcept;
+
+    /**!
+     * @brief Number of objects that the credit held in the connected session still covers
+     *
+     * @return Number of objects, 0 if the session has no FlowControl
+     */
+    size_t GetCredit() const noexcept;
+
     /**!
      * @brief Post an object's data to the connected Outbound buffer with no blocking delay
      *
@@ -72,6 +96,9 @@ public:
      * @brief Post an object's data to the connected Outbound buffer, blocking for a duration or until the transference
      * is complete, whichever finishes first
      *
+     * @note Credit is spent first. Otherwise sessions with FlowControl are slept on until enough space frees up, and
+     * any other session turns the object away as soon as it doesn't fit. The wait and the post share one duration.
+     *
      * @param[in] data Reference to an object to put to the Egress
      * @param[in] duration Maximum time that will be spent attempting to post data
      * @retval BinaryResult::kSuccessCode if successful
@@ -79,6 +106,53 @@ public:
      */
     BinaryResult Put(value_type const& data, std::chrono::microseconds duration) noexcept;
 
+    /**!
+     * @brief Encode an object's data in to a Transference and start posting it to the connected session buffer,
+     * returning right away. Completion is reported through `transference`.
+     *
+     * @param[in] data Reference to an object to put to the Egress
+     * @param[in] transference Transmission to start, constructed over exactly
+     * `data::footprint_size_bytes_v<value_type>` writable bytes that outlive it
+     * @retval BinaryResult::kSuccessCode if the transmission was started
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult PutAsync(value_type const& data, Transference& transference) noexcept;
+
+    /**!
+     * @brief Post a burst of objects to the connected Outbound buffer as one contiguous transmission, blocking for a
+     * duration or until the transference is complete, whichever finishes first. Only as many objects as fit in the
+     * buffer are posted, in order.
+     *
+     * @note The burst is encoded directly in to a reservation when the session can lend out its storage. Otherwise it
+     * is staged on the stack kPutManyStagingSizeBytes at a time, and only the first post may wait. Objects for which
+     * data::is_wire_identical holds are posted straight from `data`, with no staging. Message-oriented sessions get one
+     * Put per object instead, so that every object may be received on its own.
+     *
+     * @param[in] data Objects to put to the Egress
+     * @param[in] duration Maximum time that will be spent waiting on the session
+     * @return Number of objects posted
+     */
+    size_t PutMany(Span<value_type const> data, std::chrono::microseconds duration) noexcept;
+
+    /**!
+     * @brief Post an object's data followed by any number of trailing parts to the connected Outbound buffer as one
+     * atomic transmission, blocking for a duration or until the transference is complete, whichever finishes first.
+     * Either every part is posted contiguously or none of them are, so no other producer may split them up.
+     *
+     * @note Parts that are byte spans are gathered straight from the caller's storage, every other part is encoded on
+     * the stack first
+     *
+     * @tparam PartT Types of the trailing parts, byte spans or anything that may be encoded
+     * @param[in] duration Maximum time that will be spent attempting to post data
+     * @param[in] data Reference to an object to put to the Egress, sent first
+     * @param[in] parts Trailing parts, sent in order after `data`
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    template<typename... PartT>
+    BinaryResult PutMultipart(std::chrono::microseconds duration, value_type const& data,
+                              PartT const&... parts) noexcept;
+
 private:
     /// @brief Reference to connected buffer
     Outbound& m_buffer {};
@@ -129,6 +203,18 @@ Egress<T>::Egress(Outbound& buffer) noexcept : m_buffer {buffer}
 
 //  Public      ========================================================================================================
 
+template<typename T>
+BinaryResult Egress<T>::AcquireCredit(size_t count, std::chrono::microseconds duration) noexcept
+{
+    return _detail::egress_acquire_credit<value_type>(m_buffer, count, duration);
+}
+
+template<typename T>
+size_t Egress<T>::GetCredit() const noexcept
+{
+    return _detail::egress_credit<value_type>(m_buffer);
+}
+
 template<typename T>
 BinaryResult Egress<T>::Put(value_type const& data) noexcept
 {
@@ -138,36 +224,27 @@ BinaryResult Egress<T>::Put(value_type const& data) noexcept
 template<typename T>
 BinaryResult Egress<T>::Put(value_type const& data, std::chrono::microseconds duration) noexcept
 {
-    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<value_type>};
-
-    // Guard against overflowing the Outbound buffer
-    if (m_buffer.OutputBytesAvailable() < kDataSizeBytes)
-        return BinaryResult::Failure();
-
-    // Save time started
-    auto start_us {platform::Clock::now().time_since_epoch()};
-
-    // Encode data in byte buffer
-    uint8_t       encoded_buffer[kDataSizeBytes];
-    Span<uint8_t> encoded_span {encoded_buffer, kDataSizeBytes};
-    static_cast<void>(std::memset(encoded_buffer, 0U, kDataSizeBytes)); // Avoid unused return warning
-
-    size_t       bits_encoded {0U};
-    BinaryResult encode_result {data::encode(data, encoded_span, bits_encoded)};
-    if (!encode_result.IsSuccess())
-        return encode_result;
-
-    // Calculate the duration that encoding took
-    auto encoding_end_us {platform::Clock::now().time_since_epoch()};
-    auto encoding_duration {std::chrono::duration_cast<std::chrono::microseconds>(encoding_end_us - start_us)};
-    if (encoding_duration > duration)
-        duration = std::chrono::microseconds::zero();
-    else
-        duration -= encoding_duration;
-
-    // Pack span in to a Transference and post to Outbound buffer
-    Outbound::Result post_result {m_buffer.Post(span_cast<uint8_t const>(encoded_span), duration)};
-    return (post_result.IsSuccess() ? BinaryResult::Success() : BinaryResult::Failure());
+    return _detail::egress_put(m_buffer, data, duration);
+}
+
+template<typename T>
+BinaryResult Egress<T>::PutAsync(value_type const& data, Transference& transference) noexcept
+{
+    return _detail::egress_put_async(m_buffer, data, transference);
+}
+
+template<typename T>
+size_t Egress<T>::PutMany(Span<value_type const> data, std::chrono::microseconds duration) noexcept
+{
+    return _detail::egress_put_many(m_buffer, data, duration);
+}
+
+template<typename T>
+template<typename... PartT>
+BinaryResult Egress<T>::PutMultipart(std::chrono::microseconds duration, value_type const& data,
+                                     PartT const&... parts) noexcept
+{
+    return _detail::egress_put_multipart(m_buffer, duration, data, parts...);
 }
 
 } // namespace session
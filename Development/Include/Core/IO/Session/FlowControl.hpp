@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Core/Result.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <limits>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+class Outbound;
+
+/**!
+ * @brief Flow control state of a single-producer session, shared between its producer and its consumer.
+ *
+ * - A space-available signal: the consumer notifies it after releasing space, and producers sleep on it through
+ * WaitForSpace instead of polling the session. Notifying costs a fence and one load while nobody is waiting.
+ * - Watermarks: a callback is fired once when the session fills to its high watermark, and once again when it drains
+ * back down to its low watermark, so that producers may throttle themselves before the session is full.
+ * - Credit: the producer may set aside space for several transmissions at once through AcquireCredit, after which
+ * each of them is spent without looking at the session's free space again.
+ *
+ * @note Credit belongs to the session's one producer. Watermarks should be set before any traffic flows.
+ */
+class FlowControl
+{
+public:
+    /// @brief Watermark that a session crossed
+    enum class Watermark : uint8_t
+    {
+        kLow  = 0, ///< Drained to the low watermark, producers may resume
+        kHigh = 1  ///< Filled to the high watermark, producers should hold back
+    };
+
+    /**!
+     * @brief Called once each time a session crosses a watermark. kHigh is called from the producer's context and
+     * kLow from the consumer's, so neither may block.
+     *
+     * @param[in] watermark Watermark that was crossed
+     * @param[in] context Context registered along with the callback
+     */
+    using WatermarkCallback = void (*)(Watermark watermark, void* context);
+
+    // FlowControl is trivially default constructible and destructible
+
+    FlowControl() noexcept  = default;
+    ~FlowControl() noexcept = default;
+
+    // FlowControl holds synchronization state and may not be copied or moved
+
+    FlowControl(FlowControl const& copy) = delete;
+    FlowControl(FlowControl&& move)      = delete;
+
+    FlowControl& operator=(FlowControl const& copy) = delete;
+    FlowControl& operator=(FlowControl&& move)      = delete;
+
+    /**!
+     * @brief Set aside free space in a session for upcoming transmissions, waiting up to a timeout for it to free up.
+     * Producer side.
+     *
+     * @param[in] session Session that this FlowControl belongs to
+     * @param[in] size_bytes Space to set aside, on top of any credit already held
+     * @param[in] timeout Maximum time that will be spent waiting for space
+     * @retval BinaryResult::kSuccessCode if the credit was granted
+     * @retval BinaryResult::kFailureCode otherwise, the credit already held is unchanged
+     */
+    BinaryResult AcquireCredit(Outbound const& session, size_t size_bytes, std::chrono::microseconds timeout) noexcept;
+
+    /// @brief Space set aside for the producer and not yet spent, in bytes
+    size_t GetCreditBytes() const noexcept;
+
+    /**!
+     * @brief Signal that data was taken out of the session. Consumer side, call after the space has been released.
+     *
+     * @param[in] used_bytes Bytes still buffered in the session
+     */
+    void NotifyDrained(size_t used_bytes) noexcept;
+
+    /**!
+     * @brief Signal that data was placed in the session. Producer side, call after the data has been published.
+     *
+     * @param[in] used_bytes Bytes buffered in the session
+     */
+    void NotifyFilled(size_t used_bytes) noexcept;
+
+    /**!
+     * @brief Set watermarks on the number of bytes buffered in the session, or clear them with a null callback
+     *
+     * @param[in] low_bytes kLow is fired once the session drains to this many bytes after crossing kHigh
+     * @param[in] high_bytes kHigh is fired once the session fills to this many bytes
+     * @param[in] callback Called on every crossing
+     * @param[in] context Passed to every call of the callback
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if `low_bytes` is not below `high_bytes`
+     */
+    BinaryResult SetWatermarks(size_t low_bytes, size_t high_bytes, WatermarkCallback callback,
+                               void* context = nullptr) noexcept;
+
+    /**!
+     * @brief Spend credit already held. Producer side.
+     *
+     * @param[in] size_bytes Credit to spend
+     * @return Credit spent in bytes, less than `size_bytes` if not enough is held
+     */
+    size_t SpendCredit(size_t size_bytes) noexcept;
+
+    /**!
+     * @brief Sleep until a session has enough free space or a timeout elapses, whichever comes first. Producer side.
+     *
+     * @param[in] session Session that this FlowControl belongs to
+     * @param[in] size_bytes Free space to wait for
+     * @param[in] timeout Maximum time that will be spent waiting, zero checks the session once
+     * @retval true if the space is free
+     * @retval false if the timeout elapsed first
+     */
+    bool WaitForSpace(Outbound const& session, size_t size_bytes, std::chrono::microseconds timeout) noexcept;
+
+private:
+    /// @brief Bumped by the consumer whenever space is released while a producer waits
+    std::atomic<uint32_t> m_space_epoch {0U};
+
+    /// @brief Number of producers blocked in WaitForSpace
+    std::atomic<uint32_t> m_waiter_count {0U};
+
+    /// @brief Space set aside for the producer
+    std::atomic<size_t> m_credit_bytes {0U};
+
+    /// @brief Set by the producer at the high watermark, cleared by the consumer at the low watermark
+    std::atomic<bool> m_is_above_high {false};
+
+    size_t            m_low_watermark_bytes {0U};
+    size_t            m_high_watermark_bytes {std::numeric_limits<size_t>::max()};
+    WatermarkCallback m_callback {nullptr};
+    void*             m_context {nullptr};
+};
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,583 @@
+#pragma once
+
+#include "Inbound.hpp"
+#include "Outbound.hpp"
+#include "_Detail/Spin.hpp"
+
+#include "Core/Data/Crc.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Wire format of a frame. Every transmission is wrapped as:
+ *
+ * | Sync (2) | Length (2, little endian) | Header check (1) | Payload (Length) | Payload check (4, little endian) |
+ *
+ * The header check is a CRC-8 of the length, so that a corrupted length is caught before any payload is buffered and
+ * resynchronizing never has to look back further than the header. The payload check is a CRC-32 of the payload.
+ */
+struct FrameFormat
+{
+    constexpr static uint8_t kSync0 {0xA5U};
+    constexpr static uint8_t kSync1 {0x5AU};
+
+    constexpr static size_t kHeaderSizeBytes {5U};
+    constexpr static size_t kTrailerSizeBytes {4U};
+    constexpr static size_t kOverheadBytes {kHeaderSizeBytes + kTrailerSizeBytes};
+
+    /// @brief Largest payload that a single frame can carry
+    constexpr static size_t kMaxPayloadSizeBytes {0xFFFFU};
+};
+
+/**!
+ * @brief Outbound stage that frames every transmission before passing it to another Outbound session, such as a
+ * serial link. Egress puts to it like any other session.
+ *
+ * The payload checksum is taken while the payload is posted, without another buffer. Reservations are passed straight
+ * through to the underlying session with room left for the header and trailer, so that Egress still encodes in place
+ * and the checksum runs over bytes that were just written.
+ *
+ * @note One transmission is one frame, posted to the underlying session as one vectored Post of header, payload and
+ * trailer. A vectored Post is framed as a whole and may have at most kMaxPartCount parts.
+ */
+class FramedOutbound final : public Outbound
+{
+public:
+    /// @brief Most parts that a vectored Post may have
+    constexpr static size_t kMaxPartCount {8U};
+
+    /**!
+     * @brief Initializing constructor
+     *
+     * @param[in] session Session that frames are posted to, must outlive the stage
+     */
+    explicit FramedOutbound(Outbound& session) noexcept;
+
+    // FramedOutbound is not trivially constructible and refers to its session, it may not be copied or moved
+
+    FramedOutbound() = delete;
+
+    FramedOutbound(FramedOutbound const& copy) = delete;
+    FramedOutbound(FramedOutbound&& move)      = delete;
+
+    FramedOutbound& operator=(FramedOutbound const& copy) = delete;
+    FramedOutbound& operator=(FramedOutbound&& move)      = delete;
+
+    ~FramedOutbound() noexcept = default;
+
+    /**!
+     * @brief Publish the leading bytes of the last reservation as one frame
+     *
+     * @param[in] size_bytes Number of reserved bytes to publish, 0 abandons the reservation
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if there is no reservation or it is smaller than `size_bytes`
+     */
+    virtual Result Commit(size_t size_bytes) noexcept override;
+
+    /// @brief Largest payload that may be posted right now, the underlying session's space less the frame overhead
+    virtual size_t OutputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Post one span as a frame
+     *
+     * @param[in] tx Payload
+     * @param[in] timeout Maximum time that will be spent waiting on the underlying session
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Post several spans as the payload of one frame, gathered straight from the caller's storage
+     *
+     * @param[in] parts Spans making up the payload, in order
+     * @param[in] timeout Maximum time that will be spent waiting on the underlying session
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Reserve space for a payload within the underlying session's storage, along with its frame
+     *
+     * @param[in] size_bytes Size of the payload
+     * @return Span over the payload space, empty if the underlying session can't lend out enough of its storage
+     */
+    virtual Span<uint8_t> Reserve(size_t size_bytes) noexcept override;
+
+private:
+    /// @brief Underlying session
+    Outbound& m_session;
+
+    /// @brief Frame reserved within the underlying session, empty if there is no reservation
+    Span<uint8_t> m_reserved {nullptr, size_t {0U}};
+};
+
+/**!
+ * @brief Inbound stage that unwraps frames read from another Inbound session, such as a serial link. Only the payloads
+ * of frames that pass both checks are buffered, and Ingress gets from it like any other session.
+ *
+ * Frames are decoded as a stream, one pass over every byte that checksums and buffers payloads together. A corrupt
+ * header is rescanned for the next sync, which looks back at most kHeaderSizeBytes. A frame whose payload check fails
+ * is dropped whole, and decoding carries on at the byte after it.
+ *
+ * @note Update pulls frames from the underlying session and must be called for new data to become available. Request
+ * calls it while waiting, Peek and Consume do not. Spans returned by Peek are only valid until the next Update.
+ *
+ * @tparam CapacityV Size of the payload buffer in bytes, frames with larger payloads are dropped
+ */
+template<size_t CapacityV>
+class FramedInbound final : public Inbound
+{
+    static_assert(CapacityV > 0U, "`CapacityV` must be nonzero");
+
+public:
+    /// @brief Size of the payload buffer in bytes
+    constexpr static size_t kCapacityBytes {CapacityV};
+
+    /**!
+     * @brief Initializing constructor
+     *
+     * @param[in] session Session that frames are read from, must outlive the stage
+     */
+    explicit FramedInbound(Inbound& session) noexcept;
+
+    // FramedInbound is not trivially constructible and refers to its session, it may not be copied or moved
+
+    FramedInbound() = delete;
+
+    FramedInbound(FramedInbound const& copy) = delete;
+    FramedInbound(FramedInbound&& move)      = delete;
+
+    FramedInbound& operator=(FramedInbound const& copy) = delete;
+    FramedInbound& operator=(FramedInbound&& move)      = delete;
+
+    ~FramedInbound() noexcept = default;
+
+    /**!
+     * @brief Release the oldest buffered payload bytes
+     *
+     * @param[in] size_bytes Number of bytes to consume
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if fewer than `size_bytes` are buffered
+     */
+    virtual Result Consume(size_t size_bytes) noexcept override;
+
+    /// @brief Number of frames dropped for a failed check or a payload larger than kCapacityBytes
+    size_t GetDroppedFrameCount() const noexcept;
+
+    /// @brief Number of payload bytes buffered from whole, valid frames
+    virtual size_t InputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Look at the oldest buffered payload bytes in place
+     *
+     * @param[in] size_bytes Number of bytes to look at
+     * @return Span over the bytes, empty if fewer than `size_bytes` are buffered
+     */
+    virtual Span<uint8_t const> Peek(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Copy out the oldest buffered payload bytes, pulling frames from the underlying session until enough are
+     * buffered or the timeout elapses
+     *
+     * @param[in] rx Destination
+     * @param[in] timeout Maximum time that will be spent waiting on the underlying session
+     * @retval BinaryResult::kSuccessCode if `rx` was filled
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Pull every byte available from the underlying session and decode it, never blocks. Stops early, leaving
+     * bytes in the underlying session, once the payload buffer is too full for the next frame.
+     *
+     * @return Number of valid frames decoded
+     */
+    size_t Update() noexcept;
+
+private:
+    enum class State
+    {
+        kSync0,   ///< Hunting for the first sync byte
+        kSync1,   ///< Expecting the second sync byte
+        kHeader,  ///< Reading the length and header check
+        kPayload, ///< Reading the payload
+        kTrailer, ///< Reading the payload check
+        kDiscard  ///< Skipping a frame that is too large to buffer
+    };
+
+    /// @brief Largest block pulled at once from a session that can't be peeked
+    constexpr static size_t kStagingSizeBytes {64U};
+
+    /**!
+     * @brief Decodes bytes, stopping early if the next frame has no room
+     *
+     * @param[in] bytes Bytes to decode
+     * @return Number of bytes decoded
+     */
+    size_t Feed(Span<uint8_t const> bytes) noexcept;
+
+    /// @brief Number of bytes that may be fed right now without stopping early, Feed takes every one of them
+    size_t GetFeedableBytes() const noexcept;
+
+    /// @brief Ensures room for the payload of the current frame, compacting the buffer if need be
+    bool HasPayloadRoom() noexcept;
+
+    /// @brief Checks a completed header and moves on to its payload, or rescans it for a sync
+    void OnHeader() noexcept;
+
+    /// @brief Checks a completed trailer and publishes its payload, or drops the frame
+    void OnTrailer() noexcept;
+
+    /// @brief Underlying session
+    Inbound& m_session;
+
+    /// @brief Valid payloads, in order, from m_read to m_write. The current frame is decoded just past m_write.
+    uint8_t m_buffer[CapacityV] {};
+    size_t  m_read {0U};
+    size_t  m_write {0U};
+
+    State    m_state {State::kSync0};
+    uint8_t  m_field[FrameFormat::kTrailerSizeBytes] {};
+    size_t   m_num_field_bytes {0U};
+    size_t   m_frame_size_bytes {0U};
+    size_t   m_num_frame_bytes {0U};
+    uint32_t m_crc_state {data::kCrc32Initial};
+    size_t   m_num_decoded {0U};
+    size_t   m_num_dropped {0U};
+};
+
+namespace _detail
+{
+
+/**!
+ * @brief Writes a frame header
+ *
+ * @param[out] header Destination, FrameFormat::kHeaderSizeBytes long
+ * @param[in] payload_size_bytes Size of the payload
+ */
+inline void write_frame_header(uint8_t* header, size_t payload_size_bytes) noexcept
+{
+    header[0U] = FrameFormat::kSync0;
+    header[1U] = FrameFormat::kSync1;
+    header[2U] = static_cast<uint8_t>(payload_size_bytes & 0xFFU);
+    header[3U] = static_cast<uint8_t>((payload_size_bytes >> 8U) & 0xFFU);
+    header[4U] = data::crc8(Span<uint8_t const> {(header + 2U), size_t {2U}});
+}
+
+/**!
+ * @brief Writes a frame trailer
+ *
+ * @param[out] trailer Destination, FrameFormat::kTrailerSizeBytes long
+ * @param[in] crc Payload check
+ */
+inline void write_frame_trailer(uint8_t* trailer, uint32_t crc) noexcept
+{
+    for (size_t i = 0U; i < FrameFormat::kTrailerSizeBytes; i++)
+        trailer[i] = static_cast<uint8_t>((crc >> (i * 8U)) & 0xFFU);
+}
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FramedInbound constructor definitions           ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t CapacityV>
+FramedInbound<CapacityV>::FramedInbound(Inbound& session) noexcept : m_session {session}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FramedInbound method definitions in alphabetical order          ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t CapacityV>
+typename FramedInbound<CapacityV>::Result FramedInbound<CapacityV>::Consume(size_t size_bytes) noexcept
+{
+    if (InputBytesAvailable() < size_bytes)
+        return Result::Failure();
+
+    m_read += size_bytes;
+    return Result::Success();
+}
+
+template<size_t CapacityV>
+size_t FramedInbound<CapacityV>::GetDroppedFrameCount() const noexcept
+{
+    return m_num_dropped;
+}
+
+template<size_t CapacityV>
+size_t FramedInbound<CapacityV>::InputBytesAvailable() const noexcept
+{
+    return (m_write - m_read);
+}
+
+template<size_t CapacityV>
+Span<uint8_t const> FramedInbound<CapacityV>::Peek(size_t size_bytes) noexcept
+{
+    if (InputBytesAvailable() < size_bytes)
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    return Span<uint8_t const> {(m_buffer + m_read), size_bytes};
+}
+
+template<size_t CapacityV>
+typename FramedInbound<CapacityV>::Result FramedInbound<CapacityV>::Request(Span<uint8_t>             rx,
+                                                                            std::chrono::microseconds timeout) noexcept
+{
+    auto is_buffered {[&]() -> bool
+                      {
+                          static_cast<void>(Update());
+                          return (InputBytesAvailable() >= rx.size());
+                      }};
+    if (!_detail::spin_until(is_buffered, timeout))
+        return Result::Failure();
+
+    static_cast<void>(std::memcpy(rx.data(), (m_buffer + m_read), rx.size()));
+    m_read += rx.size();
+    return Result::Success();
+}
+
+template<size_t CapacityV>
+size_t FramedInbound<CapacityV>::Update() noexcept
+{
+    size_t const num_decoded {m_num_decoded};
+
+    size_t available_bytes {m_session.InputBytesAvailable()};
+    while (available_bytes > 0U)
+    {
+        size_t const feedable_bytes {std::min(available_bytes, GetFeedableBytes())};
+        if (feedable_bytes == 0U)
+            break;
+
+        // Decode in place when the session can lend out its storage
+        Span<uint8_t const> peeked_span {m_session.Peek(feedable_bytes)};
+        if (peeked_span.size() >= feedable_bytes)
+        {
+            size_t const num_fed {Feed(peeked_span)};
+            if ((num_fed == 0U) || m_session.Consume(num_fed).IsFailure())
+                break;
+
+            available_bytes -= num_fed;
+            continue;
+        }
+
+        // Otherwise, pull a block through the stack
+        uint8_t       staging_buffer[kStagingSizeBytes];
+        Span<uint8_t> staging_span {staging_buffer, std::min(feedable_bytes, kStagingSizeBytes)};
+        if (m_session.Request(staging_span, std::chrono::microseconds::zero()).IsFailure())
+            break;
+
+        static_cast<void>(Feed(span_cast<uint8_t const>(staging_span)));
+        available_bytes -= staging_span.size();
+    }
+
+    return (m_num_decoded - num_decoded);
+}
+
+//  Private     ========================================================================================================
+
+template<size_t CapacityV>
+size_t FramedInbound<CapacityV>::Feed(Span<uint8_t const> bytes) noexcept
+{
+    size_t num_fed {0U};
+    while (num_fed < bytes.size())
+    {
+        uint8_t const byte {bytes[num_fed]};
+        switch (m_state)
+        {
+        case State::kSync0:
+            if (byte == FrameFormat::kSync0)
+                m_state = State::kSync1;
+            num_fed++;
+            break;
+
+        case State::kSync1:
+            if (byte == FrameFormat::kSync1)
+            {
+                m_state           = State::kHeader;
+                m_num_field_bytes = 0U;
+            }
+            else if (byte != FrameFormat::kSync0)
+            {
+                m_state = State::kSync0;
+            }
+            num_fed++;
+            break;
+
+        case State::kHeader:
+            m_field[m_num_field_bytes++] = byte;
+            num_fed++;
+            if (m_num_field_bytes == (FrameFormat::kHeaderSizeBytes - 2U))
+                OnHeader();
+            break;
+
+        case State::kPayload:
+        {
+            if ((m_num_frame_bytes == 0U) && !HasPayloadRoom())
+                return num_fed;
+
+            // Checksum and buffer the payload a block at a time
+            size_t const              block_size_bytes {std::min((bytes.size() - num_fed),
+                                                                 (m_frame_size_bytes - m_num_frame_bytes))};
+            Span<uint8_t const> const block {bytes.subspan(num_fed, block_size_bytes)};
+            m_crc_state = data::crc32_update(m_crc_state, block);
+            static_cast<void>(std::memcpy((m_buffer + m_write + m_num_frame_bytes), block.data(), block_size_bytes));
+
+            m_num_frame_bytes += block_size_bytes;
+            num_fed += block_size_bytes;
+            if (m_num_frame_bytes == m_frame_size_bytes)
+            {
+                m_state           = State::kTrailer;
+                m_num_field_bytes = 0U;
+            }
+            break;
+        }
+
+        case State::kTrailer:
+            m_field[m_num_field_bytes++] = byte;
+            num_fed++;
+            if (m_num_field_bytes == FrameFormat::kTrailerSizeBytes)
+                OnTrailer();
+            break;
+
+        case State::kDiscard:
+        {
+            size_t const skip_size_bytes {std::min((bytes.size() - num_fed), (m_frame_size_bytes - m_num_frame_bytes))};
+            m_num_frame_bytes += skip_size_bytes;
+            num_fed += skip_size_bytes;
+            if (m_num_frame_bytes == m_frame_size_bytes)
+                m_state = State::kSync0;
+            break;
+        }
+        }
+    }
+
+    return num_fed;
+}
+
+template<size_t CapacityV>
+size_t FramedInbound<CapacityV>::GetFeedableBytes() const noexcept
+{
+    switch (m_state)
+    {
+    // Never more than Feed is sure to take before it stops for room, bytes requested through the stack can't go back
+    case State::kSync0:
+        return FrameFormat::kHeaderSizeBytes;
+
+    case State::kSync1:
+        return (FrameFormat::kHeaderSizeBytes - 1U);
+
+    case State::kHeader:
+        return ((FrameFormat::kHeaderSizeBytes - 2U) - m_num_field_bytes);
+
+    case State::kPayload:
+        // Nothing more until the payload has room, Feed makes room if it can
+        if ((m_num_frame_bytes == 0U) && ((CapacityV - (m_write - m_read)) < m_frame_size_bytes))
+            return 0U;
+        return ((m_frame_size_bytes - m_num_frame_bytes) + FrameFormat::kTrailerSizeBytes);
+
+    case State::kTrailer:
+        return (FrameFormat::kTrailerSizeBytes - m_num_field_bytes);
+
+    case State::kDiscard:
+        return (m_frame_size_bytes - m_num_frame_bytes);
+    }
+
+    return 0U;
+}
+
+template<size_t CapacityV>
+bool FramedInbound<CapacityV>::HasPayloadRoom() noexcept
+{
+    if ((CapacityV - m_write) >= m_frame_size_bytes)
+        return true;
+
+    // Move unread payloads to the front of the buffer
+    size_t const num_unread {m_write - m_read};
+    static_cast<void>(std::memmove(m_buffer, (m_buffer + m_read), num_unread));
+    m_read  = 0U;
+    m_write = num_unread;
+
+    return ((CapacityV - m_write) >= m_frame_size_bytes);
+}
+
+template<size_t CapacityV>
+void FramedInbound<CapacityV>::OnHeader() noexcept
+{
+    uint8_t const expected_check {data::crc8(Span<uint8_t const> {m_field, size_t {2U}})};
+    if (m_field[2U] != expected_check)
+    {
+        // The sync was false or the header is corrupt, look for a sync within what was read of it
+        uint8_t rescan[FrameFormat::kHeaderSizeBytes - 2U] {};
+        static_cast<void>(std::memcpy(rescan, m_field, sizeof(rescan)));
+
+        m_num_dropped++;
+        m_state = State::kSync0;
+        static_cast<void>(Feed(Span<uint8_t const> {rescan, sizeof(rescan)}));
+        return;
+    }
+
+    m_frame_size_bytes = (static_cast<size_t>(m_field[0U]) | (static_cast<size_t>(m_field[1U]) << 8U));
+    m_num_frame_bytes  = 0U;
+    m_num_field_bytes  = 0U;
+    m_crc_state        = data::kCrc32Initial;
+
+    if (m_frame_size_bytes > CapacityV)
+    {
+        m_num_dropped++;
+        m_frame_size_bytes += FrameFormat::kTrailerSizeBytes;
+        m_state = State::kDiscard;
+    }
+    else if (m_frame_size_bytes == 0U)
+    {
+        m_state = State::kTrailer;
+    }
+    else
+    {
+        m_state = State::kPayload;
+    }
+}
+
+template<size_t CapacityV>
+void FramedInbound<CapacityV>::OnTrailer() noexcept
+{
+    uint32_t received_check {0U};
+    for (size_t i = 0U; i < FrameFormat::kTrailerSizeBytes; i++)
+        received_check |= (static_cast<uint32_t>(m_field[i]) << (i * 8U));
+
+    if (received_check == data::crc32_finalize(m_crc_state))
+    {
+        m_write += m_frame_size_bytes;
+        m_num_decoded++;
+    }
+    else
+    {
+        m_num_dropped++;
+    }
+
+    m_state = State::kSync0;
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
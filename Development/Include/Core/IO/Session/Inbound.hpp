@@ -1,9 +1,14 @@
 #pragma once
 
+#include "Transference.hpp"
+#include "_Detail/Spin.hpp"
+
+#include "Core/Platform/Clock.hpp"
 #include "Core/Result.hpp"
 #include "Core/Span.hpp"
 
 #include <chrono>
+#include <cstring>
 
 namespace shmit
 {
@@ -17,9 +22,147 @@ class Inbound
 public:
     using Result = BinaryResult;
 
+    /// @brief Largest transmission that the default vectored Request scatters from the stack for sessions that can't
+    /// lend out their storage
+    constexpr static size_t kScatterSizeBytes {256U};
+
     virtual size_t InputBytesAvailable() const noexcept = 0;
 
     virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) = 0;
+
+    /**!
+     * @brief Request one transmission scattered across several spans, in order. Either every part is filled or nothing
+     * is consumed.
+     *
+     * @note The default implementation scatters directly out of a peeked span. Otherwise it requests up to
+     * kScatterSizeBytes on the stack with one scalar Request and scatters from there. Larger transmissions wait for a
+     * peek, or for the session to hold enough data for every part, and in the latter case request the parts one by one
+     * under one deadline. Those are all-or-nothing only while the caller is the session's single consumer.
+     *
+     * @param[in] parts Destination spans, filled in order
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every part was filled
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<Span<uint8_t> const> parts, std::chrono::microseconds timeout) noexcept
+    {
+        if (parts.count() == 1U)
+            return Request(parts[0], timeout);
+
+        size_t size_bytes {0U};
+        for (Span<uint8_t> const& part : parts)
+            size_bytes += part.size();
+
+        // Scatter straight out of the session's storage when it can lend it out right away
+        Span<uint8_t const> peeked {Peek(size_bytes)};
+        if (peeked.size() >= size_bytes)
+        {
+            Scatter(peeked.data(), parts);
+            return Consume(size_bytes);
+        }
+
+        // Otherwise request on to the stack, leaving any wait to the scalar Request
+        if (size_bytes <= kScatterSizeBytes)
+        {
+            uint8_t scattered[kScatterSizeBytes];
+            if (Request(Span<uint8_t> {scattered, size_bytes}, timeout).IsFailure())
+                return Result::Failure();
+
+            Scatter(scattered, parts);
+            return Result::Success();
+        }
+
+        // Otherwise wait for a peek, or for enough data to request every part
+        auto const kDeadline {platform::Clock::now() + timeout};
+        auto       has_data {[&]() -> bool
+                       {
+                           peeked = Peek(size_bytes);
+                           return ((peeked.size() >= size_bytes) || (InputBytesAvailable() >= size_bytes));
+                       }};
+        if (!_detail::spin_until(has_data, timeout))
+            return Result::Failure();
+
+        if (peeked.size() >= size_bytes)
+        {
+            Scatter(peeked.data(), parts);
+            return Consume(size_bytes);
+        }
+
+        // The session has the data but can't lend it out, with a single consumer nothing takes it before every part
+        for (Span<uint8_t> const& part : parts)
+        {
+            if (Request(part, _detail::get_time_remaining(kDeadline)).IsFailure())
+                return Result::Failure();
+        }
+
+        return Result::Success();
+    }
+
+    /**!
+     * @brief Start requesting in to a Transference's bytes and return right away. The session completes the
+     * Transference later, possibly from an ISR or DMA completion handler, and the caller polls it or waits on its
+     * callback in the meantime.
+     *
+     * @note The default implementation requests synchronously with no timeout and completes the Transference before
+     * returning, sessions backed by asynchronous hardware override this
+     *
+     * @param[in] transference Transmission to start, must be constructed over writable bytes and outlive it
+     * @retval BinaryResult::kSuccessCode if the transmission was started, `transference` reports its outcome
+     * @retval BinaryResult::kFailureCode if it was rejected outright, `transference` is completed as failed
+     */
+    virtual Result RequestAsync(Transference& transference) noexcept
+    {
+        Span<uint8_t> rx {transference.GetWritableData()};
+        Result        request_result {(rx.size() > 0U) ? Request(rx, std::chrono::microseconds::zero())
+                                                       : Result::Failure()};
+        transference.SetResult(request_result.IsSuccess() ? Transference::Result::Success()
+                                                          : Transference::Result::Failure());
+        return request_result;
+    }
+
+    /**!
+     * @brief Look at the oldest buffered bytes in place, without consuming them, so that data may be decoded directly
+     * from the session's own storage. Sessions that can't lend out their storage return an empty span and callers fall
+     * back to Request.
+     *
+     * @param[in] size_bytes Number of bytes to look at
+     * @return Span over the buffered bytes, empty if they are not available contiguously right now
+     */
+    virtual Span<uint8_t const> Peek(size_t size_bytes) noexcept
+    {
+        static_cast<void>(size_bytes); // Avoid unused warning
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+    }
+
+    /**!
+     * @brief Drop the oldest buffered bytes, typically after decoding them through Peek
+     *
+     * @param[in] size_bytes Number of bytes to consume
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if fewer than `size_bytes` are buffered
+     */
+    virtual Result Consume(size_t size_bytes) noexcept
+    {
+        static_cast<void>(size_bytes); // Avoid unused warning
+        return Result::Failure();
+    }
+
+private:
+    /**!
+     * @brief Copy a source out to parts back to back
+     *
+     * @param[in] src Source, at least as large as every part together
+     * @param[in] parts Destination spans, filled in order
+     */
+    static void Scatter(uint8_t const* src, Span<Span<uint8_t> const> parts) noexcept
+    {
+        size_t offset_bytes {0U};
+        for (Span<uint8_t> const& part : parts)
+        {
+            static_cast<void>(std::memcpy(part.data(), (src + offset_bytes), part.size()));
+            offset_bytes += part.size();
+        }
+    }
 };
 
 } // namespace session
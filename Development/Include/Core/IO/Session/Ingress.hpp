@@ -26,6 +26,9 @@ public:
     /// @brief Type that is read from the Ingress instance
     using value_type = typename Input<T>::value_type;
 
+    /// @brief Largest stack buffer that GetMany will stage an encoded block in, unless one object is larger
+    constexpr static size_t kGetManyStagingSizeBytes {_detail::kIngressStagingSizeBytes};
+
     /**!
      * @brief Initializing constructor. Connects Ingress to an Inbound session buffer.
      *
@@ -53,6 +56,34 @@ public:
 
     BinaryResult Get(value_type& data, std::chrono::microseconds timeout) noexcept;
 
+    /**!
+     * @brief Start requesting an object's data in to a Transference from the connected session buffer, returning right
+     * away. Once `transference` completes successfully its bytes may be decoded with data::decode.
+     *
+     * @param[in] transference Transmission to start, constructed over exactly
+     * `data::footprint_size_bytes_v<value_type>` writable bytes that outlive it
+     * @retval BinaryResult::kSuccessCode if the transmission was started
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult GetAsync(Transference& transference) noexcept;
+
+    /**!
+     * @brief Drain as many whole objects as are available from the connected Inbound buffer, in order, with a single
+     * availability check
+     *
+     * @note Objects are decoded straight out of the session's storage when it can lend it out. Otherwise they are
+     * requested kGetManyStagingSizeBytes at a time if they are arithmetic or enumerations, or one at a time if they
+     * could fail to decode, and only the first request may wait. Reading stops at the first object that fails to
+     * decode, and everything after it is left in the session. The failing object is consumed only when it had to be
+     * requested. Objects for which
+     * data::is_wire_identical holds are requested straight in to `data`, with no staging.
+     *
+     * @param[out] data Destination for the objects, filled from the front
+     * @param[in] timeout Maximum time that will be spent waiting on the session
+     * @return Number of objects read in to `data`
+     */
+    size_t GetMany(Span<value_type> data, std::chrono::microseconds timeout) noexcept;
+
 private:
     /// @brief Reference to connected session
     Inbound& m_buffer;
@@ -112,26 +143,19 @@ BinaryResult Ingress<T>::Get(value_type& data) noexcept
 template<typename T>
 BinaryResult Ingress<T>::Get(value_type& data, std::chrono::microseconds timeout) noexcept
 {
-    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<value_type>};
-
-    // Guard against underflowing the Inbound buffer
-    if (m_buffer.InputBytesAvailable() < kDataSizeBytes)
-        return BinaryResult::Failure();
-
-    // Pack Transference with apropriately sized, empty buffer and pass to session for request
-    uint8_t       encoded_buffer[kDataSizeBytes];
-    Span<uint8_t> encoded_span {encoded_buffer, kDataSizeBytes};
-    static_cast<void>(std::memset(encoded_buffer, 0U, kDataSizeBytes)); // Avoid unused return warning
-
-    Inbound::Result request_result {m_buffer.Request(encoded_span, timeout)};
-    if (request_result.IsFailure())
-        return BinaryResult::Failure();
-
-    // Transference has valid data to decode
-    // Perform decoding, return result
-    size_t       bits_decoded {0U};
-    BinaryResult decode_result {data::decode(encoded_buffer, bits_decoded, data)};
-    return (decode_result.IsSuccess() ? BinaryResult::Success() : BinaryResult::Failure());
+    return _detail::ingress_get(m_buffer, data, timeout);
+}
+
+template<typename T>
+BinaryResult Ingress<T>::GetAsync(Transference& transference) noexcept
+{
+    return _detail::ingress_get_async<value_type>(m_buffer, transference);
+}
+
+template<typename T>
+size_t Ingress<T>::GetMany(Span<value_type> data, std::chrono::microseconds timeout) noexcept
+{
+    return _detail::ingress_get_many(m_buffer, data, timeout);
 }
 
 } // namespace session
@@ -0,0 +1,268 @@
+#pragma once
+
+#include "Core/Platform/Clock.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/// @brief Whether session instrumentation is compiled in, set by defining SHMIT_SESSION_INSTRUMENTATION
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+constexpr static bool kIsSessionInstrumented {true};
+#else
+constexpr static bool kIsSessionInstrumented {false};
+#endif
+
+/**!
+ * @brief Events counted by session instrumentation
+ *
+ */
+enum class SessionCounter : size_t
+{
+    kPuts,               ///< Objects put through an Egress
+    kGets,               ///< Objects got through an Ingress
+    kBytesPosted,        ///< Encoded bytes put through an Egress
+    kBytesRequested,     ///< Encoded bytes got through an Ingress
+    kOutputRejections,   ///< Puts turned away because OutputBytesAvailable was too small
+    kInputRejections,    ///< Gets turned away because InputBytesAvailable was too small
+    kPostFailures,       ///< Posts, commits or encodings that failed once admitted
+    kRequestFailures,    ///< Requests, consumes or decodings that failed once admitted
+    kWaitTimeouts,       ///< Session waits that ran out of time
+    kCount
+};
+
+/**!
+ * @brief Durations recorded by session instrumentation
+ *
+ */
+enum class SessionHistogram : size_t
+{
+    kEncodeTime,      ///< Encoding an object for a put
+    kDecodeTime,      ///< Decoding an object for a get
+    kPostWaitTime,    ///< Waiting on a session to accept a post
+    kRequestWaitTime, ///< Waiting on a session to satisfy a request
+    kCount
+};
+
+/**!
+ * @brief Totals scraped from every thread's instrumentation
+ *
+ * Histograms have power of two buckets in microseconds. Bucket 0 counts durations under 1 us, bucket `i` counts
+ * durations from 2^(i-1) up to 2^i us, and the last bucket also counts everything longer.
+ */
+struct SessionStatistics
+{
+    constexpr static size_t kCounterCount {static_cast<size_t>(SessionCounter::kCount)};
+    constexpr static size_t kHistogramCount {static_cast<size_t>(SessionHistogram::kCount)};
+    constexpr static size_t kHistogramBucketCount {24U};
+
+    uint64_t counters[kCounterCount] {};
+    uint64_t histograms[kHistogramCount][kHistogramBucketCount] {};
+
+    /// @brief Total of a counter
+    uint64_t GetCounter(SessionCounter counter) const noexcept
+    {
+        return counters[static_cast<size_t>(counter)];
+    }
+
+    /// @brief Number of durations recorded in a histogram
+    uint64_t GetSampleCount(SessionHistogram histogram) const noexcept
+    {
+        uint64_t num_samples {0U};
+        for (uint64_t bucket : histograms[static_cast<size_t>(histogram)])
+            num_samples += bucket;
+
+        return num_samples;
+    }
+};
+
+/**!
+ * @brief Adds to a counter. Compiles to nothing unless instrumentation is enabled.
+ *
+ * @param[in] counter Counter to add to
+ * @param[in] amount Amount to add
+ */
+inline void instrument_count(SessionCounter counter, uint64_t amount = 1U) noexcept;
+
+/**!
+ * @brief Records a duration in a histogram. Compiles to nothing unless instrumentation is enabled.
+ *
+ * @param[in] histogram Histogram to record in
+ * @param[in] duration Duration to record
+ */
+inline void instrument_record(SessionHistogram histogram, std::chrono::microseconds duration) noexcept;
+
+/**!
+ * @brief Sums the instrumentation of every thread, past and present. Safe to call from any thread while sessions are in
+ * use, the totals are read counter by counter and so may be momentarily inconsistent with each other.
+ *
+ * @return Totals, all zero unless instrumentation is enabled
+ */
+SessionStatistics scrape_session_statistics() noexcept;
+
+/**!
+ * @brief Measures a duration for a histogram, reading the clock only while instrumentation is enabled
+ *
+ */
+class InstrumentStopwatch
+{
+public:
+    /// @brief Starts timing
+    InstrumentStopwatch() noexcept;
+
+    /**!
+     * @brief Records the time since starting, or since the last record, then restarts
+     *
+     * @param[in] histogram Histogram to record in
+     */
+    void Record(SessionHistogram histogram) noexcept;
+
+private:
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+    platform::Clock::time_point m_start;
+#endif
+};
+
+namespace _detail
+{
+
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+
+/**!
+ * @brief One thread's instrumentation. Each thread leases its own block, so counting is a plain load and store with no
+ * read-modify-write. Threads beyond the pool share one block and count with atomic adds instead.
+ *
+ */
+struct alignas(64) InstrumentBlock
+{
+    std::atomic<uint64_t> counters[SessionStatistics::kCounterCount];
+    std::atomic<uint64_t> histograms[SessionStatistics::kHistogramCount][SessionStatistics::kHistogramBucketCount];
+    std::atomic<bool>     is_leased;
+    bool                  is_shared;
+};
+
+/**!
+ * @brief Leases a block to the calling thread, sharing one if none are free
+ *
+ * @return Leased block
+ */
+InstrumentBlock& lease_instrument_block() noexcept;
+
+/**!
+ * @brief Returns a block to the pool when its thread exits. The block keeps its counts, the next thread to lease it
+ * carries on from them, so scraped totals never go backwards.
+ *
+ * @param[in] block Block to return
+ */
+void release_instrument_block(InstrumentBlock& block) noexcept;
+
+/// @brief Holds the calling thread's lease for as long as the thread runs
+struct InstrumentLease
+{
+    InstrumentLease() noexcept : block {lease_instrument_block()}
+    {
+    }
+
+    ~InstrumentLease() noexcept
+    {
+        release_instrument_block(block);
+    }
+
+    InstrumentBlock& block;
+};
+
+/// @brief Calling thread's block
+inline InstrumentBlock& local_instrument_block() noexcept
+{
+    thread_local InstrumentLease const lease {};
+    return lease.block;
+}
+
+inline void instrument_add(InstrumentBlock& block, std::atomic<uint64_t>& value, uint64_t amount) noexcept
+{
+    if (block.is_shared)
+        static_cast<void>(value.fetch_add(amount, std::memory_order_relaxed));
+    else
+        value.store((value.load(std::memory_order_relaxed) + amount), std::memory_order_relaxed);
+}
+
+#endif
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Namespace function definitions              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void instrument_count(SessionCounter counter, uint64_t amount) noexcept
+{
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+    _detail::InstrumentBlock& block {_detail::local_instrument_block()};
+    _detail::instrument_add(block, block.counters[static_cast<size_t>(counter)], amount);
+#else
+    static_cast<void>(counter);
+    static_cast<void>(amount);
+#endif
+}
+
+inline void instrument_record(SessionHistogram histogram, std::chrono::microseconds duration) noexcept
+{
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+    // Bucket is the bit width of the duration in whole microseconds
+    uint64_t bucket_index {0U};
+    for (uint64_t count = static_cast<uint64_t>((duration.count() > 0) ? duration.count() : 0); count != 0U;
+         count >>= 1U)
+        bucket_index++;
+
+    if (bucket_index >= SessionStatistics::kHistogramBucketCount)
+        bucket_index = (SessionStatistics::kHistogramBucketCount - 1U);
+
+    _detail::InstrumentBlock& block {_detail::local_instrument_block()};
+    _detail::instrument_add(block, block.histograms[static_cast<size_t>(histogram)][bucket_index], 1U);
+#else
+    static_cast<void>(histogram);
+    static_cast<void>(duration);
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  InstrumentStopwatch constructor definitions         ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+inline InstrumentStopwatch::InstrumentStopwatch() noexcept : m_start {platform::Clock::now()}
+{
+}
+#else
+inline InstrumentStopwatch::InstrumentStopwatch() noexcept = default;
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  InstrumentStopwatch method definitions in alphabetical order        ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+inline void InstrumentStopwatch::Record(SessionHistogram histogram) noexcept
+{
+#ifdef SHMIT_SESSION_INSTRUMENTATION
+    platform::Clock::time_point const now {platform::Clock::now()};
+    instrument_record(histogram, std::chrono::duration_cast<std::chrono::microseconds>(now - m_start));
+    m_start = now;
+#else
+    static_cast<void>(histogram);
+#endif
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,316 @@
+#pragma once
+
+#include "Inbound.hpp"
+#include "Outbound.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief On-disk layout of a mapped file segment. A recording is a numbered series of preallocated segment files,
+ * `<prefix>.000000`, `<prefix>.000001` and so on, each of which is:
+ *
+ * | Header (kHeaderSizeBytes) | Data (capacity) |
+ *
+ * The header is shared through the mapping itself. The writer publishes bytes by storing the data tail with release
+ * ordering, and seals the segment once it moves on to the next one, so that readers in any process can follow along.
+ * A transmission never straddles two segments.
+ */
+struct MappedFileFormat
+{
+    /// @brief Marks a file as a mapped file segment
+    constexpr static uint32_t kMagic {0x53484D46U}; // "SHMF"
+
+    /// @brief Size of the segment header, one cache line
+    constexpr static size_t kHeaderSizeBytes {64U};
+
+    /// @brief Longest path prefix that segments may be named with
+    constexpr static size_t kMaxPathSizeBytes {256U};
+
+    /// @brief Segment header as laid out at the start of the mapping
+    struct Header
+    {
+        uint32_t              magic;
+        std::atomic<uint32_t> is_sealed;
+        uint64_t              capacity_bytes;
+        std::atomic<uint64_t> tail_bytes;
+    };
+
+    static_assert(sizeof(Header) <= kHeaderSizeBytes, "Segment header must fit within kHeaderSizeBytes");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "Segment header atomics must be lock-free to be shared "
+                                                              "through a mapping");
+};
+
+namespace _detail
+{
+
+/// @brief One mapped segment file, owned by a mapped file session
+struct MappedSegment
+{
+    int      file_descriptor {-1};
+    uint8_t* mapping {nullptr};
+    size_t   mapping_size_bytes {0U};
+
+    MappedFileFormat::Header* GetHeader() const noexcept
+    {
+        return reinterpret_cast<MappedFileFormat::Header*>(mapping);
+    }
+
+    uint8_t* GetData() const noexcept
+    {
+        return (mapping + MappedFileFormat::kHeaderSizeBytes);
+    }
+
+    bool IsMapped() const noexcept
+    {
+        return (mapping != nullptr);
+    }
+};
+
+} // namespace _detail
+
+/**!
+ * @brief Outbound session that records transmissions to a series of memory-mapped, preallocated segment files. A Post
+ * is one copy in to the mapping followed by an atomic store of the segment's tail, and Egress encodes in place through
+ * Reserve/Commit. Native builds only.
+ *
+ * When a transmission doesn't fit in what is left of the current segment, the writer seals it and moves on to a
+ * standby segment that was mapped ahead of time. PrepareNextSegment maps the next standby, and unmaps the segment that
+ * was retired, off the write path. It may be called from a maintenance thread; if nobody has called it by the time a
+ * rotation is due, the writer maps the next segment itself.
+ *
+ * @note Exactly one thread may Post at a time. PrepareNextSegment may be called concurrently from one other thread.
+ */
+class MappedFileOutbound final : public Outbound
+{
+public:
+    /**!
+     * @brief Initializing constructor, see Open
+     *
+     * @param[in] path_prefix Path that segment files are named after, copied and must be shorter than
+     * MappedFileFormat::kMaxPathSizeBytes
+     * @param[in] segment_capacity_bytes Size of the data area of each segment, rounded up to whole pages
+     * @param[in] use_huge_pages True to advise the kernel to back mappings with huge pages where it can
+     */
+    MappedFileOutbound(char const* path_prefix, size_t segment_capacity_bytes, bool use_huge_pages = false) noexcept;
+
+    /// @brief Seals and unmaps the current segment, and removes the unused standby segment
+    ~MappedFileOutbound() noexcept;
+
+    // MappedFileOutbound owns its mappings and may not be copied or moved
+
+    MappedFileOutbound() = delete;
+
+    MappedFileOutbound(MappedFileOutbound const& copy) = delete;
+    MappedFileOutbound(MappedFileOutbound&& move)      = delete;
+
+    MappedFileOutbound& operator=(MappedFileOutbound const& copy) = delete;
+    MappedFileOutbound& operator=(MappedFileOutbound&& move)      = delete;
+
+    /**!
+     * @brief Publish the leading bytes of the last reservation
+     *
+     * @param[in] size_bytes Number of reserved bytes to publish, 0 abandons the reservation
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if `size_bytes` exceeds the reservation
+     */
+    virtual Result Commit(size_t size_bytes) noexcept override;
+
+    /// @brief Index of the segment currently being written
+    size_t GetSegmentIndex() const noexcept;
+
+    /**!
+     * @brief Creates and maps the first segment of the recording, and prepares a standby segment. Existing segment
+     * files of the same name are overwritten.
+     *
+     * @retval BinaryResult::kSuccessCode if the recording is ready to be posted to
+     * @retval BinaryResult::kFailureCode if a segment could not be created or mapped
+     */
+    Result Open() noexcept;
+
+    /**!
+     * @brief Largest transmission that a Post will take, a whole segment's capacity once open
+     *
+     * @return Size in bytes
+     */
+    virtual size_t OutputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Copy a transmission in to the current segment, rotating to the next segment if it doesn't fit
+     *
+     * @param[in] tx Bytes to post
+     * @param[in] timeout Maximum time that will be spent waiting on a concurrent PrepareNextSegment while rotating
+     * @retval BinaryResult::kSuccessCode if every byte was posted
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Gather several spans in to the current segment as one transmission
+     *
+     * @param[in] parts Spans to post, in order
+     * @param[in] timeout Maximum time that will be spent waiting on a concurrent PrepareNextSegment while rotating
+     * @retval BinaryResult::kSuccessCode if every part was posted
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Maps the next standby segment and unmaps the last retired one, if either is due. Never touches the
+     * segment being written.
+     *
+     * @retval BinaryResult::kSuccessCode if a standby segment is ready
+     * @retval BinaryResult::kFailureCode if the writer is rotating right now or the segment could not be mapped
+     */
+    Result PrepareNextSegment() noexcept;
+
+    /**!
+     * @brief Reserve contiguous space within the current segment to encode in to, rotating if it doesn't fit. Never
+     * waits on a concurrent PrepareNextSegment.
+     *
+     * @param[in] size_bytes Size of the space to reserve
+     * @return Span over the reserved space, empty if it could not be reserved
+     */
+    virtual Span<uint8_t> Reserve(size_t size_bytes) noexcept override;
+
+private:
+    /// @brief Makes room for a transmission, rotating to the standby segment if the current one is too full
+    bool MakeRoom(size_t size_bytes, std::chrono::microseconds timeout) noexcept;
+
+    /// @brief Publishes bytes written at the tail of the current segment
+    void Publish(size_t size_bytes) noexcept;
+
+    /// @brief Swaps in the standby segment, mapping it first if it isn't ready. Fails if PrepareNextSegment holds the
+    /// segments.
+    bool TryRotate() noexcept;
+
+    /// @brief Prepares segments, the caller must hold m_is_locked
+    bool UnlockedPrepare() noexcept;
+
+    char   m_path_prefix[MappedFileFormat::kMaxPathSizeBytes];
+    size_t m_capacity_bytes;
+    bool   m_use_huge_pages;
+
+    _detail::MappedSegment m_active {};
+    _detail::MappedSegment m_standby {};
+    _detail::MappedSegment m_retired {};
+
+    size_t m_segment_index {0U};
+    size_t m_tail_bytes {0U};
+    size_t m_reserved_bytes {0U};
+
+    /// @brief Held while the standby and retired segments are being touched
+    std::atomic<bool> m_is_locked {false};
+};
+
+/**!
+ * @brief Inbound session that replays a recording made by MappedFileOutbound. Bytes are read straight out of a
+ * read-only mapping, and Ingress decodes in place through Peek/Consume. Sealed segments are followed on to the next one
+ * automatically, so a whole recording reads as one stream. Native builds only.
+ *
+ * @note Update must be called to pick up bytes that a live writer published after the reader caught up with it. Request
+ * calls it while waiting.
+ *
+ * @note Exactly one thread may Request at a time
+ */
+class MappedFileInbound final : public Inbound
+{
+public:
+    /**!
+     * @brief Initializing constructor, see Open
+     *
+     * @param[in] path_prefix Path that segment files are named after, copied and must be shorter than
+     * MappedFileFormat::kMaxPathSizeBytes
+     * @param[in] use_huge_pages True to advise the kernel to back mappings with huge pages where it can
+     */
+    explicit MappedFileInbound(char const* path_prefix, bool use_huge_pages = false) noexcept;
+
+    /// @brief Unmaps the current segment
+    ~MappedFileInbound() noexcept;
+
+    // MappedFileInbound owns its mapping and may not be copied or moved
+
+    MappedFileInbound() = delete;
+
+    MappedFileInbound(MappedFileInbound const& copy) = delete;
+    MappedFileInbound(MappedFileInbound&& move)      = delete;
+
+    MappedFileInbound& operator=(MappedFileInbound const& copy) = delete;
+    MappedFileInbound& operator=(MappedFileInbound&& move)      = delete;
+
+    /**!
+     * @brief Release bytes that were looked at through Peek
+     *
+     * @param[in] size_bytes Number of bytes to release
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if fewer than `size_bytes` are available
+     */
+    virtual Result Consume(size_t size_bytes) noexcept override;
+
+    /// @brief Index of the segment currently being read
+    size_t GetSegmentIndex() const noexcept;
+
+    /**!
+     * @brief Number of published bytes left to read in the current segment
+     *
+     * @return Size in bytes
+     */
+    virtual size_t InputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Maps the first segment of the recording for reading
+     *
+     * @retval BinaryResult::kSuccessCode if the recording is ready to be read
+     * @retval BinaryResult::kFailureCode if the first segment could not be mapped or is not a segment
+     */
+    Result Open() noexcept;
+
+    /**!
+     * @brief Look at recorded bytes in place
+     *
+     * @param[in] size_bytes Number of bytes to look at
+     * @return Span over the bytes, empty if fewer than `size_bytes` are available
+     */
+    virtual Span<uint8_t const> Peek(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Copy recorded bytes out, waiting up to a timeout for a live writer to publish them
+     *
+     * @param[in] rx Destination, filled in its entirety
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every byte was received
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Moves on to the next segment if the current one is sealed and fully read
+     *
+     * @return Number of bytes available after updating
+     */
+    size_t Update() noexcept;
+
+private:
+    char m_path_prefix[MappedFileFormat::kMaxPathSizeBytes];
+    bool m_use_huge_pages;
+
+    _detail::MappedSegment m_segment {};
+
+    size_t m_segment_index {0U};
+    size_t m_head_bytes {0U};
+};
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,383 @@
+#pragma once
+
+#include "Inbound.hpp"
+#include "Instrumentation.hpp"
+#include "Outbound.hpp"
+
+#include "Core/Data/Decode.hpp"
+#include "Core/Data/Encode.hpp"
+#include "Core/Data/Footprint.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+namespace _detail
+{
+
+/**!
+ * @brief Counts the occurrences of a type within a list
+ *
+ * @tparam T Type to count
+ * @tparam ListT List searched
+ */
+template<typename T, typename... ListT>
+constexpr static size_t type_count_v {(static_cast<size_t>(std::is_same<T, ListT>::value) + ... + 0U)};
+
+/**!
+ * @brief Index of the first occurrence of a type within a list, or the length of the list if it does not occur
+ *
+ * @tparam T Type to find
+ * @tparam ListT List searched
+ */
+template<typename T, typename... ListT>
+constexpr static size_t type_index() noexcept
+{
+    constexpr bool kIsMatch[] {std::is_same<T, ListT>::value..., true};
+
+    size_t index {0U};
+    while (!kIsMatch[index])
+        index++;
+
+    return index;
+}
+
+} // namespace _detail
+
+/**!
+ * @brief Multiplexes a set of message types over one session. Every message is sent as a compact tag, the position of
+ * its type within PacketT, followed by its encoded payload. Both are encoded in one pass, in place when the session
+ * lends out its storage. Received messages are dispatched through a compile-time jump table to a handler, decoded
+ * directly out of the session's storage when it can be peeked.
+ *
+ * Handlers are any callable with an overload for each message type, `handler(PacketT const&)`, such as a struct with
+ * one `operator()` per type. The result of the call is discarded.
+ *
+ * @note Like Egress and Ingress, every read or write is all-or-nothing. A session that can't be peeked delivers the tag
+ * and the payload in two requests, and a failure between the two leaves the stream misaligned. A message that can't be
+ * peeked whole, such as one that wraps around a ring, is copied out in one request. An unknown tag is dropped.
+ *
+ * @tparam PacketT Message types, each distinct. Their order fixes the tags and must match on both ends.
+ */
+template<typename... PacketT>
+class MessageSet
+{
+    static_assert(sizeof...(PacketT) > 0U, "MessageSet needs at least one message type");
+    static_assert(((_detail::type_count_v<PacketT, PacketT...> == 1U) && ...), "Message types must be distinct");
+
+public:
+    /// @brief Tag type, as narrow as the number of message types allows
+    using tag_type = std::conditional_t<(sizeof...(PacketT) <= (std::numeric_limits<uint8_t>::max() + 1U)), uint8_t,
+                                        uint16_t>;
+
+    /// @brief Number of message types
+    constexpr static size_t kMessageCount {sizeof...(PacketT)};
+
+    /// @brief Size of an encoded tag in bytes
+    constexpr static size_t kTagSizeBytes {data::footprint_size_bytes_v<tag_type>};
+
+    /// @brief Size of the largest encoded message in bytes, including its tag
+    constexpr static size_t kMaxMessageSizeBytes {kTagSizeBytes +
+                                                  std::max({data::footprint_size_bytes_v<PacketT>...})};
+
+    /**!
+     * @brief Posts a message, tag first, to a session, blocking for a duration or until the transference is complete,
+     * whichever finishes first
+     *
+     * @tparam T Message type, one of PacketT
+     * @tparam SessionT Outbound session type
+     * @param[in] session Session to post to
+     * @param[in] message Message to post
+     * @param[in] duration Maximum time that will be spent attempting to post data
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    template<typename T, typename SessionT>
+    static BinaryResult Put(SessionT& session, T const& message, std::chrono::microseconds duration) noexcept;
+
+    /**!
+     * @brief Reads one message from a session and passes it to the handler overload for its type
+     *
+     * @tparam HandlerT Handler type, callable with every type in PacketT
+     * @tparam SessionT Inbound session type
+     * @param[in] session Session to read from
+     * @param[in] handler Handler to dispatch to
+     * @param[in] timeout Maximum time that will be spent waiting on the session
+     * @retval BinaryResult::kSuccessCode if a message was read and handled
+     * @retval BinaryResult::kFailureCode if no whole message was available, its tag was unknown or it failed to decode
+     */
+    template<typename HandlerT, typename SessionT>
+    static BinaryResult Get(SessionT& session, HandlerT& handler, std::chrono::microseconds timeout) noexcept;
+
+    /**!
+     * @brief Encoded size of a message in bytes, including its tag
+     *
+     * @tparam T Message type, one of PacketT
+     */
+    template<typename T>
+    constexpr static size_t SizeOf() noexcept;
+
+    /**!
+     * @brief Tag of a message type
+     *
+     * @tparam T Message type, one of PacketT
+     */
+    template<typename T>
+    constexpr static tag_type TagOf() noexcept;
+
+private:
+    /// @brief Decodes a message of one type from its payload and hands it off
+    template<typename HandlerT>
+    using Dispatcher = BinaryResult (*)(Span<uint8_t const> payload, HandlerT& handler);
+
+    constexpr static std::array<size_t, kMessageCount> kPayloadSizes {data::footprint_size_bytes_v<PacketT>...};
+
+    template<typename T, typename HandlerT>
+    static BinaryResult Dispatch(Span<uint8_t const> payload, HandlerT& handler) noexcept;
+
+    /// @brief One dispatcher per tag
+    template<typename HandlerT>
+    constexpr static std::array<Dispatcher<HandlerT>, kMessageCount> kJumpTable {&Dispatch<PacketT, HandlerT>...};
+
+    template<typename T>
+    static BinaryResult Encode(T const& message, Span<uint8_t> encoded_span) noexcept;
+
+    static bool DecodeTag(Span<uint8_t const> encoded_span, size_t& tag) noexcept;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MessageSet method definitions in alphabetical order         ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename... PacketT>
+template<typename HandlerT, typename SessionT>
+BinaryResult MessageSet<PacketT...>::Get(SessionT& session, HandlerT& handler,
+                                         std::chrono::microseconds timeout) noexcept // Static method
+{
+    static_assert((std::is_invocable<HandlerT&, PacketT const&>::value && ...), "Handler must accept every message "
+                                                                                "type");
+
+    if (session.InputBytesAvailable() < kTagSizeBytes)
+    {
+        instrument_count(SessionCounter::kInputRejections);
+        return BinaryResult::Failure();
+    }
+
+    InstrumentStopwatch stopwatch {};
+
+    // Decode in place when the session can lend out its storage
+    uint8_t             encoded_buffer[kMaxMessageSizeBytes];
+    size_t              tag {0U};
+    Span<uint8_t const> peeked_span {session.Peek(kTagSizeBytes)};
+    if (peeked_span.size() >= kTagSizeBytes)
+    {
+        if (!DecodeTag(peeked_span, tag))
+        {
+            // Drop the tag, as the copying path does, so that one bad tag doesn't wedge the stream
+            static_cast<void>(session.Consume(kTagSizeBytes));
+            instrument_count(SessionCounter::kRequestFailures);
+            return BinaryResult::Failure();
+        }
+
+        size_t const message_size_bytes {kTagSizeBytes + kPayloadSizes[tag]};
+        peeked_span = session.Peek(message_size_bytes);
+        if (peeked_span.size() >= message_size_bytes)
+        {
+            BinaryResult const dispatch_result {
+                kJumpTable<HandlerT>[tag](peeked_span.subspan(kTagSizeBytes, kPayloadSizes[tag]), handler)};
+            if (session.Consume(message_size_bytes).IsFailure() || dispatch_result.IsFailure())
+            {
+                instrument_count(SessionCounter::kRequestFailures);
+                return BinaryResult::Failure();
+            }
+
+            stopwatch.Record(SessionHistogram::kDecodeTime);
+            instrument_count(SessionCounter::kGets);
+            instrument_count(SessionCounter::kBytesRequested, message_size_bytes);
+            return BinaryResult::Success();
+        }
+
+        // The message wraps around the session's storage or has yet to arrive whole, copy it out in one request
+        if (session.Request(Span<uint8_t> {encoded_buffer, message_size_bytes}, timeout).IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return BinaryResult::Failure();
+        }
+    }
+    else
+    {
+        // Otherwise, request the tag and then the payload through a buffer on the stack
+        Span<uint8_t> tag_span {encoded_buffer, kTagSizeBytes};
+        if (session.Request(tag_span, timeout).IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return BinaryResult::Failure();
+        }
+
+        if (!DecodeTag(span_cast<uint8_t const>(tag_span), tag))
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return BinaryResult::Failure();
+        }
+
+        Span<uint8_t> payload_span {(encoded_buffer + kTagSizeBytes), kPayloadSizes[tag]};
+        if ((kPayloadSizes[tag] > 0U) && session.Request(payload_span, timeout).IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return BinaryResult::Failure();
+        }
+    }
+
+    Span<uint8_t const> payload_span {(encoded_buffer + kTagSizeBytes), kPayloadSizes[tag]};
+    stopwatch.Record(SessionHistogram::kRequestWaitTime);
+    if (kJumpTable<HandlerT>[tag](payload_span, handler).IsFailure())
+    {
+        instrument_count(SessionCounter::kRequestFailures);
+        return BinaryResult::Failure();
+    }
+
+    stopwatch.Record(SessionHistogram::kDecodeTime);
+    instrument_count(SessionCounter::kGets);
+    instrument_count(SessionCounter::kBytesRequested, (kTagSizeBytes + kPayloadSizes[tag]));
+    return BinaryResult::Success();
+}
+
+template<typename... PacketT>
+template<typename T, typename SessionT>
+BinaryResult MessageSet<PacketT...>::Put(SessionT& session, T const& message,
+                                         std::chrono::microseconds duration) noexcept // Static method
+{
+    constexpr static size_t kMessageSizeBytes {SizeOf<T>()};
+
+    // Guard against overflowing the Outbound buffer
+    if (session.OutputBytesAvailable() < kMessageSizeBytes)
+    {
+        instrument_count(SessionCounter::kOutputRejections);
+        return BinaryResult::Failure();
+    }
+
+    InstrumentStopwatch stopwatch {};
+
+    // Encode in place when the session can lend out its storage
+    Span<uint8_t> reserved_span {session.Reserve(kMessageSizeBytes)};
+    if (reserved_span.size() >= kMessageSizeBytes)
+    {
+        if (Encode(message, reserved_span).IsFailure())
+        {
+            static_cast<void>(session.Commit(0U)); // Abandon the reservation
+            instrument_count(SessionCounter::kPostFailures);
+            return BinaryResult::Failure();
+        }
+
+        stopwatch.Record(SessionHistogram::kEncodeTime);
+        if (session.Commit(kMessageSizeBytes).IsFailure())
+        {
+            instrument_count(SessionCounter::kPostFailures);
+            return BinaryResult::Failure();
+        }
+
+        instrument_count(SessionCounter::kPuts);
+        instrument_count(SessionCounter::kBytesPosted, kMessageSizeBytes);
+        return BinaryResult::Success();
+    }
+
+    // Otherwise, encode on the stack and post
+    uint8_t       encoded_buffer[kMessageSizeBytes];
+    Span<uint8_t> encoded_span {encoded_buffer, kMessageSizeBytes};
+    static_cast<void>(std::memset(encoded_buffer, 0U, kMessageSizeBytes)); // Avoid unused return warning
+
+    if (Encode(message, encoded_span).IsFailure())
+    {
+        instrument_count(SessionCounter::kPostFailures);
+        return BinaryResult::Failure();
+    }
+
+    stopwatch.Record(SessionHistogram::kEncodeTime);
+    auto post_result {session.Post(span_cast<uint8_t const>(encoded_span), duration)};
+    stopwatch.Record(SessionHistogram::kPostWaitTime);
+    if (post_result.IsFailure())
+    {
+        instrument_count(SessionCounter::kPostFailures);
+        return BinaryResult::Failure();
+    }
+
+    instrument_count(SessionCounter::kPuts);
+    instrument_count(SessionCounter::kBytesPosted, kMessageSizeBytes);
+    return BinaryResult::Success();
+}
+
+template<typename... PacketT>
+template<typename T>
+constexpr size_t MessageSet<PacketT...>::SizeOf() noexcept // Static method
+{
+    return (kTagSizeBytes + data::footprint_size_bytes_v<T>);
+}
+
+template<typename... PacketT>
+template<typename T>
+constexpr typename MessageSet<PacketT...>::tag_type MessageSet<PacketT...>::TagOf() noexcept // Static method
+{
+    constexpr size_t kIndex {_detail::type_index<T, PacketT...>()};
+    static_assert(kIndex < kMessageCount, "`T` is not a member of this MessageSet");
+    return static_cast<tag_type>(kIndex);
+}
+
+//  Private     ========================================================================================================
+
+template<typename... PacketT>
+bool MessageSet<PacketT...>::DecodeTag(Span<uint8_t const> encoded_span, size_t& tag) noexcept // Static method
+{
+    tag_type decoded_tag {0U};
+    size_t   bits_decoded {0U};
+    if (data::decode(encoded_span.subspan(0U, kTagSizeBytes), bits_decoded, decoded_tag).IsFailure())
+        return false;
+
+    tag = decoded_tag;
+    return (tag < kMessageCount);
+}
+
+template<typename... PacketT>
+template<typename T, typename HandlerT>
+BinaryResult MessageSet<PacketT...>::Dispatch(Span<uint8_t const> payload,
+                                              HandlerT&           handler) noexcept // Static method
+{
+    T      message {};
+    size_t bits_decoded {0U};
+    if (data::decode(payload, bits_decoded, message).IsFailure())
+        return BinaryResult::Failure();
+
+    static_cast<void>(handler(static_cast<T const&>(message)));
+    return BinaryResult::Success();
+}
+
+template<typename... PacketT>
+template<typename T>
+BinaryResult MessageSet<PacketT...>::Encode(T const& message, Span<uint8_t> encoded_span) noexcept // Static method
+{
+    constexpr static tag_type kTag {TagOf<T>()};
+
+    // Payload picks up where the tag leaves off
+    size_t bits_encoded {0U};
+    if (data::encode(kTag, encoded_span, bits_encoded).IsFailure())
+        return BinaryResult::Failure();
+
+    return data::encode(message, encoded_span, bits_encoded);
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
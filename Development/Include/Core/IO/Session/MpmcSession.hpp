@@ -0,0 +1,359 @@
+#pragma once
+
+#include "Inbound.hpp"
+#include "Outbound.hpp"
+#include "_Detail/Spin.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Bounded multi-producer/multi-consumer message queue. Implements both Outbound and Inbound so that many
+ * Egress instances, each on its own thread, may fan in to one shared session without a global lock.
+ *
+ * Every Post claims a whole slot through an atomic reservation of the enqueue position, and every slot carries a
+ * sequence number that marks it as free, published, or consumed. Messages are never split across slots, so one
+ * transmission is never interleaved with another.
+ *
+ * @note Transmissions are message oriented. A Request only succeeds when its span is exactly the size of the oldest
+ * queued message, which is the case for an Ingress and Egress of the same type.
+ *
+ * @tparam SlotCountV Number of messages that may be queued at once, must be a nonzero power of two
+ * @tparam SlotSizeBytesV Largest message that may be posted, in bytes
+ */
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+class MpmcSession final : public Outbound, public Inbound
+{
+    static_assert((SlotCountV > 0U) && ((SlotCountV & (SlotCountV - 1U)) == 0U), "`SlotCountV` must be a nonzero "
+                                                                                   "power of two");
+    static_assert(SlotSizeBytesV > 0U, "`SlotSizeBytesV` must be nonzero");
+
+public:
+    /// @brief Result type shared by both session interfaces
+    using Result = BinaryResult;
+
+    /// @brief Number of messages that may be queued at once
+    constexpr static size_t kSlotCount {SlotCountV};
+
+    /// @brief Largest message that may be posted, in bytes
+    constexpr static size_t kSlotSizeBytes {SlotSizeBytesV};
+
+    /// @brief Assumed size of a cache line, slots and positions are kept at least this far apart
+    constexpr static size_t kCacheLineSizeBytes {64U};
+
+    /// @brief Default constructor, every slot starts out free
+    MpmcSession() noexcept;
+
+    ~MpmcSession() noexcept = default;
+
+    // MpmcSession holds synchronization state and may not be copied or moved
+
+    MpmcSession(MpmcSession const& copy) = delete;
+    MpmcSession(MpmcSession&& move)      = delete;
+
+    MpmcSession& operator=(MpmcSession const& copy) = delete;
+    MpmcSession& operator=(MpmcSession&& move)      = delete;
+
+    /**!
+     * @brief Size of the oldest queued message. Wait-free, the value is a snapshot when consumers run concurrently.
+     *
+     * @return Size of the next message in bytes, 0 if none is queued
+     */
+    virtual size_t InputBytesAvailable() const noexcept override;
+
+    /// @brief Always true, every Post is one message
+    virtual bool IsMessageOriented() const noexcept override;
+
+    /**!
+     * @brief Largest message that a Post could queue right now. Wait-free, the value is a snapshot when producers run
+     * concurrently.
+     *
+     * @return kSlotSizeBytes if a slot is free, 0 otherwise
+     */
+    virtual size_t OutputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Queue a message, waiting up to a timeout for a slot to free up. Safe to call from any number of threads.
+     *
+     * @param[in] tx Message bytes, no larger than kSlotSizeBytes
+     * @param[in] timeout Maximum time that will be spent waiting for a free slot
+     * @retval BinaryResult::kSuccessCode if the message was queued
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Gather several spans in to a single slot as one message. Safe to call from any number of threads.
+     *
+     * @param[in] parts Spans to post, in order, no larger than kSlotSizeBytes combined
+     * @param[in] timeout Maximum time that will be spent waiting for a free slot
+     * @retval BinaryResult::kSuccessCode if the message was queued
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    virtual Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Dequeue the oldest message, waiting up to a timeout for one to arrive. Safe to call from any number of
+     * threads.
+     *
+     * @param[in] rx Destination, must be exactly the size of the message
+     * @param[in] timeout Maximum time that will be spent waiting for a message
+     * @retval BinaryResult::kSuccessCode if a message was received
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Scatter the oldest message across several spans. Safe to call from any number of threads.
+     *
+     * @param[in] parts Destination spans, filled in order, must be exactly the size of the message combined
+     * @param[in] timeout Maximum time that will be spent waiting for a message
+     * @retval BinaryResult::kSuccessCode if a message was received
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<Span<uint8_t> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+private:
+    constexpr static size_t kIndexMask {SlotCountV - 1U};
+
+    /// @brief Storage for one message, padded out to its own cache lines
+    struct alignas(kCacheLineSizeBytes) Slot
+    {
+        /// @brief Equal to the slot's enqueue position when free, one past it once published
+        std::atomic<size_t> sequence;
+
+        /// @brief Size of the held message in bytes
+        size_t size_bytes;
+
+        /// @brief Message bytes
+        uint8_t data[SlotSizeBytesV];
+    };
+
+    /**!
+     * @brief Attempt to claim and fill the slot at the enqueue position
+     *
+     * @param[in] parts Message bytes, in order
+     * @param[in] size_bytes Combined size of the parts
+     * @retval true if the message was queued
+     * @retval false if the queue is full
+     */
+    bool TryPost(Span<Span<uint8_t const> const> parts, size_t size_bytes) noexcept;
+
+    /**!
+     * @brief Attempt to claim and drain the slot at the dequeue position
+     *
+     * @param[in] parts Destination spans, in order
+     * @param[in] size_bytes Combined size of the parts
+     * @retval true if a message was received
+     * @retval false if the queue is empty or the oldest message does not fit `parts` exactly
+     */
+    bool TryRequest(Span<Span<uint8_t> const> parts, size_t size_bytes) noexcept;
+
+    /// @brief Next position that a producer will claim
+    alignas(kCacheLineSizeBytes) std::atomic<size_t> m_enqueue_position {0U};
+
+    /// @brief Next position that a consumer will claim
+    alignas(kCacheLineSizeBytes) std::atomic<size_t> m_dequeue_position {0U};
+
+    /// @brief Message slots
+    Slot m_slots[SlotCountV];
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MpmcSession constructor definitions             ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+MpmcSession<SlotCountV, SlotSizeBytesV>::MpmcSession() noexcept
+{
+    for (size_t i = 0U; i < SlotCountV; i++)
+    {
+        m_slots[i].sequence.store(i, std::memory_order_relaxed);
+        m_slots[i].size_bytes = 0U;
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  MpmcSession method definitions in alphabetical order            ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+size_t MpmcSession<SlotCountV, SlotSizeBytesV>::InputBytesAvailable() const noexcept
+{
+    size_t const kPosition {m_dequeue_position.load(std::memory_order_relaxed)};
+    Slot const&  slot {m_slots[kPosition & kIndexMask]};
+
+    // Published slots are one past their position
+    if (slot.sequence.load(std::memory_order_acquire) != (kPosition + 1U))
+        return 0U;
+
+    return slot.size_bytes;
+}
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+bool MpmcSession<SlotCountV, SlotSizeBytesV>::IsMessageOriented() const noexcept
+{
+    return true;
+}
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+size_t MpmcSession<SlotCountV, SlotSizeBytesV>::OutputBytesAvailable() const noexcept
+{
+    size_t const kPosition {m_enqueue_position.load(std::memory_order_relaxed)};
+    Slot const&  slot {m_slots[kPosition & kIndexMask]};
+
+    // Free slots carry their own position
+    return (slot.sequence.load(std::memory_order_acquire) == kPosition) ? SlotSizeBytesV : 0U;
+}
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+typename MpmcSession<SlotCountV, SlotSizeBytesV>::Result
+    MpmcSession<SlotCountV, SlotSizeBytesV>::Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept
+{
+    return Post(Span<Span<uint8_t const> const> {&tx, 1U}, timeout);
+}
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+typename MpmcSession<SlotCountV, SlotSizeBytesV>::Result
+    MpmcSession<SlotCountV, SlotSizeBytesV>::Post(Span<Span<uint8_t const> const> parts,
+                                                  std::chrono::microseconds       timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t const> const& part : parts)
+        size_bytes += part.size();
+
+    if (size_bytes > SlotSizeBytesV)
+        return Result::Failure();
+
+    auto try_post {[&]() -> bool { return TryPost(parts, size_bytes); }};
+    return _detail::spin_until(try_post, timeout) ? Result::Success() : Result::Failure();
+}
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+typename MpmcSession<SlotCountV, SlotSizeBytesV>::Result
+    MpmcSession<SlotCountV, SlotSizeBytesV>::Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept
+{
+    return Request(Span<Span<uint8_t> const> {&rx, 1U}, timeout);
+}
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+typename MpmcSession<SlotCountV, SlotSizeBytesV>::Result
+    MpmcSession<SlotCountV, SlotSizeBytesV>::Request(Span<Span<uint8_t> const> parts,
+                                                     std::chrono::microseconds timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t> const& part : parts)
+        size_bytes += part.size();
+
+    if (size_bytes > SlotSizeBytesV)
+        return Result::Failure();
+
+    auto try_request {[&]() -> bool { return TryRequest(parts, size_bytes); }};
+    return _detail::spin_until(try_request, timeout) ? Result::Success() : Result::Failure();
+}
+
+//  Private     ========================================================================================================
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+bool MpmcSession<SlotCountV, SlotSizeBytesV>::TryPost(Span<Span<uint8_t const> const> parts,
+                                                      size_t                          size_bytes) noexcept
+{
+    size_t position {m_enqueue_position.load(std::memory_order_relaxed)};
+    while (true)
+    {
+        Slot&        slot {m_slots[position & kIndexMask]};
+        size_t const kSequence {slot.sequence.load(std::memory_order_acquire)};
+
+        if (kSequence == position)
+        {
+            // Slot is free, race other producers for it
+            if (m_enqueue_position.compare_exchange_weak(position, (position + 1U), std::memory_order_relaxed))
+            {
+                // Gather every part in to the claimed slot before publishing it
+                size_t offset_bytes {0U};
+                for (Span<uint8_t const> const& part : parts)
+                {
+                    static_cast<void>(std::memcpy((slot.data + offset_bytes), part.data(), part.size()));
+                    offset_bytes += part.size();
+                }
+
+                slot.size_bytes = size_bytes;
+                slot.sequence.store((position + 1U), std::memory_order_release);
+                return true;
+            }
+        }
+        else if (kSequence < position)
+        {
+            // Slot still holds a message from the previous lap, the queue is full
+            return false;
+        }
+        else
+        {
+            // Another producer claimed the slot first, chase the enqueue position
+            position = m_enqueue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<size_t SlotCountV, size_t SlotSizeBytesV>
+bool MpmcSession<SlotCountV, SlotSizeBytesV>::TryRequest(Span<Span<uint8_t> const> parts,
+                                                         size_t                    size_bytes) noexcept
+{
+    size_t position {m_dequeue_position.load(std::memory_order_relaxed)};
+    while (true)
+    {
+        Slot&        slot {m_slots[position & kIndexMask]};
+        size_t const kSequence {slot.sequence.load(std::memory_order_acquire)};
+
+        if (kSequence == (position + 1U))
+        {
+            // Oldest message must fit exactly, otherwise leave it for a better suited consumer
+            if (slot.size_bytes != size_bytes)
+                return false;
+
+            // Slot is published, race other consumers for it
+            if (m_dequeue_position.compare_exchange_weak(position, (position + 1U), std::memory_order_relaxed))
+            {
+                // Scatter the claimed slot out to every part before releasing it
+                size_t offset_bytes {0U};
+                for (Span<uint8_t> const& part : parts)
+                {
+                    static_cast<void>(std::memcpy(part.data(), (slot.data + offset_bytes), part.size()));
+                    offset_bytes += part.size();
+                }
+
+                slot.sequence.store((position + SlotCountV), std::memory_order_release);
+                return true;
+            }
+        }
+        else if (kSequence < (position + 1U))
+        {
+            // Slot has not been published yet, the queue is empty
+            return false;
+        }
+        else
+        {
+            // Another consumer claimed the slot first, chase the dequeue position
+            position = m_dequeue_position.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
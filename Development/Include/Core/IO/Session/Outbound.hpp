@@ -1,9 +1,15 @@
 #pragma once
 
+#include "FlowControl.hpp"
+#include "Transference.hpp"
+#include "_Detail/Spin.hpp"
+
+#include "Core/Platform/Clock.hpp"
 #include "Core/Result.hpp"
 #include "Core/Span.hpp"
 
 #include <chrono>
+#include <cstring>
 
 namespace shmit
 {
@@ -21,9 +27,166 @@ class Outbound
 public:
     using Result = BinaryResult;
 
+    /// @brief Largest transmission that the default vectored Post gathers on the stack for sessions that can't lend out
+    /// their storage
+    constexpr static size_t kGatherSizeBytes {256U};
+
     virtual size_t OutputBytesAvailable() const noexcept = 0;
 
     virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept = 0;
+
+    /**!
+     * @brief Post several spans as one atomic transmission, in order. Either every part is posted contiguously or none
+     * of them are.
+     *
+     * @note The default implementation gathers the parts directly in to a reservation. Otherwise it gathers up to
+     * kGatherSizeBytes on the stack and posts them with one scalar Post. Larger transmissions wait for a reservation,
+     * or for the session to have room for every part, and in the latter case post the parts one by one under one
+     * deadline. Those are contiguous and all-or-nothing only while the caller is the session's single producer.
+     *
+     * @param[in] parts Spans to post, in order
+     * @param[in] timeout Maximum time that will be spent attempting to post data
+     * @retval BinaryResult::kSuccessCode if every part was posted
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept
+    {
+        if (parts.count() == 1U)
+            return Post(parts[0], timeout);
+
+        size_t size_bytes {0U};
+        for (Span<uint8_t const> const& part : parts)
+            size_bytes += part.size();
+
+        // Gather straight in to the session's storage when it can lend it out right away
+        Span<uint8_t> reserved {Reserve(size_bytes)};
+        if (reserved.size() >= size_bytes)
+        {
+            Gather(parts, reserved.data());
+            return Commit(size_bytes);
+        }
+
+        // Otherwise gather on the stack, leaving any wait to the scalar Post
+        if (size_bytes <= kGatherSizeBytes)
+        {
+            uint8_t gathered[kGatherSizeBytes];
+            Gather(parts, gathered);
+            return Post(Span<uint8_t const> {gathered, size_bytes}, timeout);
+        }
+
+        // Otherwise wait for a reservation, or for room to post every part
+        auto const kDeadline {platform::Clock::now() + timeout};
+        auto       has_room {[&]() -> bool
+                       {
+                           reserved = Reserve(size_bytes);
+                           return ((reserved.size() >= size_bytes) || (OutputBytesAvailable() >= size_bytes));
+                       }};
+        if (!_detail::spin_until(has_room, timeout))
+            return Result::Failure();
+
+        if (reserved.size() >= size_bytes)
+        {
+            Gather(parts, reserved.data());
+            return Commit(size_bytes);
+        }
+
+        // The session has the room but can't lend it out, with a single producer nothing takes it before every part
+        for (Span<uint8_t const> const& part : parts)
+        {
+            if (Post(part, _detail::get_time_remaining(kDeadline)).IsFailure())
+                return Result::Failure();
+        }
+
+        return Result::Success();
+    }
+
+    /**!
+     * @brief Start posting a Transference's bytes and return right away. The session completes the Transference later,
+     * possibly from an ISR or DMA completion handler, and the caller polls it or waits on its callback in the meantime.
+     *
+     * @note The default implementation posts synchronously with no timeout and completes the Transference before
+     * returning, sessions backed by asynchronous hardware override this
+     *
+     * @param[in] transference Transmission to start, must outlive it
+     * @retval BinaryResult::kSuccessCode if the transmission was started, `transference` reports its outcome
+     * @retval BinaryResult::kFailureCode if it was rejected outright, `transference` is completed as failed
+     */
+    virtual Result PostAsync(Transference& transference) noexcept
+    {
+        Result post_result {Post(transference.GetData(), std::chrono::microseconds::zero())};
+        transference.SetResult(post_result.IsSuccess() ? Transference::Result::Success()
+                                                       : Transference::Result::Failure());
+        return post_result;
+    }
+
+    /**!
+     * @brief Flow control state of the session, so that Egress may sleep on its space-available signal and spend
+     * credit instead of polling OutputBytesAvailable. Sessions without flow control return null and Egress turns
+     * transmissions away as soon as they don't fit.
+     *
+     * @return Session's flow control, or null
+     */
+    virtual FlowControl* GetFlowControl() noexcept
+    {
+        return nullptr;
+    }
+
+    /**!
+     * @brief Whether every Post is delivered as one whole message to one Request, rather than appended to a byte
+     * stream. Egress then posts one object per transmission, even for a burst, so that each may be received on its own.
+     *
+     * @retval true if the session is message oriented
+     * @retval false if it is a byte stream
+     */
+    virtual bool IsMessageOriented() const noexcept
+    {
+        return false;
+    }
+
+    /**!
+     * @brief Reserve contiguous space within the session's own storage so that data may be encoded in place. The
+     * reservation holds until it is committed. Sessions that can't lend out their storage return an empty span and
+     * callers fall back to Post.
+     *
+     * @param[in] size_bytes Size of the space to reserve
+     * @return Span over the reserved space, empty if no space can be reserved right now
+     */
+    virtual Span<uint8_t> Reserve(size_t size_bytes) noexcept
+    {
+        static_cast<void>(size_bytes); // Avoid unused warning
+        return Span<uint8_t> {nullptr, size_t {0U}};
+    }
+
+    /**!
+     * @brief Publish the leading bytes of the last reservation and release the remainder. Committing 0 bytes abandons
+     * the reservation.
+     *
+     * @param[in] size_bytes Number of reserved bytes to publish
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if there is no reservation or it is smaller than `size_bytes`
+     */
+    virtual Result Commit(size_t size_bytes) noexcept
+    {
+        static_cast<void>(size_bytes); // Avoid unused warning
+        return Result::Failure();
+    }
+
+private:
+    /**!
+     * @brief Copy parts back to back in to a destination
+     *
+     * @param[in] parts Spans to copy, in order
+     * @param[out] dest Destination, at least as large as every part together
+     */
+    static void Gather(Span<Span<uint8_t const> const> parts, uint8_t* dest) noexcept
+    {
+        size_t offset_bytes {0U};
+        for (Span<uint8_t const> const& part : parts)
+        {
+            static_cast<void>(std::memcpy((dest + offset_bytes), part.data(), part.size()));
+            offset_bytes += part.size();
+        }
+    }
 };
 
 } // namespace session
@@ -0,0 +1,341 @@
+#pragma once
+
+#include "Inbound.hpp"
+#include "Outbound.hpp"
+#include "RingSession.hpp"
+#include "_Detail/Spin.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <limits>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Multi-lane session that drains traffic by priority class. Every lane is its own lock-free RingSession, handed
+ * out as an Outbound through GetLane, so that an Egress picks its priority class by the lane it is constructed on and
+ * never queues behind traffic of another class. The PrioritySession itself is the Inbound that drains every lane.
+ *
+ * Lanes of weight 0 (the default) are served by strict priority, lane 0 first. Once every strict lane is empty, the
+ * remaining lanes share the drain by smooth weighted round robin, each getting a share of transmissions in proportion
+ * to its weight without any lane being starved. Each Request is served whole from a single lane.
+ *
+ * The wait a transmission sees on a strict lane is bounded by what is queued ahead of it on that lane, and on any
+ * higher priority strict lane, no matter how deep the other lanes are.
+ *
+ * @note Each lane may be posted to by exactly one thread, and the PrioritySession may be drained by exactly one thread.
+ * Weights are consumer side state and should be set before draining, or from the draining thread.
+ *
+ * @note Transmissions are only kept whole within a lane, so every Request should be the size of a transmission posted
+ * to one lane, which is the case for an Ingress and Egress of the same type
+ *
+ * @tparam LaneCapacityV Size of each lane's ring in bytes, must be a nonzero power of two
+ * @tparam LaneCountV Number of priority classes
+ */
+template<size_t LaneCapacityV, size_t LaneCountV>
+class PrioritySession final : public Inbound
+{
+    static_assert(LaneCountV > 0U, "`LaneCountV` must be nonzero");
+
+public:
+    /// @brief Result type of the drain side
+    using Result = BinaryResult;
+
+    /// @brief Session backing each lane
+    using Lane = RingSession<LaneCapacityV>;
+
+    /// @brief Number of lanes
+    constexpr static size_t kLaneCount {LaneCountV};
+
+    /// @brief Size of each lane in bytes
+    constexpr static size_t kLaneCapacityBytes {LaneCapacityV};
+
+    /// @brief Weight of a lane served by strict priority
+    constexpr static uint32_t kStrictWeight {0U};
+
+    /// @brief Returned by GetNextLane when no lane is ready
+    constexpr static size_t kNoLane {std::numeric_limits<size_t>::max()};
+
+    // PrioritySession is trivially default constructible and destructible
+
+    PrioritySession() noexcept  = default;
+    ~PrioritySession() noexcept = default;
+
+    // PrioritySession holds synchronization state and may not be copied or moved
+
+    PrioritySession(PrioritySession const& copy) = delete;
+    PrioritySession(PrioritySession&& move)      = delete;
+
+    PrioritySession& operator=(PrioritySession const& copy) = delete;
+    PrioritySession& operator=(PrioritySession&& move)      = delete;
+
+    /**!
+     * @brief Release the oldest bytes of the lane that the last Peek looked at. Consumer side.
+     *
+     * @param[in] size_bytes Number of bytes to consume
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if nothing was peeked, or fewer than `size_bytes` are buffered in its lane
+     */
+    virtual Result Consume(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Producer side of a lane, to post to or to construct an Egress on
+     *
+     * @param[in] lane Lane index, 0 is the highest priority. Must be less than kLaneCount.
+     * @return Lane as an Outbound session
+     */
+    Outbound& GetLane(size_t lane) noexcept;
+
+    /**!
+     * @brief Lane that the next Request of a given size would be served from. Consumer side, never blocks.
+     *
+     * @param[in] size_bytes Size of the transmission, a lane is ready once it holds at least this many bytes
+     * @return Lane index, or kNoLane if no lane is ready
+     */
+    size_t GetNextLane(size_t size_bytes = 1U) const noexcept;
+
+    /**!
+     * @brief Number of bytes buffered in the lane that will be served next, so that an Ingress sizes its batches
+     * against a single lane. Never blocks.
+     *
+     * @return Size of buffered data in bytes
+     */
+    virtual size_t InputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Number of bytes that a Post could place in one lane right now. Wait-free.
+     *
+     * @param[in] lane Lane index, must be less than kLaneCount
+     * @return Size of the lane's free space in bytes
+     */
+    size_t OutputBytesAvailable(size_t lane) const noexcept;
+
+    /**!
+     * @brief Look at the oldest buffered bytes of the lane that would be served next, in place. Consumer side, never
+     * blocks.
+     *
+     * @param[in] size_bytes Number of bytes to look at
+     * @return Span over the buffered bytes, empty if no lane is ready or they are not available contiguously
+     */
+    virtual Span<uint8_t const> Peek(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Copy one transmission out of the next lane to be served, waiting up to a timeout for any lane to be
+     * ready. Consumer side.
+     *
+     * @param[in] rx Destination, filled in its entirety from a single lane
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every byte was received
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Scatter one transmission out of the next lane to be served across several spans. Consumer side.
+     *
+     * @param[in] parts Destination spans, filled in order from a single lane
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every part was filled
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<Span<uint8_t> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Set how a lane is drained. Consumer side.
+     *
+     * @param[in] lane Lane index
+     * @param[in] weight kStrictWeight to serve the lane by strict priority, otherwise its share of the weighted round
+     * robin between every lane that is not strict
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if `lane` is out of range
+     */
+    Result SetWeight(size_t lane, uint32_t weight) noexcept;
+
+private:
+    /**!
+     * @brief Account for a transmission served from a weighted lane, as smooth weighted round robin does: every ready
+     * weighted lane gains its weight in credit and the lane served pays back the total
+     *
+     * @param[in] served_lane Lane that was served
+     * @param[in] size_bytes Size of the transmission, used to tell which lanes were ready
+     */
+    void Charge(size_t served_lane, size_t size_bytes) noexcept;
+
+    Lane     m_lanes[LaneCountV];
+    uint32_t m_weights[LaneCountV] {};
+
+    /// @brief Round robin credit of each weighted lane
+    int64_t m_credits[LaneCountV] {};
+
+    /// @brief Lane that the last Peek looked at
+    size_t m_peeked_lane {kNoLane};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  PrioritySession method definitions in alphabetical order            ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+typename PrioritySession<LaneCapacityV, LaneCountV>::Result
+PrioritySession<LaneCapacityV, LaneCountV>::Consume(size_t size_bytes) noexcept
+{
+    size_t const kLane {m_peeked_lane};
+    if (kLane == kNoLane)
+        return Result::Failure();
+
+    m_peeked_lane = kNoLane;
+    if (m_lanes[kLane].Consume(size_bytes).IsFailure())
+        return Result::Failure();
+
+    Charge(kLane, size_bytes);
+    return Result::Success();
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+Outbound& PrioritySession<LaneCapacityV, LaneCountV>::GetLane(size_t lane) noexcept
+{
+    return m_lanes[lane];
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+size_t PrioritySession<LaneCapacityV, LaneCountV>::GetNextLane(size_t size_bytes) const noexcept
+{
+    // Strict lanes first, highest priority first
+    for (size_t i = 0U; i < LaneCountV; i++)
+    {
+        if ((m_weights[i] == kStrictWeight) && (m_lanes[i].InputBytesAvailable() >= size_bytes))
+            return i;
+    }
+
+    // Then the ready weighted lane with the most credit once this round's weight is added
+    size_t  next_lane {kNoLane};
+    int64_t best_credit {0};
+    for (size_t i = 0U; i < LaneCountV; i++)
+    {
+        if ((m_weights[i] == kStrictWeight) || (m_lanes[i].InputBytesAvailable() < size_bytes))
+            continue;
+
+        int64_t const kCredit {m_credits[i] + static_cast<int64_t>(m_weights[i])};
+        if ((next_lane == kNoLane) || (kCredit > best_credit))
+        {
+            next_lane   = i;
+            best_credit = kCredit;
+        }
+    }
+
+    return next_lane;
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+size_t PrioritySession<LaneCapacityV, LaneCountV>::InputBytesAvailable() const noexcept
+{
+    size_t const kLane {GetNextLane()};
+    if (kLane == kNoLane)
+        return 0U;
+
+    return m_lanes[kLane].InputBytesAvailable();
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+size_t PrioritySession<LaneCapacityV, LaneCountV>::OutputBytesAvailable(size_t lane) const noexcept
+{
+    return m_lanes[lane].OutputBytesAvailable();
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+Span<uint8_t const> PrioritySession<LaneCapacityV, LaneCountV>::Peek(size_t size_bytes) noexcept
+{
+    m_peeked_lane = GetNextLane(size_bytes);
+    if (m_peeked_lane == kNoLane)
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    Span<uint8_t const> const kPeeked {m_lanes[m_peeked_lane].Peek(size_bytes)};
+    if (kPeeked.size() == 0U)
+        m_peeked_lane = kNoLane;
+
+    return kPeeked;
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+typename PrioritySession<LaneCapacityV, LaneCountV>::Result
+PrioritySession<LaneCapacityV, LaneCountV>::Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept
+{
+    return Request(Span<Span<uint8_t> const> {&rx, 1U}, timeout);
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+typename PrioritySession<LaneCapacityV, LaneCountV>::Result
+PrioritySession<LaneCapacityV, LaneCountV>::Request(Span<Span<uint8_t> const> parts,
+                                                    std::chrono::microseconds timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t> const& part : parts)
+        size_bytes += part.size();
+
+    if (size_bytes > LaneCapacityV)
+        return Result::Failure();
+
+    size_t lane {kNoLane};
+    auto   has_lane {[&]() -> bool
+                   {
+                       lane = GetNextLane(size_bytes);
+                       return lane != kNoLane;
+                   }};
+    if (!_detail::spin_until(has_lane, timeout))
+        return Result::Failure();
+
+    // Only this thread drains the lane, so the data it was chosen for is still there
+    m_peeked_lane = kNoLane;
+    if (m_lanes[lane].Request(parts, std::chrono::microseconds::zero()).IsFailure())
+        return Result::Failure();
+
+    Charge(lane, size_bytes);
+    return Result::Success();
+}
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+typename PrioritySession<LaneCapacityV, LaneCountV>::Result
+PrioritySession<LaneCapacityV, LaneCountV>::SetWeight(size_t lane, uint32_t weight) noexcept
+{
+    if (lane >= LaneCountV)
+        return Result::Failure();
+
+    m_weights[lane] = weight;
+    m_credits[lane] = 0;
+    return Result::Success();
+}
+
+//  Private     ========================================================================================================
+
+template<size_t LaneCapacityV, size_t LaneCountV>
+void PrioritySession<LaneCapacityV, LaneCountV>::Charge(size_t served_lane, size_t size_bytes) noexcept
+{
+    if (m_weights[served_lane] == kStrictWeight)
+        return;
+
+    int64_t total_weight {0};
+    for (size_t i = 0U; i < LaneCountV; i++)
+    {
+        if ((m_weights[i] == kStrictWeight) || ((i != served_lane) && (m_lanes[i].InputBytesAvailable() < size_bytes)))
+            continue;
+
+        m_credits[i] += static_cast<int64_t>(m_weights[i]);
+        total_weight += static_cast<int64_t>(m_weights[i]);
+    }
+
+    m_credits[served_lane] -= total_weight;
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
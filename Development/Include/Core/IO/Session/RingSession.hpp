@@ -0,0 +1,382 @@
+#pragma once
+
+#include "FlowControl.hpp"
+#include "Inbound.hpp"
+#include "Outbound.hpp"
+#include "_Detail/Spin.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Lock-free single-producer/single-consumer byte ring. RingSession is both an Outbound and an Inbound session
+ * buffer, so an Egress on one thread may hand data to an Ingress on another without either of them taking a lock.
+ *
+ * @note Exactly one thread may Post and exactly one thread may Request at a time. Byte availability may be queried
+ * from either side and never blocks.
+ *
+ * @note Transmissions are all-or-nothing, a Post or Request either moves every byte of its span or none of them
+ *
+ * @note Contiguous regions of the ring are lent out through Reserve/Commit and Peek/Consume, so that Egress and Ingress
+ * may encode and decode in place
+ *
+ * @note The ring has FlowControl, so a waiting Egress sleeps until the consumer frees enough space
+ *
+ * @tparam CapacityV Size of the ring in bytes, must be a nonzero power of two
+ */
+template<size_t CapacityV>
+class RingSession final : public Outbound, public Inbound
+{
+    static_assert((CapacityV > 0U) && ((CapacityV & (CapacityV - 1U)) == 0U), "`CapacityV` must be a nonzero power "
+                                                                               "of two");
+
+public:
+    /// @brief Result type shared by both session interfaces
+    using Result = BinaryResult;
+
+    /// @brief Size of the ring in bytes
+    constexpr static size_t kCapacityBytes {CapacityV};
+
+    /// @brief Assumed size of a cache line, head and tail indices are kept at least this far apart
+    constexpr static size_t kCacheLineSizeBytes {64U};
+
+    // RingSession is trivially default constructible and destructible
+
+    RingSession() noexcept  = default;
+    ~RingSession() noexcept = default;
+
+    // RingSession holds synchronization state and may not be copied or moved
+
+    RingSession(RingSession const& copy) = delete;
+    RingSession(RingSession&& move)      = delete;
+
+    RingSession& operator=(RingSession const& copy) = delete;
+    RingSession& operator=(RingSession&& move)      = delete;
+
+    /**!
+     * @brief Flow control shared by the ring's producer and consumer
+     *
+     * @return The ring's flow control
+     */
+    virtual FlowControl* GetFlowControl() noexcept override;
+
+    /**!
+     * @brief Number of bytes that a Request could take from the ring right now. Wait-free.
+     *
+     * @return Size of buffered data in bytes
+     */
+    virtual size_t InputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Number of bytes that a Post could place in the ring right now. Wait-free.
+     *
+     * @return Size of free space in bytes
+     */
+    virtual size_t OutputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Copy a transmission in to the ring, waiting up to a timeout for enough space to free up. Producer side.
+     *
+     * @param[in] tx Bytes to post
+     * @param[in] timeout Maximum time that will be spent waiting for space
+     * @retval BinaryResult::kSuccessCode if every byte was posted
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Gather several spans in to the ring as one transmission. Producer side.
+     *
+     * @param[in] parts Spans to post, in order
+     * @param[in] timeout Maximum time that will be spent waiting for space
+     * @retval BinaryResult::kSuccessCode if every part was posted
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Copy a transmission out of the ring, waiting up to a timeout for enough data to arrive. Consumer side.
+     *
+     * @param[in] rx Destination, filled in its entirety
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every byte was received
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Scatter one transmission out of the ring across several spans. Consumer side.
+     *
+     * @param[in] parts Destination spans, filled in order
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every part was filled
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<Span<uint8_t> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Reserve contiguous free space within the ring to encode in to. Producer side, never blocks.
+     *
+     * @note Space that would straddle the end of the ring can't be lent out, Post must be used instead
+     *
+     * @param[in] size_bytes Size of the space to reserve
+     * @return Span over the reserved space, empty if not enough contiguous space is free
+     */
+    virtual Span<uint8_t> Reserve(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Publish the leading bytes of the last reservation to the consumer. Producer side.
+     *
+     * @param[in] size_bytes Number of reserved bytes to publish, 0 abandons the reservation
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if `size_bytes` exceeds the reservation
+     */
+    virtual Result Commit(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Look at the oldest buffered bytes in place. Consumer side, never blocks.
+     *
+     * @note Data that straddles the end of the ring can't be lent out, Request must be used instead
+     *
+     * @param[in] size_bytes Number of bytes to look at
+     * @return Span over the buffered bytes, empty if they are not available contiguously
+     */
+    virtual Span<uint8_t const> Peek(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Release the oldest buffered bytes back to the producer. Consumer side.
+     *
+     * @param[in] size_bytes Number of bytes to consume
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if fewer than `size_bytes` are buffered
+     */
+    virtual Result Consume(size_t size_bytes) noexcept override;
+
+private:
+    constexpr static size_t kIndexMask {CapacityV - 1U};
+
+    /**!
+     * @brief Copy bytes in to the ring starting at a position, in up to two pieces split where the ring wraps
+     *
+     * @param[in] position Position of the first byte
+     * @param[in] src Bytes to copy
+     */
+    void CopyIn(size_t position, Span<uint8_t const> src) noexcept;
+
+    /**!
+     * @brief Copy bytes out of the ring starting at a position, in up to two pieces split where the ring wraps
+     *
+     * @param[in] position Position of the first byte
+     * @param[in] dest Destination, filled in its entirety
+     */
+    void CopyOut(size_t position, Span<uint8_t> dest) const noexcept;
+
+    /// @brief Total number of bytes ever posted, written only by the producer
+    alignas(kCacheLineSizeBytes) std::atomic<size_t> m_head {0U};
+
+    /// @brief Size of the outstanding reservation, touched only by the producer
+    size_t m_reserved_bytes {0U};
+
+    /// @brief Total number of bytes ever requested, written only by the consumer
+    alignas(kCacheLineSizeBytes) std::atomic<size_t> m_tail {0U};
+
+    /// @brief Ring storage
+    alignas(kCacheLineSizeBytes) uint8_t m_ring[CapacityV] {};
+
+    /// @brief Space-available signal, watermarks and credit
+    FlowControl m_flow_control {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  RingSession method definitions in alphabetical order            ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t CapacityV>
+typename RingSession<CapacityV>::Result RingSession<CapacityV>::Commit(size_t size_bytes) noexcept
+{
+    if (size_bytes > m_reserved_bytes)
+        return Result::Failure();
+
+    m_reserved_bytes = 0U;
+
+    // Publish the data to the consumer
+    size_t const kHead {m_head.load(std::memory_order_relaxed)};
+    m_head.store((kHead + size_bytes), std::memory_order_release);
+    m_flow_control.NotifyFilled((kHead + size_bytes) - m_tail.load(std::memory_order_acquire));
+    return Result::Success();
+}
+
+template<size_t CapacityV>
+typename RingSession<CapacityV>::Result RingSession<CapacityV>::Consume(size_t size_bytes) noexcept
+{
+    size_t const kTail {m_tail.load(std::memory_order_relaxed)};
+    if ((m_head.load(std::memory_order_acquire) - kTail) < size_bytes)
+        return Result::Failure();
+
+    // Release the space back to the producer
+    m_tail.store((kTail + size_bytes), std::memory_order_release);
+    m_flow_control.NotifyDrained(m_head.load(std::memory_order_acquire) - (kTail + size_bytes));
+    return Result::Success();
+}
+
+template<size_t CapacityV>
+FlowControl* RingSession<CapacityV>::GetFlowControl() noexcept
+{
+    return &m_flow_control;
+}
+
+template<size_t CapacityV>
+size_t RingSession<CapacityV>::InputBytesAvailable() const noexcept
+{
+    size_t const kTail {m_tail.load(std::memory_order_acquire)};
+    return m_head.load(std::memory_order_acquire) - kTail;
+}
+
+template<size_t CapacityV>
+size_t RingSession<CapacityV>::OutputBytesAvailable() const noexcept
+{
+    size_t const kHead {m_head.load(std::memory_order_acquire)};
+    return CapacityV - (kHead - m_tail.load(std::memory_order_acquire));
+}
+
+template<size_t CapacityV>
+Span<uint8_t const> RingSession<CapacityV>::Peek(size_t size_bytes) noexcept
+{
+    size_t const kTail {m_tail.load(std::memory_order_relaxed)};
+    size_t const kStart {kTail & kIndexMask};
+    if (((m_head.load(std::memory_order_acquire) - kTail) < size_bytes) || ((CapacityV - kStart) < size_bytes))
+        return Span<uint8_t const> {nullptr, size_t {0U}};
+
+    return Span<uint8_t const> {(m_ring + kStart), size_bytes};
+}
+
+template<size_t CapacityV>
+typename RingSession<CapacityV>::Result RingSession<CapacityV>::Post(Span<uint8_t const> tx,
+                                                                     std::chrono::microseconds timeout) noexcept
+{
+    return Post(Span<Span<uint8_t const> const> {&tx, 1U}, timeout);
+}
+
+template<size_t CapacityV>
+typename RingSession<CapacityV>::Result RingSession<CapacityV>::Post(Span<Span<uint8_t const> const> parts,
+                                                                     std::chrono::microseconds       timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t const> const& part : parts)
+        size_bytes += part.size();
+
+    if (size_bytes > CapacityV)
+        return Result::Failure();
+
+    // Only the producer moves the head, so it can be read relaxed
+    size_t const kHead {m_head.load(std::memory_order_relaxed)};
+    auto         has_space {[&]() -> bool
+                    { return (CapacityV - (kHead - m_tail.load(std::memory_order_acquire))) >= size_bytes; }};
+    if (!_detail::spin_until(has_space, timeout))
+        return Result::Failure();
+
+    // Gather every part in to the ring, nothing is visible to the consumer until the head moves
+    size_t position {kHead};
+    for (Span<uint8_t const> const& part : parts)
+    {
+        CopyIn(position, part);
+        position += part.size();
+    }
+
+    // Publish the data to the consumer
+    m_head.store((kHead + size_bytes), std::memory_order_release);
+    m_flow_control.NotifyFilled((kHead + size_bytes) - m_tail.load(std::memory_order_acquire));
+    return Result::Success();
+}
+
+template<size_t CapacityV>
+typename RingSession<CapacityV>::Result RingSession<CapacityV>::Request(Span<uint8_t>             rx,
+                                                                        std::chrono::microseconds timeout) noexcept
+{
+    return Request(Span<Span<uint8_t> const> {&rx, 1U}, timeout);
+}
+
+template<size_t CapacityV>
+typename RingSession<CapacityV>::Result RingSession<CapacityV>::Request(Span<Span<uint8_t> const> parts,
+                                                                        std::chrono::microseconds timeout) noexcept
+{
+    size_t size_bytes {0U};
+    for (Span<uint8_t> const& part : parts)
+        size_bytes += part.size();
+
+    if (size_bytes > CapacityV)
+        return Result::Failure();
+
+    // Only the consumer moves the tail, so it can be read relaxed
+    size_t const kTail {m_tail.load(std::memory_order_relaxed)};
+    auto         has_data {[&]() -> bool { return (m_head.load(std::memory_order_acquire) - kTail) >= size_bytes; }};
+    if (!_detail::spin_until(has_data, timeout))
+        return Result::Failure();
+
+    // Scatter the data out to every part, the space stays claimed until the tail moves
+    size_t position {kTail};
+    for (Span<uint8_t> const& part : parts)
+    {
+        CopyOut(position, part);
+        position += part.size();
+    }
+
+    // Release the space back to the producer
+    m_tail.store((kTail + size_bytes), std::memory_order_release);
+    m_flow_control.NotifyDrained(m_head.load(std::memory_order_acquire) - (kTail + size_bytes));
+    return Result::Success();
+}
+
+template<size_t CapacityV>
+Span<uint8_t> RingSession<CapacityV>::Reserve(size_t size_bytes) noexcept
+{
+    size_t const kHead {m_head.load(std::memory_order_relaxed)};
+    size_t const kStart {kHead & kIndexMask};
+    size_t const kFreeBytes {CapacityV - (kHead - m_tail.load(std::memory_order_acquire))};
+    if ((kFreeBytes < size_bytes) || ((CapacityV - kStart) < size_bytes))
+    {
+        m_reserved_bytes = 0U;
+        return Span<uint8_t> {nullptr, size_t {0U}};
+    }
+
+    m_reserved_bytes = size_bytes;
+    return Span<uint8_t> {(m_ring + kStart), size_bytes};
+}
+
+//  Private     ========================================================================================================
+
+template<size_t CapacityV>
+void RingSession<CapacityV>::CopyIn(size_t position, Span<uint8_t const> src) noexcept
+{
+    size_t const kStart {position & kIndexMask};
+    size_t const kFirstSizeBytes {std::min(src.size(), (CapacityV - kStart))};
+    static_cast<void>(std::memcpy((m_ring + kStart), src.data(), kFirstSizeBytes));
+    static_cast<void>(std::memcpy(m_ring, (src.data() + kFirstSizeBytes), (src.size() - kFirstSizeBytes)));
+}
+
+template<size_t CapacityV>
+void RingSession<CapacityV>::CopyOut(size_t position, Span<uint8_t> dest) const noexcept
+{
+    size_t const kStart {position & kIndexMask};
+    size_t const kFirstSizeBytes {std::min(dest.size(), (CapacityV - kStart))};
+    static_cast<void>(std::memcpy(dest.data(), (m_ring + kStart), kFirstSizeBytes));
+    static_cast<void>(std::memcpy((dest.data() + kFirstSizeBytes), m_ring, (dest.size() - kFirstSizeBytes)));
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
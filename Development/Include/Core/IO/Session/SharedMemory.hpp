@@ -0,0 +1,315 @@
+#pragma once
+
+#include "Inbound.hpp"
+#include "Outbound.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Layout of a shared-memory ring. The ring lives in a named POSIX shared memory object:
+ *
+ * | Header (kHeaderSizeBytes) | Ring (capacity, a power of two) |
+ *
+ * The producer's and consumer's indices sit on their own cache lines, as in RingSession. Both count bytes ever moved
+ * and are 64 bits wide, so that processes of any word size agree on them. The consumer raises `is_consumer_waiting`
+ * before it sleeps on it, and the producer only makes a wake call when it sees the flag raised.
+ */
+struct SharedMemoryFormat
+{
+    /// @brief Marks a shared memory object as a ring
+    constexpr static uint32_t kMagic {0x53484D52U}; // "SHMR"
+
+    /// @brief Assumed size of a cache line
+    constexpr static size_t kCacheLineSizeBytes {64U};
+
+    /// @brief Size of the header, padded so that the ring starts on its own cache line
+    constexpr static size_t kHeaderSizeBytes {3U * kCacheLineSizeBytes};
+
+    /// @brief Longest name that a ring may have, including the leading '/'
+    constexpr static size_t kMaxNameSizeBytes {64U};
+
+    /// @brief Header values of `state`, in the order that the header passes through them
+    enum State : uint32_t
+    {
+        kUninitialized = 0U, ///< Freshly created, all zero
+        kInitializing  = 1U, ///< Being initialized by whichever side opened it first
+        kReady         = 2U  ///< Ready for use
+    };
+
+    /// @brief Header as laid out at the start of the shared memory object
+    struct Header
+    {
+        std::atomic<uint32_t> state;
+        uint32_t              magic;
+        uint64_t              capacity_bytes;
+
+        /// @brief Total number of bytes ever posted, written only by the producer
+        alignas(kCacheLineSizeBytes) std::atomic<uint64_t> head;
+
+        /// @brief Total number of bytes ever requested, written only by the consumer
+        alignas(kCacheLineSizeBytes) std::atomic<uint64_t> tail;
+
+        /// @brief Nonzero while the consumer is asleep waiting for data, written only by the consumer
+        std::atomic<uint32_t> is_consumer_waiting;
+    };
+
+    static_assert(sizeof(Header) <= kHeaderSizeBytes, "Ring header must fit within kHeaderSizeBytes");
+    static_assert(std::atomic<uint64_t>::is_always_lock_free && std::atomic<uint32_t>::is_always_lock_free,
+                  "Ring header atomics must be lock-free to be shared between processes");
+};
+
+namespace _detail
+{
+
+/// @brief Mapping of a shared-memory ring, owned by one side of the session
+struct SharedRing
+{
+    int      file_descriptor {-1};
+    uint8_t* mapping {nullptr};
+    size_t   mapping_size_bytes {0U};
+
+    SharedMemoryFormat::Header* GetHeader() const noexcept
+    {
+        return reinterpret_cast<SharedMemoryFormat::Header*>(mapping);
+    }
+
+    uint8_t* GetRing() const noexcept
+    {
+        return (mapping + SharedMemoryFormat::kHeaderSizeBytes);
+    }
+
+    bool IsMapped() const noexcept
+    {
+        return (mapping != nullptr);
+    }
+};
+
+} // namespace _detail
+
+/**!
+ * @brief Producer side of a lock-free single-producer/single-consumer byte ring in shared memory, so that an Egress in
+ * one process may hand data to an Ingress in another with no syscall or kernel copy per message. Transmissions are
+ * all-or-nothing, and Egress encodes in place through Reserve/Commit. Native builds only.
+ *
+ * A Post makes a wake call only when the consumer has gone to sleep waiting for data, so a busy consumer costs the
+ * producer nothing beyond the ring itself.
+ *
+ * @note Exactly one producer, in any process, may be open on a ring at a time
+ */
+class SharedMemoryOutbound final : public Outbound
+{
+public:
+    /**!
+     * @brief Initializing constructor, see Open
+     *
+     * @param[in] name Name of the shared memory object, starting with '/', copied and must be shorter than
+     * SharedMemoryFormat::kMaxNameSizeBytes
+     * @param[in] capacity_bytes Size of the ring in bytes, must be a nonzero power of two and agree with the consumer
+     */
+    SharedMemoryOutbound(char const* name, size_t capacity_bytes) noexcept;
+
+    /// @brief Unmaps the ring, the shared memory object is left in place
+    ~SharedMemoryOutbound() noexcept;
+
+    // SharedMemoryOutbound owns its mapping and may not be copied or moved
+
+    SharedMemoryOutbound() = delete;
+
+    SharedMemoryOutbound(SharedMemoryOutbound const& copy) = delete;
+    SharedMemoryOutbound(SharedMemoryOutbound&& move)      = delete;
+
+    SharedMemoryOutbound& operator=(SharedMemoryOutbound const& copy) = delete;
+    SharedMemoryOutbound& operator=(SharedMemoryOutbound&& move)      = delete;
+
+    /**!
+     * @brief Publish the leading bytes of the last reservation to the consumer
+     *
+     * @param[in] size_bytes Number of reserved bytes to publish, 0 abandons the reservation
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if `size_bytes` exceeds the reservation
+     */
+    virtual Result Commit(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Creates the ring, or attaches to it if the consumer already has
+     *
+     * @retval BinaryResult::kSuccessCode if the ring is ready to be posted to
+     * @retval BinaryResult::kFailureCode if it could not be mapped, or exists with a different capacity
+     */
+    Result Open() noexcept;
+
+    /**!
+     * @brief Number of bytes that a Post could place in the ring right now
+     *
+     * @return Size of free space in bytes
+     */
+    virtual size_t OutputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Copy a transmission in to the ring, waiting up to a timeout for enough space to free up
+     *
+     * @param[in] tx Bytes to post
+     * @param[in] timeout Maximum time that will be spent waiting for space
+     * @retval BinaryResult::kSuccessCode if every byte was posted
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Gather several spans in to the ring as one transmission
+     *
+     * @param[in] parts Spans to post, in order
+     * @param[in] timeout Maximum time that will be spent waiting for space
+     * @retval BinaryResult::kSuccessCode if every part was posted
+     * @retval BinaryResult::kFailureCode otherwise, nothing is posted
+     */
+    virtual Result Post(Span<Span<uint8_t const> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Reserve contiguous free space within the ring to encode in to, never blocks
+     *
+     * @note Space that would straddle the end of the ring can't be lent out, Post must be used instead
+     *
+     * @param[in] size_bytes Size of the space to reserve
+     * @return Span over the reserved space, empty if not enough contiguous space is free
+     */
+    virtual Span<uint8_t> Reserve(size_t size_bytes) noexcept override;
+
+private:
+    /// @brief Moves the head and wakes the consumer if it is asleep
+    void Publish(uint64_t head) noexcept;
+
+    char   m_name[SharedMemoryFormat::kMaxNameSizeBytes];
+    size_t m_capacity_bytes;
+
+    _detail::SharedRing m_ring {};
+
+    size_t m_reserved_bytes {0U};
+};
+
+/**!
+ * @brief Consumer side of a shared-memory ring, see SharedMemoryOutbound. Ingress decodes in place through
+ * Peek/Consume. Native builds only.
+ *
+ * A Request that has to wait spins briefly, then sleeps on a futex until the producer publishes or the timeout
+ * elapses. Where futexes are not available it yields instead of sleeping.
+ *
+ * @note Exactly one consumer, in any process, may be open on a ring at a time
+ */
+class SharedMemoryInbound final : public Inbound
+{
+public:
+    /// @brief Number of checks that a waiting Request spins for before going to sleep
+    constexpr static size_t kSpinCount {1024U};
+
+    /**!
+     * @brief Initializing constructor, see Open
+     *
+     * @param[in] name Name of the shared memory object, starting with '/', copied and must be shorter than
+     * SharedMemoryFormat::kMaxNameSizeBytes
+     * @param[in] capacity_bytes Size of the ring in bytes, must be a nonzero power of two and agree with the producer
+     */
+    SharedMemoryInbound(char const* name, size_t capacity_bytes) noexcept;
+
+    /// @brief Unmaps the ring, the shared memory object is left in place, see unlink_shared_memory
+    ~SharedMemoryInbound() noexcept;
+
+    // SharedMemoryInbound owns its mapping and may not be copied or moved
+
+    SharedMemoryInbound() = delete;
+
+    SharedMemoryInbound(SharedMemoryInbound const& copy) = delete;
+    SharedMemoryInbound(SharedMemoryInbound&& move)      = delete;
+
+    SharedMemoryInbound& operator=(SharedMemoryInbound const& copy) = delete;
+    SharedMemoryInbound& operator=(SharedMemoryInbound&& move)      = delete;
+
+    /**!
+     * @brief Release the oldest buffered bytes back to the producer
+     *
+     * @param[in] size_bytes Number of bytes to consume
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode if fewer than `size_bytes` are buffered
+     */
+    virtual Result Consume(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Number of bytes that a Request could take from the ring right now
+     *
+     * @return Size of buffered data in bytes
+     */
+    virtual size_t InputBytesAvailable() const noexcept override;
+
+    /**!
+     * @brief Creates the ring, or attaches to it if the producer already has
+     *
+     * @retval BinaryResult::kSuccessCode if the ring is ready to be requested from
+     * @retval BinaryResult::kFailureCode if it could not be mapped, or exists with a different capacity
+     */
+    Result Open() noexcept;
+
+    /**!
+     * @brief Look at the oldest buffered bytes in place, never blocks
+     *
+     * @note Data that straddles the end of the ring can't be lent out, Request must be used instead
+     *
+     * @param[in] size_bytes Number of bytes to look at
+     * @return Span over the buffered bytes, empty if they are not available contiguously
+     */
+    virtual Span<uint8_t const> Peek(size_t size_bytes) noexcept override;
+
+    /**!
+     * @brief Copy a transmission out of the ring, waiting up to a timeout for enough data to arrive
+     *
+     * @param[in] rx Destination, filled in its entirety
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every byte was received
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept override;
+
+    /**!
+     * @brief Scatter one transmission out of the ring across several spans
+     *
+     * @param[in] parts Destination spans, filled in order
+     * @param[in] timeout Maximum time that will be spent waiting for data
+     * @retval BinaryResult::kSuccessCode if every part was filled
+     * @retval BinaryResult::kFailureCode otherwise, nothing is consumed
+     */
+    virtual Result Request(Span<Span<uint8_t> const> parts, std::chrono::microseconds timeout) noexcept override;
+
+private:
+    /// @brief Waits for at least `size_bytes` to be buffered, spinning first and then sleeping
+    bool WaitForInput(size_t size_bytes, std::chrono::microseconds timeout) noexcept;
+
+    char   m_name[SharedMemoryFormat::kMaxNameSizeBytes];
+    size_t m_capacity_bytes;
+
+    _detail::SharedRing m_ring {};
+};
+
+/**!
+ * @brief Removes the name of a shared-memory ring. Sides that are already open keep working, a side opened afterwards
+ * creates a new ring.
+ *
+ * @param[in] name Name of the shared memory object
+ * @retval BinaryResult::kSuccessCode if the name was removed
+ * @retval BinaryResult::kFailureCode if it did not exist
+ */
+BinaryResult unlink_shared_memory(char const* name) noexcept;
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,207 @@
+#pragma once
+
+#include "Transference.hpp"
+#include "_Detail/Egress.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <chrono>
+#include <type_traits>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Egress bound to its session type at compile time. Nothing is virtual, so when `SessionT` is a concrete,
+ * preferably final, session the whole encode-then-post path may be inlined. Use Egress where the session type must be
+ * erased.
+ *
+ * @tparam T Any type. CV and reference qualifiers are removed.
+ * @tparam SessionT Session type that provides the Outbound interface
+ */
+template<typename T, typename SessionT>
+class StaticEgress : public _detail::EgressBase
+{
+public:
+    /// @brief Type that is put to the StaticEgress instance
+    using value_type = std::decay_t<T>;
+
+    /// @brief Type of the connected session
+    using session_type = SessionT;
+
+    /**!
+     * @brief Initializing constructor. Connects StaticEgress to a session buffer.
+     *
+     * @param[in] session Reference to session buffer that the StaticEgress will connect with
+     */
+    StaticEgress(SessionT& session) noexcept;
+
+    // StaticEgress is not trivially constructible
+
+    StaticEgress() = delete;
+
+    // StaticEgress is trivially copy/move constructible and destructible
+
+    StaticEgress(StaticEgress const& copy) = default;
+    StaticEgress(StaticEgress&& move)      = default;
+
+    ~StaticEgress() = default;
+
+    // StaticEgress is trivially copy and move assignable
+
+    StaticEgress& operator=(StaticEgress const& copy) = default;
+    StaticEgress& operator=(StaticEgress&& move)      = default;
+
+    /**!
+     * @brief Set aside space in the connected session for a number of objects ahead of time, waiting up to a duration
+     * for it to free up. Every following Put, and every object of a PutMany, spends credit before it looks at the
+     * session, so a producer that knows its burst up front checks for space once.
+     *
+     * @note Credit is held by the session on behalf of its one producer, so every StaticEgress on the session shares it
+     *
+     * @param[in] count Number of objects to set space aside for, on top of any credit already held
+     * @param[in] duration Maximum time that will be spent waiting for space
+     * @retval BinaryResult::kSuccessCode if the credit was granted
+     * @retval BinaryResult::kFailureCode if the session has no FlowControl or the space didn't free up in time
+     */
+    BinaryResult AcquireCredit(size_t count, std::chrono::microseconds duration) noexcept;
+
+    /**!
+     * @brief Number of objects that the credit held in the connected session still covers
+     *
+     * @return Number of objects, 0 if the session has no FlowControl
+     */
+    size_t GetCredit() const noexcept;
+
+    /**!
+     * @brief Post an object's data to the connected session buffer with no blocking delay
+     *
+     * @param[in] data Reference to an object to put to the StaticEgress
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult Put(value_type const& data) noexcept;
+
+    /**!
+     * @brief Post an object's data to the connected session buffer, blocking for a duration or until the transference
+     * is complete, whichever finishes first
+     *
+     * @note Credit is spent first. Otherwise sessions with FlowControl are slept on until enough space frees up, and
+     * any other session turns the object away as soon as it doesn't fit.
+     *
+     * @param[in] data Reference to an object to put to the StaticEgress
+     * @param[in] duration Maximum time that will be spent attempting to post data
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult Put(value_type const& data, std::chrono::microseconds duration) noexcept;
+
+    /**!
+     * @brief Encode an object's data in to a Transference and start posting it to the connected session buffer,
+     * returning right away. Completion is reported through `transference`.
+     *
+     * @param[in] data Reference to an object to put to the StaticEgress
+     * @param[in] transference Transmission to start, constructed over exactly
+     * `data::footprint_size_bytes_v<value_type>` writable bytes that outlive it
+     * @retval BinaryResult::kSuccessCode if the transmission was started
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult PutAsync(value_type const& data, Transference& transference) noexcept;
+
+    /**!
+     * @brief Post a burst of objects to the connected session buffer, see Egress::PutMany
+     *
+     * @param[in] data Objects to put to the StaticEgress
+     * @param[in] duration Maximum time that will be spent waiting on the session
+     * @return Number of objects posted
+     */
+    size_t PutMany(Span<value_type const> data, std::chrono::microseconds duration) noexcept;
+
+    /**!
+     * @brief Post an object's data followed by trailing parts as one atomic transmission, see Egress::PutMultipart
+     *
+     * @tparam PartT Types of the trailing parts, byte spans or anything that may be encoded
+     * @param[in] duration Maximum time that will be spent attempting to post data
+     * @param[in] data Reference to an object to put to the StaticEgress, sent first
+     * @param[in] parts Trailing parts, sent in order after `data`
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    template<typename... PartT>
+    BinaryResult PutMultipart(std::chrono::microseconds duration, value_type const& data,
+                              PartT const&... parts) noexcept;
+
+private:
+    /// @brief Reference to connected session
+    SessionT& m_session;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StaticEgress constructor definitions            ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename T, typename SessionT>
+StaticEgress<T, SessionT>::StaticEgress(SessionT& session) noexcept : m_session {session}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StaticEgress method definitions in alphabetical order           ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename T, typename SessionT>
+BinaryResult StaticEgress<T, SessionT>::AcquireCredit(size_t count, std::chrono::microseconds duration) noexcept
+{
+    return _detail::egress_acquire_credit<value_type>(m_session, count, duration);
+}
+
+template<typename T, typename SessionT>
+size_t StaticEgress<T, SessionT>::GetCredit() const noexcept
+{
+    return _detail::egress_credit<value_type>(m_session);
+}
+
+template<typename T, typename SessionT>
+BinaryResult StaticEgress<T, SessionT>::Put(value_type const& data) noexcept
+{
+    return Put(data, std::chrono::microseconds::zero());
+}
+
+template<typename T, typename SessionT>
+BinaryResult StaticEgress<T, SessionT>::Put(value_type const& data, std::chrono::microseconds duration) noexcept
+{
+    return _detail::egress_put(m_session, data, duration);
+}
+
+template<typename T, typename SessionT>
+BinaryResult StaticEgress<T, SessionT>::PutAsync(value_type const& data, Transference& transference) noexcept
+{
+    return _detail::egress_put_async(m_session, data, transference);
+}
+
+template<typename T, typename SessionT>
+size_t StaticEgress<T, SessionT>::PutMany(Span<value_type const> data, std::chrono::microseconds duration) noexcept
+{
+    return _detail::egress_put_many(m_session, data, duration);
+}
+
+template<typename T, typename SessionT>
+template<typename... PartT>
+BinaryResult StaticEgress<T, SessionT>::PutMultipart(std::chrono::microseconds duration, value_type const& data,
+                                                     PartT const&... parts) noexcept
+{
+    return _detail::egress_put_multipart(m_session, duration, data, parts...);
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -0,0 +1,148 @@
+#pragma once
+
+#include "Transference.hpp"
+#include "_Detail/Ingress.hpp"
+
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <chrono>
+#include <type_traits>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+
+/**!
+ * @brief Ingress bound to its session type at compile time. Nothing is virtual, so when `SessionT` is a concrete,
+ * preferably final, session the whole request-then-decode path may be inlined. Use Ingress where the session type must
+ * be erased.
+ *
+ * @tparam T Any type. CV and reference qualifiers are removed.
+ * @tparam SessionT Session type that provides the Inbound interface
+ */
+template<typename T, typename SessionT>
+class StaticIngress : public _detail::IngressBase
+{
+public:
+    /// @brief Type that is read from the StaticIngress instance
+    using value_type = std::decay_t<T>;
+
+    /// @brief Type of the connected session
+    using session_type = SessionT;
+
+    /**!
+     * @brief Initializing constructor. Connects StaticIngress to a session buffer.
+     *
+     * @param[in] session Reference to session buffer that the StaticIngress will connect with
+     */
+    StaticIngress(SessionT& session) noexcept;
+
+    // StaticIngress is not trivially constructible
+
+    StaticIngress() = delete;
+
+    // StaticIngress is trivially copy/move constructible and destructible
+
+    StaticIngress(StaticIngress const& copy) = default;
+    StaticIngress(StaticIngress&& move)      = default;
+
+    ~StaticIngress() = default;
+
+    // StaticIngress is trivially copy and move assignable
+
+    StaticIngress& operator=(StaticIngress const& copy) = default;
+    StaticIngress& operator=(StaticIngress&& move)      = default;
+
+    /**!
+     * @brief Read an object from the connected session buffer with no blocking delay
+     *
+     * @param[out] data Destination object
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult Get(value_type& data) noexcept;
+
+    /**!
+     * @brief Read an object from the connected session buffer, blocking for a timeout or until the transference is
+     * complete, whichever finishes first
+     *
+     * @param[out] data Destination object
+     * @param[in] timeout Maximum time that will be spent waiting on the session
+     * @retval BinaryResult::kSuccessCode if successful
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult Get(value_type& data, std::chrono::microseconds timeout) noexcept;
+
+    /**!
+     * @brief Start requesting an object's data in to a Transference from the connected session buffer, returning right
+     * away. Once `transference` completes successfully its bytes may be decoded with data::decode.
+     *
+     * @param[in] transference Transmission to start, constructed over exactly
+     * `data::footprint_size_bytes_v<value_type>` writable bytes that outlive it
+     * @retval BinaryResult::kSuccessCode if the transmission was started
+     * @retval BinaryResult::kFailureCode otherwise
+     */
+    BinaryResult GetAsync(Transference& transference) noexcept;
+
+    /**!
+     * @brief Drain as many whole objects as are available from the connected session buffer, see Ingress::GetMany
+     *
+     * @param[out] data Destination for the objects, filled from the front
+     * @param[in] timeout Maximum time that will be spent waiting on the session
+     * @return Number of objects read in to `data`
+     */
+    size_t GetMany(Span<value_type> data, std::chrono::microseconds timeout) noexcept;
+
+private:
+    /// @brief Reference to connected session
+    SessionT& m_session;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StaticIngress constructor definitions           ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename T, typename SessionT>
+StaticIngress<T, SessionT>::StaticIngress(SessionT& session) noexcept : m_session {session}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StaticIngress method definitions in alphabetical order          ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename T, typename SessionT>
+BinaryResult StaticIngress<T, SessionT>::Get(value_type& data) noexcept
+{
+    return Get(data, std::chrono::microseconds::zero());
+}
+
+template<typename T, typename SessionT>
+BinaryResult StaticIngress<T, SessionT>::Get(value_type& data, std::chrono::microseconds timeout) noexcept
+{
+    return _detail::ingress_get(m_session, data, timeout);
+}
+
+template<typename T, typename SessionT>
+BinaryResult StaticIngress<T, SessionT>::GetAsync(Transference& transference) noexcept
+{
+    return _detail::ingress_get_async<value_type>(m_session, transference);
+}
+
+template<typename T, typename SessionT>
+size_t StaticIngress<T, SessionT>::GetMany(Span<value_type> data, std::chrono::microseconds timeout) noexcept
+{
+    return _detail::ingress_get_many(m_session, data, timeout);
+}
+
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -3,6 +3,9 @@
 #include "Core/Result.hpp"
 #include "Core/Span.hpp"
 
+#include <atomic>
+#include <chrono>
+
 namespace shmit
 {
 namespace io
@@ -10,6 +13,13 @@ namespace io
 namespace session
 {
 
+/**!
+ * @brief Handle to one asynchronous transmission. The caller owns the Transference and the bytes that it refers to,
+ * hands it to a session through PostAsync or RequestAsync, and may keep working while the session completes it later,
+ * possibly from an ISR or DMA completion handler. Completion is observed by polling the result or through a callback.
+ *
+ * @note A Transference must outlive its transmission and may not be copied or moved while one is in flight
+ */
 class Transference
 {
 public:
@@ -22,28 +32,85 @@ public:
 
     using Result = EnumeratedResult<ResultCode, ResultCode::kComplete, ResultCode::kFailed>;
 
+    /**!
+     * @brief Called once when a transmission completes, from whichever context completed it
+     *
+     * @param[in] transference Completed Transference
+     * @param[in] context Context registered along with the callback
+     */
+    using CompletionCallback = void (*)(Transference& transference, void* context);
+
     Transference() = delete;
 
-    Transference(Span<uint8_t> data) noexcept;
-    Transference(Span<uint8_t const> data) noexcept;
+    /**!
+     * @brief Initializing constructor for a transmission that may write to its bytes, such as a request
+     *
+     * @param[in] data Bytes that are transferred
+     * @param[in] callback Optional completion callback
+     * @param[in] context Optional context passed to the completion callback
+     */
+    Transference(Span<uint8_t> data, CompletionCallback callback = nullptr, void* context = nullptr) noexcept;
+
+    /**!
+     * @brief Initializing constructor for a transmission that only reads its bytes, such as a post
+     *
+     * @param[in] data Bytes that are transferred
+     * @param[in] callback Optional completion callback
+     * @param[in] context Optional context passed to the completion callback
+     */
+    Transference(Span<uint8_t const> data, CompletionCallback callback = nullptr, void* context = nullptr) noexcept;
+
+    // Transference is shared with the session completing it and may not be copied or moved
 
-    Transference(Transference const& copy) = default;
-    Transference(Transference&& move)      = default;
+    Transference(Transference const& copy) = delete;
+    Transference(Transference&& move)      = delete;
 
     ~Transference() = default;
 
-    Transference& operator=(Transference const& copy) = default;
-    Transference& operator=(Transference&& move)      = default;
+    Transference& operator=(Transference const& copy) = delete;
+    Transference& operator=(Transference&& move)      = delete;
 
+    /// @brief Bytes that are transferred
     Span<uint8_t const> GetData() const noexcept;
 
+    /// @brief Bytes that are transferred, empty if the Transference was constructed over read-only bytes
+    Span<uint8_t> GetWritableData() const noexcept;
+
+    /// @brief Current result, ResultCode::kPending until the session completes the transmission
     Result GetResult() const noexcept;
 
+    /// @brief Checks if the transmission is still in flight
+    bool IsPending() const noexcept;
+
+    /**!
+     * @brief Marks the Transference as pending again so that it can be reused for another transmission
+     *
+     * @note Not safe to call while a transmission is in flight
+     */
+    void Reset() noexcept;
+
+    /**!
+     * @brief Sets the result. Any result other than ResultCode::kPending completes the transmission and invokes the
+     * completion callback, if one was registered. Safe to call from an ISR.
+     *
+     * @param[in] result New result
+     */
     void SetResult(Result result) noexcept;
 
+    /**!
+     * @brief Spin until the transmission completes or a timeout elapses, whichever comes first
+     *
+     * @param[in] timeout Maximum time that will be spent waiting
+     * @return Result at the time of returning, still ResultCode::kPending if the timeout elapsed first
+     */
+    Result Wait(std::chrono::microseconds timeout) const noexcept;
+
 private:
-    Result              m_result;
-    Span<uint8_t const> m_data;
+    std::atomic<ResultCode> m_result_code;
+    Span<uint8_t const>     m_data;
+    Span<uint8_t>           m_writable_data;
+    CompletionCallback      m_callback;
+    void*                   m_context;
 };
 
 } // namespace session
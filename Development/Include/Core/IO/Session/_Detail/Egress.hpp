@@ -1,5 +1,21 @@
 #pragma once
 
+#include "Core/Data/Encode.hpp"
+#include "Core/Data/Footprint.hpp"
+#include "Core/IO/Session/FlowControl.hpp"
+#include "Core/IO/Session/Instrumentation.hpp"
+#include "Core/IO/Session/Transference.hpp"
+#include "Core/Platform/Clock.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <tuple>
+#include <utility>
+
 namespace shmit
 {
 namespace io
@@ -9,12 +25,548 @@ namespace session
 namespace _detail
 {
 
+/// @brief Largest stack buffer that a burst of objects is staged in when posting, unless one object is larger
+constexpr static size_t kEgressStagingSizeBytes {256U};
+
 /// @brief Object for all specializations of Egress to inherit from, providing a common identity
 class EgressBase
 {
 };
 
+/**!
+ * @brief One part of a multi-part Egress transmission, encoded on construction in to its own storage
+ *
+ * @tparam T Type of the part's value
+ */
+template<typename T>
+struct EgressPart
+{
+    /// @brief Size of the encoded part in bytes
+    constexpr static size_t kSizeBytes {data::footprint_size_bytes_v<T>};
+
+    /**!
+     * @brief Encodes a value in to the part's storage
+     *
+     * @param[in] value Value of the part
+     */
+    EgressPart(T const& value) noexcept : result {BinaryResult::Failure()}
+    {
+        static_cast<void>(std::memset(buffer, 0U, kSizeBytes)); // Avoid unused return warning
+
+        Span<uint8_t> encoded_span {buffer, kSizeBytes};
+        size_t        bits_encoded {0U};
+        result = data::encode(value, encoded_span, bits_encoded);
+    }
+
+    /// @brief Encoded bytes of the part
+    Span<uint8_t const> AsSpan() const noexcept
+    {
+        return Span<uint8_t const> {buffer, kSizeBytes};
+    }
+
+    /// @brief Encoded part
+    uint8_t buffer[kSizeBytes];
+
+    /// @brief Result of encoding the part
+    BinaryResult result;
+};
+
+/**!
+ * @brief Part of a multi-part Egress transmission that is already a byte span, passed through without a copy
+ *
+ */
+template<>
+struct EgressPart<Span<uint8_t const>>
+{
+    /**!
+     * @brief Refers to a span of bytes, which must outlive the part
+     *
+     * @param[in] bytes Bytes of the part
+     */
+    EgressPart(Span<uint8_t const> const& bytes) noexcept : span {bytes}, result {BinaryResult::Success()}
+    {
+    }
+
+    /// @brief Bytes of the part
+    Span<uint8_t const> AsSpan() const noexcept
+    {
+        return span;
+    }
+
+    /// @brief Bytes of the part
+    Span<uint8_t const> span;
+
+    /// @brief Always successful, nothing is encoded
+    BinaryResult result;
+};
+
+/**!
+ * @brief Part of a multi-part Egress transmission that is already a mutable byte span, passed through without a copy
+ *
+ */
+template<>
+struct EgressPart<Span<uint8_t>> : public EgressPart<Span<uint8_t const>>
+{
+    /**!
+     * @brief Refers to a span of bytes, which must outlive the part
+     *
+     * @param[in] bytes Bytes of the part
+     */
+    EgressPart(Span<uint8_t> const& bytes) noexcept : EgressPart<Span<uint8_t const>> {span_cast<uint8_t const>(bytes)}
+    {
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions               ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Sets aside space in a session for a number of objects, see Egress::AcquireCredit
+ *
+ * @tparam T Type of the objects
+ * @tparam SessionT Outbound session type
+ * @param[in] session Session to set space aside in
+ * @param[in] count Number of objects
+ * @param[in] duration Maximum time that will be spent waiting for space
+ * @retval BinaryResult::kSuccessCode if the credit was granted
+ * @retval BinaryResult::kFailureCode if the session has no flow control or the space didn't free up in time
+ */
+template<typename T, typename SessionT>
+static BinaryResult egress_acquire_credit(SessionT& session, size_t count, std::chrono::microseconds duration) noexcept
+{
+    FlowControl* const kFlowControl {session.GetFlowControl()};
+    if (kFlowControl == nullptr)
+        return BinaryResult::Failure();
+
+    return kFlowControl->AcquireCredit(session, (count * data::footprint_size_bytes_v<T>), duration);
+}
+
+/**!
+ * @brief Sleeps on a session's flow control until a transmission fits, taking the time spent waiting off the duration
+ * so that the Post which follows only waits for the remainder
+ *
+ * @tparam SessionT Outbound session type
+ * @param[in] flow_control Session's flow control
+ * @param[in] session Session to post to
+ * @param[in] size_bytes Size of the transmission
+ * @param[inout] duration Maximum time that will be spent waiting for space, updated to the time left
+ * @retval true if the transmission fits
+ * @retval false otherwise
+ */
+template<typename SessionT>
+static bool egress_wait_for_space(FlowControl& flow_control, SessionT& session, size_t size_bytes,
+                                  std::chrono::microseconds& duration) noexcept
+{
+    // The clock is only read when there is something to wait for
+    if (session.OutputBytesAvailable() >= size_bytes)
+        return true;
+
+    auto const kStart {platform::Clock::now()};
+    bool const kIsSpaceFree {flow_control.WaitForSpace(session, size_bytes, duration)};
+    auto const kWaited {std::chrono::duration_cast<std::chrono::microseconds>(platform::Clock::now() - kStart)};
+    duration = (kWaited >= duration) ? std::chrono::microseconds::zero() : (duration - kWaited);
+    return kIsSpaceFree;
+}
+
+/**!
+ * @brief Makes sure that a session has room for a transmission. Credit is spent first, then sessions with flow control
+ * are slept on until the space frees up, and any other session is only checked once.
+ *
+ * @tparam SessionT Outbound session type
+ * @param[in] session Session to post to
+ * @param[in] size_bytes Size of the transmission
+ * @param[inout] duration Maximum time that will be spent waiting for space, updated to the time left for posting
+ * @retval true if the transmission fits
+ * @retval false otherwise
+ */
+template<typename SessionT>
+static bool egress_await_space(SessionT& session, size_t size_bytes, std::chrono::microseconds& duration) noexcept
+{
+    FlowControl* const kFlowControl {session.GetFlowControl()};
+    if (kFlowControl == nullptr)
+        return (session.OutputBytesAvailable() >= size_bytes);
+
+    // Credited space was already found free and only this producer fills the session, so it needs no second look
+    if (kFlowControl->GetCreditBytes() >= size_bytes)
+    {
+        static_cast<void>(kFlowControl->SpendCredit(size_bytes));
+        return true;
+    }
+
+    return egress_wait_for_space(*kFlowControl, session, size_bytes, duration);
+}
+
+/**!
+ * @brief Number of objects that the credit held in a session covers, see Egress::GetCredit
+ *
+ * @tparam T Type of the objects
+ * @tparam SessionT Outbound session type
+ * @param[in] session Session holding the credit
+ * @return Number of objects, 0 if the session has no flow control
+ */
+template<typename T, typename SessionT>
+static size_t egress_credit(SessionT& session) noexcept
+{
+    FlowControl* const kFlowControl {session.GetFlowControl()};
+    if (kFlowControl == nullptr)
+        return 0U;
+
+    return kFlowControl->GetCreditBytes() / data::footprint_size_bytes_v<T>;
+}
+
+/**!
+ * @brief Collects the span of every part of a multi-part transmission, in order
+ *
+ * @tparam PartT Types of the parts' values
+ * @tparam I Indices of the parts
+ * @param[in] parts Encoded parts
+ * @return Span of every part
+ */
+template<typename... PartT, size_t... I>
+static std::array<Span<uint8_t const>, sizeof...(PartT)>
+    egress_part_spans(std::tuple<EgressPart<PartT>...> const& parts, std::index_sequence<I...>) noexcept
+{
+    return std::array<Span<uint8_t const>, sizeof...(PartT)> {{std::get<I>(parts).AsSpan()...}};
+}
+
+/**!
+ * @brief Checks that every part of a multi-part transmission encoded successfully
+ *
+ * @tparam PartT Types of the parts' values
+ * @tparam I Indices of the parts
+ * @param[in] parts Encoded parts
+ * @retval true if every part encoded successfully
+ * @retval false otherwise
+ */
+template<typename... PartT, size_t... I>
+static bool egress_parts_encoded(std::tuple<EgressPart<PartT>...> const& parts, std::index_sequence<I...>) noexcept
+{
+    bool const encoded[] {true, std::get<I>(parts).result.IsSuccess()...};
+
+    for (bool part_encoded : encoded)
+    {
+        if (!part_encoded)
+            return false;
+    }
+
+    return true;
+}
+
+/**!
+ * @brief Posts an object's data to a session, encoding it in place when the session lends out its storage. Shared by
+ * every Egress variant so that the session calls bind to whatever type `SessionT` is.
+ *
+ * @tparam T Type of the object
+ * @tparam SessionT Outbound session type
+ * @param[in] session Session to post to
+ * @param[in] data Object to post
+ * @param[in] duration Maximum time that will be spent attempting to post data
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename T, typename SessionT>
+static BinaryResult egress_put(SessionT& session, T const& data, std::chrono::microseconds duration) noexcept
+{
+    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<T>};
+
+    // Guard against overflowing the Outbound buffer
+    if (!egress_await_space(session, kDataSizeBytes, duration))
+    {
+        instrument_count(SessionCounter::kOutputRejections);
+        return BinaryResult::Failure();
+    }
+
+    InstrumentStopwatch stopwatch {};
+
+    // Encode in place when the session can lend out its storage
+    Span<uint8_t> reserved_span {session.Reserve(kDataSizeBytes)};
+    if (reserved_span.size() >= kDataSizeBytes)
+    {
+        size_t       bits_encoded {0U};
+        BinaryResult encode_result {data::encode(data, reserved_span, bits_encoded)};
+        if (encode_result.IsFailure())
+        {
+            static_cast<void>(session.Commit(0U)); // Abandon the reservation
+            instrument_count(SessionCounter::kPostFailures);
+            return encode_result;
+        }
+
+        stopwatch.Record(SessionHistogram::kEncodeTime);
+        if (session.Commit(kDataSizeBytes).IsFailure())
+        {
+            instrument_count(SessionCounter::kPostFailures);
+            return BinaryResult::Failure();
+        }
+
+        instrument_count(SessionCounter::kPuts);
+        instrument_count(SessionCounter::kBytesPosted, kDataSizeBytes);
+        return BinaryResult::Success();
+    }
+
+    // Otherwise, objects that are already laid out as they are encoded are posted straight from their own storage
+    if constexpr (data::is_wire_identical_v<T>)
+    {
+        auto post_result {session.Post(Span<uint8_t const> {reinterpret_cast<uint8_t const*>(&data), kDataSizeBytes},
+                                       duration)};
+        stopwatch.Record(SessionHistogram::kPostWaitTime);
+        if (post_result.IsFailure())
+        {
+            instrument_count(SessionCounter::kPostFailures);
+            return BinaryResult::Failure();
+        }
+
+        instrument_count(SessionCounter::kPuts);
+        instrument_count(SessionCounter::kBytesPosted, kDataSizeBytes);
+        return BinaryResult::Success();
+    }
+
+    // Otherwise, encode data in byte buffer. Encoding a fixed-size object is short and is not charged to the duration.
+    uint8_t       encoded_buffer[kDataSizeBytes];
+    Span<uint8_t> encoded_span {encoded_buffer, kDataSizeBytes};
+    static_cast<void>(std::memset(encoded_buffer, 0U, kDataSizeBytes)); // Avoid unused return warning
+
+    size_t       bits_encoded {0U};
+    BinaryResult encode_result {data::encode(data, encoded_span, bits_encoded)};
+    if (!encode_result.IsSuccess())
+    {
+        instrument_count(SessionCounter::kPostFailures);
+        return encode_result;
+    }
+
+    stopwatch.Record(SessionHistogram::kEncodeTime);
+
+    // Pack span in to a Transference and post to Outbound buffer
+    auto post_result {session.Post(span_cast<uint8_t const>(encoded_span), duration)};
+    stopwatch.Record(SessionHistogram::kPostWaitTime);
+    if (post_result.IsFailure())
+    {
+        instrument_count(SessionCounter::kPostFailures);
+        return BinaryResult::Failure();
+    }
+
+    instrument_count(SessionCounter::kPuts);
+    instrument_count(SessionCounter::kBytesPosted, kDataSizeBytes);
+    return BinaryResult::Success();
+}
+
+/**!
+ * @brief Posts a burst of objects to a session as few transmissions as possible, see Egress::PutMany
+ *
+ * @tparam T Type of the objects
+ * @tparam SessionT Outbound session type
+ * @param[in] session Session to post to
+ * @param[in] data Objects to post
+ * @param[in] duration Maximum time that will be spent waiting on the session
+ * @return Number of objects posted
+ */
+template<typename T, typename SessionT>
+static size_t egress_put_many(SessionT& session, Span<T const> data, std::chrono::microseconds duration) noexcept
+{
+    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<T>};
+    constexpr static size_t kStagingCount {(kEgressStagingSizeBytes < kDataSizeBytes)
+                                               ? 1U
+                                               : (kEgressStagingSizeBytes / kDataSizeBytes)};
+
+    // Message-oriented sessions hand each Post whole to one Request, so every object has to be its own message
+    if (session.IsMessageOriented())
+    {
+        size_t num_posted {0U};
+        while (num_posted < data.count())
+        {
+            std::chrono::microseconds const kWait {(num_posted == 0U) ? duration : std::chrono::microseconds::zero()};
+            if (egress_put(session, data[num_posted], kWait).IsFailure())
+                break;
+
+            num_posted++;
+        }
+
+        return num_posted;
+    }
+
+    // One availability check covers the whole burst, sessions with flow control may be waited on for the first object
+    size_t             count {std::min(data.count(), (session.OutputBytesAvailable() / kDataSizeBytes))};
+    FlowControl* const kFlowControl {session.GetFlowControl()};
+    if ((count == 0U) && (data.count() > 0U) && (kFlowControl != nullptr) &&
+        egress_wait_for_space(*kFlowControl, session, kDataSizeBytes, duration))
+        count = std::min(data.count(), (session.OutputBytesAvailable() / kDataSizeBytes));
+
+    if (count == 0U)
+    {
+        instrument_count(SessionCounter::kOutputRejections);
+        return 0U;
+    }
+
+    // Credit is only spent on what actually gets posted, a failed burst keeps it for the next attempt
+    auto const spend_credit {[kFlowControl](size_t num_objects)
+                             {
+                                 if (kFlowControl != nullptr)
+                                     static_cast<void>(kFlowControl->SpendCredit(num_objects * kDataSizeBytes));
+                             }};
+
+    // Encode in place when the session can lend out its storage
+    Span<uint8_t> reserved_span {session.Reserve(count * kDataSizeBytes)};
+    if (reserved_span.size() >= (count * kDataSizeBytes))
+    {
+        size_t num_encoded {0U};
+        if constexpr (data::is_wire_identical_v<T>)
+        {
+            // Already laid out as encoded, the whole burst is one copy
+            static_cast<void>(std::memcpy(reserved_span.data(), reinterpret_cast<uint8_t const*>(data.data()),
+                                          (count * kDataSizeBytes)));
+            num_encoded = count;
+        }
+
+        for (; num_encoded < count; num_encoded++)
+        {
+            Span<uint8_t> element_span {reserved_span.subspan((num_encoded * kDataSizeBytes), kDataSizeBytes)};
+            size_t        bits_encoded {0U};
+            if (data::encode(data[num_encoded], element_span, bits_encoded).IsFailure())
+                break;
+        }
+
+        // Publish everything encoded before any failure
+        if (session.Commit(num_encoded * kDataSizeBytes).IsFailure())
+        {
+            instrument_count(SessionCounter::kPostFailures);
+            return 0U;
+        }
+
+        spend_credit(num_encoded);
+        instrument_count(SessionCounter::kPuts, num_encoded);
+        instrument_count(SessionCounter::kBytesPosted, (num_encoded * kDataSizeBytes));
+        return num_encoded;
+    }
+
+    // Otherwise, objects that are already laid out as they are encoded are posted straight from their own storage
+    if constexpr (data::is_wire_identical_v<T>)
+    {
+        Span<uint8_t const> burst_span {reinterpret_cast<uint8_t const*>(data.data()), (count * kDataSizeBytes)};
+        if (session.Post(burst_span, duration).IsFailure())
+        {
+            instrument_count(SessionCounter::kPostFailures);
+            return 0U;
+        }
+
+        spend_credit(count);
+        instrument_count(SessionCounter::kPuts, count);
+        instrument_count(SessionCounter::kBytesPosted, (count * kDataSizeBytes));
+        return count;
+    }
+
+    // Otherwise, stage the burst on the stack
+    uint8_t encoded_buffer[kStagingCount * kDataSizeBytes];
+
+    size_t num_posted {0U};
+    while (num_posted < count)
+    {
+        size_t const chunk_count {std::min(kStagingCount, (count - num_posted))};
+        // Avoid unused return warning
+        static_cast<void>(std::memset(encoded_buffer, 0U, (chunk_count * kDataSizeBytes)));
+
+        size_t num_encoded {0U};
+        for (; num_encoded < chunk_count; num_encoded++)
+        {
+            Span<uint8_t> element_span {(encoded_buffer + (num_encoded * kDataSizeBytes)), kDataSizeBytes};
+            size_t        bits_encoded {0U};
+            if (data::encode(data[num_posted + num_encoded], element_span, bits_encoded).IsFailure())
+                break;
+        }
+
+        if (num_encoded == 0U)
+            break;
+
+        // Space was checked up front, only the first post waits on the session
+        Span<uint8_t const> encoded_span {encoded_buffer, (num_encoded * kDataSizeBytes)};
+        if (session.Post(encoded_span, duration).IsFailure())
+        {
+            instrument_count(SessionCounter::kPostFailures);
+            break;
+        }
+
+        spend_credit(num_encoded);
+        duration = std::chrono::microseconds::zero();
+        num_posted += num_encoded;
+
+        if (num_encoded < chunk_count)
+            break;
+    }
+
+    instrument_count(SessionCounter::kPuts, num_posted);
+    instrument_count(SessionCounter::kBytesPosted, (num_posted * kDataSizeBytes));
+    return num_posted;
+}
+
+/**!
+ * @brief Encodes an object's data in to a Transference and starts posting it to a session, see Egress::PutAsync
+ *
+ * @tparam T Type of the object
+ * @tparam SessionT Outbound session type
+ * @param[in] session Session to post to
+ * @param[in] data Object to post
+ * @param[in] transference Transmission to start, over exactly the encoded size of `data` in writable bytes
+ * @retval BinaryResult::kSuccessCode if the transmission was started
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename T, typename SessionT>
+static BinaryResult egress_put_async(SessionT& session, T const& data, Transference& transference) noexcept
+{
+    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<T>};
+
+    Span<uint8_t> encoded_span {transference.GetWritableData()};
+    if (encoded_span.size() != kDataSizeBytes)
+        return BinaryResult::Failure();
+
+    size_t       bits_encoded {0U};
+    BinaryResult encode_result {data::encode(data, encoded_span, bits_encoded)};
+    if (encode_result.IsFailure())
+        return encode_result;
+
+    return (session.PostAsync(transference).IsSuccess() ? BinaryResult::Success() : BinaryResult::Failure());
+}
+
+/**!
+ * @brief Posts an object's data followed by trailing parts to a session as one transmission, see Egress::PutMultipart
+ *
+ * @tparam T Type of the object
+ * @tparam SessionT Outbound session type
+ * @tparam PartT Types of the trailing parts
+ * @param[in] session Session to post to
+ * @param[in] duration Maximum time that will be spent attempting to post data
+ * @param[in] data Object to post first
+ * @param[in] parts Trailing parts
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename T, typename SessionT, typename... PartT>
+static BinaryResult egress_put_multipart(SessionT& session, std::chrono::microseconds duration, T const& data,
+                                         PartT const&... parts) noexcept
+{
+    constexpr static size_t kNumParts {sizeof...(PartT) + 1U};
+
+    // Encode every part that isn't already a span of bytes, keeping them alive until posted
+    std::tuple<EgressPart<T>, EgressPart<PartT>...> const encoded_parts {data, parts...};
+    if (!egress_parts_encoded(encoded_parts, std::make_index_sequence<kNumParts> {}))
+        return BinaryResult::Failure();
+
+    std::array<Span<uint8_t const>, kNumParts> const part_spans {
+        egress_part_spans(encoded_parts, std::make_index_sequence<kNumParts> {})};
+
+    // Guard against overflowing the Outbound buffer
+    size_t size_bytes {0U};
+    for (Span<uint8_t const> const& part_span : part_spans)
+        size_bytes += part_span.size();
+
+    if (!egress_await_space(session, size_bytes, duration))
+        return BinaryResult::Failure();
+
+    // Gather every part in to one transmission
+    Span<Span<uint8_t const> const> gathered_span {part_spans.data(), kNumParts};
+    auto                post_result {session.Post(gathered_span, duration)};
+    return (post_result.IsSuccess() ? BinaryResult::Success() : BinaryResult::Failure());
+}
+
 } // namespace _detail
 } // namespace session
 } // namespace io
-} // namespace shmit
\ No newline at end of file
+} // namespace shmit
@@ -1,5 +1,17 @@
 #pragma once
 
+#include "Core/Data/Decode.hpp"
+#include "Core/Data/Footprint.hpp"
+#include "Core/IO/Session/Instrumentation.hpp"
+#include "Core/IO/Session/Transference.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <type_traits>
+
 namespace shmit
 {
 namespace io
@@ -9,11 +21,244 @@ namespace session
 namespace _detail
 {
 
+/// @brief Largest stack buffer that a block of objects is staged in when requesting, unless one object is larger
+constexpr static size_t kIngressStagingSizeBytes {256U};
+
 /// @brief Object for all specializations of Ingress to inherit from, providing a common identity
 class IngressBase
 {
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Namespace function definitions               ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Reads an object from a session, decoding it in place when the session lends out its storage. Shared by every
+ * Ingress variant so that the session calls bind to whatever type `SessionT` is.
+ *
+ * @tparam T Type of the object
+ * @tparam SessionT Inbound session type
+ * @param[in] session Session to read from
+ * @param[out] data Destination object
+ * @param[in] timeout Maximum time that will be spent waiting on the session
+ * @retval BinaryResult::kSuccessCode if successful
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename T, typename SessionT>
+static BinaryResult ingress_get(SessionT& session, T& data, std::chrono::microseconds timeout) noexcept
+{
+    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<T>};
+
+    // Guard against underflowing the Inbound buffer
+    if (session.InputBytesAvailable() < kDataSizeBytes)
+    {
+        instrument_count(SessionCounter::kInputRejections);
+        return BinaryResult::Failure();
+    }
+
+    InstrumentStopwatch stopwatch {};
+
+    // Decode in place when the session can lend out its storage
+    Span<uint8_t const> peeked_span {session.Peek(kDataSizeBytes)};
+    if (peeked_span.size() >= kDataSizeBytes)
+    {
+        size_t       bits_decoded {0U};
+        BinaryResult decode_result {data::decode(peeked_span, bits_decoded, data)};
+        if (decode_result.IsFailure() || session.Consume(kDataSizeBytes).IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return BinaryResult::Failure();
+        }
+
+        stopwatch.Record(SessionHistogram::kDecodeTime);
+        instrument_count(SessionCounter::kGets);
+        instrument_count(SessionCounter::kBytesRequested, kDataSizeBytes);
+        return BinaryResult::Success();
+    }
+
+    // Otherwise, objects that are laid out as they are encoded are requested straight in to their own storage
+    if constexpr (data::is_wire_identical_v<T>)
+    {
+        Span<uint8_t> data_span {reinterpret_cast<uint8_t*>(&data), kDataSizeBytes};
+        auto          request_result {session.Request(data_span, timeout)};
+        stopwatch.Record(SessionHistogram::kRequestWaitTime);
+        if (request_result.IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return BinaryResult::Failure();
+        }
+
+        instrument_count(SessionCounter::kGets);
+        instrument_count(SessionCounter::kBytesRequested, kDataSizeBytes);
+        return BinaryResult::Success();
+    }
+
+    // Otherwise, pack Transference with apropriately sized, empty buffer and pass to session for request
+    uint8_t       encoded_buffer[kDataSizeBytes];
+    Span<uint8_t> encoded_span {encoded_buffer, kDataSizeBytes};
+    static_cast<void>(std::memset(encoded_buffer, 0U, kDataSizeBytes)); // Avoid unused return warning
+
+    auto request_result {session.Request(encoded_span, timeout)};
+    stopwatch.Record(SessionHistogram::kRequestWaitTime);
+    if (request_result.IsFailure())
+    {
+        instrument_count(SessionCounter::kRequestFailures);
+        return BinaryResult::Failure();
+    }
+
+    // Transference has valid data to decode
+    // Perform decoding, return result
+    size_t       bits_decoded {0U};
+    BinaryResult decode_result {data::decode(encoded_buffer, bits_decoded, data)};
+    if (decode_result.IsFailure())
+    {
+        instrument_count(SessionCounter::kRequestFailures);
+        return BinaryResult::Failure();
+    }
+
+    stopwatch.Record(SessionHistogram::kDecodeTime);
+    instrument_count(SessionCounter::kGets);
+    instrument_count(SessionCounter::kBytesRequested, kDataSizeBytes);
+    return BinaryResult::Success();
+}
+
+/**!
+ * @brief Starts requesting an object's data in to a Transference from a session, see Ingress::GetAsync
+ *
+ * @tparam T Type of the object
+ * @tparam SessionT Inbound session type
+ * @param[in] session Session to request from
+ * @param[in] transference Transmission to start, over exactly the encoded size of a `T` in writable bytes
+ * @retval BinaryResult::kSuccessCode if the transmission was started
+ * @retval BinaryResult::kFailureCode otherwise
+ */
+template<typename T, typename SessionT>
+static BinaryResult ingress_get_async(SessionT& session, Transference& transference) noexcept
+{
+    if (transference.GetWritableData().size() != data::footprint_size_bytes_v<T>)
+        return BinaryResult::Failure();
+
+    return (session.RequestAsync(transference).IsSuccess() ? BinaryResult::Success() : BinaryResult::Failure());
+}
+
+/**!
+ * @brief Drains as many whole objects as are available from a session, see Ingress::GetMany
+ *
+ * @tparam T Type of the objects
+ * @tparam SessionT Inbound session type
+ * @param[in] session Session to read from
+ * @param[out] data Destination for the objects, filled from the front
+ * @param[in] timeout Maximum time that will be spent waiting on the session
+ * @return Number of objects read in to `data`
+ */
+template<typename T, typename SessionT>
+static size_t ingress_get_many(SessionT& session, Span<T> data, std::chrono::microseconds timeout) noexcept
+{
+    constexpr static size_t kDataSizeBytes {data::footprint_size_bytes_v<T>};
+
+    // Requested bytes can't be handed back, so objects are staged together only when none of them can fail to decode.
+    // Anything else is requested one object at a time, so that a failure costs no more than the failing object.
+    constexpr static bool   kIsDecodeInfallible {std::is_arithmetic_v<T> || std::is_enum_v<T>};
+    constexpr static size_t kStagingCount {(!kIsDecodeInfallible || (kIngressStagingSizeBytes < kDataSizeBytes))
+                                               ? 1U
+                                               : (kIngressStagingSizeBytes / kDataSizeBytes)};
+
+    // One availability check covers the whole block
+    size_t const count {std::min(data.count(), (session.InputBytesAvailable() / kDataSizeBytes))};
+    if (count == 0U)
+    {
+        instrument_count(SessionCounter::kInputRejections);
+        return 0U;
+    }
+
+    // Decode in place when the session can lend out its storage
+    Span<uint8_t const> peeked_span {session.Peek(count * kDataSizeBytes)};
+    if (peeked_span.size() >= (count * kDataSizeBytes))
+    {
+        size_t num_decoded {0U};
+        if constexpr (data::is_wire_identical_v<T>)
+        {
+            // Already laid out as encoded, the whole block is one copy
+            static_cast<void>(std::memcpy(reinterpret_cast<uint8_t*>(data.data()), peeked_span.data(),
+                                          (count * kDataSizeBytes)));
+            num_decoded = count;
+        }
+
+        for (; num_decoded < count; num_decoded++)
+        {
+            Span<uint8_t const> element_span {peeked_span.subspan((num_decoded * kDataSizeBytes), kDataSizeBytes)};
+            size_t              bits_decoded {0U};
+            if (data::decode(element_span, bits_decoded, data[num_decoded]).IsFailure())
+                break;
+        }
+
+        // Release everything decoded before any failure
+        if ((num_decoded > 0U) && session.Consume(num_decoded * kDataSizeBytes).IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return 0U;
+        }
+
+        instrument_count(SessionCounter::kGets, num_decoded);
+        instrument_count(SessionCounter::kBytesRequested, (num_decoded * kDataSizeBytes));
+        return num_decoded;
+    }
+
+    // Otherwise, objects that are laid out as they are encoded are requested straight in to their own storage
+    if constexpr (data::is_wire_identical_v<T>)
+    {
+        Span<uint8_t> block_span {reinterpret_cast<uint8_t*>(data.data()), (count * kDataSizeBytes)};
+        if (session.Request(block_span, timeout).IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            return 0U;
+        }
+
+        instrument_count(SessionCounter::kGets, count);
+        instrument_count(SessionCounter::kBytesRequested, (count * kDataSizeBytes));
+        return count;
+    }
+
+    // Otherwise, request the block through a buffer on the stack
+    uint8_t encoded_buffer[kStagingCount * kDataSizeBytes];
+
+    size_t num_read {0U};
+    bool   is_decoded {true};
+    while (is_decoded && (num_read < count))
+    {
+        size_t const  chunk_count {std::min(kStagingCount, (count - num_read))};
+        Span<uint8_t> encoded_span {encoded_buffer, (chunk_count * kDataSizeBytes)};
+
+        // Availability was checked up front, only the first request waits on the session
+        if (session.Request(encoded_span, timeout).IsFailure())
+        {
+            instrument_count(SessionCounter::kRequestFailures);
+            break;
+        }
+
+        timeout = std::chrono::microseconds::zero();
+
+        for (size_t i = 0U; i < chunk_count; i++)
+        {
+            Span<uint8_t const> element_span {(encoded_buffer + (i * kDataSizeBytes)), kDataSizeBytes};
+            size_t              bits_decoded {0U};
+            if (data::decode(element_span, bits_decoded, data[num_read]).IsFailure())
+            {
+                instrument_count(SessionCounter::kRequestFailures);
+                is_decoded = false;
+                break;
+            }
+
+            num_read++;
+        }
+    }
+
+    instrument_count(SessionCounter::kGets, num_read);
+    instrument_count(SessionCounter::kBytesRequested, (num_read * kDataSizeBytes));
+    return num_read;
+}
+
 } // namespace _detail
 } // namespace session
 } // namespace io
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Core/Help/RoutineLogic.hpp"
+#include "Core/IO/Session/Instrumentation.hpp"
+#include "Core/Platform/Clock.hpp"
+#include "Core/Time/Timer.hpp"
+
+#include <chrono>
+
+namespace shmit
+{
+namespace io
+{
+namespace session
+{
+namespace _detail
+{
+
+/**!
+ * @brief Time left until a deadline, never negative
+ *
+ * @param[in] deadline Deadline to count down to
+ * @return Time remaining, zero once the deadline has passed
+ */
+inline std::chrono::microseconds get_time_remaining(platform::Clock::time_point deadline) noexcept
+{
+    platform::Clock::time_point const kNow {platform::Clock::now()};
+    if (kNow >= deadline)
+        return std::chrono::microseconds::zero();
+
+    return std::chrono::duration_cast<std::chrono::microseconds>(deadline - kNow);
+}
+
+/**!
+ * @brief Wait until a condition holds or a timeout elapses, whichever comes first. Backs off from spinning, to
+ * yielding, to sleeping as help::BlockOnPassCondition does, so that a long wait does not hold on to the processor.
+ *
+ * @tparam PredicateT Callable returning bool
+ * @param[in] predicate Condition to wait on
+ * @param[in] timeout Maximum time to wait, zero checks the condition once
+ * @retval true if the condition held
+ * @retval false if the timeout elapsed first
+ */
+template<typename PredicateT>
+static bool spin_until(PredicateT predicate, std::chrono::microseconds timeout) noexcept
+{
+    if (predicate())
+        return true;
+
+    if (timeout <= std::chrono::microseconds::zero())
+        return false;
+
+    time::BasicTimer<platform::Clock> const kTimeout {timeout};
+    if (help::BlockOnPassCondition([&predicate]() -> bool { return predicate(); }, kTimeout))
+        return true;
+
+    instrument_count(SessionCounter::kWaitTimeouts);
+    return false;
+}
+
+} // namespace _detail
+} // namespace session
+} // namespace io
+} // namespace shmit
@@ -2,6 +2,17 @@
 
 #include "Ratio.hpp"
 
+#include <Core/Span.hpp>
+#include <Core/StdTypes.hpp>
+
+#include <algorithm>
+#include <limits>
+#include <type_traits>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
 namespace shmit
 {
 namespace math
@@ -16,7 +27,7 @@ namespace math
 template<typename Representation, class RatioFromBase>
 struct Denomination
 {
-    static_assert(std::is_arithmetic<Representation>, "Representation must be fundamental arithmetic type");
+    static_assert(std::is_arithmetic<Representation>::value, "Representation must be fundamental arithmetic type");
 
     using Rep      = Representation;
     using FromBase = typename to_static_ratio<RatioFromBase>::type;
@@ -26,22 +37,308 @@ struct Denomination
     static_assert(FromBase::den > 0, "RatioFromBase must be positive");
 };
 
+namespace _detail
+{
+
+/// @brief Magnitude of the most extreme value of an integer type
+template<typename T>
+constexpr static uintmax_t kMaxMagnitude {std::is_signed<T>::value
+                                              ? (static_cast<uintmax_t>(std::numeric_limits<T>::max()) + 1U)
+                                              : static_cast<uintmax_t>(std::numeric_limits<T>::max())};
+
+constexpr static bool is_power_of_two(uintmax_t value) noexcept
+{
+    return ((value != 0U) && ((value & (value - 1U)) == 0U));
+}
+
+constexpr static size_t log2_floor(uintmax_t value) noexcept
+{
+    size_t log {0U};
+    while (value > 1U)
+    {
+        value >>= 1U;
+        log++;
+    }
+
+    return log;
+}
+
+/**!
+ * @brief Fixed-point reciprocal of a divisor, such that `(dividend * multiplier) >> shift` equals `dividend / divisor`
+ * for every dividend up to a bound, without overflowing the multiply
+ *
+ */
+struct Reciprocal
+{
+    uintmax_t multiplier;
+    size_t    shift;
+    bool      is_valid;
+};
+
+/**!
+ * @brief Finds the reciprocal with the smallest multiplier. With `multiplier = ceil(2^shift / divisor)` and
+ * `error = (multiplier * divisor) - 2^shift`, the truncated product is exact whenever `error * max_dividend < 2^shift`.
+ *
+ * @param[in] divisor Divisor, nonzero
+ * @param[in] max_dividend Largest dividend that the reciprocal must be exact for
+ * @return Reciprocal, not valid if none fits within uintmax_t
+ */
+constexpr static Reciprocal find_reciprocal(uintmax_t divisor, uintmax_t max_dividend) noexcept
+{
+    for (size_t shift = 0U; shift < std::numeric_limits<uintmax_t>::digits; shift++)
+    {
+        uintmax_t const power {uintmax_t {1U} << shift};
+        uintmax_t const multiplier {(power / divisor) + (((power % divisor) != 0U) ? 1U : 0U)};
+        uintmax_t const error {(multiplier * divisor) - power}; // Exact under modular arithmetic, always below divisor
+
+        if ((multiplier == 0U) || (max_dividend > (std::numeric_limits<uintmax_t>::max() / multiplier)))
+            continue;
+
+        if ((error == 0U) || (max_dividend <= ((power - 1U) / error)))
+            return Reciprocal {multiplier, shift, true};
+    }
+
+    return Reciprocal {0U, 0U, false};
+}
+
+/**!
+ * @brief Scales an integer by `Numerator / Denominator` without floating point, truncating toward zero. The scale is
+ * folded at compile time in to an integer multiply, a shift, a fixed-point reciprocal multiply or, failing those, a
+ * division by a constant, all in an intermediate wide enough to never overflow before the result is narrowed.
+ *
+ * @tparam ResultRep Integer result type
+ * @tparam Rep Integer value type
+ * @tparam Numerator Numerator of the scale, positive
+ * @tparam Denominator Denominator of the scale, positive
+ * @param[in] value Value to scale
+ * @return Scaled value
+ */
+template<typename ResultRep, typename Rep, intmax_t Numerator, intmax_t Denominator>
+constexpr static ResultRep scale_integer(Rep value) noexcept
+{
+    using WideRep = std::conditional_t<std::is_signed<Rep>::value, intmax_t, uintmax_t>;
+
+    constexpr uintmax_t kNumerator {static_cast<uintmax_t>(Numerator)};
+    constexpr uintmax_t kDenominator {static_cast<uintmax_t>(Denominator)};
+
+    // Largest widened product magnitude, if it can be represented
+    constexpr bool kIsProductBounded {kMaxMagnitude<Rep> <= (std::numeric_limits<uintmax_t>::max() / kNumerator)};
+
+    if constexpr (kDenominator == 1U)
+    {
+        return static_cast<ResultRep>(static_cast<WideRep>(value) * static_cast<WideRep>(kNumerator));
+    }
+    else if constexpr (!kIsProductBounded)
+    {
+        // Split the value around the divisor so that neither product can overflow
+        WideRep const wide {static_cast<WideRep>(value)};
+        WideRep const quotient {wide / static_cast<WideRep>(kDenominator)};
+        WideRep const remainder {wide % static_cast<WideRep>(kDenominator)};
+        return static_cast<ResultRep>((quotient * static_cast<WideRep>(kNumerator))
+                                      + ((remainder * static_cast<WideRep>(kNumerator))
+                                         / static_cast<WideRep>(kDenominator)));
+    }
+    else
+    {
+        constexpr uintmax_t  kMaxProduct {kMaxMagnitude<Rep> * kNumerator};
+        constexpr Reciprocal kReciprocal {find_reciprocal(kDenominator, kMaxProduct)};
+
+        // Work on the magnitude, so that every path truncates toward zero as integer division does
+        bool const      is_negative {value < Rep {0}};
+        uintmax_t const magnitude {is_negative ? (uintmax_t {0U} - static_cast<uintmax_t>(value))
+                                               : static_cast<uintmax_t>(value)};
+        uintmax_t const product {magnitude * kNumerator};
+
+        uintmax_t quotient {0U};
+        if constexpr (is_power_of_two(kDenominator))
+            quotient = (product >> log2_floor(kDenominator));
+        else if constexpr (kReciprocal.is_valid)
+            quotient = ((product * kReciprocal.multiplier) >> kReciprocal.shift);
+        else
+            quotient = (product / kDenominator);
+
+        if (is_negative)
+            return static_cast<ResultRep>(-static_cast<WideRep>(quotient));
+
+        return static_cast<ResultRep>(quotient);
+    }
+}
+
+/**!
+ * @brief Scales a value by `Numerator / Denominator` in floating point, used when either type is floating
+ *
+ * @tparam ResultRep Result type
+ * @tparam Rep Value type
+ * @tparam Numerator Numerator of the scale
+ * @tparam Denominator Denominator of the scale
+ * @param[in] value Value to scale
+ * @return Scaled value
+ */
+template<typename ResultRep, typename Rep, intmax_t Numerator, intmax_t Denominator>
+constexpr static ResultRep scale_floating(Rep value) noexcept
+{
+    // Scale in the widest floating type involved
+    using FloatRep = std::conditional_t<
+        std::is_floating_point<Rep>::value,
+        std::conditional_t<std::is_floating_point<ResultRep>::value, std::common_type_t<Rep, ResultRep>, Rep>,
+        ResultRep>;
+
+    constexpr FloatRep kScale {static_cast<FloatRep>(Numerator) / static_cast<FloatRep>(Denominator)};
+    return static_cast<ResultRep>(static_cast<FloatRep>(value) * kScale);
+}
+
+/**!
+ * @brief Converts the leading elements of a block eight lanes at a time, for the scales and types that have an AVX2
+ * kernel. Every kernel gives exactly the same results as the scalar conversion.
+ *
+ * @tparam ResultRep Result type
+ * @tparam Rep Value type
+ * @tparam Numerator Numerator of the scale
+ * @tparam Denominator Denominator of the scale
+ * @param[in] values Values to convert
+ * @param[out] results Converted values, may be `values` itself
+ * @param[in] count Number of values
+ * @return Number of leading values converted, the rest are left to the scalar loop
+ */
+template<typename ResultRep, typename Rep, intmax_t Numerator, intmax_t Denominator>
+static size_t scale_block_simd(Rep const* values, ResultRep* results, size_t count) noexcept
+{
+    size_t i {0U};
+
+#if defined(__AVX2__)
+    constexpr size_t kLaneCount {8U};
+
+    if constexpr (std::is_same<Rep, float>::value && std::is_same<ResultRep, float>::value)
+    {
+        constexpr float kScale {static_cast<float>(Numerator) / static_cast<float>(Denominator)};
+
+        __m256 const scale {_mm256_set1_ps(kScale)};
+        for (; (i + kLaneCount) <= count; i += kLaneCount)
+            _mm256_storeu_ps((results + i), _mm256_mul_ps(_mm256_loadu_ps(values + i), scale));
+    }
+    else if constexpr (std::is_same<Rep, int32_t>::value && std::is_same<ResultRep, int32_t>::value
+                       && (Denominator == 1) && (Numerator <= std::numeric_limits<int32_t>::max()))
+    {
+        // The low 32 bits of the product are what narrowing the widened product keeps
+        __m256i const numerator {_mm256_set1_epi32(static_cast<int32_t>(Numerator))};
+        for (; (i + kLaneCount) <= count; i += kLaneCount)
+        {
+            __m256i const value {_mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i))};
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(results + i), _mm256_mullo_epi32(value, numerator));
+        }
+    }
+    else if constexpr (std::is_same<Rep, int32_t>::value && std::is_same<ResultRep, int32_t>::value
+                       && (Numerator == 1))
+    {
+        constexpr uintmax_t  kDenominator {static_cast<uintmax_t>(Denominator)};
+        constexpr Reciprocal kReciprocal {find_reciprocal(kDenominator, kMaxMagnitude<int32_t>)};
+
+        // Magnitudes are taken as unsigned, so the magnitude of INT32_MIN is exact, and the sign is put back after
+        if constexpr (is_power_of_two(kDenominator))
+        {
+            for (; (i + kLaneCount) <= count; i += kLaneCount)
+            {
+                __m256i const value {_mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i))};
+                __m256i const quotient {
+                    _mm256_srli_epi32(_mm256_abs_epi32(value), static_cast<int>(log2_floor(kDenominator)))};
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(results + i), _mm256_sign_epi32(quotient, value));
+            }
+        }
+        else if constexpr (kReciprocal.is_valid && (kReciprocal.multiplier <= std::numeric_limits<uint32_t>::max()))
+        {
+            // Even and odd lanes are multiplied out to 64 bits separately, then shifted and interleaved back
+            __m256i const multiplier {_mm256_set1_epi64x(static_cast<long long>(kReciprocal.multiplier))};
+            for (; (i + kLaneCount) <= count; i += kLaneCount)
+            {
+                __m256i const value {_mm256_loadu_si256(reinterpret_cast<__m256i const*>(values + i))};
+                __m256i const magnitude {_mm256_abs_epi32(value)};
+
+                __m256i const even {_mm256_srli_epi64(_mm256_mul_epu32(magnitude, multiplier),
+                                                      static_cast<int>(kReciprocal.shift))};
+                __m256i const odd {_mm256_srli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(magnitude, 32), multiplier),
+                                                     static_cast<int>(kReciprocal.shift))};
+
+                __m256i const quotient {_mm256_blend_epi32(even, _mm256_slli_epi64(odd, 32), 0xAA)};
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(results + i), _mm256_sign_epi32(quotient, value));
+            }
+        }
+    }
+#else
+    static_cast<void>(values);  // Avoid unused warning
+    static_cast<void>(results); // Avoid unused warning
+    static_cast<void>(count);   // Avoid unused warning
+#endif
+
+    return i;
+}
+
+} // namespace _detail
+
+/**!
+ * @brief Converts a value from one Denomination to another. The scale between the two is folded at compile time, and
+ * integer conversions never touch floating point: they compile down to an integer multiply, a shift, or a fixed-point
+ * reciprocal multiply, in a widened intermediate. Integer results truncate toward zero.
+ *
+ * @tparam DenominationOut Denomination to convert to
+ * @tparam DenominationIn Denomination to convert from
+ * @param[in] value Value in DenominationIn
+ * @return Value in DenominationOut
+ */
 template<class DenominationOut, class DenominationIn>
-inline constexpr typename DenominationOut::Rep denomination_cast(typename DenominationIn::Rep const& value)
+inline constexpr typename DenominationOut::Rep denomination_cast(typename DenominationIn::Rep const& value) noexcept
 {
     using ResultRep = typename DenominationOut::Rep;
+    using ValueRep  = typename DenominationIn::Rep;
     using Ratio1    = typename DenominationIn::ToBase;
     using Ratio2    = typename DenominationOut::ToBase;
 
     // Divide the first ratio by the second to determine how the value must be scaled
-    using Scale = typename math::divide<Ratio1, Ratio2>;
-    constexpr math::Ratio scale {Scale::value};
+    using Scale = math::divide_t<Ratio1, Ratio2>;
+
+    if constexpr (std::is_floating_point<ResultRep>::value || std::is_floating_point<ValueRep>::value)
+        return _detail::scale_floating<ResultRep, ValueRep, Scale::num, Scale::den>(value);
+    else
+        return _detail::scale_integer<ResultRep, ValueRep, Scale::num, Scale::den>(value);
+}
+
+/**!
+ * @brief Converts a block of values from one Denomination to another, with the same results as converting them one at
+ * a time. On native builds with AVX2, float and int32 blocks run eight lanes at a time for the scales that allow it,
+ * and everything else runs through a loop unrolled by four.
+ *
+ * @note Converts in place when `values` and `results` are the same memory, otherwise they must not overlap
+ *
+ * @tparam DenominationOut Denomination to convert to
+ * @tparam DenominationIn Denomination to convert from
+ * @param[in] values Values in DenominationIn
+ * @param[out] results Values in DenominationOut
+ * @return Number of values converted, the smaller of the two counts
+ */
+template<class DenominationOut, class DenominationIn>
+inline size_t denomination_cast(Span<typename DenominationIn::Rep const> values,
+                                Span<typename DenominationOut::Rep>      results) noexcept
+{
+    using ResultRep = typename DenominationOut::Rep;
+    using ValueRep  = typename DenominationIn::Rep;
+    using Scale     = math::divide_t<typename DenominationIn::ToBase, typename DenominationOut::ToBase>;
+
+    size_t const     count {std::min(values.count(), results.count())};
+    ValueRep const*  in {values.data()};
+    ResultRep* const out {results.data()};
+
+    size_t i {_detail::scale_block_simd<ResultRep, ValueRep, Scale::num, Scale::den>(in, out, count)};
+    for (; (i + 4U) <= count; i += 4U)
+    {
+        out[i]      = denomination_cast<DenominationOut, DenominationIn>(in[i]);
+        out[i + 1U] = denomination_cast<DenominationOut, DenominationIn>(in[i + 1U]);
+        out[i + 2U] = denomination_cast<DenominationOut, DenominationIn>(in[i + 2U]);
+        out[i + 3U] = denomination_cast<DenominationOut, DenominationIn>(in[i + 3U]);
+    }
 
-    // Cast quantifying value to the output Denomination's representation then perform value transformation
-    ResultRep result {static_cast<ResultRep>(value)};
-    result *= scale;
+    for (; i < count; i++)
+        out[i] = denomination_cast<DenominationOut, DenominationIn>(in[i]);
 
-    return result;
+    return count;
 }
 
 /**!
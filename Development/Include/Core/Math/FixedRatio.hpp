@@ -0,0 +1,390 @@
+#pragma once
+
+#include "Denomination.hpp"
+#include "Ratio.hpp"
+
+#include <Core/StdTypes.hpp>
+
+#include <limits>
+#include <type_traits>
+
+namespace shmit
+{
+namespace math
+{
+
+namespace _detail
+{
+
+/// @brief Integer wide enough to hold the product of two values of a fixed-point representation
+template<typename Rep>
+struct fixed_wide
+{
+    static_assert(sizeof(Rep) <= sizeof(int32_t), "Fixed-point representations wider than 32 bits need a 128-bit "
+                                                  "integer");
+
+    using type = int64_t;
+};
+
+#if defined(__SIZEOF_INT128__)
+template<>
+struct fixed_wide<int64_t>
+{
+    using type = __int128;
+};
+#endif
+
+template<typename Rep>
+using fixed_wide_t = typename fixed_wide<Rep>::type;
+
+} // namespace _detail
+
+/**!
+ * @brief Signed binary fixed-point number, in Q-format with FractionBitsV fractional bits. Its value is
+ * `raw / 2^FractionBitsV`.
+ *
+ * Adds and subtracts are one integer operation, multiplies are one widened multiply and a shift, and nothing is ever
+ * simplified, so every operation takes constant time. FixedRatio converts to and from Ratio for exact work, see
+ * Normalize, and a Denomination scale is folded in to one with denomination_scale.
+ *
+ * @note Adds and subtracts wrap on overflow. Multiplies and conversions round to nearest, with ties rounded up.
+ * Divides truncate toward zero.
+ *
+ * @tparam FractionBitsV Number of fractional bits
+ * @tparam RepT Signed integer representation
+ */
+template<size_t FractionBitsV, typename RepT = int32_t>
+class FixedRatio
+{
+    static_assert(std::is_integral<RepT>::value && std::is_signed<RepT>::value, "RepT must be a signed integer");
+    static_assert(FractionBitsV < (std::numeric_limits<RepT>::digits), "FractionBitsV must leave room for the sign and "
+                                                                       "at least one integer bit");
+
+public:
+    using Rep     = RepT;
+    using WideRep = _detail::fixed_wide_t<RepT>;
+
+    /// @brief Number of fractional bits
+    constexpr static size_t kFractionBits {FractionBitsV};
+
+    /// @brief Raw representation of 1
+    constexpr static Rep kOne {static_cast<Rep>(Rep {1} << FractionBitsV)};
+
+    /// @brief Smallest step between two values, as a Ratio
+    constexpr static intmax_t kDenominator {intmax_t {1} << FractionBitsV};
+
+    constexpr FixedRatio() noexcept = default;
+
+    /**!
+     * @brief Fixed-point value from its raw representation
+     *
+     * @param[in] raw Raw representation, the value times 2^kFractionBits
+     */
+    constexpr static FixedRatio FromRaw(Rep raw) noexcept;
+
+    /**!
+     * @brief Fixed-point value of a whole number
+     *
+     * @param[in] whole Whole number
+     */
+    constexpr static FixedRatio FromInteger(Rep whole) noexcept;
+
+    /**!
+     * @brief Nearest fixed-point value to a Ratio
+     *
+     * @param[in] ratio Ratio to convert
+     */
+    constexpr static FixedRatio FromRatio(Ratio const& ratio) noexcept;
+
+    /**!
+     * @brief Nearest fixed-point value to a compile-time ratio
+     *
+     * @tparam StaticRatioT Meets the "Compile-Time Ratio" named requirements
+     */
+    template<class StaticRatioT>
+    constexpr static FixedRatio FromStaticRatio() noexcept;
+
+    /// @brief Raw representation, the value times 2^kFractionBits
+    constexpr Rep GetRaw() const noexcept;
+
+    /**!
+     * @brief Exact value as a simplified Ratio, for when exactness is needed again
+     *
+     * @return Ratio in lowest terms
+     */
+    constexpr Ratio Normalize() const noexcept;
+
+    /**!
+     * @brief Multiplies an integer by the value, rounding to nearest
+     *
+     * @tparam IntT Integer type, at most as wide as Rep
+     * @param[in] value Integer to scale
+     * @return Scaled integer
+     */
+    template<typename IntT>
+    constexpr IntT Scale(IntT value) const noexcept;
+
+    /**!
+     * @brief Exact value as a Ratio over 2^kFractionBits, without simplifying
+     *
+     * @return Unsimplified Ratio
+     */
+    constexpr Ratio ToRatio() const noexcept;
+
+    explicit constexpr operator double() const noexcept;
+
+    constexpr bool operator==(FixedRatio const& rhs) const noexcept;
+    constexpr bool operator!=(FixedRatio const& rhs) const noexcept;
+    constexpr bool operator<(FixedRatio const& rhs) const noexcept;
+    constexpr bool operator<=(FixedRatio const& rhs) const noexcept;
+    constexpr bool operator>(FixedRatio const& rhs) const noexcept;
+    constexpr bool operator>=(FixedRatio const& rhs) const noexcept;
+
+    constexpr FixedRatio operator+() const noexcept;
+    constexpr FixedRatio operator-() const noexcept;
+
+    constexpr FixedRatio operator+(FixedRatio const& rhs) const noexcept;
+    constexpr FixedRatio operator-(FixedRatio const& rhs) const noexcept;
+    constexpr FixedRatio operator*(FixedRatio const& rhs) const noexcept;
+    constexpr FixedRatio operator/(FixedRatio const& rhs) const noexcept;
+
+    constexpr FixedRatio& operator+=(FixedRatio const& rhs) noexcept;
+    constexpr FixedRatio& operator-=(FixedRatio const& rhs) noexcept;
+    constexpr FixedRatio& operator*=(FixedRatio const& rhs) noexcept;
+    constexpr FixedRatio& operator/=(FixedRatio const& rhs) noexcept;
+
+private:
+    using UnsignedRep = std::make_unsigned_t<Rep>;
+
+    /// @brief Half of the smallest step, added before shifting out fractional bits to round to nearest
+    constexpr static WideRep kHalf {(FractionBitsV > 0U) ? (WideRep {1} << (FractionBitsV - 1U)) : WideRep {0}};
+
+    /// @brief Rounds a widened value with 2 * kFractionBits fractional bits back down to kFractionBits
+    constexpr static Rep RoundProduct(WideRep product) noexcept;
+
+    Rep m_raw {0};
+};
+
+/**!
+ * @brief Scale between two Denominations as a fixed-point value, folded at compile time. Multiplying a value by it
+ * converts the value from DenominationIn to DenominationOut, see FixedRatio::Scale.
+ *
+ * @tparam FixedT FixedRatio specialization
+ * @tparam DenominationOut Denomination to convert to
+ * @tparam DenominationIn Denomination to convert from
+ */
+template<class FixedT, class DenominationOut, class DenominationIn>
+constexpr static FixedT denomination_scale() noexcept
+{
+    return FixedT::template FromStaticRatio<
+        divide_t<typename DenominationIn::ToBase, typename DenominationOut::ToBase>>();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  FixedRatio method definitions in alphabetical order         ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::FromInteger(Rep whole) noexcept
+{
+    return FromRaw(static_cast<Rep>(static_cast<UnsignedRep>(whole) << FractionBitsV));
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::FromRatio(Ratio const& ratio) noexcept
+{
+    // Split off the whole part first, so that only the remainder has to be shifted
+    intmax_t const numerator {(ratio.denominator < 0) ? -ratio.numerator : ratio.numerator};
+    intmax_t const denominator {(ratio.denominator < 0) ? -ratio.denominator : ratio.denominator};
+
+    intmax_t const whole {numerator / denominator};
+    intmax_t const remainder {numerator % denominator};
+
+    intmax_t const shifted {remainder * kDenominator};
+    intmax_t const fraction {(shifted + ((shifted < 0) ? -(denominator / 2) : (denominator / 2))) / denominator};
+
+    UnsignedRep const raw {static_cast<UnsignedRep>(static_cast<UnsignedRep>(whole * kDenominator) +
+                                                    static_cast<UnsignedRep>(fraction))};
+    return FromRaw(static_cast<Rep>(raw));
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::FromRaw(Rep raw) noexcept
+{
+    FixedRatio value {};
+    value.m_raw = raw;
+    return value;
+}
+
+template<size_t FractionBitsV, typename RepT>
+template<class StaticRatioT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::FromStaticRatio() noexcept
+{
+    constexpr Ratio            kRatio {to_static_ratio_t<StaticRatioT>::value};
+    constexpr FixedRatio const kValue {FromRatio(kRatio)};
+    return kValue;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr RepT FixedRatio<FractionBitsV, RepT>::GetRaw() const noexcept
+{
+    return m_raw;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr Ratio FixedRatio<FractionBitsV, RepT>::Normalize() const noexcept
+{
+    return Ratio::Simplify(ToRatio());
+}
+
+template<size_t FractionBitsV, typename RepT>
+template<typename IntT>
+constexpr IntT FixedRatio<FractionBitsV, RepT>::Scale(IntT value) const noexcept
+{
+    static_assert(std::is_integral<IntT>::value && (sizeof(IntT) <= sizeof(Rep)), "IntT must be an integer no wider "
+                                                                                   "than Rep");
+
+    WideRep const product {static_cast<WideRep>(value) * static_cast<WideRep>(m_raw)};
+    return static_cast<IntT>((product + kHalf) >> FractionBitsV);
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr Ratio FixedRatio<FractionBitsV, RepT>::ToRatio() const noexcept
+{
+    Ratio ratio {};
+    ratio.numerator   = m_raw;
+    ratio.denominator = kDenominator;
+    return ratio;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT>::operator double() const noexcept
+{
+    return (static_cast<double>(m_raw) / static_cast<double>(kDenominator));
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr bool FixedRatio<FractionBitsV, RepT>::operator==(FixedRatio const& rhs) const noexcept
+{
+    return (m_raw == rhs.m_raw);
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr bool FixedRatio<FractionBitsV, RepT>::operator!=(FixedRatio const& rhs) const noexcept
+{
+    return (m_raw != rhs.m_raw);
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr bool FixedRatio<FractionBitsV, RepT>::operator<(FixedRatio const& rhs) const noexcept
+{
+    return (m_raw < rhs.m_raw);
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr bool FixedRatio<FractionBitsV, RepT>::operator<=(FixedRatio const& rhs) const noexcept
+{
+    return (m_raw <= rhs.m_raw);
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr bool FixedRatio<FractionBitsV, RepT>::operator>(FixedRatio const& rhs) const noexcept
+{
+    return (m_raw > rhs.m_raw);
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr bool FixedRatio<FractionBitsV, RepT>::operator>=(FixedRatio const& rhs) const noexcept
+{
+    return (m_raw >= rhs.m_raw);
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::operator+() const noexcept
+{
+    return *this;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::operator-() const noexcept
+{
+    return FromRaw(static_cast<Rep>(UnsignedRep {0} - static_cast<UnsignedRep>(m_raw)));
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::operator+(
+    FixedRatio const& rhs) const noexcept
+{
+    FixedRatio tmp {*this};
+    tmp += rhs;
+    return tmp;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::operator-(
+    FixedRatio const& rhs) const noexcept
+{
+    FixedRatio tmp {*this};
+    tmp -= rhs;
+    return tmp;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::operator*(
+    FixedRatio const& rhs) const noexcept
+{
+    FixedRatio tmp {*this};
+    tmp *= rhs;
+    return tmp;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT> FixedRatio<FractionBitsV, RepT>::operator/(
+    FixedRatio const& rhs) const noexcept
+{
+    FixedRatio tmp {*this};
+    tmp /= rhs;
+    return tmp;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT>& FixedRatio<FractionBitsV, RepT>::operator+=(FixedRatio const& rhs) noexcept
+{
+    m_raw = static_cast<Rep>(static_cast<UnsignedRep>(m_raw) + static_cast<UnsignedRep>(rhs.m_raw));
+    return *this;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT>& FixedRatio<FractionBitsV, RepT>::operator-=(FixedRatio const& rhs) noexcept
+{
+    m_raw = static_cast<Rep>(static_cast<UnsignedRep>(m_raw) - static_cast<UnsignedRep>(rhs.m_raw));
+    return *this;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT>& FixedRatio<FractionBitsV, RepT>::operator*=(FixedRatio const& rhs) noexcept
+{
+    m_raw = RoundProduct(static_cast<WideRep>(m_raw) * static_cast<WideRep>(rhs.m_raw));
+    return *this;
+}
+
+template<size_t FractionBitsV, typename RepT>
+constexpr FixedRatio<FractionBitsV, RepT>& FixedRatio<FractionBitsV, RepT>::operator/=(FixedRatio const& rhs) noexcept
+{
+    WideRep const dividend {static_cast<WideRep>(m_raw) * static_cast<WideRep>(kOne)};
+    m_raw = static_cast<Rep>(dividend / static_cast<WideRep>(rhs.m_raw));
+    return *this;
+}
+
+//  Private     ========================================================================================================
+
+template<size_t FractionBitsV, typename RepT>
+constexpr RepT FixedRatio<FractionBitsV, RepT>::RoundProduct(WideRep product) noexcept // Static method
+{
+    return static_cast<Rep>((product + kHalf) >> FractionBitsV);
+}
+
+} // namespace math
+} // namespace shmit
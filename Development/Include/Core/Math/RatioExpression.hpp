@@ -0,0 +1,312 @@
+#pragma once
+
+#include "Ratio.hpp"
+
+#include <Core/StdTypes.hpp>
+
+#include <type_traits>
+
+namespace shmit
+{
+namespace math
+{
+
+namespace _detail
+{
+
+#if defined(__SIZEOF_INT128__)
+using ratio_wide_t = __int128;
+#else
+using ratio_wide_t = intmax_t;
+#endif
+
+/// @brief Unsimplified intermediate result of a Ratio expression, in widened integers
+struct WideRatio
+{
+    ratio_wide_t numerator {1};
+    ratio_wide_t denominator {1};
+};
+
+constexpr static ratio_wide_t wide_abs(ratio_wide_t value) noexcept
+{
+    return (value < 0) ? -value : value;
+}
+
+constexpr static ratio_wide_t wide_gcd(ratio_wide_t a, ratio_wide_t b) noexcept
+{
+    a = wide_abs(a);
+    b = wide_abs(b);
+    while (b != 0)
+    {
+        ratio_wide_t const remainder {a % b};
+        a = b;
+        b = remainder;
+    }
+    return a;
+}
+
+/// @brief Sum of two intermediate results, cross-multiplying only if their denominators differ
+struct RatioSum
+{
+    constexpr static WideRatio Apply(WideRatio const& lhs, WideRatio const& rhs) noexcept
+    {
+        if (lhs.denominator == rhs.denominator)
+            return WideRatio {lhs.numerator + rhs.numerator, lhs.denominator};
+
+        return WideRatio {(lhs.numerator * rhs.denominator) + (rhs.numerator * lhs.denominator),
+                          lhs.denominator * rhs.denominator};
+    }
+};
+
+/// @brief Difference of two intermediate results, cross-multiplying only if their denominators differ
+struct RatioDifference
+{
+    constexpr static WideRatio Apply(WideRatio const& lhs, WideRatio const& rhs) noexcept
+    {
+        if (lhs.denominator == rhs.denominator)
+            return WideRatio {lhs.numerator - rhs.numerator, lhs.denominator};
+
+        return WideRatio {(lhs.numerator * rhs.denominator) - (rhs.numerator * lhs.denominator),
+                          lhs.denominator * rhs.denominator};
+    }
+};
+
+/// @brief Product of two intermediate results
+struct RatioProduct
+{
+    constexpr static WideRatio Apply(WideRatio const& lhs, WideRatio const& rhs) noexcept
+    {
+        return WideRatio {lhs.numerator * rhs.numerator, lhs.denominator * rhs.denominator};
+    }
+};
+
+/// @brief Quotient of two intermediate results, the sign is left for evaluation to sort out
+struct RatioQuotient
+{
+    constexpr static WideRatio Apply(WideRatio const& lhs, WideRatio const& rhs) noexcept
+    {
+        return WideRatio {lhs.numerator * rhs.denominator, lhs.denominator * rhs.numerator};
+    }
+};
+
+/// @brief Simplifies an intermediate result once and narrows it back to a Ratio
+constexpr static Ratio narrow_ratio(WideRatio wide) noexcept
+{
+    if (wide.denominator < 0)
+    {
+        wide.numerator   = -wide.numerator;
+        wide.denominator = -wide.denominator;
+    }
+
+    ratio_wide_t const divisor {wide_gcd(wide.numerator, wide.denominator)};
+    if (divisor > 1)
+    {
+        wide.numerator /= divisor;
+        wide.denominator /= divisor;
+    }
+
+    Ratio ratio {};
+    ratio.numerator   = static_cast<intmax_t>(wide.numerator);
+    ratio.denominator = static_cast<intmax_t>(wide.denominator);
+    return ratio;
+}
+
+} // namespace _detail
+
+/**!
+ * @brief Leaf of a lazily evaluated Ratio expression, see lazy
+ */
+class RatioTerm
+{
+public:
+    /**!
+     * @brief Wraps a Ratio as an expression term
+     *
+     * @param[in] ratio Ratio to hold, copied
+     */
+    explicit constexpr RatioTerm(Ratio const& ratio) noexcept : m_ratio {ratio}
+    {
+    }
+
+    /// @brief Intermediate value of the term, in widened integers
+    constexpr _detail::WideRatio EvaluateWide() const noexcept
+    {
+        return _detail::WideRatio {m_ratio.numerator, m_ratio.denominator};
+    }
+
+    /// @brief Value of the term, simplified
+    constexpr Ratio Evaluate() const noexcept
+    {
+        return _detail::narrow_ratio(EvaluateWide());
+    }
+
+    constexpr operator Ratio() const noexcept
+    {
+        return Evaluate();
+    }
+
+private:
+    Ratio m_ratio;
+};
+
+/**!
+ * @brief Node of a lazily evaluated Ratio expression. Operators on expressions build up a tree of nodes instead of a
+ * Ratio; the whole tree is combined in widened integers and simplified once, when it is evaluated or assigned to a
+ * Ratio.
+ *
+ * @note Intermediate products must fit in 128 bits, or in intmax_t where 128-bit integers are not available. The
+ * simplified result must fit in a Ratio.
+ *
+ * @tparam OperationT Combines the intermediate values of both operands
+ * @tparam LhsT Left operand, a RatioTerm or RatioExpression
+ * @tparam RhsT Right operand, a RatioTerm or RatioExpression
+ */
+template<class OperationT, class LhsT, class RhsT>
+class RatioExpression
+{
+public:
+    constexpr RatioExpression(LhsT const& lhs, RhsT const& rhs) noexcept : m_lhs {lhs}, m_rhs {rhs}
+    {
+    }
+
+    /// @brief Intermediate value of the expression, in widened integers and unsimplified
+    constexpr _detail::WideRatio EvaluateWide() const noexcept
+    {
+        return OperationT::Apply(m_lhs.EvaluateWide(), m_rhs.EvaluateWide());
+    }
+
+    /// @brief Value of the expression, simplified once
+    constexpr Ratio Evaluate() const noexcept
+    {
+        return _detail::narrow_ratio(EvaluateWide());
+    }
+
+    constexpr operator Ratio() const noexcept
+    {
+        return Evaluate();
+    }
+
+private:
+    LhsT m_lhs;
+    RhsT m_rhs;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Metafunction definitions            ////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Default (failed) check for if a type is a lazily evaluated Ratio expression
+ *
+ * @tparam T Any type
+ */
+template<class T>
+struct is_ratio_expression : public std::false_type
+{
+};
+
+/**!
+ * @brief Successful check for if a type is a RatioTerm
+ */
+template<>
+struct is_ratio_expression<RatioTerm> : public std::true_type
+{
+};
+
+/**!
+ * @brief Successful check for if a type is a RatioExpression
+ *
+ * @tparam shmit::math::RatioExpression<OperationT,LhsT,RhsT>
+ */
+template<class OperationT, class LhsT, class RhsT>
+struct is_ratio_expression<RatioExpression<OperationT, LhsT, RhsT>> : public std::true_type
+{
+};
+
+/**!
+ * @brief Accesses the returned value from is_ratio_expression
+ *
+ * @tparam T Any type
+ */
+template<class T>
+constexpr static bool is_ratio_expression_v = is_ratio_expression<T>::value;
+
+namespace _detail
+{
+
+/// @brief Expression type that an operand is held as, Ratios become RatioTerms
+template<class T>
+using ratio_operand_t = std::conditional_t<std::is_same<T, Ratio>::value, RatioTerm, T>;
+
+/// @brief True if a type may be an operand of an expression, an expression itself or a Ratio
+template<class T>
+constexpr static bool is_ratio_operand_v = (is_ratio_expression_v<T> || std::is_same<T, Ratio>::value);
+
+/// @brief Enables an expression operator if one operand is an expression and the other is an expression or Ratio
+template<class LhsT, class RhsT>
+using enable_ratio_expression_t = std::enable_if_t<is_ratio_operand_v<LhsT> && is_ratio_operand_v<RhsT> &&
+                                                   (is_ratio_expression_v<LhsT> || is_ratio_expression_v<RhsT>)>;
+
+template<class OperationT, class LhsT, class RhsT>
+using ratio_expression_t = RatioExpression<OperationT, ratio_operand_t<LhsT>, ratio_operand_t<RhsT>>;
+
+template<class T>
+constexpr static ratio_operand_t<T> to_ratio_operand(T const& operand) noexcept
+{
+    return ratio_operand_t<T> {operand};
+}
+
+} // namespace _detail
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Namespace function definitions in alphabetical order        ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/**!
+ * @brief Starts a lazily evaluated expression. Arithmetic on the result, with Ratios or other expressions, builds an
+ * expression tree that is simplified only once:
+ *
+ * `Ratio const coefficient = lazy(a) * b + c / d;`
+ *
+ * @param[in] ratio First term of the expression
+ * @return RatioTerm holding `ratio`
+ */
+constexpr static RatioTerm lazy(Ratio const& ratio) noexcept
+{
+    return RatioTerm {ratio};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  External operator overload definitions          ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<class LhsT, class RhsT, typename = _detail::enable_ratio_expression_t<LhsT, RhsT>>
+constexpr _detail::ratio_expression_t<_detail::RatioSum, LhsT, RhsT> operator+(LhsT const& lhs,
+                                                                                RhsT const& rhs) noexcept
+{
+    return {_detail::to_ratio_operand(lhs), _detail::to_ratio_operand(rhs)};
+}
+
+template<class LhsT, class RhsT, typename = _detail::enable_ratio_expression_t<LhsT, RhsT>>
+constexpr _detail::ratio_expression_t<_detail::RatioDifference, LhsT, RhsT> operator-(LhsT const& lhs,
+                                                                                       RhsT const& rhs) noexcept
+{
+    return {_detail::to_ratio_operand(lhs), _detail::to_ratio_operand(rhs)};
+}
+
+template<class LhsT, class RhsT, typename = _detail::enable_ratio_expression_t<LhsT, RhsT>>
+constexpr _detail::ratio_expression_t<_detail::RatioProduct, LhsT, RhsT> operator*(LhsT const& lhs,
+                                                                                    RhsT const& rhs) noexcept
+{
+    return {_detail::to_ratio_operand(lhs), _detail::to_ratio_operand(rhs)};
+}
+
+template<class LhsT, class RhsT, typename = _detail::enable_ratio_expression_t<LhsT, RhsT>>
+constexpr _detail::ratio_expression_t<_detail::RatioQuotient, LhsT, RhsT> operator/(LhsT const& lhs,
+                                                                                     RhsT const& rhs) noexcept
+{
+    return {_detail::to_ratio_operand(lhs), _detail::to_ratio_operand(rhs)};
+}
+
+} // namespace math
+} // namespace shmit
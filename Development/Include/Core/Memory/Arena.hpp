@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+namespace shmit
+{
+namespace memory
+{
+
+/**!
+ * @brief Monotonic allocator over a block of static storage. Allocations bump an offset and are never freed one by one;
+ * the whole arena is released at once through Reset. Lock-free, any number of threads may allocate at the same time.
+ *
+ * An Arena suits storage that is carved up once at startup, such as the buffers of sessions and rings, so that memory
+ * use is fixed at compile time and no heap is involved.
+ *
+ * @tparam CapacityBytesV Size of the storage in bytes
+ * @tparam AlignmentV Alignment of the storage, and the default alignment of allocations
+ */
+template<size_t CapacityBytesV, size_t AlignmentV = alignof(std::max_align_t)>
+class Arena
+{
+    static_assert(CapacityBytesV > 0U, "`CapacityBytesV` must be nonzero");
+    static_assert((AlignmentV > 0U) && ((AlignmentV & (AlignmentV - 1U)) == 0U), "`AlignmentV` must be a power of two");
+
+public:
+    /// @brief Size of the storage in bytes
+    constexpr static size_t kCapacityBytes {CapacityBytesV};
+
+    /// @brief Alignment of the storage, and the default alignment of allocations
+    constexpr static size_t kAlignment {AlignmentV};
+
+    Arena() noexcept = default;
+
+    // Arena lends out its own storage and may not be copied or moved
+
+    Arena(Arena const& copy) = delete;
+    Arena(Arena&& move)      = delete;
+
+    Arena& operator=(Arena const& copy) = delete;
+    Arena& operator=(Arena&& move)      = delete;
+
+    /**!
+     * @brief Allocate space from the arena. Never blocks.
+     *
+     * @param[in] size_bytes Size of the space in bytes
+     * @param[in] alignment Alignment of the space, must be a power of two no larger than kAlignment
+     * @return Span over the space, empty if not enough is left
+     */
+    Span<uint8_t> Allocate(size_t size_bytes, size_t alignment = kAlignment) noexcept;
+
+    /// @brief Number of bytes left to allocate, alignment padding aside
+    size_t BytesAvailable() const noexcept;
+
+    /// @brief Number of bytes allocated so far, including alignment padding
+    size_t BytesUsed() const noexcept;
+
+    /**!
+     * @brief Release every allocation at once
+     *
+     * @note Nothing allocated from the arena may be in use, and no other thread may be allocating
+     */
+    void Reset() noexcept;
+
+private:
+    alignas(AlignmentV) uint8_t m_storage[CapacityBytesV];
+
+    std::atomic<size_t> m_offset {0U};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Arena method definitions in alphabetical order          ////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t CapacityBytesV, size_t AlignmentV>
+Span<uint8_t> Arena<CapacityBytesV, AlignmentV>::Allocate(size_t size_bytes, size_t alignment) noexcept
+{
+    bool const kAlignmentIsValid {(alignment > 0U) && ((alignment & (alignment - 1U)) == 0U) &&
+                                  (alignment <= kAlignment)};
+    if (!kAlignmentIsValid)
+        return Span<uint8_t> {nullptr, size_t {0U}};
+
+    // The storage itself is aligned to kAlignment, so aligning the offset aligns the address
+    size_t offset {m_offset.load(std::memory_order_relaxed)};
+    size_t start {0U};
+    do
+    {
+        start = (offset + (alignment - 1U)) & ~(alignment - 1U);
+        if ((start > kCapacityBytes) || (size_bytes > (kCapacityBytes - start)))
+            return Span<uint8_t> {nullptr, size_t {0U}};
+    }
+    while (!m_offset.compare_exchange_weak(offset, (start + size_bytes), std::memory_order_relaxed));
+
+    return Span<uint8_t> {(m_storage + start), size_bytes};
+}
+
+template<size_t CapacityBytesV, size_t AlignmentV>
+size_t Arena<CapacityBytesV, AlignmentV>::BytesAvailable() const noexcept
+{
+    return (kCapacityBytes - m_offset.load(std::memory_order_relaxed));
+}
+
+template<size_t CapacityBytesV, size_t AlignmentV>
+size_t Arena<CapacityBytesV, AlignmentV>::BytesUsed() const noexcept
+{
+    return m_offset.load(std::memory_order_relaxed);
+}
+
+template<size_t CapacityBytesV, size_t AlignmentV>
+void Arena<CapacityBytesV, AlignmentV>::Reset() noexcept
+{
+    m_offset.store(0U, std::memory_order_relaxed);
+}
+
+} // namespace memory
+} // namespace shmit
@@ -0,0 +1,328 @@
+#pragma once
+
+#include "Core/Data/Footprint.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+namespace shmit
+{
+namespace memory
+{
+
+/**!
+ * @brief Fixed-size block allocator over static storage. Allocate and Free are O(1) and lock-free, any number of
+ * threads may allocate and free at the same time.
+ *
+ * Free blocks form a stack whose head is tagged with a counter, so that a block freed and allocated again while
+ * another thread is mid-allocation can't corrupt the stack. Links are kept apart from the blocks, so freed blocks are
+ * never written to by the pool. The tag and index share one 32-bit word, so that the head is exchanged with a single
+ * word-sized compare-and-swap on targets without a 64-bit one, such as Cortex-M.
+ *
+ * @note The 16-bit tag wraps after 65536 exchanges, a thread would have to stall across that many for a stale
+ * exchange to succeed
+ *
+ * @note Freeing a block twice, or freeing one that wasn't allocated from the pool, is not detected
+ *
+ * @tparam BlockSizeBytesV Size of each block in bytes, rounded up to a multiple of AlignmentV
+ * @tparam BlockCountV Number of blocks
+ * @tparam AlignmentV Alignment of each block
+ */
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV = alignof(std::max_align_t)>
+class Pool
+{
+    static_assert(BlockSizeBytesV > 0U, "`BlockSizeBytesV` must be nonzero");
+    static_assert((BlockCountV > 0U) && (BlockCountV < UINT16_MAX), "`BlockCountV` must be nonzero and fit in 16 "
+                                                                    "bits");
+    static_assert((AlignmentV > 0U) && ((AlignmentV & (AlignmentV - 1U)) == 0U), "`AlignmentV` must be a power of two");
+
+public:
+    /// @brief Size of each block in bytes
+    constexpr static size_t kBlockSizeBytes {(BlockSizeBytesV + (AlignmentV - 1U)) & ~(AlignmentV - 1U)};
+
+    /// @brief Number of blocks
+    constexpr static size_t kBlockCount {BlockCountV};
+
+    /// @brief Alignment of each block
+    constexpr static size_t kAlignment {AlignmentV};
+
+    /**!
+     * @brief Block allocated from a Pool, freed back to it when destroyed. Move-only.
+     */
+    class Block
+    {
+    public:
+        /// @brief Default constructor, holds no block
+        Block() noexcept = default;
+
+        /// @brief Frees the held block, if any
+        ~Block() noexcept;
+
+        Block(Block&& move) noexcept;
+        Block& operator=(Block&& move) noexcept;
+
+        // Block owns its allocation and may not be copied
+
+        Block(Block const& copy)            = delete;
+        Block& operator=(Block const& copy) = delete;
+
+        /// @brief Span over the whole block, empty if no block is held
+        Span<uint8_t> GetSpan() const noexcept;
+
+        /// @brief True if a block is held
+        bool IsValid() const noexcept;
+
+        /// @brief Frees the held block early, if any
+        void Reset() noexcept;
+
+    private:
+        friend class Pool;
+
+        Block(Pool* pool, uint8_t* block) noexcept;
+
+        Pool*    m_pool {nullptr};
+        uint8_t* m_block {nullptr};
+    };
+
+    /// @brief Default constructor, every block starts out free
+    Pool() noexcept;
+
+    ~Pool() noexcept = default;
+
+    // Pool lends out its own storage and may not be copied or moved
+
+    Pool(Pool const& copy) = delete;
+    Pool(Pool&& move)      = delete;
+
+    Pool& operator=(Pool const& copy) = delete;
+    Pool& operator=(Pool&& move)      = delete;
+
+    /**!
+     * @brief Allocate a block, held by a handle that frees it when destroyed. Never blocks.
+     *
+     * @return Block handle, invalid if every block is in use
+     */
+    Block Acquire() noexcept;
+
+    /**!
+     * @brief Allocate a block. Never blocks.
+     *
+     * @return Span over the block, empty if every block is in use
+     */
+    Span<uint8_t> Allocate() noexcept;
+
+    /// @brief Number of free blocks, a snapshot when other threads are allocating or freeing
+    size_t BlocksAvailable() const noexcept;
+
+    /**!
+     * @brief Return a block to the pool. Never blocks.
+     *
+     * @param[in] block Start of a block allocated from this pool
+     * @retval true if the block was freed
+     * @retval false if `block` doesn't point at the start of a block in this pool
+     */
+    bool Free(void* block) noexcept;
+
+private:
+    /// @brief Index that ends the free stack
+    constexpr static uint16_t kNullIndex {UINT16_MAX};
+
+    constexpr static uint32_t PackHead(uint16_t tag, uint16_t index) noexcept;
+
+    /// @brief Index of the top free block in a packed head
+    constexpr static uint16_t GetHeadIndex(uint32_t head) noexcept;
+
+    /// @brief Tag of a packed head
+    constexpr static uint16_t GetHeadTag(uint32_t head) noexcept;
+
+    alignas(AlignmentV) uint8_t m_storage[kBlockCount * kBlockSizeBytes];
+
+    /// @brief Index of the block below each free block in the stack
+    std::atomic<uint16_t> m_next[kBlockCount];
+
+    /// @brief Tag in the upper 16 bits, index of the top free block in the lower 16 bits
+    std::atomic<uint32_t> m_head;
+
+    static_assert(std::atomic<uint32_t>::is_always_lock_free && std::atomic<uint16_t>::is_always_lock_free,
+                  "Pool atomics must be lock-free for allocation to be lock-free");
+
+    std::atomic<size_t> m_available_count {kBlockCount};
+};
+
+/**!
+ * @brief Pool whose blocks fit the encoded footprint of any of a set of packet types, so that packets may be staged in
+ * pool blocks instead of on the stack or heap
+ *
+ * @tparam BlockCountV Number of blocks
+ * @tparam PacketTs Packet types, or any types with a footprint
+ */
+template<size_t BlockCountV, typename... PacketTs>
+using PacketPool = Pool<std::max({data::footprint_size_bytes_v<PacketTs>...}), BlockCountV>;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Pool constructor definitions        ////////////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Pool() noexcept : m_head {PackHead(0U, 0U)}
+{
+    // Stack every block in order, the last one ends the stack
+    for (size_t i = 0U; i < kBlockCount; i++)
+    {
+        uint16_t const kNext {((i + 1U) < kBlockCount) ? static_cast<uint16_t>(i + 1U) : kNullIndex};
+        m_next[i].store(kNext, std::memory_order_relaxed);
+    }
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block::Block(Pool* pool, uint8_t* block) noexcept
+    : m_pool {pool}, m_block {block}
+{
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block::Block(Block&& move) noexcept
+    : m_pool {move.m_pool}, m_block {move.m_block}
+{
+    move.m_pool  = nullptr;
+    move.m_block = nullptr;
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block::~Block() noexcept
+{
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Pool method definitions in alphabetical order           ////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+typename Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block Pool<BlockSizeBytesV, BlockCountV,
+                                                                    AlignmentV>::Acquire() noexcept
+{
+    Span<uint8_t> const kBlock {Allocate()};
+    return Block {this, kBlock.data()};
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+Span<uint8_t> Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Allocate() noexcept
+{
+    uint32_t head {m_head.load(std::memory_order_acquire)};
+    uint16_t index {0U};
+    do
+    {
+        index = GetHeadIndex(head);
+        if (index == kNullIndex)
+            return Span<uint8_t> {nullptr, size_t {0U}};
+
+        // A stale link is harmless, the tag makes the exchange fail if the top block changed hands in the meantime
+        uint16_t const kNext {m_next[index].load(std::memory_order_relaxed)};
+        uint16_t const kTag {static_cast<uint16_t>(GetHeadTag(head) + 1U)};
+        if (m_head.compare_exchange_weak(head, PackHead(kTag, kNext), std::memory_order_acquire,
+                                         std::memory_order_acquire))
+            break;
+    }
+    while (true);
+
+    m_available_count.fetch_sub(1U, std::memory_order_relaxed);
+    return Span<uint8_t> {(m_storage + (index * kBlockSizeBytes)), kBlockSizeBytes};
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+size_t Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::BlocksAvailable() const noexcept
+{
+    return m_available_count.load(std::memory_order_relaxed);
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+bool Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Free(void* block) noexcept
+{
+    uint8_t* const kBlock {static_cast<uint8_t*>(block)};
+    if ((kBlock < m_storage) || (kBlock >= (m_storage + sizeof(m_storage))))
+        return false;
+
+    size_t const kOffset {static_cast<size_t>(kBlock - m_storage)};
+    if ((kOffset % kBlockSizeBytes) != 0U)
+        return false;
+
+    uint16_t const kIndex {static_cast<uint16_t>(kOffset / kBlockSizeBytes)};
+
+    uint32_t head {m_head.load(std::memory_order_relaxed)};
+    do
+    {
+        m_next[kIndex].store(GetHeadIndex(head), std::memory_order_relaxed);
+    }
+    while (!m_head.compare_exchange_weak(head, PackHead(static_cast<uint16_t>(GetHeadTag(head) + 1U), kIndex),
+                                         std::memory_order_release, std::memory_order_relaxed));
+
+    m_available_count.fetch_add(1U, std::memory_order_relaxed);
+    return true;
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+Span<uint8_t> Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block::GetSpan() const noexcept
+{
+    return Span<uint8_t> {m_block, ((m_block != nullptr) ? kBlockSizeBytes : size_t {0U})};
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+bool Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block::IsValid() const noexcept
+{
+    return (m_block != nullptr);
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+void Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block::Reset() noexcept
+{
+    if (m_block != nullptr)
+        static_cast<void>(m_pool->Free(m_block));
+
+    m_pool  = nullptr;
+    m_block = nullptr;
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+typename Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block& Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::Block::
+operator=(Block&& move) noexcept
+{
+    if (this != &move)
+    {
+        Reset();
+        m_pool       = move.m_pool;
+        m_block      = move.m_block;
+        move.m_pool  = nullptr;
+        move.m_block = nullptr;
+    }
+    return *this;
+}
+
+//  Private     ========================================================================================================
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+constexpr uint16_t Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::GetHeadIndex(uint32_t head) noexcept // Static method
+{
+    return static_cast<uint16_t>(head & UINT16_MAX);
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+constexpr uint16_t Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::GetHeadTag(uint32_t head) noexcept // Static method
+{
+    return static_cast<uint16_t>(head >> 16U);
+}
+
+template<size_t BlockSizeBytesV, size_t BlockCountV, size_t AlignmentV>
+constexpr uint32_t Pool<BlockSizeBytesV, BlockCountV, AlignmentV>::PackHead(uint16_t tag,
+                                                                            uint16_t index) noexcept // Static method
+{
+    return ((static_cast<uint32_t>(tag) << 16U) | index);
+}
+
+} // namespace memory
+} // namespace shmit
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace shmit
+{
+namespace platform
+{
+
+/**!
+ * @brief Precise monotonic clock that every Core clock is built on. Meets the Core named requirements for Clock.
+ *
+ * @note Backed by CLOCK_MONOTONIC (through std::chrono::steady_clock) on native builds, ports provide their own
+ * implementation of get_platform_clock_duration_since_epoch otherwise, read from a hardware cycle counter
+ */
+struct Clock
+{
+    using duration   = std::chrono::microseconds;
+    using rep        = duration::rep;
+    using period     = duration::period;
+    using time_point = std::chrono::time_point<Clock>;
+
+    constexpr static bool is_steady {true};
+
+    /**!
+     * @brief Reads the current time from the platform's monotonic time source
+     *
+     * @return Current time
+     */
+    static time_point now();
+};
+
+/**!
+ * @brief Coarse monotonic clock for hot paths. Reading it is a single atomic load of a timestamp cached from Clock,
+ * which only moves forward when Update is called, typically once per scheduler tick.
+ *
+ * @note On Zephyr the port calls Update from a kernel timer on every system tick, starting before application code
+ * runs. Native builds have no scheduler tick, so whatever drives the application's main loop must call Update. Until
+ * the first call to Update, now() reads the clock's epoch.
+ */
+struct CoarseClock
+{
+    using duration   = Clock::duration;
+    using rep        = Clock::rep;
+    using period     = Clock::period;
+    using time_point = std::chrono::time_point<CoarseClock>;
+
+    constexpr static bool is_steady {true};
+
+    /**!
+     * @brief Reads the cached timestamp
+     *
+     * @return Time as of the last Update
+     */
+    static time_point now() noexcept;
+
+    /**!
+     * @brief Refreshes the cached timestamp from Clock. Safe to call from any thread or interrupt context.
+     *
+     * @return Refreshed time
+     */
+    static time_point Update() noexcept;
+
+private:
+    static std::atomic<rep> s_cached_count;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  CoarseClock method definitions in alphabetical order            ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+inline CoarseClock::time_point CoarseClock::now() noexcept // Static method
+{
+    return time_point {duration {s_cached_count.load(std::memory_order_relaxed)}};
+}
+
+} // namespace platform
+} // namespace shmit
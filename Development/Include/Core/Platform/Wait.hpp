@@ -0,0 +1,39 @@
+#pragma once
+
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <chrono>
+
+namespace shmit
+{
+namespace platform
+{
+
+/**!
+ * @brief Block the calling thread while a word holds an expected value, until it is notified through notify_all or a
+ * timeout elapses. Spurious wakeups are allowed, callers re-check their own condition after returning.
+ *
+ * @note Backed by a condition variable on native builds, ports provide their own implementation otherwise
+ *
+ * @param[in] word Word to wait on
+ * @param[in] expected Value the word must still hold for the thread to block
+ * @param[in] timeout Maximum time that will be spent blocked
+ */
+void wait_on(std::atomic<uint32_t> const& word, uint32_t expected, std::chrono::microseconds timeout) noexcept;
+
+/**!
+ * @brief Wake every thread blocked in wait_on for a word. Call after changing the word's value.
+ *
+ * @param[in] word Word that threads are waiting on
+ */
+void notify_all(std::atomic<uint32_t> const& word) noexcept;
+
+/**!
+ * @brief Give up the rest of the calling thread's time slice to any other ready thread
+ *
+ */
+void yield() noexcept;
+
+} // namespace platform
+} // namespace shmit
@@ -3,6 +3,8 @@
 #include "Core/Data/Footprint.hpp"
 #include "Core/StdTypes.hpp"
 
+#include <algorithm>
+#include <cstring>
 #include <iterator>
 #include <limits>
 #include <type_traits>
@@ -10,8 +12,69 @@
 namespace shmit
 {
 
-template<typename T>
-class Span
+/// @brief Extent of a Span whose number of elements is only known at runtime
+constexpr static size_t kDynamicExtent {std::numeric_limits<size_t>::max()};
+
+namespace detail
+{
+
+/**!
+ * @brief Number of elements viewed by a Span. Static extents are part of the type and take no storage.
+ *
+ * @tparam ExtentV Number of elements, or kDynamicExtent
+ */
+template<size_t ExtentV>
+struct SpanExtent
+{
+    constexpr explicit SpanExtent(size_t count) noexcept
+    {
+        static_cast<void>(count); // Avoid unused warning
+    }
+
+    constexpr static size_t GetCount() noexcept
+    {
+        return ExtentV;
+    }
+};
+
+template<>
+struct SpanExtent<kDynamicExtent>
+{
+    constexpr explicit SpanExtent(size_t count) noexcept : m_count {count}
+    {
+    }
+
+    constexpr size_t GetCount() const noexcept
+    {
+        return m_count;
+    }
+
+    size_t m_count;
+};
+
+/**!
+ * @brief Extent of a subspan taken at compile-time offsets
+ *
+ * @tparam ExtentV Extent of the Span the subspan is taken from
+ * @tparam OffsetV Offset of the subspan
+ * @tparam CountV Number of elements in the subspan, or kDynamicExtent for every element after the offset
+ */
+template<size_t ExtentV, size_t OffsetV, size_t CountV>
+constexpr static size_t kSubspanExtent {(CountV != kDynamicExtent)   ? CountV
+                                        : (ExtentV != kDynamicExtent) ? (ExtentV - OffsetV)
+                                                                      : kDynamicExtent};
+
+} // namespace detail
+
+/**!
+ * @brief Non-owning view of a contiguous run of elements
+ *
+ * @tparam T Element type
+ * @tparam ExtentV Number of elements when it is known at compile time, so that it is part of the type and bounds
+ * within it can be proven by the compiler. Defaults to kDynamicExtent, counted at runtime.
+ */
+template<typename T, size_t ExtentV = kDynamicExtent>
+class Span : private detail::SpanExtent<ExtentV>
 {
     static_assert(!std::is_pointer<T>::value, "shmit::Span template parameter 'T' may not be a pointer type");
     static_assert(sizeof(T) > 0, "shmit::Span template parameter 'T' must have a nonzero size");
@@ -35,15 +98,24 @@ public:
 
     constexpr static size_type npos {std::numeric_limits<size_type>::max()};
 
+    /// @brief Number of elements when known at compile time, otherwise kDynamicExtent
+    constexpr static size_type kExtent {ExtentV};
+
     Span() = delete;
 
+    /// @note A Span of static extent assumes `count` is kExtent
     constexpr explicit Span(pointer start, size_type count) noexcept;
 
     constexpr explicit Span(iterator start, iterator end) noexcept;
 
-    template<size_t N>
+    template<size_t N, typename = std::enable_if_t<((ExtentV == kDynamicExtent) || (N == ExtentV))>>
     constexpr Span(element_type (&arr)[N]) noexcept;
 
+    /// @brief A Span of static extent converts to a Span of dynamic extent over the same elements
+    template<size_t OtherExtentV,
+             typename = std::enable_if_t<((ExtentV == kDynamicExtent) && (OtherExtentV != kDynamicExtent))>>
+    constexpr Span(Span<T, OtherExtentV> const& rhs) noexcept;
+
     constexpr Span(Span const& rhs) noexcept = default;
 
     ~Span() = default;
@@ -68,7 +140,29 @@ public:
     constexpr reference front() const noexcept;
     constexpr reference back() const noexcept;
 
-    constexpr Span subspan(size_type start, size_type count = npos) const noexcept;
+    /// @brief Leading `CountV` elements. Checked at compile time against a static extent, a Span of dynamic extent
+    /// must hold at least `CountV` elements.
+    template<size_t CountV>
+    constexpr Span<T, CountV> first() const noexcept;
+
+    /// @brief Leading `count` elements, or every element if there are fewer
+    constexpr Span<T> first(size_type count) const noexcept;
+
+    /// @brief Trailing `CountV` elements. Checked at compile time against a static extent, a Span of dynamic extent
+    /// must hold at least `CountV` elements.
+    template<size_t CountV>
+    constexpr Span<T, CountV> last() const noexcept;
+
+    /// @brief Trailing `count` elements, or every element if there are fewer
+    constexpr Span<T> last(size_type count) const noexcept;
+
+    /// @brief Elements from `OffsetV`, `CountV` of them or every one after it. Checked at compile time against a
+    /// static extent, a Span of dynamic extent must hold them all.
+    template<size_t OffsetV, size_t CountV = kDynamicExtent>
+    constexpr Span<T, detail::kSubspanExtent<ExtentV, OffsetV, CountV>> subspan() const noexcept;
+
+    /// @brief Elements from `start`, `count` of them or every one after it. Both are clamped to the Span.
+    constexpr Span<T> subspan(size_type start, size_type count = npos) const noexcept;
 
     constexpr reference       at(size_type i) noexcept;
     constexpr const_reference at(size_type i) const noexcept;
@@ -79,12 +173,8 @@ public:
 
     constexpr size_type size() const noexcept;
 
-    template<typename ValueTypeOut, typename ValueTypeIn>
-    friend Span<ValueTypeOut> span_cast(Span<ValueTypeIn> const& span);
-
 private:
-    pointer   m_data;
-    size_type m_count;
+    pointer m_data;
 };
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -93,20 +183,29 @@ private:
 
 // Public   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-constexpr Span<T>::Span(Span<T>::pointer start, Span<T>::size_type count) noexcept : m_data {start}, m_count {count}
+template<typename T, size_t ExtentV>
+constexpr Span<T, ExtentV>::Span(Span<T, ExtentV>::pointer start, Span<T, ExtentV>::size_type count) noexcept :
+    detail::SpanExtent<ExtentV> {count}, m_data {start}
+{
+}
+
+template<typename T, size_t ExtentV>
+constexpr Span<T, ExtentV>::Span(Span<T, ExtentV>::iterator start, Span<T, ExtentV>::iterator end) noexcept :
+    detail::SpanExtent<ExtentV> {static_cast<size_type>(end - start)}, m_data {start}
 {
 }
 
-template<typename T>
-constexpr Span<T>::Span(Span<T>::iterator start, Span<T>::iterator end) noexcept :
-    m_data {start}, m_count {static_cast<size_type>(end - start)}
+template<typename T, size_t ExtentV>
+template<size_t N, typename>
+constexpr Span<T, ExtentV>::Span(Span<T, ExtentV>::element_type (&arr)[N]) noexcept :
+    detail::SpanExtent<ExtentV> {N}, m_data {arr}
 {
 }
 
-template<typename T>
-template<size_t N>
-constexpr Span<T>::Span(Span<T>::element_type (&arr)[N]) noexcept : m_data {arr}, m_count {N}
+template<typename T, size_t ExtentV>
+template<size_t OtherExtentV, typename>
+constexpr Span<T, ExtentV>::Span(Span<T, OtherExtentV> const& rhs) noexcept :
+    detail::SpanExtent<ExtentV> {rhs.count()}, m_data {rhs.data()}
 {
 }
 
@@ -116,104 +215,150 @@ constexpr Span<T>::Span(Span<T>::element_type (&arr)[N]) noexcept : m_data {arr}
 
 // Public   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-constexpr typename Span<T>::reference Span<T>::at(typename Span<T>::size_type i) noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::reference Span<T, ExtentV>::at(typename Span<T, ExtentV>::size_type i) noexcept
 {
     return *(m_data + i);
 }
 
-template<typename T>
-constexpr typename Span<T>::const_reference Span<T>::at(typename Span<T>::size_type i) const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::const_reference
+Span<T, ExtentV>::at(typename Span<T, ExtentV>::size_type i) const noexcept
 {
     return *(m_data + i);
 }
 
-template<typename T>
-constexpr typename Span<T>::reference Span<T>::back() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::reference Span<T, ExtentV>::back() const noexcept
 {
-    return *(m_data + m_count - 1U);
+    return *(m_data + count() - 1U);
 }
 
-template<typename T>
-constexpr typename Span<T>::iterator Span<T>::begin() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::iterator Span<T, ExtentV>::begin() const noexcept
 {
     return m_data;
 }
 
-template<typename T>
-constexpr typename Span<T>::const_iterator Span<T>::cbegin() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::const_iterator Span<T, ExtentV>::cbegin() const noexcept
 {
     return const_iterator {begin()};
 }
 
-template<typename T>
-constexpr typename Span<T>::const_iterator Span<T>::cend() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::const_iterator Span<T, ExtentV>::cend() const noexcept
 {
     return const_iterator {end()};
 }
 
-template<typename T>
-constexpr typename Span<T>::size_type Span<T>::count() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::size_type Span<T, ExtentV>::count() const noexcept
 {
-    return m_count;
+    return detail::SpanExtent<ExtentV>::GetCount();
 }
 
-template<typename T>
-constexpr typename Span<T>::const_reverse_iterator Span<T>::crbegin() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::const_reverse_iterator Span<T, ExtentV>::crbegin() const noexcept
 {
     return const_reverse_iterator {cbegin()};
 }
 
-template<typename T>
-constexpr typename Span<T>::const_reverse_iterator Span<T>::crend() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::const_reverse_iterator Span<T, ExtentV>::crend() const noexcept
 {
     return const_reverse_iterator {cend()};
 }
 
-template<typename T>
-constexpr typename Span<T>::pointer Span<T>::data() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::pointer Span<T, ExtentV>::data() const noexcept
 {
     return m_data;
 }
 
-template<typename T>
-constexpr typename Span<T>::iterator Span<T>::end() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::iterator Span<T, ExtentV>::end() const noexcept
 {
-    return m_data + m_count;
+    return m_data + count();
 }
 
-template<typename T>
-constexpr typename Span<T>::reference Span<T>::front() const noexcept
+template<typename T, size_t ExtentV>
+template<size_t CountV>
+constexpr Span<T, CountV> Span<T, ExtentV>::first() const noexcept
+{
+    static_assert(((ExtentV == kDynamicExtent) || (CountV <= ExtentV)), "`CountV` must be within the Span");
+    return Span<T, CountV> {m_data, CountV};
+}
+
+template<typename T, size_t ExtentV>
+constexpr Span<T> Span<T, ExtentV>::first(typename Span<T, ExtentV>::size_type count) const noexcept
+{
+    return Span<T> {m_data, std::min(count, this->count())};
+}
+
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::reference Span<T, ExtentV>::front() const noexcept
 {
     return *m_data;
 }
 
-template<typename T>
-constexpr typename Span<T>::reverse_iterator Span<T>::rbegin() const noexcept
+template<typename T, size_t ExtentV>
+template<size_t CountV>
+constexpr Span<T, CountV> Span<T, ExtentV>::last() const noexcept
+{
+    static_assert(((ExtentV == kDynamicExtent) || (CountV <= ExtentV)), "`CountV` must be within the Span");
+    return Span<T, CountV> {(m_data + (count() - CountV)), CountV};
+}
+
+template<typename T, size_t ExtentV>
+constexpr Span<T> Span<T, ExtentV>::last(typename Span<T, ExtentV>::size_type count) const noexcept
+{
+    size_type const kCount {std::min(count, this->count())};
+    return Span<T> {(m_data + (this->count() - kCount)), kCount};
+}
+
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::reverse_iterator Span<T, ExtentV>::rbegin() const noexcept
 {
     return reverse_iterator {begin()};
 }
 
-template<typename T>
-constexpr typename Span<T>::reverse_iterator Span<T>::rend() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::reverse_iterator Span<T, ExtentV>::rend() const noexcept
 {
     return reverse_iterator {end()};
 }
 
-template<typename T>
-constexpr typename Span<T>::size_type Span<T>::size() const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::size_type Span<T, ExtentV>::size() const noexcept
+{
+    return data::footprint_size_bytes_v<T> * count();
+}
+
+template<typename T, size_t ExtentV>
+template<size_t OffsetV, size_t CountV>
+constexpr Span<T, detail::kSubspanExtent<ExtentV, OffsetV, CountV>> Span<T, ExtentV>::subspan() const noexcept
 {
-    return data::footprint_size_bytes_v<T> * m_count;
+    constexpr size_t kExtent {detail::kSubspanExtent<ExtentV, OffsetV, CountV>};
+    static_assert(((ExtentV == kDynamicExtent) || (OffsetV <= ExtentV)), "`OffsetV` must be within the Span");
+    static_assert(((ExtentV == kDynamicExtent) || (CountV == kDynamicExtent) || ((OffsetV + CountV) <= ExtentV)),
+                  "`CountV` elements from `OffsetV` must be within the Span");
+
+    size_type const kCount {(kExtent == kDynamicExtent) ? (count() - OffsetV) : kExtent};
+    return Span<T, kExtent> {(m_data + OffsetV), kCount};
 }
 
-template<typename T>
-constexpr Span<T> Span<T>::subspan(typename Span<T>::size_type start, typename Span<T>::size_type count) const noexcept
+template<typename T, size_t ExtentV>
+constexpr Span<T> Span<T, ExtentV>::subspan(typename Span<T, ExtentV>::size_type start,
+                                            typename Span<T, ExtentV>::size_type count) const noexcept
 {
-    // Reduce count to the amount following the start point if undefined or larger than the size of the span
-    if ((count == npos) || ((start + count) > m_count))
-        count = (m_count - start);
+    // Reduce start to the end of the span, and count to the amount following the start point if undefined or larger
+    // than the size of the span
+    start = std::min(start, this->count());
+    if ((count == npos) || (count > (this->count() - start)))
+        count = (this->count() - start);
 
-    return Span {(m_data + start), count};
+    return Span<T> {(m_data + start), count};
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -222,14 +367,16 @@ constexpr Span<T> Span<T>::subspan(typename Span<T>::size_type start, typename S
 
 // Public   ////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename T>
-constexpr typename Span<T>::reference Span<T>::operator[](typename Span<T>::size_type i) noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::reference
+Span<T, ExtentV>::operator[](typename Span<T, ExtentV>::size_type i) noexcept
 {
     return at(i);
 }
 
-template<typename T>
-constexpr typename Span<T>::const_reference Span<T>::operator[](typename Span<T>::size_type i) const noexcept
+template<typename T, size_t ExtentV>
+constexpr typename Span<T, ExtentV>::const_reference
+Span<T, ExtentV>::operator[](typename Span<T, ExtentV>::size_type i) const noexcept
 {
     return at(i);
 }
@@ -238,12 +385,63 @@ constexpr typename Span<T>::const_reference Span<T>::operator[](typename Span<T>
 //  Namespace function definitions in alphabetical order                ////////////////////////////////////////////////
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-template<typename ValueTypeOut, typename ValueTypeIn>
-Span<ValueTypeOut> span_cast(Span<ValueTypeIn> const& span)
+template<typename ValueTypeOut, typename ValueTypeIn, size_t ExtentV>
+Span<ValueTypeOut, ExtentV> span_cast(Span<ValueTypeIn, ExtentV> const& span)
 {
     static_assert(std::is_convertible<ValueTypeIn*, ValueTypeOut*>::value, "`ValueTypeOut` and `ValueTypeIn` must be "
                                                                            "convertible");
-    return Span<ValueTypeOut> {reinterpret_cast<ValueTypeOut*>(span.m_data), span.m_count};
+    return Span<ValueTypeOut, ExtentV> {reinterpret_cast<ValueTypeOut*>(span.data()), span.count()};
+}
+
+/**!
+ * @brief Copies elements from one Span to another, as many as the shorter of the two holds. Trivially copyable
+ * elements are copied with a single memcpy.
+ *
+ * @note Spans of static extent are checked at compile time, the destination must hold every source element
+ *
+ * @param[in] src Elements to copy
+ * @param[out] dest Destination, must not overlap `src`
+ * @return Number of elements copied
+ */
+template<typename SrcT, size_t SrcExtentV, typename DestT, size_t DestExtentV>
+size_t span_copy(Span<SrcT, SrcExtentV> src, Span<DestT, DestExtentV> dest) noexcept
+{
+    static_assert(std::is_same<std::remove_cv_t<SrcT>, DestT>::value, "`SrcT` and `DestT` must be the same type");
+    static_assert(((SrcExtentV == kDynamicExtent) || (DestExtentV == kDynamicExtent) || (SrcExtentV <= DestExtentV)),
+                  "`dest` must hold every element of `src`");
+
+    size_t const kCount {std::min(src.count(), dest.count())};
+    if constexpr (std::is_trivially_copyable<DestT>::value)
+    {
+        if (kCount > 0U)
+            static_cast<void>(std::memcpy(dest.data(), src.data(), (kCount * sizeof(DestT))));
+    }
+    else
+        static_cast<void>(std::copy(src.begin(), (src.begin() + kCount), dest.begin()));
+
+    return kCount;
+}
+
+/**!
+ * @brief Assigns a value to every element of a Span. Spans of single bytes are filled with a single memset.
+ *
+ * @param[out] dest Elements to fill
+ * @param[in] value Value to assign
+ */
+template<typename T, size_t ExtentV>
+void span_fill(Span<T, ExtentV> dest, typename Span<T, ExtentV>::value_type const& value) noexcept
+{
+    if constexpr ((sizeof(T) == 1U) && std::is_trivially_copyable<T>::value)
+    {
+        if (dest.count() > 0U)
+        {
+            unsigned char byte {};
+            static_cast<void>(std::memcpy(&byte, &value, 1U));
+            static_cast<void>(std::memset(dest.data(), byte, dest.count()));
+        }
+    }
+    else
+        std::fill(dest.begin(), dest.end(), value);
 }
 
-} // namespace shmit
\ No newline at end of file
+} // namespace shmit
@@ -176,6 +176,53 @@ struct string_compare
 template<typename String1T, typename String2T>
 constexpr static bool string_compare_v {string_compare<String1T, String2T>::value};
 
+/**!
+ * @brief 32-bit FNV-1a hash of a string's characters, not including any terminator. Wide characters are hashed one
+ * byte at a time from least to most significant, so a string hashes the same whether hashed here or at runtime.
+ *
+ * @tparam CharT Character type
+ * @param[in] str String to hash
+ * @return Hash of `str`
+ */
+template<typename CharT>
+constexpr static uint32_t fnv1a_hash(std::basic_string_view<CharT> str) noexcept
+{
+    constexpr uint32_t kOffsetBasis {2166136261U};
+    constexpr uint32_t kPrime {16777619U};
+
+    uint32_t hash {kOffsetBasis};
+    for (CharT character : str)
+    {
+        auto const code_unit {static_cast<std::make_unsigned_t<CharT>>(character)};
+        for (size_t byte = 0U; byte < sizeof(CharT); byte++)
+        {
+            hash ^= static_cast<uint32_t>((code_unit >> (byte * 8U)) & 0xFFU);
+            hash *= kPrime;
+        }
+    }
+
+    return hash;
+}
+
+/**!
+ * @brief Hashes a StringConstant at compile time, see fnv1a_hash
+ *
+ * @tparam StringT StringConstant to hash
+ */
+template<typename StringT>
+struct string_constant_hash
+{
+    static_assert(is_string_constant_v<StringT>, "shmit::string_constant_hash StringT parameter must be "
+                                                 "specialization of shmit::StringConstant");
+
+    // StringConstant values are stored with their terminator
+    constexpr static uint32_t value {
+        fnv1a_hash(typename StringT::rep {StringT::value.data(), (StringT::value.size() - 1U)})};
+};
+
+template<typename StringT>
+constexpr static uint32_t string_constant_hash_v {string_constant_hash<StringT>::value};
+
 } // namespace shmit
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,315 @@
+#pragma once
+
+#include "Core/StdTypes.hpp"
+#include "Core/StringConstant.hpp"
+
+#include <array>
+#include <limits>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+
+namespace shmit
+{
+
+namespace detail
+{
+
+/// @brief Murmur3 finalizer, spreads every bit of a hash across the low bits that index a table
+constexpr static uint32_t mix_hash(uint32_t hash) noexcept
+{
+    hash ^= (hash >> 16U);
+    hash *= 0x85EBCA6BU;
+    hash ^= (hash >> 13U);
+    hash *= 0xC2B2AE35U;
+    hash ^= (hash >> 16U);
+    return hash;
+}
+
+/// @brief Slot of a hash within a table, under a displacement seed
+constexpr static uint32_t seeded_hash(uint32_t hash, uint32_t seed) noexcept
+{
+    return mix_hash(hash ^ (seed * 0x9E3779B9U));
+}
+
+constexpr static size_t next_power_of_two(size_t value) noexcept
+{
+    size_t power {1U};
+    while (power < value)
+        power <<= 1U;
+
+    return power;
+}
+
+/// @brief Key string of a StringConstant, without its terminator
+template<typename StringT>
+constexpr static typename StringT::rep string_constant_key_v {StringT::value.data(), (StringT::value.size() - 1U)};
+
+} // namespace detail
+
+/**!
+ * @brief Compile-time perfect hash from a set of StringConstant keys to their index in the set. Finding a string
+ * costs one hash of the string, two table reads and one comparison against the single key it could be, no matter how
+ * many keys there are.
+ *
+ * The table is hash-and-displace: keys are spread over buckets by their hash, and every bucket stores either the slot
+ * of its only key or a seed under which all of its keys land in free slots. Everything is computed at compile time.
+ *
+ * @tparam KeyT StringConstant keys, must be distinct and share one character type
+ */
+template<typename... KeyT>
+class StringConstantIndex
+{
+    static_assert(sizeof...(KeyT) > 0U, "StringConstantIndex needs at least one key");
+    static_assert((is_string_constant_v<KeyT> && ...), "Every key must be a specialization of shmit::StringConstant");
+
+public:
+    using rep = typename std::tuple_element_t<0U, std::tuple<KeyT...>>::rep;
+
+    static_assert((std::is_same<rep, typename KeyT::rep>::value && ...), "Every key must share one character type");
+
+    /// @brief Number of keys
+    constexpr static size_t kKeyCount {sizeof...(KeyT)};
+
+    /// @brief Returned by Find for strings that are not keys
+    constexpr static size_t kNotFound {std::numeric_limits<size_t>::max()};
+
+    /// @brief Number of buckets
+    constexpr static size_t kBucketCount {detail::next_power_of_two(kKeyCount)};
+
+    /// @brief Number of slots, kept at or below half full so that seeds are quick to find
+    constexpr static size_t kSlotCount {detail::next_power_of_two(kKeyCount * 2U)};
+
+    /// @brief Key strings in the order given
+    constexpr static std::array<rep, kKeyCount> kKeys {detail::string_constant_key_v<KeyT>...};
+
+    /**!
+     * @brief Finds the index of a key at runtime
+     *
+     * @param[in] str String to find
+     * @return Index of `str` within KeyT, or kNotFound
+     */
+    constexpr static size_t Find(rep str) noexcept;
+
+    /**!
+     * @brief Index of a key at compile time
+     *
+     * @tparam StringT Key to find, must be one of KeyT
+     */
+    template<typename StringT>
+    constexpr static size_t IndexOf() noexcept;
+
+private:
+    using SlotIndex = std::conditional_t<(kKeyCount < std::numeric_limits<uint16_t>::max()), uint16_t, uint32_t>;
+
+    /// @brief Most seeds to try per bucket before giving up on building the table
+    constexpr static uint32_t kMaxSeed {1U << 20U};
+
+    /// @brief Marks a slot without a key
+    constexpr static SlotIndex kEmptySlot {std::numeric_limits<SlotIndex>::max()};
+
+    struct Table
+    {
+        /// @brief Negative for a bucket whose only key sits directly at slot `-(displacement + 1)`, otherwise a seed
+        std::array<int32_t, kBucketCount> displacements;
+        std::array<SlotIndex, kSlotCount> slots;
+        bool                              is_built;
+    };
+
+    constexpr static std::array<uint32_t, kKeyCount> kHashes {string_constant_hash_v<KeyT>...};
+
+    constexpr static Table BuildTable() noexcept;
+
+    constexpr static Table kTable {BuildTable()};
+
+    static_assert(kTable.is_built, "Keys must be distinct and hash to distinct values");
+};
+
+/**!
+ * @brief Table of handlers, one per StringConstant key, found by string through a StringConstantIndex
+ *
+ * @tparam HandlerT Handler type, such as a function pointer
+ * @tparam KeyT StringConstant keys, in the same order as the handlers
+ */
+template<typename HandlerT, typename... KeyT>
+class StringDispatchTable
+{
+public:
+    using Index = StringConstantIndex<KeyT...>;
+    using rep   = typename Index::rep;
+
+    /**!
+     * @brief Constructs a StringDispatchTable
+     *
+     * @param[in] handlers Handlers in the same order as KeyT
+     */
+    constexpr StringDispatchTable(std::array<HandlerT, sizeof...(KeyT)> const& handlers) noexcept;
+
+    /**!
+     * @brief Finds the handler for a string
+     *
+     * @param[in] str String to find
+     * @return Handler for `str`, or null if it is not a key
+     */
+    constexpr HandlerT const* Find(rep str) const noexcept;
+
+private:
+    std::array<HandlerT, sizeof...(KeyT)> m_handlers;
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StringConstantIndex method definitions in alphabetical order      ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename... KeyT>
+constexpr size_t StringConstantIndex<KeyT...>::Find(rep str) noexcept // Static method
+{
+    uint32_t const hash {fnv1a_hash(str)};
+    int32_t const  displacement {kTable.displacements[detail::mix_hash(hash) & (kBucketCount - 1U)]};
+
+    size_t const slot {(displacement < 0)
+                           ? static_cast<size_t>(-(displacement + 1))
+                           : (detail::seeded_hash(hash, static_cast<uint32_t>(displacement)) & (kSlotCount - 1U))};
+
+    SlotIndex const index {kTable.slots[slot]};
+    if ((index == kEmptySlot) || (kKeys[index] != str))
+        return kNotFound;
+
+    return index;
+}
+
+template<typename... KeyT>
+template<typename StringT>
+constexpr size_t StringConstantIndex<KeyT...>::IndexOf() noexcept // Static method
+{
+    constexpr size_t kIndex {Find(detail::string_constant_key_v<StringT>)};
+    static_assert(kIndex != kNotFound, "`StringT` is not a key");
+    return kIndex;
+}
+
+//  Private     ========================================================================================================
+
+template<typename... KeyT>
+constexpr typename StringConstantIndex<KeyT...>::Table StringConstantIndex<KeyT...>::BuildTable() noexcept
+{
+    Table table {{}, {}, false};
+    for (SlotIndex& slot : table.slots)
+        slot = kEmptySlot;
+
+    // Distinct keys sharing one hash can never be told apart
+    for (size_t i = 0U; i < kKeyCount; i++)
+    {
+        for (size_t j = (i + 1U); j < kKeyCount; j++)
+        {
+            if (kHashes[i] == kHashes[j])
+                return table;
+        }
+    }
+
+    // Gather keys in to buckets, then place the largest buckets first while the table is emptiest
+    std::array<size_t, kBucketCount> bucket_sizes {};
+    std::array<size_t, kKeyCount>    key_buckets {};
+    for (size_t i = 0U; i < kKeyCount; i++)
+    {
+        key_buckets[i] = (detail::mix_hash(kHashes[i]) & (kBucketCount - 1U));
+        bucket_sizes[key_buckets[i]]++;
+    }
+
+    std::array<size_t, kBucketCount> bucket_order {};
+    for (size_t i = 0U; i < kBucketCount; i++)
+        bucket_order[i] = i;
+
+    for (size_t i = 1U; i < kBucketCount; i++)
+    {
+        for (size_t j = i; (j > 0U) && (bucket_sizes[bucket_order[j - 1U]] < bucket_sizes[bucket_order[j]]); j--)
+        {
+            size_t const swapped {bucket_order[j]};
+            bucket_order[j]      = bucket_order[j - 1U];
+            bucket_order[j - 1U] = swapped;
+        }
+    }
+
+    for (size_t bucket : bucket_order)
+    {
+        if (bucket_sizes[bucket] == 0U)
+            break;
+
+        // Lone keys go straight in to the first free slot
+        if (bucket_sizes[bucket] == 1U)
+        {
+            size_t key {0U};
+            while (key_buckets[key] != bucket)
+                key++;
+
+            size_t slot {0U};
+            while (table.slots[slot] != kEmptySlot)
+                slot++;
+
+            table.slots[slot]           = static_cast<SlotIndex>(key);
+            table.displacements[bucket] = -(static_cast<int32_t>(slot) + 1);
+            continue;
+        }
+
+        // Otherwise, search for a seed that lands every key of the bucket in its own free slot
+        bool is_placed {false};
+        for (uint32_t seed = 0U; !is_placed && (seed < kMaxSeed); seed++)
+        {
+            std::array<SlotIndex, kSlotCount> trial_slots {table.slots};
+
+            is_placed = true;
+            for (size_t key = 0U; is_placed && (key < kKeyCount); key++)
+            {
+                if (key_buckets[key] != bucket)
+                    continue;
+
+                size_t const slot {detail::seeded_hash(kHashes[key], seed) & (kSlotCount - 1U)};
+                if (trial_slots[slot] != kEmptySlot)
+                    is_placed = false;
+                else
+                    trial_slots[slot] = static_cast<SlotIndex>(key);
+            }
+
+            if (is_placed)
+            {
+                table.slots                 = trial_slots;
+                table.displacements[bucket] = static_cast<int32_t>(seed);
+            }
+        }
+
+        if (!is_placed)
+            return table;
+    }
+
+    table.is_built = true;
+    return table;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StringDispatchTable constructor definitions         ////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename HandlerT, typename... KeyT>
+constexpr StringDispatchTable<HandlerT, KeyT...>::StringDispatchTable(
+    std::array<HandlerT, sizeof...(KeyT)> const& handlers) noexcept :
+    m_handlers {handlers}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  StringDispatchTable method definitions in alphabetical order      ////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename HandlerT, typename... KeyT>
+constexpr HandlerT const* StringDispatchTable<HandlerT, KeyT...>::Find(rep str) const noexcept
+{
+    size_t const index {Index::Find(str)};
+    return ((index == Index::kNotFound) ? nullptr : &m_handlers[index]);
+}
+
+} // namespace shmit
@@ -0,0 +1,224 @@
+#pragma once
+
+#include "Core/Result.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+#ifdef NATIVE_SHMIT
+
+#include <thread>
+
+#else
+
+struct k_work_q;
+
+#endif
+
+namespace shmit
+{
+namespace system
+{
+
+class Executor;
+
+/**!
+ * @brief Unit of work that may be submitted to an Executor. Work items are owned by the caller and are never copied
+ * or allocated by the Executor, so that submitting one takes no more than a few atomic operations and is safe from
+ * interrupt context.
+ *
+ * A work item may be pending on one Executor at a time. It stops being pending just before its handler runs, so a
+ * handler may submit its own work item again.
+ *
+ * @note A work item must outlive every submission of it
+ */
+class Work
+{
+public:
+    /// @brief Work handler, called with the context given at construction
+    using Handler = void (*)(void* context);
+
+    /// @brief Space reserved for ports that back work items with kernel objects
+    constexpr static size_t kPortStorageSizeBytes {32U};
+
+    /**!
+     * @brief Initializing constructor
+     *
+     * @param[in] handler Called each time the work item runs
+     * @param[in] context Passed to every call of the handler
+     */
+    Work(Handler handler, void* context) noexcept;
+
+    // Work is queued by address and may not be copied or moved
+
+    Work(Work const& copy) = delete;
+    Work(Work&& move)      = delete;
+
+    Work& operator=(Work const& copy) = delete;
+    Work& operator=(Work&& move)      = delete;
+
+    ~Work() noexcept = default;
+
+    /// @brief True from submission until the handler starts running
+    bool IsPending() const noexcept;
+
+private:
+    friend class Executor;
+
+    /// @brief Kernel work object for ports that need one, kept first so that the work item can be found from it
+    alignas(std::max_align_t) unsigned char m_port_storage[kPortStorageSizeBytes];
+
+    Handler m_handler;
+    void*   m_context;
+
+    /// @brief Link within the Executor's submission stack
+    Work* m_next {nullptr};
+
+    std::atomic<bool> m_is_pending {false};
+};
+
+/**!
+ * @brief Runs submitted work items on a fixed set of worker threads, one per core by default.
+ *
+ * On native builds each worker owns a bounded work-stealing deque. Work submitted from a worker goes to the bottom of
+ * its own deque, where it is taken again last in first out while it is still hot in cache. Idle workers steal the
+ * oldest work from the top of the other workers' deques. Work submitted from any other thread, or from an interrupt,
+ * is pushed on to a single lock-free stack that every worker drains in to its own deque.
+ *
+ * On Zephyr each worker is a kernel work queue, and work items are submitted to them in turn as `k_work` items.
+ *
+ * @note On native builds, work items still pending when the Executor is stopped run once it is started again. On
+ * Zephyr, Stop runs every pending work item first.
+ */
+class Executor
+{
+public:
+    /// @brief Most worker threads an Executor may run
+    constexpr static size_t kMaxWorkerCount {16U};
+
+    /// @brief Capacity of each worker's deque, work submitted past it goes to the shared submission stack instead
+    constexpr static size_t kDequeCapacity {256U};
+
+    static_assert(((kDequeCapacity & (kDequeCapacity - 1U)) == 0U), "`kDequeCapacity` must be a power of two");
+
+    /**!
+     * @brief Initializing constructor, workers are not started until Start is called
+     *
+     * @param[in] worker_count Number of worker threads, limited to kMaxWorkerCount. 0 starts one per hardware thread.
+     */
+    explicit Executor(size_t worker_count = 0U) noexcept;
+
+    // Executor is referenced by its workers and may not be copied or moved
+
+    Executor(Executor const& copy) = delete;
+    Executor(Executor&& move)      = delete;
+
+    Executor& operator=(Executor const& copy) = delete;
+    Executor& operator=(Executor&& move)      = delete;
+
+    /// @brief Stops every worker, see Stop
+    ~Executor() noexcept;
+
+    /// @brief Number of worker threads
+    size_t GetWorkerCount() const noexcept;
+
+    /// @brief True between Start and Stop
+    bool IsRunning() const noexcept;
+
+    /**!
+     * @brief Starts every worker thread
+     *
+     * @retval BinaryResult::kSuccessCode if every worker was started
+     * @retval BinaryResult::kFailureCode if the Executor is already running or a worker could not be started, no
+     * worker is left running
+     */
+    BinaryResult Start() noexcept;
+
+    /**!
+     * @brief Stops every worker thread, waiting for each to finish the work item it is running. Must not be called
+     * from a worker.
+     */
+    void Stop() noexcept;
+
+    /**!
+     * @brief Submits a work item to run on one of the workers. Never blocks, safe to call from any thread, any worker
+     * and interrupt context.
+     *
+     * @param[in] work Work item to run
+     * @retval BinaryResult::kSuccessCode if the work item was submitted
+     * @retval BinaryResult::kFailureCode if the work item is already pending, or on Zephyr if the Executor has
+     * never been started
+     */
+    BinaryResult Submit(Work& work) noexcept;
+
+private:
+    friend class Work;
+
+    /// @brief Clears a work item's pending flag and calls its handler
+    static void RunWork(Work& work) noexcept;
+
+#ifdef NATIVE_SHMIT
+
+    /**!
+     * @brief Bounded Chase-Lev deque of work items. The owning worker pushes and pops at the bottom, any other worker
+     * steals from the top.
+     */
+    struct WorkDeque
+    {
+        /// @brief Pushes on to the bottom, owner only. Returns false if the deque is full.
+        bool Push(Work* work) noexcept;
+
+        /// @brief Pops from the bottom, owner only. Returns null if the deque is empty.
+        Work* Pop() noexcept;
+
+        /// @brief Steals from the top, any thread. Returns null if the deque is empty or the steal lost a race.
+        Work* Steal() noexcept;
+
+        alignas(64) std::atomic<int64_t> top {0};
+        alignas(64) std::atomic<int64_t> bottom {0};
+        std::atomic<Work*> slots[kDequeCapacity] {};
+    };
+
+    struct Worker
+    {
+        WorkDeque   deque;
+        std::thread thread;
+    };
+
+    /// @brief Finds the next work item for a worker: its own deque, then the submission stack, then the other deques
+    Work* FindWork(size_t worker_index) noexcept;
+
+    /// @brief Runs on each worker thread between Start and Stop
+    void RunWorker(size_t worker_index) noexcept;
+
+    /// @brief Takes every work item off the submission stack in to a worker's deque, returning one of them to run
+    Work* TakeSubmitted(size_t worker_index) noexcept;
+
+    Worker m_workers[kMaxWorkerCount];
+
+    /// @brief Work submitted from outside the workers, in last in first out order
+    std::atomic<Work*> m_submitted {nullptr};
+
+    /// @brief Counts submissions, idle workers wait for it to change
+    std::atomic<uint32_t> m_generation {0U};
+
+    /// @brief Number of workers waiting on m_generation
+    std::atomic<uint32_t> m_sleeper_count {0U};
+
+#else
+
+    /// @brief Kernel work queue running each worker
+    struct k_work_q* m_queues[kMaxWorkerCount] {};
+
+    /// @brief Queue that the next work item is submitted to
+    std::atomic<size_t> m_next_queue {0U};
+
+#endif
+
+    size_t            m_worker_count;
+    std::atomic<bool> m_is_running {false};
+};
+
+} // namespace system
+} // namespace shmit
@@ -1,9 +1,147 @@
 #pragma once
 
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <cstddef>
+#include <limits>
+
+#ifdef NATIVE_SHMIT
+
+#include <pthread.h>
+
+#endif
+
 namespace shmit
 {
 namespace system
 {
 
-}
-} // namespace shmit
\ No newline at end of file
+/**!
+ * @brief Statically allocatable stack for a Thread
+ *
+ * @note Zephyr builds with memory protection need stacks defined through K_THREAD_STACK_DEFINE instead, passed to
+ * Thread as a span
+ *
+ * @tparam SizeBytesV Size of the stack in bytes. Native builds refuse stacks smaller than PTHREAD_STACK_MIN.
+ */
+template<size_t SizeBytesV>
+struct ThreadStack
+{
+    static_assert(SizeBytesV > 0U, "`SizeBytesV` must be nonzero");
+
+    /// @brief Span over the whole stack
+    Span<uint8_t> GetSpan() noexcept
+    {
+        return Span<uint8_t> {storage};
+    }
+
+    alignas(64) uint8_t storage[SizeBytesV];
+};
+
+/**!
+ * @brief Scheduling of a Thread, fixed when it is started
+ */
+struct ThreadOptions
+{
+    /// @brief Core that a thread may run on only, or kAnyCore
+    size_t core {kAnyCore};
+
+    /// @brief Real-time priority from 1 to kMaxPriority, higher preempts lower. kNormalPriority leaves the thread to
+    /// the default time-shared scheduler.
+    int priority {kNormalPriority};
+
+    /// @brief Runs the thread on any core
+    constexpr static size_t kAnyCore {std::numeric_limits<size_t>::max()};
+
+    /// @brief Time-shared, non real-time priority
+    constexpr static int kNormalPriority {0};
+
+    /// @brief Highest real-time priority
+    constexpr static int kMaxPriority {99};
+};
+
+/**!
+ * @brief Thread of execution running on a caller-provided stack, optionally pinned to a single core and scheduled at
+ * a real-time priority.
+ *
+ * On native builds a Thread is a pthread, real-time priorities use SCHED_FIFO and pinning sets the thread's CPU
+ * affinity before it starts. On Zephyr a Thread is a `k_thread`, real-time priorities map on to preemptible kernel
+ * priorities from highest down and pinning uses the thread's CPU mask (CONFIG_SCHED_CPU_MASK).
+ *
+ * @note Real-time priorities may need privileges, such as CAP_SYS_NICE on Linux. Start fails if they are refused.
+ */
+class Thread
+{
+public:
+    /// @brief Thread entry point, called with the context given to Start
+    using Entry = void (*)(void* context);
+
+    /// @brief Space reserved for ports that hold kernel thread objects
+    constexpr static size_t kPortStorageSizeBytes {512U};
+
+    /**!
+     * @brief Initializing constructor, the thread is not started until Start is called
+     *
+     * @param[in] stack Stack the thread runs on, must outlive the thread
+     */
+    explicit Thread(Span<uint8_t> stack) noexcept;
+
+    // Thread is referenced by the running thread and may not be copied or moved
+
+    Thread(Thread const& copy) = delete;
+    Thread(Thread&& move)      = delete;
+
+    Thread& operator=(Thread const& copy) = delete;
+    Thread& operator=(Thread&& move)      = delete;
+
+    /// @brief Waits for the thread to return if it was started, see Join
+    ~Thread() noexcept;
+
+    /// @brief True between a successful Start and Join
+    bool IsJoinable() const noexcept;
+
+    /**!
+     * @brief Waits for the thread to return from its entry point. Must not be called from the thread itself.
+     *
+     * @retval BinaryResult::kSuccessCode if the thread returned
+     * @retval BinaryResult::kFailureCode if the thread was never started or has already been joined
+     */
+    BinaryResult Join() noexcept;
+
+    /**!
+     * @brief Starts the thread
+     *
+     * @param[in] entry Entry point
+     * @param[in] context Passed to the entry point
+     * @param[in] options Core affinity and priority
+     * @retval BinaryResult::kSuccessCode if the thread was started
+     * @retval BinaryResult::kFailureCode if it is already running, the stack is too small, the core does not exist, or
+     * the priority was refused
+     */
+    BinaryResult Start(Entry entry, void* context, ThreadOptions const& options = {}) noexcept;
+
+private:
+    Span<uint8_t> m_stack;
+    Entry         m_entry {nullptr};
+    void*         m_context {nullptr};
+    bool          m_is_joinable {false};
+
+#ifdef NATIVE_SHMIT
+
+    /// @brief Runs the entry point on the new thread
+    static void* Run(void* thread) noexcept;
+
+    pthread_t m_handle {};
+
+#else
+
+    /// @brief Kernel thread object for the port
+    alignas(std::max_align_t) unsigned char m_port_storage[kPortStorageSizeBytes];
+
+#endif
+};
+
+} // namespace system
+} // namespace shmit
@@ -0,0 +1,448 @@
+#pragma once
+
+#include "Timer.hpp"
+
+#include "Core/Help/InplaceFunction.hpp"
+#include "Core/StdTypes.hpp"
+
+#include <chrono>
+
+namespace shmit
+{
+namespace time
+{
+
+class WheelTimer;
+
+/**!
+ * @brief Interface that a WheelTimer uses to reach the wheel it is registered with, independent of the wheel's clock
+ * and geometry
+ *
+ */
+class TimerWheelBase
+{
+public:
+    /// @brief Current tick of the wheel, as of its last Tick
+    virtual uint64_t GetCurrentTick() const noexcept = 0;
+
+    /**!
+     * @brief Converts a duration to a whole number of the wheel's ticks, rounding up
+     *
+     * @param[in] duration Duration to convert
+     * @return Number of ticks
+     */
+    virtual uint64_t ToTicks(std::chrono::nanoseconds duration) const noexcept = 0;
+
+    /**!
+     * @brief Registers a timer to fire at its deadline, moving it if it is already registered
+     *
+     * @param[in] timer Timer to register
+     */
+    virtual void Schedule(WheelTimer& timer) noexcept = 0;
+
+    /**!
+     * @brief Unregisters a timer, if it is registered
+     *
+     * @param[in] timer Timer to unregister
+     */
+    virtual void Cancel(WheelTimer& timer) noexcept = 0;
+
+protected:
+    ~TimerWheelBase() = default;
+};
+
+/**!
+ * @brief Timer that is driven by a TimerWheel instead of polling a clock. It is marked expired, and its callback is
+ * invoked, by the Tick in which its deadline passes, so checking IsExpired never reads the clock.
+ *
+ * @note Like the wheel, a WheelTimer is not thread safe and must only be used from the thread that ticks its wheel
+ */
+class WheelTimer final : public Timer
+{
+public:
+    /// @brief Called from TimerWheel::Tick when the timer expires
+    using Callback = help::InplaceFunction<void(WheelTimer&), (4U * sizeof(void*))>;
+
+    WheelTimer() = delete;
+
+    /**!
+     * @brief Constructs a WheelTimer and starts it
+     *
+     * @tparam Rep Duration representation
+     * @tparam Period Duration period
+     * @param[in] wheel Wheel that drives the timer
+     * @param[in] duration Timer duration
+     * @param[in] callback Optional callback invoked on expiration
+     */
+    template<typename Rep, typename Period>
+    WheelTimer(TimerWheelBase& wheel, std::chrono::duration<Rep, Period> const& duration,
+               Callback callback = Callback {}) noexcept;
+
+    /// @brief Unregisters the timer from its wheel
+    ~WheelTimer() noexcept;
+
+    // WheelTimer is linked in to its wheel and may not be copied or moved
+
+    WheelTimer(WheelTimer const& copy) = delete;
+    WheelTimer(WheelTimer&& move)      = delete;
+
+    WheelTimer& operator=(WheelTimer const& copy) = delete;
+    WheelTimer& operator=(WheelTimer&& move)      = delete;
+
+    /**!
+     * @brief Stops the timer without expiring it
+     *
+     */
+    void Cancel() noexcept;
+
+    /**!
+     * @brief Tick at which the timer expires
+     *
+     * @return Deadline in ticks of the connected wheel
+     */
+    uint64_t GetDeadline() const noexcept;
+
+    /**!
+     * @copydoc Timer::IsExpired()
+     *
+     */
+    bool IsExpired() const noexcept override;
+
+    /**!
+     * @brief Checks for an expiration overrun past the timer's duration a second time
+     *
+     * @retval true if timer should have expired twice
+     * @retval false otherwise
+     */
+    bool IsOverExpired() const noexcept override;
+
+    /**!
+     * @brief Restarts the timer. As with BasicTimer, a timer that expired on schedule restarts from its previous
+     * deadline so that periodic use does not drift.
+     *
+     */
+    void Reset() noexcept override;
+
+    /**!
+     * @brief Modifies the timer duration then resets
+     *
+     * @tparam Rep Duration representation
+     * @tparam Period Duration period
+     * @param[in] duration Expiration duration
+     */
+    template<typename Rep, typename Period>
+    void Set(std::chrono::duration<Rep, Period> const& duration) noexcept;
+
+private:
+    template<size_t, size_t, typename, typename>
+    friend class TimerWheel;
+
+    TimerWheelBase& m_wheel;
+    Callback        m_callback;
+    uint64_t        m_duration_ticks {0U};
+    uint64_t        m_deadline {0U};
+    bool            m_is_expired {false};
+
+    /// @brief Links within the wheel slot that the timer is registered in, all null if unregistered
+    WheelTimer*  m_prev {nullptr};
+    WheelTimer*  m_next {nullptr};
+    WheelTimer** m_slot {nullptr};
+};
+
+/**!
+ * @brief Hierarchical timer wheel. Registered timers are hashed in to slots by deadline, so each Tick reads the clock
+ * once and only visits slots whose time has come, firing each expired timer in constant time no matter how many are
+ * registered.
+ *
+ * Level 0 holds timers due within one revolution of kSlotCount ticks, and each level above covers kSlotCount times the
+ * span of the one below. Timers cascade down a level each time the level below completes a revolution. Deadlines past
+ * the span of the top level wait in its furthest slot and are re-hashed until they come in to range.
+ *
+ * @note Not thread safe. Ticking, scheduling and cancelling must all happen on one thread.
+ *
+ * @tparam SlotBitsV Number of slots per level, as a power of two
+ * @tparam LevelCountV Number of levels
+ * @tparam Clock Time source. Must meet the Core named requirements for Clock.
+ * @tparam ResolutionT Duration of one tick
+ */
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT = std::chrono::milliseconds>
+class TimerWheel final : public TimerWheelBase
+{
+    static_assert((SlotBitsV > 0U) && ((SlotBitsV * LevelCountV) < 64U), "Wheel span must fit within 64-bit ticks");
+    static_assert(LevelCountV > 0U, "`LevelCountV` must be nonzero");
+
+public:
+    using TimePoint = std::chrono::time_point<Clock>;
+
+    /// @brief Number of slots per level
+    constexpr static size_t kSlotCount {size_t {1U} << SlotBitsV};
+
+    /// @brief Number of ticks that the top level spans
+    constexpr static uint64_t kSpanTicks {uint64_t {1U} << (SlotBitsV * LevelCountV)};
+
+    /// @brief Constructs an empty wheel whose tick 0 is now
+    TimerWheel() noexcept;
+
+    ~TimerWheel() noexcept = default;
+
+    // TimerWheel is linked to its timers and may not be copied or moved
+
+    TimerWheel(TimerWheel const& copy) = delete;
+    TimerWheel(TimerWheel&& move)      = delete;
+
+    TimerWheel& operator=(TimerWheel const& copy) = delete;
+    TimerWheel& operator=(TimerWheel&& move)      = delete;
+
+    void Cancel(WheelTimer& timer) noexcept override;
+
+    uint64_t GetCurrentTick() const noexcept override;
+
+    void Schedule(WheelTimer& timer) noexcept override;
+
+    /**!
+     * @brief Reads the clock once and advances the wheel to it, firing every timer whose deadline has passed
+     *
+     * @return Number of timers fired
+     */
+    size_t Tick() noexcept;
+
+    /**!
+     * @brief Advances the wheel to a tick, firing every timer whose deadline has passed
+     *
+     * @param[in] tick Tick to advance to, ignored if not ahead of the current tick
+     * @return Number of timers fired
+     */
+    size_t AdvanceTo(uint64_t tick) noexcept;
+
+    uint64_t ToTicks(std::chrono::nanoseconds duration) const noexcept override;
+
+private:
+    constexpr static uint64_t kSlotMask {kSlotCount - 1U};
+
+    /**!
+     * @brief Links a timer in to the slot matching its deadline
+     *
+     * @param[in] timer Timer to link
+     * @param[in] earliest_tick First tick whose slot has not yet been processed
+     */
+    void Insert(WheelTimer& timer, uint64_t earliest_tick) noexcept;
+
+    /// @brief Unlinks a timer from its slot
+    static void Unlink(WheelTimer& timer) noexcept;
+
+    /// @brief Re-hashes every timer in a slot of a higher level in to the levels below
+    void Cascade(size_t level) noexcept;
+
+    TimePoint   m_epoch;
+    uint64_t    m_current_tick {0U};
+    WheelTimer* m_slots[LevelCountV][kSlotCount] {};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  WheelTimer constructor definitions              ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename Rep, typename Period>
+WheelTimer::WheelTimer(TimerWheelBase& wheel, std::chrono::duration<Rep, Period> const& duration,
+                       Callback callback) noexcept :
+    m_wheel {wheel}, m_callback {callback}
+{
+    Set(duration);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  WheelTimer method definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<typename Rep, typename Period>
+void WheelTimer::Set(std::chrono::duration<Rep, Period> const& duration) noexcept
+{
+    m_duration_ticks = m_wheel.ToTicks(std::chrono::duration_cast<std::chrono::nanoseconds>(duration));
+    m_is_expired     = false;
+    Reset();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  TimerWheel constructor definitions              ////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::TimerWheel() noexcept : m_epoch {Clock::now()}
+{
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  TimerWheel method definitions in alphabetical order             ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+size_t TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::AdvanceTo(uint64_t tick) noexcept
+{
+    size_t num_fired {0U};
+    while (m_current_tick < tick)
+    {
+        m_current_tick++;
+
+        // Pull timers down from each level that the lower levels have just completed a revolution of
+        for (size_t level = 1U; level < LevelCountV; level++)
+        {
+            if ((m_current_tick & ((uint64_t {1U} << (SlotBitsV * level)) - 1U)) != 0U)
+                break;
+
+            Cascade(level);
+        }
+
+        // Detach the due slot first, callbacks may reschedule their timers
+        WheelTimer*& slot {m_slots[0U][m_current_tick & kSlotMask]};
+        WheelTimer*  due {slot};
+        slot = nullptr;
+
+        while (due != nullptr)
+        {
+            WheelTimer& timer {*due};
+            due = timer.m_next;
+
+            timer.m_prev = nullptr;
+            timer.m_next = nullptr;
+            timer.m_slot = nullptr;
+
+            // Deadlines beyond the wheel's span land here early, send them around again
+            if (timer.m_deadline > m_current_tick)
+            {
+                Insert(timer, (m_current_tick + 1U));
+                continue;
+            }
+
+            timer.m_is_expired = true;
+            num_fired++;
+            if (timer.m_callback)
+                timer.m_callback(timer);
+        }
+    }
+
+    return num_fired;
+}
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+void TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::Cancel(WheelTimer& timer) noexcept
+{
+    Unlink(timer);
+}
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+uint64_t TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::GetCurrentTick() const noexcept
+{
+    return m_current_tick;
+}
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+void TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::Schedule(WheelTimer& timer) noexcept
+{
+    // Schedule may be called from a callback fired by the current tick, whose slot has already been processed
+    Unlink(timer);
+    Insert(timer, (m_current_tick + 1U));
+}
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+size_t TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::Tick() noexcept
+{
+    auto const elapsed {std::chrono::duration_cast<ResolutionT>(Clock::now() - m_epoch)};
+    if (elapsed.count() <= 0)
+        return 0U;
+
+    return AdvanceTo(static_cast<uint64_t>(elapsed.count()));
+}
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+uint64_t
+    TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::ToTicks(std::chrono::nanoseconds duration) const noexcept
+{
+    if (duration.count() <= 0)
+        return 0U;
+
+    auto ticks {std::chrono::duration_cast<ResolutionT>(duration)};
+    if (ticks < duration)
+        ticks += ResolutionT {1};
+
+    return static_cast<uint64_t>(ticks.count());
+}
+
+//  Private     ========================================================================================================
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+void TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::Cascade(size_t level) noexcept
+{
+    WheelTimer*& slot {m_slots[level][(m_current_tick >> (SlotBitsV * level)) & kSlotMask]};
+    WheelTimer*  cascading {slot};
+    slot = nullptr;
+
+    while (cascading != nullptr)
+    {
+        WheelTimer& timer {*cascading};
+        cascading = timer.m_next;
+
+        timer.m_prev = nullptr;
+        timer.m_next = nullptr;
+        timer.m_slot = nullptr;
+
+        // The slot for the current tick is processed right after cascading, so timers due now may land in it
+        Insert(timer, m_current_tick);
+    }
+}
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+void TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::Insert(WheelTimer& timer, uint64_t earliest_tick) noexcept
+{
+    uint64_t const due_tick {(timer.m_deadline > earliest_tick) ? timer.m_deadline : earliest_tick};
+    uint64_t       delta {due_tick - m_current_tick};
+    uint64_t       slot_tick {due_tick};
+    if (delta >= kSpanTicks)
+    {
+        delta     = (kSpanTicks - 1U);
+        slot_tick = (m_current_tick + delta);
+    }
+
+    // Lowest level whose span covers the delay
+    size_t level {0U};
+    while ((level < (LevelCountV - 1U)) && (delta >= (uint64_t {1U} << (SlotBitsV * (level + 1U)))))
+        level++;
+
+    WheelTimer*& slot {m_slots[level][(slot_tick >> (SlotBitsV * level)) & kSlotMask]};
+    timer.m_prev = nullptr;
+    timer.m_next = slot;
+    timer.m_slot = &slot;
+    if (slot != nullptr)
+        slot->m_prev = &timer;
+
+    slot = &timer;
+}
+
+template<size_t SlotBitsV, size_t LevelCountV, typename Clock, typename ResolutionT>
+void TimerWheel<SlotBitsV, LevelCountV, Clock, ResolutionT>::Unlink(WheelTimer& timer) noexcept // Static method
+{
+    if (timer.m_slot == nullptr)
+        return;
+
+    if (timer.m_prev != nullptr)
+        timer.m_prev->m_next = timer.m_next;
+    else
+        *timer.m_slot = timer.m_next;
+
+    if (timer.m_next != nullptr)
+        timer.m_next->m_prev = timer.m_prev;
+
+    timer.m_prev = nullptr;
+    timer.m_next = nullptr;
+    timer.m_slot = nullptr;
+}
+
+} // namespace time
+} // namespace shmit
@@ -0,0 +1,274 @@
+#pragma once
+
+#include "Core/Data/Decode.hpp"
+#include "Core/Data/Encode.hpp"
+#include "Core/Data/Footprint.hpp"
+#include "Core/Data/Packet.hpp"
+#include "Core/IO/Session/Outbound.hpp"
+#include "Core/Platform/Clock.hpp"
+#include "Core/Result.hpp"
+#include "Core/Span.hpp"
+#include "Core/StdTypes.hpp"
+#include "Core/StringConstant.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstring>
+
+namespace shmit
+{
+namespace trace
+{
+
+/**!
+ * @brief Header leading every trace record: timestamp in ticks of the tracing clock, event ID, payload size in bytes,
+ * and a sequence number that increments with every logged or dropped event so that the host can spot gaps
+ *
+ */
+using TraceRecordHeader = data::packet_t<uint64_t, uint32_t, uint16_t, uint16_t>;
+
+/// @brief Encoded size of a trace record header
+constexpr static size_t kTraceRecordHeaderSizeBytes {TraceRecordHeader::kSizeBytes};
+
+/**!
+ * @brief Event ID of a StringConstant, hashed at compile time
+ *
+ * @tparam StringT StringConstant naming the event, as in `string_constant("egress.put")`
+ */
+template<typename StringT>
+constexpr static uint32_t trace_event_id_v {string_constant_hash_v<StringT>};
+
+/**!
+ * @brief Fixed-size ring of binary trace records, meant to be kept one per core. Logging an event reads the clock,
+ * encodes a header and payload in to the next free record and publishes it with a single release store, with no locks
+ * or read-modify-write. Records are drained to the host over any Outbound session.
+ *
+ * Every record takes kRecordSizeBytes on the wire: the header followed by the payload, zero filled to
+ * kPayloadCapacityBytes.
+ *
+ * @note Logging is single producer, an interrupt that logs must not preempt another Log on the same ring. Draining is
+ * single consumer and may run on any thread.
+ *
+ * @tparam RecordCountV Number of records held by the ring, must be a power of two
+ * @tparam PayloadCapacityBytesV Largest payload that a record may carry, in bytes
+ * @tparam ClockT Clock that timestamps events. Must meet the Core named requirements for Clock.
+ */
+template<size_t RecordCountV, size_t PayloadCapacityBytesV = 16U, typename ClockT = platform::Clock>
+class TraceRing
+{
+    static_assert((RecordCountV > 0U) && ((RecordCountV & (RecordCountV - 1U)) == 0U), "`RecordCountV` must be a "
+                                                                                       "nonzero power of two");
+
+public:
+    /// @brief Largest payload that a record may carry, in bytes
+    constexpr static size_t kPayloadCapacityBytes {PayloadCapacityBytesV};
+
+    /// @brief Size of every record, in bytes
+    constexpr static size_t kRecordSizeBytes {kTraceRecordHeaderSizeBytes + PayloadCapacityBytesV};
+
+    /// @brief Number of records held by the ring
+    constexpr static size_t kRecordCount {RecordCountV};
+
+    TraceRing() noexcept  = default;
+    ~TraceRing() noexcept = default;
+
+    // TraceRing holds synchronization state and may not be copied or moved
+
+    TraceRing(TraceRing const& copy) = delete;
+    TraceRing(TraceRing&& move)      = delete;
+
+    TraceRing& operator=(TraceRing const& copy) = delete;
+    TraceRing& operator=(TraceRing&& move)      = delete;
+
+    /**!
+     * @brief Posts as many whole records as the session has room for to it, oldest first, waiting up to a timeout
+     * for the session to take them. Consumer side.
+     *
+     * @param[in] session Session to drain to
+     * @param[in] timeout Maximum time to wait on the session
+     * @return Number of records drained
+     */
+    size_t Drain(io::session::Outbound& session, std::chrono::microseconds timeout) noexcept;
+
+    /// @brief Number of events dropped because the ring was full
+    size_t GetDroppedCount() const noexcept;
+
+    /// @brief Number of records waiting to be drained
+    size_t GetPendingCount() const noexcept;
+
+    /**!
+     * @brief Logs an event with a payload. Producer side.
+     *
+     * @tparam PayloadT Payload type, usually a data::Packet, must encode within kPayloadCapacityBytes
+     * @param[in] event_id Event ID, see trace_event_id_v
+     * @param[in] payload Payload to encode in to the record
+     * @retval true if the event was logged
+     * @retval false if the ring was full and the event was dropped
+     */
+    template<typename PayloadT>
+    bool Log(uint32_t event_id, PayloadT const& payload) noexcept;
+
+    /**!
+     * @brief Logs an event without a payload. Producer side.
+     *
+     * @param[in] event_id Event ID, see trace_event_id_v
+     * @retval true if the event was logged
+     * @retval false if the ring was full and the event was dropped
+     */
+    bool Log(uint32_t event_id) noexcept;
+
+    /**!
+     * @brief Logs an event named by a StringConstant, with an optional payload. Producer side.
+     *
+     * @tparam EventT StringConstant naming the event
+     * @tparam PayloadT Payload types, at most one
+     * @param[in] payload Payload to encode in to the record
+     * @retval true if the event was logged
+     * @retval false if the ring was full and the event was dropped
+     */
+    template<typename EventT, typename... PayloadT>
+    bool Log(PayloadT const&... payload) noexcept;
+
+private:
+    constexpr static size_t kIndexMask {RecordCountV - 1U};
+
+    /// @brief Claims the next free record, or counts a drop if there is none
+    uint8_t* Claim() noexcept;
+
+    /// @brief Encodes a record header and publishes the record
+    void Publish(uint8_t* record, uint32_t event_id, size_t payload_size_bytes) noexcept;
+
+    uint8_t m_records[RecordCountV][kRecordSizeBytes] {};
+
+    /// @brief Producer-owned counters, kept on their own cache line
+    alignas(64) std::atomic<size_t> m_head {0U};
+    std::atomic<size_t> m_num_dropped {0U};
+    uint16_t            m_sequence {0U};
+
+    /// @brief Consumer-owned index
+    alignas(64) std::atomic<size_t> m_tail {0U};
+};
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  TraceRing method definitions in alphabetical order              ////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+size_t TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::Drain(io::session::Outbound&   session,
+                                                                     std::chrono::microseconds timeout) noexcept
+{
+    size_t const tail {m_tail.load(std::memory_order_relaxed)};
+    size_t const head {m_head.load(std::memory_order_acquire)};
+
+    size_t const count {std::min((head - tail), (session.OutputBytesAvailable() / kRecordSizeBytes))};
+    if (count == 0U)
+        return 0U;
+
+    // Pending records are contiguous except where they wrap around the end of the ring
+    size_t const first_index {tail & kIndexMask};
+    size_t const first_count {std::min(count, (RecordCountV - first_index))};
+
+    std::array<Span<uint8_t const>, 2U> const parts {
+        Span<uint8_t const> {m_records[first_index], (first_count * kRecordSizeBytes)},
+        Span<uint8_t const> {m_records[0U], ((count - first_count) * kRecordSizeBytes)}};
+
+    size_t const                          num_parts {(first_count < count) ? 2U : 1U};
+    Span<Span<uint8_t const> const> const parts_span {parts.data(), num_parts};
+    if (session.Post(parts_span, timeout).IsFailure())
+        return 0U;
+
+    m_tail.store((tail + count), std::memory_order_release);
+    return count;
+}
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+size_t TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::GetDroppedCount() const noexcept
+{
+    return m_num_dropped.load(std::memory_order_relaxed);
+}
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+size_t TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::GetPendingCount() const noexcept
+{
+    return (m_head.load(std::memory_order_acquire) - m_tail.load(std::memory_order_acquire));
+}
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+template<typename PayloadT>
+bool TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::Log(uint32_t event_id, PayloadT const& payload) noexcept
+{
+    constexpr static size_t kPayloadSizeBytes {data::footprint_size_bytes_v<PayloadT>};
+    static_assert(kPayloadSizeBytes <= PayloadCapacityBytesV, "Payload does not fit within a trace record");
+
+    uint8_t* record {Claim()};
+    if (record == nullptr)
+        return false;
+
+    size_t        bits_encoded {0U};
+    Span<uint8_t> payload_span {(record + kTraceRecordHeaderSizeBytes), PayloadCapacityBytesV};
+    static_cast<void>(data::encode(payload, payload_span, bits_encoded)); // Cannot fail, size is checked above
+
+    Publish(record, event_id, kPayloadSizeBytes);
+    return true;
+}
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+bool TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::Log(uint32_t event_id) noexcept
+{
+    uint8_t* record {Claim()};
+    if (record == nullptr)
+        return false;
+
+    Publish(record, event_id, 0U);
+    return true;
+}
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+template<typename EventT, typename... PayloadT>
+bool TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::Log(PayloadT const&... payload) noexcept
+{
+    static_assert(sizeof...(PayloadT) <= 1U, "Trace events carry at most one payload, wrap multiple in a Packet");
+    return Log(trace_event_id_v<EventT>, payload...);
+}
+
+//  Private     ========================================================================================================
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+uint8_t* TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::Claim() noexcept
+{
+    size_t const head {m_head.load(std::memory_order_relaxed)};
+    if ((head - m_tail.load(std::memory_order_acquire)) >= RecordCountV)
+    {
+        m_num_dropped.store((m_num_dropped.load(std::memory_order_relaxed) + 1U), std::memory_order_relaxed);
+        m_sequence++;
+        return nullptr;
+    }
+
+    return m_records[head & kIndexMask];
+}
+
+template<size_t RecordCountV, size_t PayloadCapacityBytesV, typename ClockT>
+void TraceRing<RecordCountV, PayloadCapacityBytesV, ClockT>::Publish(uint8_t* record, uint32_t event_id,
+                                                                     size_t payload_size_bytes) noexcept
+{
+    uint64_t const ticks {static_cast<uint64_t>(ClockT::now().time_since_epoch().count())};
+    TraceRecordHeader const header {ticks, event_id, static_cast<uint16_t>(payload_size_bytes), m_sequence};
+    m_sequence++;
+
+    // Stale bytes past a short payload would otherwise leak from whichever record last used the slot
+    if (payload_size_bytes < PayloadCapacityBytesV)
+        static_cast<void>(std::memset((record + kTraceRecordHeaderSizeBytes + payload_size_bytes), 0U,
+                                      (PayloadCapacityBytesV - payload_size_bytes)));
+
+    size_t        bits_encoded {0U};
+    Span<uint8_t> header_span {record, kTraceRecordHeaderSizeBytes};
+    static_cast<void>(data::encode(header, header_span, bits_encoded));
+
+    m_head.store((m_head.load(std::memory_order_relaxed) + 1U), std::memory_order_release);
+}
+
+} // namespace trace
+} // namespace shmit
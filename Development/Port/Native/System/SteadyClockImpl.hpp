@@ -1,13 +1,13 @@
 #pragma once
 
-#include <chrono>
+#include <Core/Platform/Clock.hpp>
 
 namespace shmit
 {
 namespace port
 {
 
-using SteadyClockImpl = std::chrono::steady_clock;
+using SteadyClockImpl = platform::Clock;
 
 } // namespace port
-} // namespace shmit
\ No newline at end of file
+} // namespace shmit
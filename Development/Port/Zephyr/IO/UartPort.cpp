@@ -0,0 +1,167 @@
+#include <Core/IO/Serial/UartPort.hpp>
+#include <Core/Platform/Clock.hpp>
+#include <Core/Platform/Wait.hpp>
+
+#include <zephyr/drivers/uart.h>
+#include <zephyr/kernel.h>
+
+namespace shmit
+{
+namespace io
+{
+namespace serial
+{
+
+static struct device const* as_device(void const* device) noexcept
+{
+    return static_cast<struct device const*>(device);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  UartPort constructor definitions            ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+UartPort::UartPort(void const* device) noexcept : m_device {device}
+{
+}
+
+UartPort::~UartPort() noexcept
+{
+    static_cast<void>(uart_rx_disable(as_device(m_device)));
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  UartPort method definitions in alphabetical order           ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+void UartPort::OnEvent(void const* device, void* event, void* port) noexcept // Static method
+{
+    UartPort&                self {*static_cast<UartPort*>(port)};
+    struct uart_event const& event_data {*static_cast<struct uart_event const*>(event)};
+
+    switch (event_data.type)
+    {
+    case UART_RX_RDY:
+        // Bytes that don't fit the ring are dropped, the reader is too far behind
+        static_cast<void>(self.m_rx_ring.Post(
+            Span<uint8_t const> {(event_data.data.rx.buf + event_data.data.rx.offset), event_data.data.rx.len},
+            std::chrono::microseconds::zero()));
+        break;
+
+    case UART_RX_BUF_REQUEST:
+        static_cast<void>(uart_rx_buf_rsp(as_device(device), self.m_rx_chunks[self.m_next_rx_chunk],
+                                          UartPort::kRxChunkSizeBytes));
+        self.m_next_rx_chunk ^= 1U;
+        break;
+
+    case UART_RX_DISABLED:
+        // Reception stops on line errors, start it again
+        static_cast<void>(uart_rx_enable(as_device(device), self.m_rx_chunks[self.m_next_rx_chunk],
+                                         UartPort::kRxChunkSizeBytes, UartPort::kRxIdleTimeout.count()));
+        self.m_next_rx_chunk ^= 1U;
+        break;
+
+    case UART_TX_DONE:
+    case UART_TX_ABORTED:
+    {
+        // Transmissions started by WriteAsync are told apart by their bytes, a synchronous Write may have owned the
+        // driver when WriteAsync claimed the Transference slot
+        session::Transference* const transference {self.m_tx_transference.load(std::memory_order_acquire)};
+        if ((transference != nullptr) && (event_data.data.tx.buf == transference->GetData().data()))
+        {
+            self.m_tx_transference.store(nullptr, std::memory_order_release);
+            transference->SetResult((event_data.data.tx.len == transference->GetData().size())
+                                        ? session::Transference::Result::Success()
+                                        : session::Transference::Result::Failure());
+            break;
+        }
+
+        self.m_num_tx_sent.store(event_data.data.tx.len, std::memory_order_relaxed);
+        self.m_tx_generation.fetch_add(1U, std::memory_order_release);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+BinaryResult UartPort::Open() noexcept
+{
+    auto const callback {[](struct device const* device, struct uart_event* event, void* port)
+                         { UartPort::OnEvent(device, event, port); }};
+    if (uart_callback_set(as_device(m_device), callback, this) != 0)
+        return BinaryResult::Failure();
+
+    m_next_rx_chunk = 1U;
+    if (uart_rx_enable(as_device(m_device), m_rx_chunks[0U], kRxChunkSizeBytes, kRxIdleTimeout.count()) != 0)
+        return BinaryResult::Failure();
+
+    return BinaryResult::Success();
+}
+
+size_t UartPort::Read(Span<uint8_t> rx, std::chrono::microseconds timeout) noexcept
+{
+    platform::Clock::time_point const deadline {platform::Clock::now() + timeout};
+    while ((m_rx_ring.InputBytesAvailable() == 0U) && (platform::Clock::now() < deadline))
+        platform::yield();
+
+    size_t const num_ready {std::min(m_rx_ring.InputBytesAvailable(), rx.size())};
+    if ((num_ready == 0U)
+        || m_rx_ring.Request(rx.subspan(0U, num_ready), std::chrono::microseconds::zero()).IsFailure())
+        return 0U;
+
+    return num_ready;
+}
+
+size_t UartPort::ReadBytesAvailable() const noexcept
+{
+    return m_rx_ring.InputBytesAvailable();
+}
+
+size_t UartPort::Write(Span<uint8_t const> tx, std::chrono::microseconds timeout) noexcept
+{
+    uint32_t const generation {m_tx_generation.load(std::memory_order_acquire)};
+    if (uart_tx(as_device(m_device), tx.data(), tx.size(), SYS_FOREVER_US) != 0)
+        return 0U;
+
+    // The span is lent to the driver until it reports back, abort rather than return early. Completion is signalled
+    // from the driver's interrupt, where waking a waiter isn't allowed, so poll for it.
+    platform::Clock::time_point const deadline {platform::Clock::now() + timeout};
+    while ((m_tx_generation.load(std::memory_order_acquire) == generation) && (platform::Clock::now() < deadline))
+        platform::yield();
+
+    if (m_tx_generation.load(std::memory_order_acquire) == generation)
+    {
+        static_cast<void>(uart_tx_abort(as_device(m_device)));
+        while (m_tx_generation.load(std::memory_order_acquire) == generation)
+            platform::yield();
+    }
+
+    return m_num_tx_sent.load(std::memory_order_relaxed);
+}
+
+bool UartPort::WriteAsync(session::Transference& transference) noexcept
+{
+    // Claim the slot before starting, the driver may report back before uart_tx returns
+    session::Transference* idle {nullptr};
+    if (!m_tx_transference.compare_exchange_strong(idle, &transference, std::memory_order_acq_rel))
+        return false;
+
+    Span<uint8_t const> const tx {transference.GetData()};
+    if (uart_tx(as_device(m_device), tx.data(), tx.size(), SYS_FOREVER_US) != 0)
+    {
+        m_tx_transference.store(nullptr, std::memory_order_release);
+        return false;
+    }
+
+    return true;
+}
+
+} // namespace serial
+} // namespace io
+} // namespace shmit
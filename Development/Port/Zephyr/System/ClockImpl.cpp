@@ -0,0 +1,42 @@
+#include <Core/Platform/Clock.hpp>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+
+namespace shmit
+{
+namespace platform
+{
+
+Clock::duration get_platform_clock_duration_since_epoch() noexcept
+{
+#ifdef CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER
+    uint64_t const microseconds {k_cyc_to_us_floor64(k_cycle_get_64())};
+#else
+    // The 32-bit counter wraps within seconds on fast cores, extend it through the kernel's 64-bit tick count
+    uint64_t const microseconds {k_ticks_to_us_floor64(k_uptime_ticks())};
+#endif
+
+    return Clock::duration {static_cast<Clock::rep>(microseconds)};
+}
+
+/// @brief Periodic kernel timer that refreshes CoarseClock once per system tick
+static struct k_timer coarse_clock_timer;
+
+/**!
+ * @brief Starts refreshing CoarseClock from the system tick, before any application code reads it
+ *
+ * @return 0, the timer can't fail to start
+ */
+static int start_coarse_clock() noexcept
+{
+    k_timer_init(&coarse_clock_timer, [](struct k_timer*) { static_cast<void>(CoarseClock::Update()); }, nullptr);
+    k_timer_start(&coarse_clock_timer, K_TICKS(1), K_TICKS(1));
+    static_cast<void>(CoarseClock::Update());
+    return 0;
+}
+
+SYS_INIT(start_coarse_clock, APPLICATION, 0);
+
+} // namespace platform
+} // namespace shmit
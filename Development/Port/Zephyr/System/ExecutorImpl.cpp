@@ -0,0 +1,164 @@
+#include <Core/System/Executor.hpp>
+
+#include <zephyr/kernel.h>
+
+#include <algorithm>
+
+namespace shmit
+{
+namespace system
+{
+
+/// @brief Stack size of each worker's work queue thread
+constexpr static size_t kWorkQueueStackSizeBytes {2048U};
+
+/// @brief Preemptible priority that every worker's work queue thread runs at
+constexpr static int kWorkQueuePriority {K_LOWEST_APPLICATION_THREAD_PRIO};
+
+static_assert(sizeof(struct k_work) <= Work::kPortStorageSizeBytes, "`struct k_work` must fit within a Work");
+
+/// @brief Work queues shared out between every Executor, each is claimed by the first Start that needs it
+K_THREAD_STACK_ARRAY_DEFINE(work_queue_stacks, Executor::kMaxWorkerCount, kWorkQueueStackSizeBytes);
+static struct k_work_q     work_queues[Executor::kMaxWorkerCount];
+static std::atomic<size_t> num_claimed_work_queues {0U};
+
+static struct k_work* as_k_work(Work& work) noexcept
+{
+    // The kernel work object is the first member of Work, see Work::m_port_storage
+    return reinterpret_cast<struct k_work*>(&work);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Work constructor definitions                ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+Work::Work(Handler handler, void* context) noexcept : m_port_storage {}, m_handler {handler}, m_context {context}
+{
+    k_work_init(as_k_work(*this), [](struct k_work* item) { Executor::RunWork(*reinterpret_cast<Work*>(item)); });
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Work method definitions in alphabetical order               ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+bool Work::IsPending() const noexcept
+{
+    return m_is_pending.load(std::memory_order_acquire);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Executor constructor definitions            ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+Executor::Executor(size_t worker_count) noexcept : m_worker_count {worker_count}
+{
+    if (m_worker_count == 0U)
+        m_worker_count = arch_num_cpus();
+
+    m_worker_count = std::clamp(m_worker_count, size_t {1U}, kMaxWorkerCount);
+}
+
+Executor::~Executor() noexcept
+{
+    Stop();
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Executor method definitions in alphabetical order           ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+size_t Executor::GetWorkerCount() const noexcept
+{
+    return m_worker_count;
+}
+
+bool Executor::IsRunning() const noexcept
+{
+    return m_is_running.load(std::memory_order_acquire);
+}
+
+BinaryResult Executor::Start() noexcept
+{
+    if (m_is_running.exchange(true, std::memory_order_acq_rel))
+        return BinaryResult::Failure();
+
+    // Queues are claimed and started once, later starts only reopen them
+    if (m_queues[0] != nullptr)
+    {
+        for (size_t i = 0U; i < m_worker_count; i++)
+            static_cast<void>(k_work_queue_unplug(m_queues[i]));
+
+        return BinaryResult::Success();
+    }
+
+    size_t const kFirstQueue {num_claimed_work_queues.fetch_add(m_worker_count, std::memory_order_relaxed)};
+    if ((kFirstQueue + m_worker_count) > kMaxWorkerCount)
+    {
+        num_claimed_work_queues.fetch_sub(m_worker_count, std::memory_order_relaxed);
+        m_is_running.store(false, std::memory_order_release);
+        return BinaryResult::Failure();
+    }
+
+    for (size_t i = 0U; i < m_worker_count; i++)
+    {
+        size_t const kQueue {kFirstQueue + i};
+        m_queues[i] = &work_queues[kQueue];
+
+        k_work_queue_init(m_queues[i]);
+        k_work_queue_start(m_queues[i], work_queue_stacks[kQueue], K_THREAD_STACK_SIZEOF(work_queue_stacks[kQueue]),
+                           kWorkQueuePriority, nullptr);
+    }
+
+    return BinaryResult::Success();
+}
+
+void Executor::Stop() noexcept
+{
+    if (!m_is_running.exchange(false, std::memory_order_acq_rel))
+        return;
+
+    // Plugged queues finish what they hold and refuse anything new until they are unplugged
+    for (size_t i = 0U; i < m_worker_count; i++)
+        static_cast<void>(k_work_queue_drain(m_queues[i], true));
+}
+
+BinaryResult Executor::Submit(Work& work) noexcept
+{
+    if (m_queues[0] == nullptr)
+        return BinaryResult::Failure();
+
+    if (work.m_is_pending.exchange(true, std::memory_order_acq_rel))
+        return BinaryResult::Failure();
+
+    size_t const kQueue {m_next_queue.fetch_add(1U, std::memory_order_relaxed) % m_worker_count};
+    if (k_work_submit_to_queue(m_queues[kQueue], as_k_work(work)) < 0)
+    {
+        work.m_is_pending.store(false, std::memory_order_release);
+        return BinaryResult::Failure();
+    }
+
+    return BinaryResult::Success();
+}
+
+//  Private     ========================================================================================================
+
+void Executor::RunWork(Work& work) noexcept // Static method
+{
+    Work::Handler const kHandler {work.m_handler};
+    void* const         kContext {work.m_context};
+
+    // Cleared first so that the handler may submit its own work item again
+    work.m_is_pending.store(false, std::memory_order_release);
+    kHandler(kContext);
+}
+
+} // namespace system
+} // namespace shmit
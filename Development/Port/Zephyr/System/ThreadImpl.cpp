@@ -0,0 +1,118 @@
+#include <Core/System/Thread.hpp>
+
+#include <zephyr/kernel.h>
+
+namespace shmit
+{
+namespace system
+{
+
+static_assert(sizeof(struct k_thread) <= Thread::kPortStorageSizeBytes, "`struct k_thread` must fit within a Thread");
+
+static struct k_thread* as_k_thread(unsigned char* port_storage) noexcept
+{
+    return reinterpret_cast<struct k_thread*>(port_storage);
+}
+
+/**!
+ * @brief Maps a portable thread priority on to a preemptible kernel priority
+ *
+ * @param[in] priority Real-time priority from 1 to ThreadOptions::kMaxPriority, or ThreadOptions::kNormalPriority
+ * @return Kernel priority, higher real-time priorities map to lower kernel priority numbers
+ */
+static int to_kernel_priority(int priority) noexcept
+{
+    if (priority == ThreadOptions::kNormalPriority)
+        return K_LOWEST_APPLICATION_THREAD_PRIO;
+
+    // Spread 1 to kMaxPriority across the preemptible priorities below the normal one
+    int const kNumPriorities {CONFIG_NUM_PREEMPT_PRIORITIES - 1};
+    int const kOffset {((priority - 1) * kNumPriorities) / ThreadOptions::kMaxPriority};
+    return K_PRIO_PREEMPT((kNumPriorities - 1) - kOffset);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Thread constructor definitions              ////////////////////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+Thread::Thread(Span<uint8_t> stack) noexcept : m_stack {stack}, m_port_storage {}
+{
+}
+
+Thread::~Thread() noexcept
+{
+    static_cast<void>(Join());
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//  Thread method definitions in alphabetical order             ////////////////////////////////////////////////////////
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+//  Public      ========================================================================================================
+
+bool Thread::IsJoinable() const noexcept
+{
+    return m_is_joinable;
+}
+
+BinaryResult Thread::Join() noexcept
+{
+    if (!m_is_joinable)
+        return BinaryResult::Failure();
+
+    if (k_thread_join(as_k_thread(m_port_storage), K_FOREVER) != 0)
+        return BinaryResult::Failure();
+
+    m_is_joinable = false;
+    return BinaryResult::Success();
+}
+
+BinaryResult Thread::Start(Entry entry, void* context, ThreadOptions const& options) noexcept
+{
+    if (m_is_joinable || (entry == nullptr) || (m_stack.count() < K_THREAD_STACK_RESERVED))
+        return BinaryResult::Failure();
+
+    if ((options.priority < ThreadOptions::kNormalPriority) || (options.priority > ThreadOptions::kMaxPriority))
+        return BinaryResult::Failure();
+
+    if ((options.core != ThreadOptions::kAnyCore) && (options.core >= arch_num_cpus()))
+        return BinaryResult::Failure();
+
+#ifndef CONFIG_SCHED_CPU_MASK
+    if (options.core != ThreadOptions::kAnyCore)
+        return BinaryResult::Failure();
+#endif
+
+    m_entry   = entry;
+    m_context = context;
+
+    // Created without starting, so that the CPU mask may be set while the thread is not yet runnable
+    struct k_thread* const kThread {as_k_thread(m_port_storage)};
+    static_cast<void>(k_thread_create(
+        kThread, reinterpret_cast<k_thread_stack_t*>(m_stack.data()), m_stack.count(),
+        [](void* thread, void* unused_1, void* unused_2) {
+            static_cast<void>(unused_1); // Avoid unused warning
+            static_cast<void>(unused_2); // Avoid unused warning
+
+            Thread const& self {*static_cast<Thread const*>(thread)};
+            self.m_entry(self.m_context);
+        },
+        this, nullptr, nullptr, to_kernel_priority(options.priority), 0U, K_FOREVER));
+
+#ifdef CONFIG_SCHED_CPU_MASK
+    if ((options.core != ThreadOptions::kAnyCore) && (k_thread_cpu_pin(kThread, static_cast<int>(options.core)) != 0))
+    {
+        k_thread_abort(kThread);
+        return BinaryResult::Failure();
+    }
+#endif
+
+    k_thread_start(kThread);
+    m_is_joinable = true;
+    return BinaryResult::Success();
+}
+
+} // namespace system
+} // namespace shmit
@@ -0,0 +1,71 @@
+#include <Core/Platform/Wait.hpp>
+
+#include <zephyr/kernel.h>
+
+#include <chrono>
+
+namespace shmit
+{
+namespace platform
+{
+
+/// @brief Threads waiting on any word that hashes to the same bucket share one kernel mutex and condition variable
+struct WaitBucket
+{
+    struct k_mutex   mutex;
+    struct k_condvar condition;
+};
+
+constexpr static size_t kNumWaitBuckets {8U};
+
+/// @brief Every wait bucket, kernel objects are initialized by static construction before any thread runs
+struct WaitBuckets
+{
+    WaitBuckets() noexcept
+    {
+        for (WaitBucket& bucket : buckets)
+        {
+            static_cast<void>(k_mutex_init(&bucket.mutex));
+            static_cast<void>(k_condvar_init(&bucket.condition));
+        }
+    }
+
+    WaitBucket buckets[kNumWaitBuckets];
+};
+
+static WaitBuckets wait_buckets;
+
+static WaitBucket& get_wait_bucket(std::atomic<uint32_t> const& word) noexcept
+{
+    // Words are at least 4-byte aligned, drop the bits that never vary
+    uintptr_t const address {reinterpret_cast<uintptr_t>(&word)};
+    return wait_buckets.buckets[(address >> 2U) % kNumWaitBuckets];
+}
+
+void wait_on(std::atomic<uint32_t> const& word, uint32_t expected, std::chrono::microseconds timeout) noexcept
+{
+    WaitBucket& bucket {get_wait_bucket(word)};
+    static_cast<void>(k_mutex_lock(&bucket.mutex, K_FOREVER));
+
+    // Checked under the bucket's lock so that a notification between here and blocking is never lost
+    if (word.load(std::memory_order_acquire) == expected)
+        static_cast<void>(k_condvar_wait(&bucket.condition, &bucket.mutex, K_USEC(timeout.count())));
+
+    static_cast<void>(k_mutex_unlock(&bucket.mutex));
+}
+
+void notify_all(std::atomic<uint32_t> const& word) noexcept
+{
+    WaitBucket& bucket {get_wait_bucket(word)};
+    static_cast<void>(k_mutex_lock(&bucket.mutex, K_FOREVER));
+    static_cast<void>(k_condvar_broadcast(&bucket.condition));
+    static_cast<void>(k_mutex_unlock(&bucket.mutex));
+}
+
+void yield() noexcept
+{
+    k_yield();
+}
+
+} // namespace platform
+} // namespace shmit